@@ -0,0 +1,322 @@
+#ifndef BACKLIGHT_H
+#define BACKLIGHT_H
+
+#include <Preferences.h>
+#include "driver/ledc.h"
+
+#define BL_MODE LEDC_LOW_SPEED_MODE
+#define BL_TIMER LEDC_TIMER_0
+#define BL_CHANNEL LEDC_CHANNEL_0
+#define BL_FREQ 5000               // Hz, well above anything visible
+#define BL_FULL 255                // 8 bit duty
+#define BL_DIM 24
+#define BL_MIN 10                  // Dimmest the ambient level goes, percent
+#define BL_CURVE_POINTS 6
+#define BL_UPDATE_MS 2000          // How often the curve or sensor is looked at
+#define BL_FADE_MS 1500            // Fade for a change in ambient level
+#define BL_STEP 4                  // Smaller changes than this are ignored, keeps sensor noise from fading all the time
+
+/**
+ * @brief A point on the day/night curve, brightness in between is interpolated
+ *
+ */
+struct CurvePoint {
+  uint16_t minute;                 // Minutes after midnight
+  uint8_t percent;
+};
+
+/**
+ * @brief A new cap from limit(), on its way to the backlight task
+ *
+ */
+struct BacklightLimit {
+  uint8_t val;
+  uint16_t ms;
+};
+
+/**
+ * @brief Drives the backlight pin with the LEDC peripheral. Brightness follows a day/night
+ * curve, or an analog ambient light sensor if one is wired up, and is capped by the idle
+ * state (see Power.h). Every change is a fade run by the LEDC hardware, a task of its own
+ * looks at the curve or sensor so the loop doesn't, and nothing is redrawn.
+ *
+ * Only the backlight task calls into LEDC. Starting a fade waits for one already running on
+ * the channel, so a cap from the loop goes through a queue rather than waiting on it.
+ *
+ */
+class Backlight {
+  private:
+    Preferences prefs;
+    SemaphoreHandle_t lock = nullptr;  // Guards the curve, it is set and read from the web server
+    QueueHandle_t limits = nullptr;
+    CurvePoint curve[BL_CURVE_POINTS];
+    uint8_t points = 0;
+    int sensor = -1;
+    uint32_t reading = 0;          // Smoothed sensor reading
+    uint8_t ambient = 0;           // What the curve or sensor wants, fades in from off at boot
+    uint8_t cap = BL_FULL;         // Most the idle state allows
+    uint8_t level = 0;             // Duty being faded to
+    unsigned long updated_at = 0;
+    void apply(uint16_t ms);
+    void update();
+    uint8_t fromCurve(int minute);
+    uint8_t fromSensor();
+
+  public:
+    void begin(int pin, int sensor_pin);
+    void run();
+    void limit(uint8_t val, uint16_t ms);
+    boolean setCurve(const CurvePoint *pts, uint8_t n);
+    uint8_t getCurve(CurvePoint *out);
+    boolean hasSensor();
+    uint8_t getLevel();
+    uint32_t getDuty();
+};
+
+Backlight backlight;
+
+/**
+ * @brief Percent brightness to duty. Squared, so equal steps in percent look about even.
+ *
+ * @param percent
+ * @return uint8_t
+ */
+uint8_t percentDuty(uint8_t percent){
+  percent = min(percent, (uint8_t)100);
+  return percent ? max(1, (percent * percent * BL_FULL) / 10000) : 0;
+}
+
+/**
+ * @brief Keeps the brightness up to date, runs on its own task
+ *
+ * @param arg
+ */
+void backlightTask(void *arg){
+  for(;;){
+    backlight.run();
+  }
+}
+
+/**
+ * @brief Attach the LEDC channel to the backlight pin, load the curve and start the task. The
+ * backlight fades in from the task.
+ *
+ * @param pin
+ * @param sensor_pin analog ambient light sensor on an ADC1 pin, -1 to follow the curve
+ */
+void Backlight::begin(int pin, int sensor_pin){
+  ledc_timer_config_t timer = {};
+  timer.speed_mode = BL_MODE;
+  timer.duty_resolution = LEDC_TIMER_8_BIT;
+  timer.timer_num = BL_TIMER;
+  timer.freq_hz = BL_FREQ;
+  timer.clk_cfg = LEDC_AUTO_CLK;
+  ledc_timer_config(&timer);
+
+  ledc_channel_config_t channel = {};
+  channel.gpio_num = pin;
+  channel.speed_mode = BL_MODE;
+  channel.channel = BL_CHANNEL;
+  channel.timer_sel = BL_TIMER;
+  channel.duty = 0;
+  ledc_channel_config(&channel);
+  ledc_fade_func_install(0);
+
+  // 7am to 9pm at full brightness, fading down to a quarter overnight
+  prefs.begin("backlight", false);
+  size_t len = prefs.getBytes("curve", curve, sizeof(curve));
+  points = len / sizeof(CurvePoint);
+  if(!points){
+    const CurvePoint fallback[4] = {{390, 25}, {420, 100}, {1260, 100}, {1320, 25}};
+    memcpy(curve, fallback, sizeof(fallback));
+    points = 4;
+  }
+  sensor = sensor_pin;
+  if(sensor >= 0){
+    pinMode(sensor, INPUT);
+    reading = analogRead(sensor);
+  }
+
+  lock = xSemaphoreCreateMutex();
+  limits = xQueueCreate(1, sizeof(BacklightLimit));
+  updated_at = millis() - BL_UPDATE_MS;
+  xTaskCreate(backlightTask, "backlight", 2048, nullptr, 1, nullptr);
+}
+
+/**
+ * @brief Fade to whatever is lower of the ambient level and the cap. The fade runs in the
+ * LEDC hardware, but starting it waits for any fade already running. Backlight task only.
+ *
+ * @param ms 0 to change straight away
+ */
+void Backlight::apply(uint16_t ms){
+  uint8_t want = min(ambient, cap);
+  if(want == level){
+    return;
+  }
+  level = want;
+  if(ms == 0){
+    ledc_set_duty_and_update(BL_MODE, BL_CHANNEL, level, 0);
+    return;
+  }
+  ledc_set_fade_with_time(BL_MODE, BL_CHANNEL, level, ms);
+  ledc_fade_start(BL_MODE, BL_CHANNEL, LEDC_FADE_NO_WAIT);
+}
+
+/**
+ * @brief Brightness on the curve at a time of day
+ *
+ * @param minute minutes after midnight
+ * @return uint8_t percent
+ */
+uint8_t Backlight::fromCurve(int minute){
+  if(points == 1){
+    return curve[0].percent;
+  }
+  // The last point at or before now, before the first point of the day is the last of the day before
+  int i = points - 1;
+  for(int k = 0; k < points; k++){
+    if(curve[k].minute <= minute) i = k;
+  }
+  const CurvePoint &a = curve[i];
+  const CurvePoint &b = curve[(i + 1) % points];
+  int span = (b.minute - a.minute + 1440) % 1440;
+  int into = (minute - a.minute + 1440) % 1440;
+  if(span == 0){
+    return a.percent;
+  }
+  return a.percent + ((int)b.percent - a.percent) * into / span;
+}
+
+/**
+ * @brief Brightness from the ambient light sensor, brighter room brighter screen
+ *
+ * @return uint8_t percent
+ */
+uint8_t Backlight::fromSensor(){
+  reading += ((int32_t)analogRead(sensor) - (int32_t)reading) / 4;
+  return BL_MIN + ((100 - BL_MIN) * reading) / 4095;
+}
+
+/**
+ * @brief One pass of the backlight task. Takes a new cap as soon as limit() sends one and
+ * looks at the curve or sensor every BL_UPDATE_MS.
+ *
+ */
+void Backlight::run(){
+  BacklightLimit l;
+  unsigned long wait = BL_UPDATE_MS - min(millis() - updated_at, (unsigned long)BL_UPDATE_MS);
+  if(xQueueReceive(limits, &l, pdMS_TO_TICKS(wait)) == pdTRUE){
+    cap = l.val;
+    apply(l.ms);
+  }
+  if(millis() - updated_at >= BL_UPDATE_MS){
+    updated_at = millis();
+    update();
+  }
+}
+
+/**
+ * @brief Look at the sensor or the curve and fade to the new level if it has moved enough.
+ * Before the clock is set the curve isn't used and the screen stays at full brightness.
+ *
+ */
+void Backlight::update(){
+  uint8_t percent = 100;
+  if(sensor >= 0){
+    percent = fromSensor();
+  } else {
+    time_t now = time(nullptr);
+    struct tm t;
+    localtime_r(&now, &t);
+    if(t.tm_year > (2016 - 1900)){
+      xSemaphoreTake(lock, portMAX_DELAY);
+      percent = fromCurve(t.tm_hour * 60 + t.tm_min);
+      xSemaphoreGive(lock);
+    }
+  }
+  uint8_t duty = percentDuty(percent);
+  if(abs((int)duty - ambient) >= BL_STEP){
+    ambient = duty;
+    apply(BL_FADE_MS);
+  }
+}
+
+/**
+ * @brief Cap the brightness, i.e. dimmed or off while idle. Hands it to the backlight task and
+ * returns straight away, a cap not taken yet is replaced by the newer one.
+ *
+ * @param val BL_FULL for no cap
+ * @param ms fade time, 0 to change straight away
+ */
+void Backlight::limit(uint8_t val, uint16_t ms){
+  BacklightLimit l = {val, ms};
+  xQueueOverwrite(limits, &l);
+}
+
+/**
+ * @brief Replace the day/night curve and save it
+ *
+ * @param pts in order through the day
+ * @param n 1 to BL_CURVE_POINTS
+ * @return boolean false if there are too many or too few points, or they're out of order
+ */
+boolean Backlight::setCurve(const CurvePoint *pts, uint8_t n){
+  if(n == 0 || n > BL_CURVE_POINTS){
+    return false;
+  }
+  for(int i = 0; i < n; i++){
+    if(pts[i].minute >= 1440 || pts[i].percent > 100 || (i > 0 && pts[i].minute <= pts[i - 1].minute)){
+      return false;
+    }
+  }
+  xSemaphoreTake(lock, portMAX_DELAY);
+  memcpy(curve, pts, n * sizeof(CurvePoint));
+  points = n;
+  xSemaphoreGive(lock);
+  prefs.putBytes("curve", curve, n * sizeof(CurvePoint));
+  return true;
+}
+
+/**
+ * @brief Copy out the day/night curve
+ *
+ * @param out room for BL_CURVE_POINTS
+ * @return uint8_t number of points
+ */
+uint8_t Backlight::getCurve(CurvePoint *out){
+  xSemaphoreTake(lock, portMAX_DELAY);
+  uint8_t n = points;
+  memcpy(out, curve, n * sizeof(CurvePoint));
+  xSemaphoreGive(lock);
+  return n;
+}
+
+/**
+ * @brief Whether brightness comes from a light sensor rather than the curve
+ *
+ * @return boolean
+ */
+boolean Backlight::hasSensor(){
+  return sensor >= 0;
+}
+
+/**
+ * @brief Returns the duty being faded to
+ *
+ * @return uint8_t
+ */
+uint8_t Backlight::getLevel(){
+  return level;
+}
+
+/**
+ * @brief Returns the duty the hardware is at right now, part way through a fade
+ *
+ * @return uint32_t
+ */
+uint32_t Backlight::getDuty(){
+  return ledc_get_duty(BL_MODE, BL_CHANNEL);
+}
+
+#endif
@@ -0,0 +1,223 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "Thermostat.h"
+#include "Draw.h"
+#include "Schedule_Json.h"
+#include "Clock.h"
+
+#define BENCH_TIME 200000          // Run each case for at least 200ms
+#define BENCH_MAX_RUNS 5000
+
+// Context handed to every case, the objects under test
+struct BenchTarget {
+  Thermostat *thermostat;
+  Draw *draw;
+  Rooms *rooms;            // A full table of made up rooms
+};
+
+typedef void (*BenchFn)(BenchTarget &t, uint32_t i);
+
+volatile uint32_t bench_allocs = 0;
+volatile uint32_t bench_alloc_bytes = 0;
+
+#ifdef CONFIG_HEAP_USE_HOOKS
+// Counts every allocation on the heap while the hooks are compiled into the core
+extern "C" void esp_heap_trace_alloc_hook(void *ptr, size_t size, uint32_t caps){
+  bench_allocs++;
+  bench_alloc_bytes += size;
+}
+extern "C" void esp_heap_trace_free_hook(void *ptr){}
+#endif
+
+/**
+ * @brief Runs each case over and over with the cycle counter around every call, and reports
+ * time per call and what it did to the heap. A number for each hot function so the effect
+ * of a change can be seen on the real hardware.
+ *
+ * Allocations are only counted when the core is built with heap hooks (CONFIG_HEAP_USE_HOOKS),
+ * they include anything other tasks allocate while a case runs. The heap column is the net
+ * change in free heap per call, anything but 0 is a leak or a cache filling up.
+ *
+ */
+class Bench {
+  private:
+    BenchTarget target;
+    Print *out = nullptr;
+    const char *filter = nullptr;
+    uint32_t mhz = 240;
+
+  public:
+    void begin(Print &print, Thermostat &thermostat, Draw &draw, const char *only);
+    void run(const char *name, BenchFn fn, uint32_t max_runs = BENCH_MAX_RUNS);
+    void all();
+};
+
+/**
+ * @brief Print the header
+ *
+ * @param print
+ * @param thermostat
+ * @param draw
+ * @param only run cases whose name starts with this, empty for all
+ */
+void Bench::begin(Print &print, Thermostat &thermostat, Draw &draw, const char *only){
+  out = &print;
+  target = {&thermostat, &draw, nullptr};
+  filter = only;
+  mhz = getCpuFrequencyMhz();
+  out->printf("%-24s %6s %10s %10s %10s %8s %8s\n", "case", "runs", "mean us", "min us", "max us", "allocs", "heap");
+}
+
+/**
+ * @brief Time one case, one call first to warm the caches then until BENCH_TIME has passed
+ *
+ * @param name
+ * @param fn called with the run number, so a case can step through its inputs
+ * @param max_runs
+ */
+void Bench::run(const char *name, BenchFn fn, uint32_t max_runs){
+  if(filter && strncmp(name, filter, strlen(filter)) != 0){
+    return;
+  }
+  fn(target, 0);
+  uint64_t total = 0;
+  uint32_t fastest = UINT32_MAX;
+  uint32_t slowest = 0;
+  uint32_t runs = 0;
+  uint32_t heap = ESP.getFreeHeap();
+  uint32_t allocs = bench_allocs;
+  while(runs < max_runs && total < (uint64_t)BENCH_TIME * mhz){
+    uint32_t start = ESP.getCycleCount();
+    fn(target, runs + 1);
+    uint32_t cycles = ESP.getCycleCount() - start;
+    total += cycles;
+    fastest = min(fastest, cycles);
+    slowest = max(slowest, cycles);
+    runs++;
+  }
+  int32_t leaked = (int32_t)(heap - ESP.getFreeHeap());
+  char allocs_buf[12];
+#ifdef CONFIG_HEAP_USE_HOOKS
+  snprintf(allocs_buf, sizeof(allocs_buf), "%.1f", (float)(bench_allocs - allocs) / runs);
+#else
+  strcpy(allocs_buf, "-");
+#endif
+  out->printf("%-24s %6lu %10.2f %10.2f %10.2f %8s %8ld\n", name, (unsigned long)runs,
+    (double)total / runs / mhz, (double)fastest / mhz, (double)slowest / mhz, allocs_buf, (long)(leaked / (int32_t)runs));
+  yield();
+}
+
+/**
+ * @brief Fill a room table with MAX_ROOMS rooms and half a day of sparkline each
+ *
+ * @param list
+ */
+void benchRooms(Rooms &list){
+  char name[ROOM_NAME_LEN];
+  for(int i = 0; i < MAX_ROOMS; i++){
+    snprintf(name, sizeof(name), "Room %d", i + 1);
+    int room = list.add(name);
+    for(int k = 0; k < ROOM_SPARK; k++){
+      list.reading(room, deci(19, 0) + ((i * 7 + k * 3) % 40), 35 + (i % 20), 100 - (i * 3), (unsigned long)k * ROOM_SPARK_EVERY);
+    }
+  }
+}
+
+/**
+ * @brief Every case. Anything that switches outputs only decides, the caller locks the relays
+ * and puts back what the control loop had decided afterwards.
+ *
+ */
+void Bench::all(){
+  // Only on the heap while the cases run
+  target.rooms = new Rooms();
+  benchRooms(*target.rooms);
+  run("thermostat.loadSchedule", [](BenchTarget &t, uint32_t i){
+    Preferences prefs;
+    prefs.begin("schedule", true);
+    t.thermostat->loadSchedule(prefs);
+    prefs.end();
+  }, 200);
+  run("thermostat.daySlots", [](BenchTarget &t, uint32_t i){
+    String slots[10];
+    t.thermostat->daySlots(slots);
+  });
+  run("thermostat.getSlotInfo", [](BenchTarget &t, uint32_t i){
+    t.thermostat->getSlotInfo(i % max(1, t.thermostat->getSlotCount()));
+  });
+  // Steps the clock a quarter hour a call, a week every 672 calls
+  run("thermostat.checkSchedule", [](BenchTarget &t, uint32_t i){
+    static time_t base = 0;
+    if(i == 0) base = time(nullptr);
+    replay_clock = {true, millis(), base + (time_t)(i % 672) * 900, millis()};
+    t.thermostat->checkSchedule();
+    replay_clock.active = false;
+  }, 672 * 2);
+  run("thermostat.keepTemperature", [](BenchTarget &t, uint32_t i){
+    t.thermostat->keepTemperature(deci(18, 0) + (i % 60));
+  });
+  run("thermostat.keepHumidity", [](BenchTarget &t, uint32_t i){
+    t.thermostat->keepHumidity(20.0 + (i % 30), deci(21, 0));
+  });
+  run("json.parseWeek", [](BenchTarget &t, uint32_t i){
+    static ScheduleParser parser;
+    char buf[512];
+    const struct Schedule *week = t.thermostat->getWeek();
+    parser.begin();
+    for(int d = 0; d < 7; d++){
+      parser.feed((const uint8_t*)buf, scheduleDayJson(buf, sizeof(buf), week[d], d));
+    }
+    parser.finish();
+  }, 500);
+  run("draw.fillArc", [](BenchTarget &t, uint32_t i){
+    // Never pushed, so the sprite doesn't need a screen
+    TFT_eSprite sprite = TFT_eSprite(nullptr);
+    sprite.createSprite(60, 40);
+    t.draw->fillArc(sprite, 35, 35, 310, 17, 25, 30, 4, TFT_WHITE);
+    sprite.deleteSprite();
+  });
+  run("draw.main", [](BenchTarget &t, uint32_t i){
+    t.draw->main(deci(21, 5), 35.0, deci(22, 0), 40.0, i & 1, 90);
+  }, 50);
+  // One frame of a flick down a full list, a few pixels on from the last
+  run("draw.rooms", [](BenchTarget &t, uint32_t i){
+    t.draw->rooms(*t.rooms, (i * 7) % (roomScrollLimit(MAX_ROOMS) + 1), (unsigned long)ROOM_SPARK * ROOM_SPARK_EVERY, i == 0);
+  }, 200);
+  run("draw.schedule", [](BenchTarget &t, uint32_t i){
+    String slots[10];
+    t.thermostat->daySlots(slots);
+    t.draw->schedule(slots, t.thermostat->getSlotCount(), t.thermostat->getShortDow(), i & 1, 0, 0, false);
+  }, 50);
+  run("draw.settings", [](BenchTarget &t, uint32_t i){
+    t.draw->settings(t.thermostat->getHoldName(), t.thermostat->getHoldTemp(), t.thermostat->getHumdSetpoint(), t.thermostat->getModeName());
+  }, 50);
+  run("draw.navBar", [](BenchTarget &t, uint32_t i){
+    t.draw->navBar(navState(i & 1), i & 2 ? W_MENU_SETTINGS : W_NONE, true);
+  });
+  run("draw.wifi", [](BenchTarget &t, uint32_t i){
+    t.draw->wifi(455, 35, i % 4);
+  });
+  run("draw.time", [](BenchTarget &t, uint32_t i){
+    t.draw->time();
+  });
+  run("draw.notice", [](BenchTarget &t, uint32_t i){
+    t.draw->notice("Benchmark");
+  });
+  run("draw.dhtTemp", [](BenchTarget &t, uint32_t i){
+    t.draw->dhtTemp(deci(18, 0) + (i % 60));
+  });
+  run("draw.dhtHumd", [](BenchTarget &t, uint32_t i){
+    t.draw->dhtHumd(20.0 + (i % 30));
+  });
+  run("draw.goalTemp", [](BenchTarget &t, uint32_t i){
+    t.draw->goalTemp(i & 1, deci(21, 0) + (i % 20), i % 120);
+  });
+  run("draw.goalHumd", [](BenchTarget &t, uint32_t i){
+    t.draw->goalHumd(30.0 + (i % 20));
+  });
+  delete target.rooms;
+  target.rooms = nullptr;
+}
+
+#endif
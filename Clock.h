@@ -0,0 +1,56 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <time.h>
+
+/**
+ * @brief The time seen by everything that makes a control or display decision. Normally
+ * millis() and the system clock, while a trace is replayed it is the time recorded in the
+ * trace, so a replay doesn't wait for real time and comes out the same every run.
+ *
+ */
+struct ReplayClock {
+  boolean active;
+  unsigned long ms;
+  time_t epoch;             // Wall clock at ms
+  unsigned long epoch_ms;
+};
+ReplayClock replay_clock = {false, 0, 0, 0};
+
+/**
+ * @brief millis(), or the replayed time
+ *
+ * @return unsigned long
+ */
+unsigned long clockMillis(){
+  return replay_clock.active ? replay_clock.ms : millis();
+}
+
+/**
+ * @brief time(nullptr), or the replayed wall clock
+ *
+ * @return time_t
+ */
+time_t clockTime(){
+  if(!replay_clock.active){
+    return time(nullptr);
+  }
+  return replay_clock.epoch + (long)(replay_clock.ms - replay_clock.epoch_ms) / 1000;
+}
+
+/**
+ * @brief getLocalTime(), or the replayed wall clock in local time. Doesn't wait for NTP.
+ *
+ * @param info
+ * @return boolean false if the clock hasn't been set
+ */
+boolean clockLocal(struct tm *info){
+  if(!replay_clock.active){
+    return getLocalTime(info, 0);
+  }
+  time_t now = clockTime();
+  localtime_r(&now, info);
+  return true;
+}
+
+#endif
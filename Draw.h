@@ -3,7 +3,13 @@
 
 #include <TFT_eSPI.h> 
 #include <SPI.h>
-#include "Free_Fonts.h"
+#include "Font.h"
+#include "Temperature.h"
+#include "Profiler.h"
+#include "Clock.h"
+#include "Screen_Layout.h"
+#include "Rooms.h"
+#include "esp_rom_crc.h"
 #include "time.h"
 
 #include "Home_Icon.h"
@@ -11,6 +17,36 @@
 #include "Gear_Icon.h"
 #define DEG2RAD 0.0174532925
 #define PENRADIUS 2
+#define NAV_LIT 0x2124             // Behind the nav bar icon of the screen showing
+#define ROOM_STALE 900000          // A reading older than 15 minutes is drawn as stale
+#define SIGNAL_W 60                // Wifi strength sprite, from 35 left of the middle of the arcs to 25 right
+
+/**
+ * @brief What one kind of draw call has sent to the screen
+ *
+ */
+struct DrawStats {
+  uint32_t calls;
+  uint32_t pushes;
+  uint32_t pixels;
+  uint32_t bytes;          // Over SPI, 16 bits a pixel whatever the sprite depth
+};
+
+/**
+ * @brief Sets which draw call pushes are counted against for the rest of the scope
+ *
+ */
+class DrawScope {
+  private:
+    ProfSection &current;
+    ProfSection prev;
+  public:
+    DrawScope(ProfSection &cur, ProfSection s) : current(cur), prev(cur){ current = s; }
+    ~DrawScope(){ current = prev; }
+};
+
+// Skip a public draw call while the screen is off, otherwise time it and count what it pushes
+#define DRAW_SCOPE(s) if(!visible) return; PROFILE(s); DrawScope draw_scope_(section, s); stats[s].calls++
 
 /**
  * @brief This class has preconfigured drawing methods for a 480x320 pixel
@@ -20,36 +56,98 @@
 class Draw {
   private:
     TFT_eSPI tft = TFT_eSPI();
-    TFT_eSprite img = TFT_eSprite(&tft);
+
+    // Sprites are made once in begin() and drawn over, nothing is allocated while drawing
+    TFT_eSprite img = TFT_eSprite(&tft);       // Screen body, left of the nav bar
+    TFT_eSprite cell = TFT_eSprite(&tft);      // One value on the main screen
+    TFT_eSprite strip = TFT_eSprite(&tft);     // Time and notices in the header
+    TFT_eSprite signal = TFT_eSprite(&tft);    // Wifi strength in the header
+    TFT_eSprite row_bufs[2] = {TFT_eSprite(&tft), TFT_eSprite(&tft)};  // Room list rows, one is drawn while the other goes out
+    TFT_eSprite *row = &row_bufs[0];           // The one being drawn
+    Font main_font;
+    Font second_font;
+    Font header_font;
+    Font table_font;
+    Font *font = &main_font;
     const uint16_t *menu[3] = {Home_Icon, Cal_Icon, Gear_Icon};
+    uint16_t chrome_colour = TFT_WHITE;
+    uint16_t mask_bg = TFT_BLACK;  // Background the masks were last given with setBitmapColor()
+
+    // 1-bit masks of the static chrome, rasterized once in begin()
+    TFT_eSprite back_mask = TFT_eSprite(&tft);
+    TFT_eSprite prev_mask = TFT_eSprite(&tft);
+    TFT_eSprite next_mask = TFT_eSprite(&tft);
+    TFT_eSprite up_mask = TFT_eSprite(&tft);
+    TFT_eSprite down_mask = TFT_eSprite(&tft);
+    TFT_eSprite scroll_up_mask = TFT_eSprite(&tft);
+    TFT_eSprite scroll_down_mask = TFT_eSprite(&tft);
+    TFT_eSprite home_mask = TFT_eSprite(&tft);
+    TFT_eSprite cal_mask = TFT_eSprite(&tft);
+    TFT_eSprite gear_mask = TFT_eSprite(&tft);
+    TFT_eSprite *icons[ICONS] = {&back_mask, &prev_mask, &next_mask, &up_mask, &down_mask,
+      &scroll_up_mask, &scroll_down_mask, &home_mask, &cal_mask, &gear_mask};
+
+    // What each nav bar slot shows, the icon with the top bit set when lit
+    uint8_t nav_shown[3] = {0xFF, 0xFF, 0xFF};
+
+    void createMask(TFT_eSprite &mask, int w, int h);
+    void rasterizeChrome();
+    void blit(TFT_eSprite &dst, TFT_eSprite &mask, int x, int y);
+    void widgets(TFT_eSprite &dst, const Widget *ws, size_t n, uint8_t state);
+    template<size_t N> void widgets(TFT_eSprite &dst, const Widget (&ws)[N], uint8_t state){ widgets(dst, ws, N, state); }
+    void button(TFT_eSprite &img, int x, int y, int w, int h, const String &label);
+    void roomTitle(Rooms &list, int page);
+    void roomRow(Rooms &list, int i, unsigned long now);
+    void sparkline(Rooms &list, int i, Rect box);
+    const char* age(char *buf, size_t size, unsigned long at, unsigned long now);
+
+    // Screen traffic
+    DrawStats stats[PROF_SECTIONS];
+    ProfSection section = PROF_DRAW_MAIN;
+    uint32_t frame_crc = 0;
+    boolean checksums = false;
+    boolean visible = true;
+    boolean dma = false;
+    void count(TFT_eSprite &sprite, int x, int y, int sy, int h);
+    void push(TFT_eSprite &sprite, int x, int y);
+    void push(TFT_eSprite &sprite, int x, int y, int sy, int h);
+    void pushDMA(TFT_eSprite &sprite, int x, int y, int sy, int h);
 
   public:
     void begin();
+    void setChromeColour(uint16_t colour);
+    void setVisible(boolean val);
+    void resetStats(boolean crc);
+    const DrawStats& getStats(ProfSection s);
+    uint32_t getFrameCrc();
+    void report(Print &out);
     
     // Navigational
-    void main(float temp, float humd, float goal_temp, float goal_humd, boolean holding);
-    void rooms();
-    void schedule(String slots[], String short_dow);
-    void settings(boolean hold, float hold_temp, float goal_humd);
+    void main(deci_celsius temp, float humd, deci_celsius goal_temp, float goal_humd, boolean holding, int hold_left);
+    void rooms(Rooms &list, int scroll, unsigned long now, boolean title);
+    void schedule(String slots[], int count, String short_dow, boolean editing, int selected, int scroll, boolean can_paste);
+    void settings(String hold, deci_celsius hold_temp, float goal_humd, String mode);
 
     // Helper functions
-    void tempHeaders();
-    void back(TFT_eSprite &img);
+    void navBar(uint8_t state, WidgetId lit, boolean whole);
     void wifi(int x, int y, int strength);
-    void fillArc(int x, int y, int start_angle, int seg_count, int rx, int ry, int w, unsigned int colour);
+    void fillArc(TFT_eSPI &dst, int x, int y, int start_angle, int seg_count, int rx, int ry, int w, unsigned int colour);
+    void text(TFT_eSprite &img, const String &str, int x, int y);
+    void text(TFT_eSprite &img, const char *str, int x, int y);
     void time();
+    void notice(String msg);
 
     // Temperature Sensor
     void dhtHumd(float humd);
-    void dhtTemp(float temp);
+    void dhtTemp(deci_celsius temp);
     void goalHumd(float humd);
-    void goalTemp(boolean holding, float temp);
+    void goalTemp(boolean holding, deci_celsius temp, int hold_left);
     
     // Fonts
-    void mainFont(TFT_eSprite& img);
-    void secondFont(TFT_eSprite& img);
-    void headerFont(TFT_eSprite& img);
-    void tableFont(TFT_eSprite& img);
+    void mainFont();
+    void secondFont();
+    void headerFont();
+    void tableFont();
 };
 
 /**
@@ -60,9 +158,274 @@ class Draw {
 void Draw::begin(){
   tft.init();
   tft.fillScreen(TFT_BLACK);
-  tft.setRotation(3);
-  pinMode(TFT_BL, OUTPUT);
-  digitalWrite(TFT_BL, 128);
+  tft.setRotation(SCREEN_ROTATION);
+  main_font.begin(&Atlas_Main, TFT_WHITE, TFT_BLACK);
+  second_font.begin(&Atlas_Second, TFT_DARKGREY, TFT_BLACK);
+  header_font.begin(&Atlas_Header, TFT_WHITE, TFT_BLACK);
+  table_font.begin(&Atlas_Table, TFT_WHITE, TFT_BLACK);
+  rasterizeChrome();
+  img.createSprite(BODY_W, SCREEN_H - BODY_Y);
+  cell.createSprite(180, 60);
+  strip.createSprite(400, 40);
+  for(int i = 0; i < 2; i++){
+    // DMA can't read from PSRAM
+    row_bufs[i].setAttribute(PSRAM_ENABLE, false);
+    row_bufs[i].createSprite(BODY_W, ROOM_ROW_H);
+  }
+  signal.createSprite(SIGNAL_W, 40);
+  dma = tft.initDMA();
+}
+
+/**
+ * @brief Set the colour that the static chrome (back arrow, nav bar, arrows) is blitted with.
+ * Takes effect on the next draw of each screen.
+ * 
+ * @param colour 
+ */
+void Draw::setChromeColour(uint16_t colour){
+  chrome_colour = colour;
+  memset(nav_shown, 0xFF, sizeof(nav_shown));
+}
+
+/**
+ * @brief Turn drawing on or off. While the screen is off every draw call returns straight
+ * away, whatever it would have drawn is stale by the time it comes back on so the caller
+ * draws the whole screen again then.
+ * 
+ * @param val 
+ */
+void Draw::setVisible(boolean val){
+  visible = val;
+}
+
+/**
+ * @brief Clear the screen traffic counters
+ * 
+ * @param crc also checksum every pixel pushed, costs a pass over each sprite so it is only
+ * turned on when the result is wanted (i.e. a trace replay)
+ */
+void Draw::resetStats(boolean crc){
+  memset(stats, 0, sizeof(stats));
+  frame_crc = 0;
+  checksums = crc;
+}
+
+/**
+ * @brief Returns what a draw call has pushed since the last reset
+ * 
+ * @param s one of the PROF_DRAW_ sections
+ * @return const DrawStats& 
+ */
+const DrawStats& Draw::getStats(ProfSection s){
+  return stats[s];
+}
+
+/**
+ * @brief CRC-32 of every pixel pushed, and where, since the last reset. Two runs that draw
+ * exactly the same thing have the same CRC.
+ * 
+ * @return uint32_t 
+ */
+uint32_t Draw::getFrameCrc(){
+  return frame_crc;
+}
+
+/**
+ * @brief Print a table of the screen traffic for each draw call
+ * 
+ * @param out 
+ */
+void Draw::report(Print &out){
+  out.printf("%-16s %8s %8s %10s %10s\n", "draw", "calls", "pushes", "pixels", "bytes");
+  for(int s = PROF_DRAW_MAIN; s < PROF_SECTIONS; s++){
+    if(!stats[s].calls) continue;
+    out.printf("%-16s %8lu %8lu %10lu %10lu\n", prof_names[s], (unsigned long)stats[s].calls,
+      (unsigned long)stats[s].pushes, (unsigned long)stats[s].pixels, (unsigned long)stats[s].bytes);
+  }
+  if(checksums){
+    out.printf("frame crc %08lx\n", (unsigned long)frame_crc);
+  }
+}
+
+/**
+ * @brief Push a sprite to the screen, counted against the draw call it was made in.
+ * Every screen update goes through here.
+ * 
+ * @param sprite 
+ * @param x 
+ * @param y 
+ */
+void Draw::push(TFT_eSprite &sprite, int x, int y){
+  push(sprite, x, y, 0, sprite.height());
+}
+
+/**
+ * @brief Count a push against the draw call it was made in, and checksum it
+ * 
+ * @param sprite 
+ * @param x 
+ * @param y 
+ * @param sy 
+ * @param h 
+ */
+void Draw::count(TFT_eSprite &sprite, int x, int y, int sy, int h){
+  uint32_t pixels = sprite.width() * h;
+  DrawStats &st = stats[section];
+  st.pushes++;
+  st.pixels += pixels;
+  st.bytes += pixels * 2;
+  if(checksums){
+    int16_t where[2] = {(int16_t)x, (int16_t)y};
+    uint32_t line = sprite.getColorDepth() == 1 ? (sprite.width() + 7) / 8 : sprite.width() * (sprite.getColorDepth() / 8);
+    frame_crc = esp_rom_crc32_le(frame_crc, (const uint8_t*)where, sizeof(where));
+    if(sprite.getColorDepth() == 1){
+      // A mask's pixels are only on or off, what they look like is down to the two colours
+      uint16_t colours[2] = {chrome_colour, mask_bg};
+      frame_crc = esp_rom_crc32_le(frame_crc, (const uint8_t*)colours, sizeof(colours));
+    }
+    frame_crc = esp_rom_crc32_le(frame_crc, (const uint8_t*)sprite.getPointer() + (sy * line), h * line);
+  }
+}
+
+/**
+ * @brief Push some of the lines of a sprite, i.e. a row of a list cut off by the edge of it
+ * 
+ * @param sprite 
+ * @param x 
+ * @param y where the first line pushed goes
+ * @param sy first line of the sprite pushed
+ * @param h lines pushed
+ */
+void Draw::push(TFT_eSprite &sprite, int x, int y, int sy, int h){
+  count(sprite, x, y, sy, h);
+  if(sy == 0 && h == sprite.height()){
+    sprite.pushSprite(x, y);
+  } else {
+    sprite.pushSprite(x, y, 0, sy, sprite.width(), h);
+  }
+}
+
+/**
+ * @brief Same as push() for a 16 bit sprite, but sent by DMA. It waits for the transfer
+ * before it and returns once this one is queued, so the next can be drawn into another sprite
+ * while it goes out. Only between tft.startWrite() and tft.dmaWait(), endWrite().
+ * 
+ * @param sprite 
+ * @param x 
+ * @param y 
+ * @param sy 
+ * @param h 
+ */
+void Draw::pushDMA(TFT_eSprite &sprite, int x, int y, int sy, int h){
+  if(!dma){
+    push(sprite, x, y, sy, h);
+    return;
+  }
+  count(sprite, x, y, sy, h);
+  // The sprite's pixels are already in the order the panel wants them
+  tft.pushImageDMA(x, y, sprite.width(), h, (uint16_t*)sprite.getPointer() + (sy * sprite.width()));
+}
+
+/**
+ * @brief Creates an empty 1-bit sprite to be used as a mask, each pixel is a single bit
+ * 
+ * @param mask 
+ * @param w 
+ * @param h 
+ */
+void Draw::createMask(TFT_eSprite &mask, int w, int h){
+  mask.setColorDepth(1);
+  mask.createSprite(w, h);
+  mask.fillSprite(TFT_BLACK);
+}
+
+/**
+ * @brief Draws the geometry of all the static chrome a single time into 1-bit masks.
+ * The masks are kept for the life of the program and blitted in any colour, so none of
+ * the geometry has to be redrawn when a screen is rendered.
+ * 
+ * Each mask is positioned relative to the top left corner of where it gets blitted.
+ * 
+ */
+void Draw::rasterizeChrome(){
+  // Back arrow, drawn with a round pen in the middle of a nav bar slot
+  createMask(back_mask, icon_w[ICON_BACK], icon_h[ICON_BACK]);
+  for(int i = 0; i < 25; i++){
+    back_mask.fillCircle(30 + i, 40 - i, PENRADIUS, TFT_WHITE);
+    back_mask.fillCircle(30 + i, 40 + i, PENRADIUS, TFT_WHITE);
+  }
+  for(int i = 0; i < 50; i++){
+    back_mask.fillCircle(30 + i, 40, PENRADIUS, TFT_WHITE);
+  }
+
+  // Previous/next day triangles on the schedule screen
+  createMask(prev_mask, icon_w[ICON_PREV], icon_h[ICON_PREV]);
+  prev_mask.fillTriangle(0, 20, 20, 0, 20, 40, TFT_WHITE);
+  createMask(next_mask, icon_w[ICON_NEXT], icon_h[ICON_NEXT]);
+  next_mask.fillTriangle(20, 20, 0, 0, 0, 40, TFT_WHITE);
+
+  // Up/down arrows on the settings screen
+  createMask(up_mask, icon_w[ICON_UP], icon_h[ICON_UP]);
+  up_mask.fillTriangle(30, 0, 60, 30, 0, 30, TFT_WHITE);
+  createMask(down_mask, icon_w[ICON_DOWN], icon_h[ICON_DOWN]);
+  down_mask.fillTriangle(30, 30, 60, 0, 0, 0, TFT_WHITE);
+
+  // Scroll arrows for lists
+  createMask(scroll_up_mask, icon_w[ICON_SCROLL_UP], icon_h[ICON_SCROLL_UP]);
+  scroll_up_mask.fillTriangle(12, 0, 24, 24, 0, 24, TFT_WHITE);
+  createMask(scroll_down_mask, icon_w[ICON_SCROLL_DOWN], icon_h[ICON_SCROLL_DOWN]);
+  scroll_down_mask.fillTriangle(12, 24, 24, 0, 0, 0, TFT_WHITE);
+
+  // Menu icons are near monochrome, anything brighter than half green is kept
+  for(int i = 0; i < 3; i++){
+    TFT_eSprite &mask = *icons[ICON_HOME + i];
+    createMask(mask, 100, 80);
+    for(int y = 0; y < 80; y++){
+      for(int x = 0; x < 100; x++){
+        uint16_t px = pgm_read_word(&menu[i][(y * 100) + x]);
+        if(((px >> 5) & 0x3F) >= 32){
+          mask.drawPixel(x, y, TFT_WHITE);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Blits a 1-bit mask into a sprite using the chrome colour, only set bits are drawn
+ * 
+ * @param dst sprite being drawn into
+ * @param mask 
+ * @param x top left of the mask inside dst
+ * @param y top left of the mask inside dst
+ */
+void Draw::blit(TFT_eSprite &dst, TFT_eSprite &mask, int x, int y){
+  dst.drawBitmap(x, y, (const uint8_t*)mask.getPointer(), mask.width(), mask.height(), chrome_colour);
+}
+
+/**
+ * @brief Draws the widgets from a screen's layout table (see Screen_Layout.h) that are shown
+ * in state, buttons with their labels, boxes and icons. Areas are left to the screen.
+ * 
+ * @param dst the screen sprite
+ * @param ws 
+ * @param n 
+ * @param state WHEN_ flags
+ */
+void Draw::widgets(TFT_eSprite &dst, const Widget *ws, size_t n, uint8_t state){
+  headerFont();
+  for(size_t i = 0; i < n; i++){
+    const Widget &w = ws[i];
+    if(!w.shown(state)) continue;
+    Rect r = w.box.body();
+    if(w.art == ART_BUTTON){
+      button(dst, r.x, r.y, r.w, r.h, w.label);
+    } else if(w.art == ART_BOX){
+      dst.drawRoundRect(r.x, r.y, r.w, r.h, 5, TFT_WHITE);
+    } else if(w.art == ART_ICON){
+      blit(dst, *icons[w.icon], r.x, r.y);
+    }
+  }
 }
 
 /**
@@ -74,136 +437,320 @@ void Draw::begin(){
  * @param goal_temp 
  * @param goal_humd 
  * @param holding
+ * @param hold_left minutes left on the hold
  */
-void Draw::main(float temp, float humd, float goal_temp, float goal_humd, boolean holding){
-  img.createSprite(480, 280);
-  img.fillScreen(TFT_BLACK);
-  img.pushSprite(0, 40);
-  img.deleteSprite();
-  for (int i = 0; i < 3; i++){
-    tft.pushImage(380, (i+1) * 80, 100, 80, menu[i]);
-  }
-  tempHeaders();
+void Draw::main(deci_celsius temp, float humd, deci_celsius goal_temp, float goal_humd, boolean holding, int hold_left){
+  DRAW_SCOPE(PROF_DRAW_MAIN);
+  // Current/target column headers, the values go in their own cells over the top
+  img.fillSprite(TFT_BLACK);
+  secondFont();
+  img.setTextDatum(ML_DATUM);
+  text(img, "current", 20, 165 - BODY_Y);
+  text(img, "target", 200, 165 - BODY_Y);
+  push(img, 0, BODY_Y);
   dhtTemp(temp);
   dhtHumd(humd);
-  goalTemp(holding, goal_temp);
+  goalTemp(holding, goal_temp, hold_left);
   goalHumd(goal_humd);
 }
 
 /**
- * @brief This will be a list of sensors in the house and their respective output
+ * @brief The room modules as a list scrolled to any pixel. Only the rows in view are drawn,
+ * one at a time into a sprite a row high that is pushed with whatever the edges of the list
+ * cut off left out, so a frame costs the same with 3 rooms or MAX_ROOMS. The scroll bar is
+ * drawn down the right of each row as it goes.
+ *
+ * A frame is 182KB over SPI whatever is drawn, so the rows take turns in two sprites and go
+ * out by DMA, each drawn while the one before is being sent. The frame then takes about as
+ * long as the transfer.
  * 
+ * @param list 
+ * @param scroll pixels from the top of the list
+ * @param now clockMillis(), for the age of each reading
+ * @param title draw the title line too, it only changes with the page
  */
-void Draw::rooms(){
-  img.createSprite(480, 280);
-  img.fillRect(0, 0, 480, 280, TFT_BLACK);
-  //img.pushSprite(0, 40);
-  //img.deleteSprite();
-  //img.createSprite(380, 260);
-  //img.fillRect(0, 0, 380, 260, TFT_BLACK);
-  mainFont(img);
-  img.setTextDatum(MC_DATUM);
-  img.drawString("Rooms!", 190, 130);
-  back(img);
-  img.pushSprite(0, 40);
-  img.deleteSprite();
+void Draw::rooms(Rooms &list, int scroll, unsigned long now, boolean title){
+  DRAW_SCOPE(PROF_DRAW_ROOMS);
+  const Rect view = Layout::room_list.box;
+  int total = list.getCount() * ROOM_ROW_H;
+  if(title){
+    roomTitle(list, roomPage(scroll));
+  }
+  int thumb_h = 0;
+  int thumb_y = 0;
+  if(total > view.h){
+    thumb_h = max(20, (view.h * view.h) / total);
+    thumb_y = view.y + ((view.h - thumb_h) * scroll) / (total - view.h);
+  }
+  boolean swap = tft.getSwapBytes();
+  tft.setSwapBytes(false);
+  tft.startWrite();
+  int n = 0;
+  for(int y = view.y; y < view.bottom(); ){
+    row = &row_bufs[n++ & 1];
+    int into = scroll + (y - view.y);
+    int i = into / ROOM_ROW_H;
+    int sy = into % ROOM_ROW_H;
+    int h = min(ROOM_ROW_H - sy, view.bottom() - y);
+    row->fillSprite(TFT_BLACK);
+    if(i < list.getCount()){
+      roomRow(list, i, now);
+    } else if(i == 0){
+      secondFont();
+      row->setTextDatum(MC_DATUM);
+      text(*row, "No room modules yet", Layout::room_bar_x / 2, ROOM_ROW_H / 2);
+    }
+    if(thumb_h){
+      // Where the row's top line would be on the screen, the sprite clips the rest
+      row->fillRoundRect(Layout::room_bar_x, thumb_y - (y - sy), 4, thumb_h, 2, TFT_DARKGREY);
+    }
+    pushDMA(*row, view.x, y, sy, h);
+    y += h;
+  }
+  if(dma) tft.dmaWait();
+  tft.endWrite();
+  tft.setSwapBytes(swap);
+  row = &row_bufs[0];
 }
 
 /**
- * @brief Allows you to view the schedule for the currently select day
+ * @brief The title line over the room list, drawn in the row sprite
  * 
- * @param day_slots 
+ * @param list 
+ * @param page 
+ */
+void Draw::roomTitle(Rooms &list, int page){
+  char buf[24];
+  int pages = roomPages(list.getCount());
+  row->fillSprite(TFT_BLACK);
+  headerFont();
+  row->setTextDatum(ML_DATUM);
+  text(*row, "Rooms", 8, 20);
+  secondFont();
+  row->setTextDatum(MR_DATUM);
+  if(pages > 1){
+    snprintf(buf, sizeof(buf), "%u rooms  %d/%d", list.getCount(), page + 1, pages);
+  } else {
+    snprintf(buf, sizeof(buf), "%u rooms", list.getCount());
+  }
+  text(*row, buf, Layout::room_bar_x, 20);
+  push(*row, Layout::room_title.x, Layout::room_title.y, 0, Layout::room_title.h);
+}
+
+/**
+ * @brief Draws one room into the row sprite. The name over the age of the reading, the
+ * temperature, humidity over battery, and the sparkline on the right.
+ * 
+ * @param list 
+ * @param i 
+ * @param now 
+ */
+void Draw::roomRow(Rooms &list, int i, unsigned long now){
+  char buf[16];
+  const Room *room = list.get(i);
+  const int right = 280;
+  row->setTextDatum(ML_DATUM);
+  headerFont();
+  text(*row, room->name, 8, 18);
+  secondFont();
+  text(*row, age(buf, sizeof(buf), room->reading_at, now), 8, 44);
+
+  row->setTextDatum(MR_DATUM);
+  if(isValid(room->temp)){
+    // Stale readings are left in grey
+    tableFont();
+    if(now - room->reading_at >= ROOM_STALE) secondFont();
+    text(*row, formatDeci(buf, room->temp), 215, 20);
+  }
+  if(room->humd != ROOM_UNKNOWN){
+    headerFont();
+    snprintf(buf, sizeof(buf), "%u%%", room->humd);
+    text(*row, buf, right, 20);
+  }
+  if(room->battery != ROOM_UNKNOWN){
+    secondFont();
+    snprintf(buf, sizeof(buf), "bat %u%%", room->battery);
+    text(*row, buf, right, 44);
+  }
+  sparkline(list, i, Rect{(int16_t)(right + 12), 10, (int16_t)(Layout::room_bar_x - right - 20), 40});
+  row->drawFastHLine(0, ROOM_ROW_H - 1, Layout::room_bar_x - 4, 0x39E7);
+}
+
+/**
+ * @brief The last ROOM_SPARK temperatures as a line, scaled to at least a degree top to
+ * bottom so sensor noise stays flat
+ * 
+ * @param list 
+ * @param i 
+ * @param box in the row sprite
+ */
+void Draw::sparkline(Rooms &list, int i, Rect box){
+  deci_celsius pts[ROOM_SPARK];
+  uint8_t n = list.sparkline(i, pts);
+  if(n < 2){
+    return;
+  }
+  deci_celsius lo = pts[0];
+  deci_celsius hi = pts[0];
+  for(int k = 1; k < n; k++){
+    lo = min(lo, pts[k]);
+    hi = max(hi, pts[k]);
+  }
+  int span = max(hi - lo, 10);
+  int base = lo - ((span - (hi - lo)) / 2);
+  int px = box.x;
+  int py = box.bottom() - 1 - ((pts[0] - base) * (box.h - 1)) / span;
+  for(int k = 1; k < n; k++){
+    int x = box.x + (k * (box.w - 1)) / (ROOM_SPARK - 1);
+    int y = box.bottom() - 1 - ((pts[k] - base) * (box.h - 1)) / span;
+    row->drawLine(px, py, x, y, chrome_colour);
+    px = x;
+    py = y;
+  }
+}
+
+/**
+ * @brief How long ago a reading came in, in the largest unit that fits
+ * 
+ * @param buf 
+ * @param size 
+ * @param at clockMillis() of the reading, 0 for none
+ * @param now 
+ * @return const char* buf
+ */
+const char* Draw::age(char *buf, size_t size, unsigned long at, unsigned long now){
+  unsigned long mins = (now - at) / 60000;
+  if(!at){
+    snprintf(buf, size, "no reading");
+  } else if(mins == 0){
+    snprintf(buf, size, "just now");
+  } else if(mins < 60){
+    snprintf(buf, size, "%lum ago", mins);
+  } else if(mins < 2880){
+    snprintf(buf, size, "%luh ago", mins / 60);
+  } else {
+    snprintf(buf, size, "%lud ago", mins / 1440);
+  }
+  return buf;
+}
+
+/**
+ * @brief Allows you to view and edit the schedule for the currently selected day.
+ * Up to SCHED_ROWS slots are shown starting from scroll. While editing the selected
+ * slot is outlined and the edit buttons are drawn:
+ * Add/Del/Copy(Paste) down the side, T-/T+ (time), H-/H+ (heat), C-/C+ (cool) along the bottom
+ * 
+ * @param slots preformatted slots for the day
+ * @param count number of slots in the day
  * @param short_dow 
+ * @param editing 
+ * @param selected slot selected in the editor
+ * @param scroll first slot shown
+ * @param can_paste a day has been copied
  */
-void Draw::schedule(String slots[], String short_dow){
-  img.createSprite(480, 280);
-  img.fillRect(0,0,480,280,TFT_BLACK);
-  mainFont(img);
-  img.fillTriangle(40,20,60,0,60,40, TFT_WHITE);
-  img.fillTriangle(200,20,180,0,180,40, TFT_WHITE);
+void Draw::schedule(String slots[], int count, String short_dow, boolean editing, int selected, int scroll, boolean can_paste){
+  DRAW_SCOPE(PROF_DRAW_SCHEDULE);
+  const Rect rows = Layout::rows.box.body();
+  const Rect up = Layout::scroll_up.box.body();
+  const Rect down = Layout::scroll_down.box.body();
+  img.fillSprite(TFT_BLACK);
+  widgets(img, schedule_screen, scheduleState(editing, can_paste));
+
+  // Day between the arrows
+  mainFont();
   img.setTextDatum(MC_DATUM);
-  img.drawString(short_dow, 120, 20);
+  text(img, short_dow, (Layout::prev_day.box.right() + Layout::next_day.box.x) / 2, Layout::prev_day.box.body().cy());
+
   img.setTextDatum(ML_DATUM);
-  tableFont(img);
-  for(int i = 0; i < 10; i++){
-    if(slots[i] == "") continue;
-    img.drawString(slots[i], 20, 80+(i*40), GFXFF);
-    img.drawCircle(285,70+(i*40),3,TFT_WHITE);
+  tableFont();
+  for(int i = 0; i < SCHED_ROWS && scroll + i < count; i++){
+    int y = rows.y + (i * SCHED_ROW_H);
+    text(img, slots[scroll + i], rows.x + 6, y + (SCHED_ROW_H / 2));
+    if(editing && scroll + i == selected){
+      img.drawRoundRect(rows.x, y, rows.w, SCHED_ROW_H, 5, TFT_WHITE);
+    }
+  }
+  if(scroll > 0){
+    blit(img, scroll_up_mask, up.cx() - (icon_w[ICON_SCROLL_UP] / 2), up.y + 10);
+  }
+  if(scroll + SCHED_ROWS < count){
+    blit(img, scroll_down_mask, down.cx() - (icon_w[ICON_SCROLL_DOWN] / 2), down.bottom() - 35);
   }
-  back(img);
-  img.pushSprite(0,40);
-  img.deleteSprite();
+  push(img, 0, BODY_Y);
 }
 
 /**
- * @brief Displays the target humidity
+ * @brief Displays the hold, heating/cooling mode and target humidity settings
  * 
+ * @param hold name of the hold type (OFF, SLOT, 2H, ON)
+ * @param hold_temp
  * @param goal_humd current target humidity
+ * @param mode name of the thermostat mode (OFF, HEAT, COOL, AUTO)
  */
-void Draw::settings(boolean hold, float hold_temp, float goal_humd){
-  img.createSprite(480, 280);
-  img.fillRect(0,0,480,280,TFT_BLACK);
-  // Write out headers
-  secondFont(img);
+void Draw::settings(String hold, deci_celsius hold_temp, float goal_humd, String mode){
+  DRAW_SCOPE(PROF_DRAW_SETTINGS);
+  char temp_buf[8];
+  const int heading_y = Layout::settings_heading_y - BODY_Y;
+  const int value_y = Layout::settings_value_y - BODY_Y;
+  img.fillSprite(TFT_BLACK);
+  widgets(img, settings_screen, WHEN_ALWAYS);
+
+  // Write out headers over each column
+  secondFont();
   img.setTextDatum(MC_DATUM);
-  img.drawString("Hold", 40, 50);
-  img.drawString("Hold Temp", 155, 50);
-  img.drawString("Humidity", 305, 50);
+  text(img, "Hold", Layout::hold.box.cx(), heading_y);
+  text(img, "Hold Temp", Layout::hold_up.box.cx(), heading_y);
+  text(img, "Humidity", Layout::humd_up.box.cx(), heading_y);
   
-  // Draw out triangles and buttons
-  mainFont(img);
-  if(hold){
-    img.drawString("ON", 40, 120);
-  } else {
-    img.drawString("OFF", 40, 120);
-  }
-  img.drawRoundRect(10, 90, 60, 60, 5, TFT_WHITE);
-  img.fillTriangle(155,90,185,120,125,120, TFT_WHITE);
-  img.fillTriangle(155,240,185,210,125,210, TFT_WHITE);
-  img.fillTriangle(305,90,335,120,275,120, TFT_WHITE);
-  img.fillTriangle(305,240,335,210,275,210, TFT_WHITE);
-  img.drawString(String(hold_temp), 155, 160);
+  // Hold and mode go in their boxes, the values between their arrows
+  headerFont();
+  text(img, hold, Layout::hold.box.cx(), Layout::hold.box.body().cy());
+  text(img, mode, Layout::mode.box.cx(), Layout::mode.box.body().cy());
+  mainFont();
+  text(img, formatDeci(temp_buf, hold_temp), Layout::hold_up.box.cx(), value_y);
   String temp_str = String((int)goal_humd);
   temp_str += "%";
-  img.drawString(temp_str, 305, 160);
-  back(img);
-  img.pushSprite(0,40);
-  img.deleteSprite();
-  
+  text(img, temp_str, Layout::humd_up.box.cx(), value_y);
+  push(img, 0, BODY_Y);
 }
 
 /**
- * @brief Draws out the current/target column headers
+ * @brief Draws an outlined button with its label centred, in the current font
  * 
+ * @param img 
+ * @param x 
+ * @param y 
+ * @param w 
+ * @param h 
+ * @param label 
  */
-void Draw::tempHeaders(){
-  img.createSprite(360,30);
-  secondFont(img);
-  img.setTextDatum(ML_DATUM);
-  img.drawString("current",20,15, GFXFF);
-  img.drawString("target", 200, 15, GFXFF);
-  img.pushSprite(0,150);
-  img.deleteSprite();
+void Draw::button(TFT_eSprite &img, int x, int y, int w, int h, const String &label){
+  img.drawRoundRect(x, y, w, h, 5, TFT_WHITE);
+  uint8_t datum = img.getTextDatum();
+  img.setTextDatum(MC_DATUM);
+  text(img, label, x + (w / 2), y + (h / 2));
+  img.setTextDatum(datum);
 }
 
 /**
- * @brief Draws a back arrow, used in nested navigational screens
+ * @brief Pushes the nav bar icons straight from their masks to the screen. The nav bar stays
+ * up through a change of screen, only the slots that look different are pushed.
  * 
+ * @param state navState() of the screen showing
+ * @param lit the icon for the screen showing, drawn on a lighter background
+ * @param whole push every slot, i.e. when what's on the screen isn't known
  */
-void Draw::back(TFT_eSprite &img){
-  //img.createSprite(80, 80);
-  int start_x = 410;
-  int start_y = 80;
-  for(int i = 0; i < 25; i++){
-    img.fillCircle(start_x + i, start_y - i, PENRADIUS, TFT_WHITE);
-  }
-  
-  for(int i = 0; i < 25; i++){
-    img.fillCircle(start_x + i, start_y + i, PENRADIUS, TFT_WHITE);
-  }
-
-  for(int i = 0; i < 50; i++){
-    img.fillCircle( start_x + i, start_y, PENRADIUS, TFT_WHITE);
+void Draw::navBar(uint8_t state, WidgetId lit, boolean whole){
+  DRAW_SCOPE(PROF_DRAW_MENU);
+  for(const Widget &w : nav_bar){
+    if(!w.shown(state)) continue;
+    int slot = (w.box.y - Layout::nav_top) / Layout::nav_slot_h;
+    uint8_t look = w.icon | (w.id == lit ? 0x80 : 0);
+    if(!whole && nav_shown[slot] == look) continue;
+    nav_shown[slot] = look;
+    mask_bg = w.id == lit ? NAV_LIT : TFT_BLACK;
+    icons[w.icon]->setBitmapColor(chrome_colour, mask_bg);
+    push(*icons[w.icon], w.box.x, w.box.y);
   }
 }
 
@@ -215,18 +762,24 @@ void Draw::back(TFT_eSprite &img){
  * @param strength 0-3
  */
 void Draw::wifi(int x, int y, int strength){
+  DRAW_SCOPE(PROF_DRAW_WIFI);
   uint16_t str_sig[3] = {0x39E7,0x39E7,0x39E7};
   for (int i = 0; i < strength; i++){
     str_sig[i] = TFT_WHITE; 
   }
-  fillArc(x, y, 310, 17, 25, 30, 4, str_sig[2]);
-  fillArc(x, y+5, 315, 15, 18, 25, 4, str_sig[1]);
-  tft.fillCircle(x-1, y-7, 4, str_sig[0]);
+  // Drawn into a sprite covering the right of the header so it goes out in one push
+  int left = x - 35;
+  signal.fillSprite(TFT_BLACK);
+  fillArc(signal, x - left, y, 310, 17, 25, 30, 4, str_sig[2]);
+  fillArc(signal, x - left, y+5, 315, 15, 18, 25, 4, str_sig[1]);
+  signal.fillCircle(x - left - 1, y-7, 4, str_sig[0]);
+  push(signal, left, 0);
 }
 
 /**
  * @brief I took this function from the TFT_espi library examples, used to draw arcs
  * 
+ * @param dst the screen or a sprite
  * @param x
  * @param y 
  * @param start_angle 
@@ -236,7 +789,7 @@ void Draw::wifi(int x, int y, int strength){
  * @param w 
  * @param colour 
  */
-void Draw::fillArc(int x, int y, int start_angle, int seg_count, int rx, int ry, int w, unsigned int colour)
+void Draw::fillArc(TFT_eSPI &dst, int x, int y, int start_angle, int seg_count, int rx, int ry, int w, unsigned int colour)
 {
   byte seg = 6; // Segments are 3 degrees wide = 120 segments for 360 degrees
   byte inc = 6; // Draw segments every 3 degrees, increase to 6 for segmented ring
@@ -260,8 +813,8 @@ void Draw::fillArc(int x, int y, int start_angle, int seg_count, int rx, int ry,
     int x3 = sx2 * rx + x;
     int y3 = sy2 * ry + y;
 
-    tft.fillTriangle(x0, y0, x1, y1, x2, y2, colour);
-    tft.fillTriangle(x1, y1, x2, y2, x3, y3, colour);
+    dst.fillTriangle(x0, y0, x1, y1, x2, y2, colour);
+    dst.fillTriangle(x1, y1, x2, y2, x3, y3, colour);
 
     // Copy segment end to sgement start for next segment
     x0 = x2;
@@ -271,13 +824,30 @@ void Draw::fillArc(int x, int y, int start_angle, int seg_count, int rx, int ry,
   }
 }
 
+/**
+ * @brief Draws the string with the currently selected font, aligned with the sprites text datum
+ * 
+ * @param img 
+ * @param str 
+ * @param x 
+ * @param y 
+ */
+void Draw::text(TFT_eSprite &img, const String &str, int x, int y){
+  font->drawString(img, str, x, y, img.getTextDatum());
+}
+
+void Draw::text(TFT_eSprite &img, const char *str, int x, int y){
+  font->drawString(img, str, x, y, img.getTextDatum());
+}
+
 /**
  * @brief Retrieves the time from an NTP server and draws to screen
  * 
  */
 void Draw::time(){
+  DRAW_SCOPE(PROF_DRAW_TIME);
   struct tm timeinfo;
-  if(!getLocalTime(&timeinfo)){
+  if(!clockLocal(&timeinfo)){
     return;
   }
   char local_out[33];
@@ -290,12 +860,25 @@ void Draw::time(){
   String full_out = String(local_out) + " ";
   full_out += ampm;
   ampm.toLowerCase();
-  img.createSprite(400, 40);
-  headerFont(img);
-  img.setTextDatum(TR_DATUM);
-  img.drawString(full_out, 400, 10, GFXFF);
-  img.pushSprite(10,0);
-  img.deleteSprite();
+  strip.fillSprite(TFT_BLACK);
+  headerFont();
+  strip.setTextDatum(TR_DATUM);
+  text(strip, full_out, 400, 10);
+  push(strip, 10,0);
+}
+
+/**
+ * @brief Shows a short message in the header, the next time() update replaces it
+ * 
+ * @param msg 
+ */
+void Draw::notice(String msg){
+  DRAW_SCOPE(PROF_DRAW_NOTICE);
+  strip.fillSprite(TFT_BLACK);
+  headerFont();
+  strip.setTextDatum(TR_DATUM);
+  text(strip, msg, 400, 10);
+  push(strip, 10,0);
 }
 
 /**
@@ -304,13 +887,13 @@ void Draw::time(){
  * @param humd current humidity from sensor
  */
 void Draw::dhtHumd(float humd){
-  img.createSprite(180, 60);
-  img.setTextDatum(ML_DATUM);
-  mainFont(img);
+  DRAW_SCOPE(PROF_DRAW_DHT_HUMD);
+  cell.fillSprite(TFT_BLACK);
+  cell.setTextDatum(ML_DATUM);
+  mainFont();
   String humd_str = String(humd) + "%";
-  img.drawString(humd_str, 5, 30, GFXFF);
-  img.pushSprite(0, 240);
-  img.deleteSprite();
+  text(cell, humd_str, 5, 30);
+  push(cell, 0, 240);
 }
 
 /**
@@ -318,14 +901,15 @@ void Draw::dhtHumd(float humd){
  * 
  * @param temp current temperature from sensor
  */
-void Draw::dhtTemp(float temp){
-  img.createSprite(180, 60);
-  img.setTextDatum(ML_DATUM);
-  mainFont(img);
-  String temp_str = String(temp) + " c";
-  img.drawString(temp_str, 5, 30, GFXFF);
-  img.pushSprite(0, 180);
-  img.deleteSprite();
+void Draw::dhtTemp(deci_celsius temp){
+  DRAW_SCOPE(PROF_DRAW_DHT_TEMP);
+  char temp_buf[8];
+  cell.fillSprite(TFT_BLACK);
+  cell.setTextDatum(ML_DATUM);
+  mainFont();
+  String temp_str = String(formatDeci(temp_buf, temp)) + " c";
+  text(cell, temp_str, 5, 30);
+  push(cell, 0, 180);
 }
 
 /**
@@ -334,56 +918,59 @@ void Draw::dhtTemp(float temp){
  * @param humd 
  */
 void Draw::goalHumd(float humd){
+  DRAW_SCOPE(PROF_DRAW_GOAL_HUMD);
   String goal_str = String(humd);
-  img.createSprite(180, 60);
-  mainFont(img);
-  img.setTextDatum(ML_DATUM);
-  img.drawString(goal_str, 0, 30, GFXFF);
-  img.pushSprite(180,240);
-  img.deleteSprite();
+  cell.fillSprite(TFT_BLACK);
+  mainFont();
+  cell.setTextDatum(ML_DATUM);
+  text(cell, goal_str, 0, 30);
+  push(cell, 180,240);
 }
 
 /**
- * @brief Draws out the target temperature
+ * @brief Draws out the target temperature, boxed while holding with the time left
+ * on the hold in the corner
  * 
+ * @param holding
  * @param temp 
+ * @param hold_left minutes, 0 for a hold that doesn't end by itself
  */
-void Draw::goalTemp(boolean holding, float temp){
-  String goal_str = String(temp);
-  img.createSprite(180,60);
-  mainFont(img);
-  img.setTextDatum(ML_DATUM);
-  img.drawString(goal_str,0,30, GFXFF);
+void Draw::goalTemp(boolean holding, deci_celsius temp, int hold_left){
+  DRAW_SCOPE(PROF_DRAW_GOAL_TEMP);
+  char temp_buf[8];
+  String goal_str = String(formatDeci(temp_buf, temp));
+  cell.fillSprite(TFT_BLACK);
+  mainFont();
+  cell.setTextDatum(ML_DATUM);
+  text(cell, goal_str,0,30);
   if(holding){
-    img.drawRoundRect(0, 0, 180, 60, 5, TFT_WHITE);
+    cell.drawRoundRect(0, 0, 180, 60, 5, TFT_WHITE);
+  }
+  if(holding && hold_left > 0){
+    snprintf(temp_buf, sizeof(temp_buf), "%d:%02d", hold_left / 60, hold_left % 60);
+    secondFont();
+    cell.setTextDatum(BR_DATUM);
+    text(cell, temp_buf, 174, 56);
   }
-  img.pushSprite(180,180);
-  img.deleteSprite();
+  push(cell, 180,180);
 }
 
 /**
- * Pre-determined fonts for ease of re-use
+ * Pre-determined fonts for ease of re-use, all are anti-aliased atlas fonts
+ * from Font_Atlas.h with their colour set in begin()
  * 
  */
-void Draw::mainFont(TFT_eSprite& img){
-  img.setFreeFont(FF26);
-  img.setTextColor(TFT_WHITE);
-  img.setTextSize(2);
+void Draw::mainFont(){
+  font = &main_font;
 }
-void Draw::secondFont(TFT_eSprite& img){
-  img.setFreeFont(FMO12);
-  img.setTextColor(TFT_DARKGREY);
-  img.setTextSize(1);
+void Draw::secondFont(){
+  font = &second_font;
 }
-void Draw::headerFont(TFT_eSprite& img){
-  img.setFreeFont(FF26);
-  img.setTextColor(TFT_WHITE);
-  img.setTextSize(1);
+void Draw::headerFont(){
+  font = &header_font;
 }
-void Draw::tableFont(TFT_eSprite& img){
-  img.setTextSize(2);
-  img.setFreeFont(FM9);
-  img.setTextColor(TFT_WHITE);
+void Draw::tableFont(){
+  font = &table_font;
 }
 
 #endif
\ No newline at end of file
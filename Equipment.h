@@ -0,0 +1,465 @@
+#ifndef EQUIPMENT_H
+#define EQUIPMENT_H
+
+#include <limits.h>
+#include "Relay.h"
+
+#define MAX_STAGES 3
+#define EQUIP_RELAYS 5
+#define EFFORT_PER_DECI 5        // Control effort per tenth of a degree of error, 2c off is full effort
+#define STAGE_ON 25              // Start the first stage half a degree from the target
+#define STAGE_OFF -25            // and stop half a degree past it
+#define STAGE_UP 50              // Effort needed before adding another stage
+#define STAGE_DELAY 600000       // Time a stage gets to catch up before the next is added
+#define STAGE_DELAY_FULL 120000  // Shorter wait when the effort is maxed out
+
+/**
+ * @brief Which outputs are wired up, use NOPIN for anything that isn't connected
+ *
+ */
+struct EquipmentPins {
+  int heat;       // W1, furnace first stage or heat pump auxiliary heat
+  int heat2;      // W2, furnace second stage
+  int cool;       // Y1, air conditioner or heat pump compressor
+  int cool2;      // Y2, second compressor stage
+  int fan;        // G
+  int reversing;  // O/B, heat pump reversing valve (energized to cool)
+  boolean heat_pump;
+};
+
+enum EquipmentMode { EQUIP_OFF, EQUIP_HEAT, EQUIP_COOL };
+enum FanMode { FAN_AUTO, FAN_ON };
+
+/**
+ * @brief What the equipment has decided, kept aside while the benchmarks feed it made up readings
+ *
+ */
+struct EquipmentState {
+  EquipmentMode mode;
+  int8_t effort;
+  uint8_t stage;
+  unsigned long stage_at;
+  boolean valve_cooling;
+  boolean requested[EQUIP_RELAYS];
+  unsigned long sensor_at[EQUIP_RELAYS];
+};
+
+/**
+ * @brief The control output layer. Takes a single control effort from the thermostat
+ * (-100 full cooling to 100 full heating) and decides how many stages of the installed
+ * equipment to run. Lower, more efficient stages are started first and higher stages are
+ * only added once the current stage has had time to catch up.
+ *
+ * Every output is a governed Relay, so staging can never short cycle anything.
+ *
+ */
+class Equipment {
+  private:
+    EquipmentPins pins;
+    Relay heat1;
+    Relay heat2;
+    Relay cool1;
+    Relay cool2;
+    Relay fan;
+    Relay *all[EQUIP_RELAYS] = {&heat1, &heat2, &cool1, &cool2, &fan};
+    Relay *heat_stages[MAX_STAGES];
+    Relay *cool_stages[MAX_STAGES];
+    uint8_t heat_count = 0;
+    uint8_t cool_count = 0;
+    EquipmentMode mode = EQUIP_HEAT;
+    FanMode fan_mode = FAN_AUTO;
+    int8_t effort = 0;
+    uint8_t stage = 0;
+    unsigned long stage_at = 0;
+    boolean valve_cooling = false;
+
+    boolean wanted(Relay *relay);
+    boolean setValve(boolean cooling);
+    void apply(unsigned long now);
+
+  public:
+    Equipment(EquipmentPins equipmentPins);
+    void begin();
+    void drive(int8_t control_effort, unsigned long now);
+    void update(unsigned long now);
+    void sensorOk(unsigned long now);
+    void lock(boolean val, unsigned long now);
+    void reset(unsigned long now);
+    void getState(EquipmentState &out);
+    void setState(const EquipmentState &state, unsigned long now);
+    void setMode(EquipmentMode val, unsigned long now);
+    void setFanMode(FanMode val, unsigned long now);
+
+    EquipmentMode getMode();
+    FanMode getFanMode();
+    int8_t getEffort();
+    uint8_t getStage();
+    uint8_t getStageCount();
+    boolean getHeating();
+    boolean getCooling();
+    boolean getFanOn();
+    Relay* getStageRelay(uint8_t i);
+    Relay& getFan();
+    Relay* getRelay(uint8_t i);
+};
+
+/**
+ * @brief Construct a new Equipment:: Equipment object and work out the order of the stages.
+ * A heat pump heats with its compressor first and only falls back to the auxiliary heat.
+ *
+ * @param equipmentPins
+ */
+Equipment::Equipment(EquipmentPins equipmentPins) :
+  pins(equipmentPins),
+  // Furnace stages: 5 minutes minimum on/off, at most 3 hours continuous and 6 starts an hour
+  heat1(equipmentPins.heat, "heat", {300000, 300000, 10800000, 6}),
+  heat2(equipmentPins.heat2, "heat2", {300000, 300000, 10800000, 6}),
+  // Compressors need longer off times for the pressures to equalize and fewer starts
+  cool1(equipmentPins.cool, "cool", {300000, 300000, 14400000, 3}),
+  cool2(equipmentPins.cool2, "cool2", {300000, 300000, 14400000, 3}),
+  fan(equipmentPins.fan, "fan", {60000, 60000, ULONG_MAX, 30}){
+  Relay *heating[4];
+  uint8_t n = 0;
+  if(pins.heat_pump){
+    heating[n++] = &cool1;
+    heating[n++] = &cool2;
+  }
+  heating[n++] = &heat1;
+  heating[n++] = &heat2;
+  for(int i = 0; i < n && heat_count < MAX_STAGES; i++){
+    if(heating[i]->installed()) heat_stages[heat_count++] = heating[i];
+  }
+  if(cool1.installed()) cool_stages[cool_count++] = &cool1;
+  if(cool2.installed()) cool_stages[cool_count++] = &cool2;
+}
+
+/**
+ * @brief Starts all the relays in the off state
+ *
+ */
+void Equipment::begin(){
+  for(int i = 0; i < EQUIP_RELAYS; i++){
+    all[i]->begin();
+  }
+  if(pins.reversing != NOPIN){
+    pinMode(pins.reversing, OUTPUT);
+    digitalWrite(pins.reversing, HIGH);
+  }
+}
+
+/**
+ * @brief Whether the relay is one of the stages that should be running
+ *
+ * @param relay
+ * @return boolean
+ */
+boolean Equipment::wanted(Relay *relay){
+  Relay **stages = mode == EQUIP_COOL ? cool_stages : heat_stages;
+  for(int i = 0; i < stage; i++){
+    if(stages[i] == relay) return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Moves the reversing valve, which is only done while the compressor is stopped
+ *
+ * @param cooling
+ * @return boolean true once the valve is in the requested position
+ */
+boolean Equipment::setValve(boolean cooling){
+  if(pins.reversing == NOPIN || valve_cooling == cooling){
+    return true;
+  }
+  if(cool1.getOn() || cool2.getOn()){
+    return false;
+  }
+  digitalWrite(pins.reversing, cooling ? LOW : HIGH);
+  valve_cooling = cooling;
+  return true;
+}
+
+/**
+ * @brief Passes the wanted state of every output on to its relay governor
+ *
+ * @param now
+ */
+void Equipment::apply(unsigned long now){
+  boolean compressor = wanted(&cool1) || wanted(&cool2);
+  boolean valve_ok = !compressor || setValve(mode == EQUIP_COOL);
+  for(int i = 0; i < 4; i++){
+    boolean on = wanted(all[i]);
+    if(all[i] == &cool1 || all[i] == &cool2){
+      on = on && valve_ok;
+    }
+    all[i]->request(on, now);
+  }
+  // Furnaces run their own blower, air conditioners and heat pumps need the fan called
+  fan.request(fan_mode == FAN_ON || compressor || (pins.heat_pump && stage > 0), now);
+}
+
+/**
+ * @brief Stage the equipment for the given control effort. Positive effort is a call for heat,
+ * negative a call for cooling, only the side matching the mode is acted on.
+ *
+ * @param control_effort -100 to 100
+ * @param now
+ */
+void Equipment::drive(int8_t control_effort, unsigned long now){
+  effort = control_effort;
+  int demand = 0;
+  uint8_t count = 0;
+  if(mode == EQUIP_HEAT){
+    demand = effort;
+    count = heat_count;
+  } else if(mode == EQUIP_COOL){
+    demand = -effort;
+    count = cool_count;
+  }
+
+  if(stage == 0){
+    if(demand >= STAGE_ON && count > 0){
+      stage = 1;
+      stage_at = now;
+    }
+  } else if(demand <= STAGE_OFF){
+    stage = 0;
+    stage_at = now;
+  } else if(stage > 1 && demand < STAGE_ON){
+    stage--;
+    stage_at = now;
+  } else if(stage < count && demand >= STAGE_UP){
+    unsigned long wait = demand >= 100 ? STAGE_DELAY_FULL : STAGE_DELAY;
+    if(now - stage_at >= wait){
+      stage++;
+      stage_at = now;
+    }
+  }
+  apply(now);
+}
+
+/**
+ * @brief Lets the relay governors apply pending changes and safety cut offs
+ *
+ * @param now
+ */
+void Equipment::update(unsigned long now){
+  apply(now);
+}
+
+/**
+ * @brief Called whenever the controlling sensor gives a valid reading
+ *
+ * @param now
+ */
+void Equipment::sensorOk(unsigned long now){
+  for(int i = 0; i < EQUIP_RELAYS; i++){
+    all[i]->sensorOk(now);
+  }
+}
+
+/**
+ * @brief Hold every output off (or release them)
+ *
+ * @param val
+ * @param now
+ */
+void Equipment::lock(boolean val, unsigned long now){
+  for(int i = 0; i < EQUIP_RELAYS; i++){
+    all[i]->lock(val, now);
+  }
+}
+
+/**
+ * @brief Back to heating with no stages called for and every relay started over at now, for
+ * a trace replay. Call with everything locked off.
+ *
+ * @param now
+ */
+void Equipment::reset(unsigned long now){
+  mode = EQUIP_HEAT;
+  effort = 0;
+  stage = 0;
+  stage_at = now;
+  for(int i = 0; i < EQUIP_RELAYS; i++){
+    all[i]->reset(now);
+  }
+}
+
+/**
+ * @brief Copy out the staging and what each relay has been asked for
+ *
+ * @param out
+ */
+void Equipment::getState(EquipmentState &out){
+  out.mode = mode;
+  out.effort = effort;
+  out.stage = stage;
+  out.stage_at = stage_at;
+  out.valve_cooling = valve_cooling;
+  for(int i = 0; i < EQUIP_RELAYS; i++){
+    out.requested[i] = all[i]->getRequested();
+    out.sensor_at[i] = all[i]->getSensorAt();
+  }
+}
+
+/**
+ * @brief Put back what getState() copied out. Call with everything locked off, the relays
+ * act on it once they're released.
+ *
+ * @param state
+ * @param now
+ */
+void Equipment::setState(const EquipmentState &state, unsigned long now){
+  mode = state.mode;
+  effort = state.effort;
+  stage = state.stage;
+  stage_at = state.stage_at;
+  setValve(state.valve_cooling);
+  for(int i = 0; i < EQUIP_RELAYS; i++){
+    all[i]->sensorOk(state.sensor_at[i]);
+    all[i]->request(state.requested[i], now);
+  }
+}
+
+/**
+ * @brief Switch between heating and cooling, everything running is staged back down first
+ *
+ * @param val
+ * @param now
+ */
+void Equipment::setMode(EquipmentMode val, unsigned long now){
+  if(val == mode){
+    return;
+  }
+  mode = val;
+  stage = 0;
+  stage_at = now;
+  apply(now);
+}
+
+/**
+ * @brief Run the fan only when the equipment needs it or all the time
+ *
+ * @param val
+ * @param now
+ */
+void Equipment::setFanMode(FanMode val, unsigned long now){
+  fan_mode = val;
+  apply(now);
+}
+
+/**
+ * @brief Returns whether the equipment is heating, cooling or off
+ *
+ * @return EquipmentMode
+ */
+EquipmentMode Equipment::getMode(){
+  return mode;
+}
+
+/**
+ * @brief Returns the fan mode
+ *
+ * @return FanMode
+ */
+FanMode Equipment::getFanMode(){
+  return fan_mode;
+}
+
+/**
+ * @brief Returns the last control effort from the thermostat
+ *
+ * @return int8_t
+ */
+int8_t Equipment::getEffort(){
+  return effort;
+}
+
+/**
+ * @brief Returns the number of stages being called for
+ *
+ * @return uint8_t
+ */
+uint8_t Equipment::getStage(){
+  return stage;
+}
+
+/**
+ * @brief Returns the number of stages available in the current mode
+ *
+ * @return uint8_t
+ */
+uint8_t Equipment::getStageCount(){
+  if(mode == EQUIP_COOL) return cool_count;
+  if(mode == EQUIP_HEAT) return heat_count;
+  return 0;
+}
+
+/**
+ * @brief Returns whether any heating stage is actually running
+ *
+ * @return boolean
+ */
+boolean Equipment::getHeating(){
+  if(mode != EQUIP_HEAT) return false;
+  for(int i = 0; i < heat_count; i++){
+    if(heat_stages[i]->getOn()) return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Returns whether any cooling stage is actually running
+ *
+ * @return boolean
+ */
+boolean Equipment::getCooling(){
+  if(mode != EQUIP_COOL) return false;
+  for(int i = 0; i < cool_count; i++){
+    if(cool_stages[i]->getOn()) return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Returns whether the fan relay is on
+ *
+ * @return boolean
+ */
+boolean Equipment::getFanOn(){
+  return fan.getOn();
+}
+
+/**
+ * @brief Returns the relay for a stage in the current mode, for runtime and cycle counts
+ *
+ * @param i stage index starting at 0
+ * @return Relay* nullptr past the last stage
+ */
+Relay* Equipment::getStageRelay(uint8_t i){
+  if(i >= getStageCount()) return nullptr;
+  return mode == EQUIP_COOL ? cool_stages[i] : heat_stages[i];
+}
+
+/**
+ * @brief Returns the fan relay
+ *
+ * @return Relay&
+ */
+Relay& Equipment::getFan(){
+  return fan;
+}
+
+/**
+ * @brief Returns any of the relays, installed or not, for reporting
+ *
+ * @param i 0 to EQUIP_RELAYS - 1
+ * @return Relay* nullptr past the last
+ */
+Relay* Equipment::getRelay(uint8_t i){
+  if(i >= EQUIP_RELAYS) return nullptr;
+  return all[i];
+}
+
+#endif
@@ -0,0 +1,254 @@
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include <Preferences.h>
+#include "esp_system.h"
+#include "Temperature.h"
+
+#define LOG_SIZE 128               // Entries kept, must be a power of two
+#define LOG_MAGIC 0x4C4F4731
+#define LOG_SPILL_GAP 600000       // Write the log to flash at most every 10 minutes
+#define LOG_LINE 64                // Longest decoded line
+
+enum LogType : uint8_t {
+  LOG_BOOT,       // a: reset reason
+  LOG_RELAY,      // a: pin, b: on
+  LOG_SCHEDULE,   // a: day, b: slot, c: heating target
+  LOG_HOLD,       // a: hold type, b: hold temperature
+  LOG_WIFI,       // a: connected, b: rssi
+  LOG_NTP,        // clock synced
+  LOG_TOUCH,      // a: screen, b: x, c: y
+  LOG_SENSOR,     // a: sensor, b: failing
+  LOG_FAULT,      // a: fault code, b: detail
+  LOG_UPDATE      // a: update stage, b: KB written
+};
+
+enum LogSensor : uint8_t { SENSOR_TEMP, SENSOR_HUMD };
+enum LogFault : uint8_t { FAULT_FAILSAFE, FAULT_OVERRUN, FAULT_CRASH };
+
+/**
+ * @brief One binary log entry, 12 bytes
+ *
+ */
+struct LogEntry {
+  uint32_t ms;
+  uint16_t seq;
+  LogType type;
+  uint8_t a;
+  int16_t b;
+  int16_t c;
+};
+
+/**
+ * @brief The ring lives in RTC memory that isn't cleared on a reset, so after a crash or
+ * watchdog reset the events leading up to it are still there to be saved.
+ *
+ */
+struct LogRing {
+  uint32_t magic;
+  uint32_t seq;
+  LogEntry entries[LOG_SIZE];
+};
+RTC_NOINIT_ATTR LogRing log_ring;
+
+/**
+ * @brief Structured event log. Logging an event is a short critical section and a 12 byte
+ * copy into the ring, so it can be called from any task. Nothing is formatted until the log
+ * is dumped. Faults copy the ring to flash so it survives a power cycle.
+ *
+ */
+class EventLog {
+  private:
+    portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+    Preferences prefs;
+    LogRing copy;
+    unsigned long spilled_at = 0;
+    boolean spilled = false;
+    boolean paused = false;
+    void snapshot(LogRing &out);
+
+  public:
+    void begin();
+    void add(LogType type, uint8_t a, int16_t b, int16_t c);
+    void fault(LogFault code, int16_t detail);
+    void pause(boolean val);
+    void spill();
+    size_t format(char *buf, size_t size, const LogEntry &e);
+    void dump(Print &out, boolean saved);
+};
+
+EventLog event_log;
+
+/**
+ * @brief Log an event, short for event_log.add()
+ *
+ * @param type
+ * @param a
+ * @param b
+ * @param c
+ */
+void logEvent(LogType type, uint8_t a = 0, int16_t b = 0, int16_t c = 0){
+  event_log.add(type, a, b, c);
+}
+
+/**
+ * @brief Keeps the log from before a reset. After a crash it is saved to flash straight away,
+ * after a power cycle the RTC memory is garbage and the log starts over.
+ *
+ */
+void EventLog::begin(){
+  prefs.begin("log", false);
+  esp_reset_reason_t reason = esp_reset_reason();
+  if(log_ring.magic != LOG_MAGIC || reason == ESP_RST_POWERON || reason == ESP_RST_BROWNOUT){
+    memset(&log_ring, 0, sizeof(log_ring));
+    log_ring.magic = LOG_MAGIC;
+  }
+  boolean crashed = reason == ESP_RST_PANIC || reason == ESP_RST_INT_WDT ||
+    reason == ESP_RST_TASK_WDT || reason == ESP_RST_WDT;
+  add(LOG_BOOT, reason, 0, 0);
+  if(crashed){
+    fault(FAULT_CRASH, reason);
+  }
+}
+
+/**
+ * @brief Add an event to the ring, overwriting the oldest
+ *
+ * @param type
+ * @param a
+ * @param b
+ * @param c
+ */
+void EventLog::add(LogType type, uint8_t a, int16_t b, int16_t c){
+  if(paused){
+    return;
+  }
+  portENTER_CRITICAL(&mux);
+  uint32_t s = log_ring.seq++;
+  log_ring.entries[s & (LOG_SIZE - 1)] = {millis(), (uint16_t)s, type, a, b, c};
+  portEXIT_CRITICAL(&mux);
+}
+
+/**
+ * @brief Log a fault and save the log to flash, at most every LOG_SPILL_GAP
+ *
+ * @param code
+ * @param detail
+ */
+void EventLog::fault(LogFault code, int16_t detail){
+  if(paused){
+    return;
+  }
+  add(LOG_FAULT, code, detail, 0);
+  if(!spilled || millis() - spilled_at >= LOG_SPILL_GAP){
+    spill();
+  }
+}
+
+/**
+ * @brief Stop logging for a while, i.e. so a benchmark doesn't push the real events out or a
+ * trace replay doesn't log (and save) relay switches that never happened
+ *
+ * @param val
+ */
+void EventLog::pause(boolean val){
+  paused = val;
+}
+
+/**
+ * @brief Consistent copy of the ring
+ *
+ * @param out
+ */
+void EventLog::snapshot(LogRing &out){
+  portENTER_CRITICAL(&mux);
+  memcpy(&out, &log_ring, sizeof(LogRing));
+  portEXIT_CRITICAL(&mux);
+}
+
+/**
+ * @brief Write the ring to flash, replacing the last one saved
+ *
+ */
+void EventLog::spill(){
+  snapshot(copy);
+  prefs.putBytes("spill", &copy, sizeof(copy));
+  spilled_at = millis();
+  spilled = true;
+}
+
+/**
+ * @brief Decode an entry into a line of text
+ *
+ * @param buf
+ * @param size
+ * @param e
+ * @return size_t characters written
+ */
+size_t EventLog::format(char *buf, size_t size, const LogEntry &e){
+  const char *holds[4] = {"off", "next slot", "timed", "permanent"};
+  const char *faults[3] = {"relay failsafe", "relay max runtime", "crash"};
+  const char *updates[5] = {"started", "written", "failed", "kept", "rolled back"};
+  char temp_buf[8];
+  int n = snprintf(buf, size, "%5u %7lu.%03lu ", e.seq, (unsigned long)(e.ms / 1000), (unsigned long)(e.ms % 1000));
+  switch(e.type){
+    case LOG_BOOT:
+      n += snprintf(buf + n, size - n, "boot, reset reason %u", e.a);
+      break;
+    case LOG_RELAY:
+      n += snprintf(buf + n, size - n, "relay pin %u %s", e.a, e.b ? "on" : "off");
+      break;
+    case LOG_SCHEDULE:
+      n += snprintf(buf + n, size - n, "schedule day %u slot %d heat %s", e.a, e.b, formatDeci(temp_buf, e.c));
+      break;
+    case LOG_HOLD:
+      n += snprintf(buf + n, size - n, "hold %s at %s", e.a < 4 ? holds[e.a] : "?", formatDeci(temp_buf, e.b));
+      break;
+    case LOG_WIFI:
+      n += snprintf(buf + n, size - n, "wifi %s rssi %d", e.a ? "connected" : "disconnected", e.b);
+      break;
+    case LOG_NTP:
+      n += snprintf(buf + n, size - n, "clock synced");
+      break;
+    case LOG_TOUCH:
+      n += snprintf(buf + n, size - n, "touch screen %u at %d,%d", e.a, e.b, e.c);
+      break;
+    case LOG_SENSOR:
+      n += snprintf(buf + n, size - n, "%s sensor %s", e.a == SENSOR_TEMP ? "temperature" : "humidity", e.b ? "failing" : "ok");
+      break;
+    case LOG_FAULT:
+      n += snprintf(buf + n, size - n, "fault: %s (%d)", e.a < 3 ? faults[e.a] : "?", e.b);
+      break;
+    case LOG_UPDATE:
+      n += snprintf(buf + n, size - n, "firmware update %s (%d KB)", e.a < 5 ? updates[e.a] : "?", e.b);
+      break;
+    default:
+      n += snprintf(buf + n, size - n, "unknown %u %u %d %d", e.type, e.a, e.b, e.c);
+  }
+  return min((size_t)n, size - 1);
+}
+
+/**
+ * @brief Print the log oldest first, one decoded line per event
+ *
+ * @param out Serial, or anything else that prints
+ * @param saved the copy saved in flash by the last fault instead of the live log
+ */
+void EventLog::dump(Print &out, boolean saved){
+  char line[LOG_LINE];
+  if(saved){
+    if(prefs.getBytes("spill", &copy, sizeof(copy)) != sizeof(copy) || copy.magic != LOG_MAGIC){
+      out.println("No saved log");
+      return;
+    }
+  } else {
+    snapshot(copy);
+  }
+  uint32_t count = min(copy.seq, (uint32_t)LOG_SIZE);
+  for(uint32_t s = copy.seq - count; s != copy.seq; s++){
+    format(line, sizeof(line), copy.entries[s & (LOG_SIZE - 1)]);
+    out.println(line);
+  }
+}
+
+#endif
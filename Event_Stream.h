@@ -0,0 +1,163 @@
+#ifndef EVENT_STREAM_H
+#define EVENT_STREAM_H
+
+#include <WiFi.h>
+#include <WebServer.h>
+#include <lwip/sockets.h>
+
+#define STREAM_CLIENTS 6           // Browsers watching at once, each holds one lwIP socket
+#define STREAM_EVENT 320           // Longest event data
+#define STREAM_HEARTBEAT 15000     // Comment sent when quiet so dead clients are found
+
+/**
+ * @brief Server-sent events to a fixed set of browsers. Each event is formatted once into
+ * one buffer and the same bytes are written to every client without waiting, so another
+ * browser costs one socket and one send(). A client that can't take an event whole (gone,
+ * or too far behind) is dropped and its EventSource reconnects.
+ *
+ */
+class EventStream {
+  private:
+    WiFiClient clients[STREAM_CLIENTS];
+    char buf[STREAM_EVENT + 32];
+    char last[STREAM_EVENT];       // Last state, sent to each new client straight away
+    unsigned long sent_at = 0;
+    boolean write(WiFiClient &client, const char *data, size_t len);
+    void broadcast(const char *data, size_t len);
+    size_t format(const char *event, const char *data);
+
+  public:
+    boolean add(WiFiClient &client);
+    void publish(const char *event, const char *data, unsigned long now);
+    void heartbeat(unsigned long now);
+    uint8_t getCount();
+};
+
+/**
+ * @brief The web server, able to let go of the connection it is handling. Once the event
+ * stream has taken a connection over the server would otherwise wait up to HTTP_MAX_CLOSE_WAIT
+ * for the browser to close it before taking another request.
+ *
+ */
+class StreamServer : public WebServer {
+  public:
+    StreamServer(int port) : WebServer(port) {}
+    void release();
+};
+
+/**
+ * @brief Drop the server's copy of the current connection, the socket stays open for the
+ * event stream's copy and the server goes straight on to the next request
+ *
+ */
+void StreamServer::release(){
+  _currentClient = WiFiClient();
+}
+
+/**
+ * @brief Send without blocking, only whole events count as sent
+ *
+ * @param client
+ * @param data
+ * @param len
+ * @return boolean false if the client should be dropped
+ */
+boolean EventStream::write(WiFiClient &client, const char *data, size_t len){
+  int fd = client.fd();
+  if(fd < 0){
+    return false;
+  }
+  return send(fd, data, len, MSG_DONTWAIT) == (int)len;
+}
+
+/**
+ * @brief Format an event into the shared buffer
+ *
+ * @param event
+ * @param data a single line, i.e. JSON
+ * @return size_t
+ */
+size_t EventStream::format(const char *event, const char *data){
+  int n = snprintf(buf, sizeof(buf), "event: %s\ndata: %s\n\n", event, data);
+  return min((size_t)n, sizeof(buf) - 1);
+}
+
+/**
+ * @brief Write the same bytes to every client, dropping any that can't keep up
+ *
+ * @param data
+ * @param len
+ */
+void EventStream::broadcast(const char *data, size_t len){
+  for(int i = 0; i < STREAM_CLIENTS; i++){
+    if(!clients[i].connected()) continue;
+    if(!write(clients[i], data, len)){
+      clients[i].stop();
+    }
+  }
+}
+
+/**
+ * @brief Take over the connection of a GET /events request. Call from the handler, the
+ * response headers are written here rather than through the web server.
+ *
+ * @param client
+ * @return boolean false if every slot is taken
+ */
+boolean EventStream::add(WiFiClient &client){
+  for(int i = 0; i < STREAM_CLIENTS; i++){
+    if(clients[i].connected()) continue;
+    clients[i] = client;
+    clients[i].print("HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\n"
+      "Cache-Control: no-cache\r\nConnection: keep-alive\r\n\r\nretry: 5000\n\n");
+    if(last[0]){
+      size_t len = format("state", last);
+      write(clients[i], buf, len);
+    }
+    return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Send an event to every client. A state event that hasn't changed since the
+ * last one isn't sent again.
+ *
+ * @param event name the page listens for
+ * @param data
+ * @param now
+ */
+void EventStream::publish(const char *event, const char *data, unsigned long now){
+  if(strcmp(event, "state") == 0){
+    if(strcmp(last, data) == 0) return;
+    strncpy(last, data, sizeof(last) - 1);
+  }
+  broadcast(buf, format(event, data));
+  sent_at = now;
+}
+
+/**
+ * @brief Keep idle connections alive and find the ones that have gone
+ *
+ * @param now
+ */
+void EventStream::heartbeat(unsigned long now){
+  if(now - sent_at < STREAM_HEARTBEAT) return;
+  broadcast(":\n\n", 3);
+  sent_at = now;
+}
+
+/**
+ * @brief Number of browsers connected
+ *
+ * @return uint8_t
+ */
+uint8_t EventStream::getCount(){
+  uint8_t n = 0;
+  for(int i = 0; i < STREAM_CLIENTS; i++){
+    if(clients[i].connected()) n++;
+  }
+  return n;
+}
+
+#endif
@@ -0,0 +1,148 @@
+#ifndef EVENTS_H
+#define EVENTS_H
+
+#include <limits.h>
+
+#define MAX_EVENTS 8
+
+typedef void (*EventCallback)(void *ctx);
+
+/**
+ * @brief One shot timers kept in a small fixed queue ordered by due time. Checking for due
+ * events only looks at the front of the queue, so things that happen at a known time (a hold
+ * running out) don't need checking every loop. Times are millis() and wrap safely.
+ *
+ * Each event has an id picked by its owner, scheduling an id again replaces the pending one.
+ *
+ */
+class Events {
+  private:
+    struct Event {
+      unsigned long due;
+      EventCallback fn;
+      void *ctx;
+      uint8_t id;
+    };
+    Event queue[MAX_EVENTS];
+    uint8_t count = 0;
+
+  public:
+    boolean at(uint8_t id, unsigned long delay, EventCallback fn, void *ctx, unsigned long now);
+    boolean cancel(uint8_t id);
+    boolean pending(uint8_t id);
+    unsigned long remaining(uint8_t id, unsigned long now);
+    unsigned long untilNext(unsigned long now);
+    void run(unsigned long now);
+    void clear();
+};
+
+/**
+ * @brief Schedule fn to run once delay ms from now
+ *
+ * @param id
+ * @param delay
+ * @param fn
+ * @param ctx passed to fn
+ * @param now
+ * @return boolean false if the queue is full
+ */
+boolean Events::at(uint8_t id, unsigned long delay, EventCallback fn, void *ctx, unsigned long now){
+  cancel(id);
+  if(count >= MAX_EVENTS){
+    return false;
+  }
+  unsigned long due = now + delay;
+  int i = count;
+  while(i > 0 && (long)(queue[i - 1].due - due) > 0){
+    queue[i] = queue[i - 1];
+    i--;
+  }
+  queue[i] = {due, fn, ctx, id};
+  count++;
+  return true;
+}
+
+/**
+ * @brief Drop a pending event
+ *
+ * @param id
+ * @return boolean false if there wasn't one
+ */
+boolean Events::cancel(uint8_t id){
+  for(int i = 0; i < count; i++){
+    if(queue[i].id != id) continue;
+    for(int k = i; k < count - 1; k++){
+      queue[k] = queue[k + 1];
+    }
+    count--;
+    return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Whether an event is waiting to run
+ *
+ * @param id
+ * @return boolean
+ */
+boolean Events::pending(uint8_t id){
+  for(int i = 0; i < count; i++){
+    if(queue[i].id == id) return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Milliseconds until an event runs
+ *
+ * @param id
+ * @param now
+ * @return unsigned long 0 if it isn't pending
+ */
+unsigned long Events::remaining(uint8_t id, unsigned long now){
+  for(int i = 0; i < count; i++){
+    if(queue[i].id == id) return max(0L, (long)(queue[i].due - now));
+  }
+  return 0;
+}
+
+/**
+ * @brief Milliseconds until the next event of any kind
+ *
+ * @param now
+ * @return unsigned long ULONG_MAX when nothing is scheduled
+ */
+unsigned long Events::untilNext(unsigned long now){
+  if(count == 0){
+    return ULONG_MAX;
+  }
+  return max(0L, (long)(queue[0].due - now));
+}
+
+/**
+ * @brief Run everything that is due. Each event is taken off the queue before it runs so
+ * it can schedule itself again.
+ *
+ * @param now
+ */
+void Events::run(unsigned long now){
+  while(count > 0 && (long)(queue[0].due - now) <= 0){
+    Event e = queue[0];
+    for(int k = 0; k < count - 1; k++){
+      queue[k] = queue[k + 1];
+    }
+    count--;
+    e.fn(e.ctx);
+  }
+}
+
+/**
+ * @brief Drop everything pending, i.e. timers on the real clock before a trace replay
+ *
+ */
+void Events::clear(){
+  count = 0;
+}
+
+#endif
@@ -0,0 +1,246 @@
+#ifndef EXCEPTIONS_H
+#define EXCEPTIONS_H
+
+#include <Preferences.h>
+#include "time.h"
+#include "Temperature.h"
+#include "Schedule.h"
+#include "Trace.h"
+
+#define MAX_EXCEPTIONS 16
+#define NO_DAY -1          // Day override that holds fixed targets instead of running another weekday
+
+enum ExceptionKind : uint8_t { EXC_VACATION, EXC_DAY };
+
+/**
+ * @brief A dated break from the weekly schedule. Times are epoch seconds, start inclusive and
+ * end exclusive. A vacation holds fixed targets, a day override either holds fixed targets or
+ * runs the slots of another weekday (i.e. a holiday Monday run as a Sunday).
+ *
+ */
+struct ScheduleException {
+  uint32_t start;
+  uint32_t end;
+  ExceptionKind kind;
+  int8_t day;
+  deci_celsius heat;
+  deci_celsius cool;
+};
+
+/**
+ * @brief Parse a local date "2026-12-24" into the epoch seconds of its midnight
+ *
+ * @param str
+ * @param out
+ * @return boolean false if it isn't a date
+ */
+boolean parseDate(const char *str, uint32_t &out){
+  struct tm t = {};
+  if(sscanf(str, "%d-%d-%d", &t.tm_year, &t.tm_mon, &t.tm_mday) != 3){
+    return false;
+  }
+  if(t.tm_mon < 1 || t.tm_mon > 12 || t.tm_mday < 1 || t.tm_mday > 31){
+    return false;
+  }
+  t.tm_year -= 1900;
+  t.tm_mon -= 1;
+  t.tm_isdst = -1;
+  time_t epoch = mktime(&t);
+  if(epoch <= 0){
+    return false;
+  }
+  out = epoch;
+  return true;
+}
+
+/**
+ * @brief Holds the dated exceptions and answers which one applies right now.
+ * When several overlap a day override beats a vacation, and between two of the same kind
+ * the one that started last wins.
+ *
+ * The answer is cached along with the window of time it stays true for, the nearest start or
+ * end of any exception. Lookups inside that window are a compare, the table is only scanned
+ * again when a boundary is crossed, so the cost doesn't grow with the number stored.
+ *
+ */
+class Exceptions {
+  private:
+    ScheduleException entries[MAX_EXCEPTIONS];
+    uint8_t count = 0;
+    Preferences *prefs = nullptr;
+    int8_t cached = -1;
+    uint32_t cached_from = 1;
+    uint32_t cached_until = 0;
+
+    boolean beats(const ScheduleException &a, const ScheduleException &b);
+    void resolve(uint32_t now);
+    void prune(uint32_t now);
+    void save();
+
+  public:
+    void begin(Preferences &preferences);
+    int8_t lookup(uint32_t now);
+    const ScheduleException* get(int8_t i);
+    uint8_t getCount();
+    boolean add(const ScheduleException &e, uint32_t now);
+    boolean remove(uint8_t i);
+};
+
+/**
+ * @brief Load the exceptions saved in preferences
+ *
+ * @param preferences
+ */
+void Exceptions::begin(Preferences &preferences){
+  prefs = &preferences;
+  size_t len = prefs->getBytesLength("Except");
+  if(len % sizeof(ScheduleException) == 0 && len <= sizeof(entries)){
+    count = prefs->getBytes("Except", entries, len) / sizeof(ScheduleException);
+  }
+  cached_from = 1;
+  cached_until = 0;
+}
+
+/**
+ * @brief Whether exception a takes precedence over b
+ *
+ * @param a
+ * @param b
+ * @return boolean
+ */
+boolean Exceptions::beats(const ScheduleException &a, const ScheduleException &b){
+  if(a.kind != b.kind){
+    return a.kind > b.kind;
+  }
+  return a.start > b.start;
+}
+
+/**
+ * @brief Scan the table for the exception in effect and how long that stays the answer
+ *
+ * @param now
+ */
+void Exceptions::resolve(uint32_t now){
+  cached = -1;
+  cached_from = 0;
+  cached_until = UINT32_MAX;
+  for(int i = 0; i < count; i++){
+    const ScheduleException &e = entries[i];
+    if(e.start <= now && now < e.end){
+      if(cached < 0 || beats(e, entries[cached])) cached = i;
+      cached_from = max(cached_from, e.start);
+      cached_until = min(cached_until, e.end);
+    } else if(e.start > now){
+      cached_until = min(cached_until, e.start);
+    } else {
+      cached_from = max(cached_from, e.end);
+    }
+  }
+}
+
+/**
+ * @brief Returns the index of the exception in effect at the given time
+ *
+ * @param now epoch seconds
+ * @return int8_t -1 when the weekly schedule applies
+ */
+int8_t Exceptions::lookup(uint32_t now){
+  if(now < cached_from || now >= cached_until){
+    resolve(now);
+  }
+  return cached;
+}
+
+/**
+ * @brief Returns an exception by index
+ *
+ * @param i
+ * @return const ScheduleException* nullptr when out of range
+ */
+const ScheduleException* Exceptions::get(int8_t i){
+  if(i < 0 || i >= count) return nullptr;
+  return &entries[i];
+}
+
+/**
+ * @brief Returns the number of stored exceptions
+ *
+ * @return uint8_t
+ */
+uint8_t Exceptions::getCount(){
+  return count;
+}
+
+/**
+ * @brief Drop exceptions that are over
+ *
+ * @param now
+ */
+void Exceptions::prune(uint32_t now){
+  uint8_t n = 0;
+  for(int i = 0; i < count; i++){
+    if(entries[i].end > now) entries[n++] = entries[i];
+  }
+  count = n;
+}
+
+/**
+ * @brief Write the table to preferences as one entry, not during a trace replay
+ *
+ */
+void Exceptions::save(){
+  if(!prefs || traceReplaying()) return;
+  if(count == 0){
+    prefs->remove("Except");
+  } else {
+    prefs->putBytes("Except", entries, count * sizeof(ScheduleException));
+  }
+}
+
+/**
+ * @brief Store a new exception, anything already over is cleared out to make room
+ *
+ * @param e
+ * @param now
+ * @return boolean false if the exception is invalid or the table is full
+ */
+boolean Exceptions::add(const ScheduleException &e, uint32_t now){
+  if(e.end <= e.start || e.end <= now || e.day < NO_DAY || e.day > 6){
+    return false;
+  }
+  // Held to the same targets as a schedule slot
+  if(e.day == NO_DAY && (e.heat < MIN_TARGET || e.cool > MAX_TARGET || e.cool - e.heat < DEADBAND)){
+    return false;
+  }
+  prune(now);
+  if(count >= MAX_EXCEPTIONS){
+    return false;
+  }
+  entries[count++] = e;
+  cached_from = 1;
+  cached_until = 0;
+  save();
+  return true;
+}
+
+/**
+ * @brief Delete an exception by index
+ *
+ * @param i
+ * @return boolean
+ */
+boolean Exceptions::remove(uint8_t i){
+  if(i >= count){
+    return false;
+  }
+  for(int k = i; k < count - 1; k++){
+    entries[k] = entries[k + 1];
+  }
+  count--;
+  cached_from = 1;
+  cached_until = 0;
+  save();
+  return true;
+}
+
+#endif
@@ -0,0 +1,291 @@
+#ifndef FIRMWARE_H
+#define FIRMWARE_H
+
+#include <Update.h>
+#include <HTTPClient.h>
+#include "esp_ota_ops.h"
+#include "mbedtls/sha256.h"
+#include "Event_Log.h"
+
+#define FW_CHUNK 1024              // Bytes read off the network at a time
+#define FW_READ_TIMEOUT 10000      // Give up on a download that stalls this long
+#define FW_HEALTHY_PASSES 4        // Control loop passes a new image needs before it is kept (2 minutes)
+#define FW_HEALTH_DEADLINE 600000  // and it has to get there within 10 minutes of boot
+#define EVENT_RESTART 2
+
+enum FirmwareStatus : uint8_t { FW_IDLE, FW_WRITING, FW_READY, FW_FAILED };
+enum LogUpdate : uint8_t { UPDATE_START, UPDATE_DONE, UPDATE_FAILED, UPDATE_VALID, UPDATE_ROLLBACK };
+
+/**
+ * @brief Keeps the Arduino core from marking a new image good as soon as it boots, Firmware
+ * does it once the control loop is running
+ *
+ */
+extern "C" bool verifyRollbackLater(){
+  return true;
+}
+
+/**
+ * @brief Over the air updates into the inactive app partition. The image is hashed and
+ * written a chunk at a time as it arrives, so it is never held in RAM, and it only becomes
+ * the boot partition if the SHA-256 matches and the image checks out.
+ *
+ * After an update the new image boots on probation. It has to make FW_HEALTHY_PASSES passes
+ * of the control loop with a good reading to be kept, if it crashes first the bootloader
+ * goes back to the old image and if it hangs or never gets a reading it rolls itself back
+ * at FW_HEALTH_DEADLINE.
+ *
+ */
+class Firmware {
+  private:
+    mbedtls_sha256_context sha;
+    uint8_t expected[32];
+    uint8_t chunk[FW_CHUNK];
+    FirmwareStatus status = FW_IDLE;
+    const char *error = nullptr;
+    size_t written = 0;
+    boolean pending = false;
+    uint8_t passes = 0;
+    boolean fail(const char *why);
+
+  public:
+    void begin();
+    boolean start(const char *sha256);
+    boolean write(const uint8_t *buf, size_t len);
+    boolean finish();
+    void abort();
+    boolean download(const char *url, const char *sha256);
+    void healthy();
+    void check(unsigned long now);
+    FirmwareStatus getStatus();
+    const char* getError();
+    size_t getWritten();
+    boolean getPending();
+};
+
+/**
+ * @brief Find out whether this image is on probation after an update
+ *
+ */
+void Firmware::begin(){
+  esp_ota_img_states_t state;
+  if(esp_ota_get_state_partition(esp_ota_get_running_partition(), &state) == ESP_OK){
+    pending = state == ESP_OTA_IMG_PENDING_VERIFY;
+  }
+}
+
+/**
+ * @brief Record why an update failed and throw away what was written
+ *
+ * @param why
+ * @return boolean always false
+ */
+boolean Firmware::fail(const char *why){
+  if(status == FW_WRITING){
+    Update.abort();
+    mbedtls_sha256_free(&sha);
+  }
+  error = why;
+  status = FW_FAILED;
+  logEvent(LOG_UPDATE, UPDATE_FAILED, written / 1024);
+  return false;
+}
+
+/**
+ * @brief Start writing a new image to the inactive partition
+ *
+ * @param sha256 hash of the image as 64 hex digits
+ * @return boolean
+ */
+boolean Firmware::start(const char *sha256){
+  if(status == FW_WRITING){
+    abort();
+  }
+  written = 0;
+  error = nullptr;
+  if(strlen(sha256) != 64){
+    return fail("sha256 must be 64 hex digits");
+  }
+  for(int i = 0; i < 32; i++){
+    char hex[3] = {sha256[i * 2], sha256[(i * 2) + 1], '\0'};
+    char *end;
+    expected[i] = strtoul(hex, &end, 16);
+    if(*end){
+      return fail("sha256 must be 64 hex digits");
+    }
+  }
+  if(!Update.begin(UPDATE_SIZE_UNKNOWN, U_FLASH)){
+    return fail("no partition to update");
+  }
+  mbedtls_sha256_init(&sha);
+  mbedtls_sha256_starts(&sha, 0);
+  status = FW_WRITING;
+  logEvent(LOG_UPDATE, UPDATE_START);
+  return true;
+}
+
+/**
+ * @brief Hash and write the next piece of the image
+ *
+ * @param buf
+ * @param len
+ * @return boolean
+ */
+boolean Firmware::write(const uint8_t *buf, size_t len){
+  if(status != FW_WRITING){
+    return false;
+  }
+  mbedtls_sha256_update(&sha, buf, len);
+  if(Update.write((uint8_t*)buf, len) != len){
+    return fail("flash write failed");
+  }
+  written += len;
+  return true;
+}
+
+/**
+ * @brief Check the hash and make the new image the one that boots next
+ *
+ * @return boolean
+ */
+boolean Firmware::finish(){
+  uint8_t actual[32];
+  if(status != FW_WRITING){
+    return false;
+  }
+  mbedtls_sha256_finish(&sha, actual);
+  if(memcmp(actual, expected, sizeof(actual)) != 0){
+    return fail("sha256 mismatch");
+  }
+  mbedtls_sha256_free(&sha);
+  status = FW_IDLE;
+  // The size wasn't known up front so finish wherever the image ended, the image headers
+  // and checksum are checked before the boot partition is switched
+  if(!Update.end(true)){
+    return fail("image rejected");
+  }
+  status = FW_READY;
+  logEvent(LOG_UPDATE, UPDATE_DONE, written / 1024);
+  return true;
+}
+
+/**
+ * @brief Give up on an update part way through
+ *
+ */
+void Firmware::abort(){
+  if(status == FW_WRITING){
+    fail("aborted");
+  }
+}
+
+/**
+ * @brief Fetch an image over HTTP and write it as it arrives
+ *
+ * @param url i.e. http://192.168.1.10:8000/Smart_Thermostat.ino.bin
+ * @param sha256
+ * @return boolean
+ */
+boolean Firmware::download(const char *url, const char *sha256){
+  HTTPClient http;
+  if(!start(sha256)){
+    return false;
+  }
+  http.begin(url);
+  if(http.GET() != HTTP_CODE_OK){
+    http.end();
+    return fail("download failed");
+  }
+  int remaining = http.getSize();
+  WiFiClient *stream = http.getStreamPtr();
+  unsigned long read_at = millis();
+  while(remaining != 0 && (http.connected() || stream->available())){
+    size_t avail = stream->available();
+    if(!avail){
+      if(millis() - read_at >= FW_READ_TIMEOUT){
+        http.end();
+        return fail("download stalled");
+      }
+      delay(1);
+      continue;
+    }
+    size_t n = stream->readBytes(chunk, min(avail, sizeof(chunk)));
+    if(!write(chunk, n)){
+      http.end();
+      return false;
+    }
+    if(remaining > 0) remaining -= n;
+    read_at = millis();
+  }
+  http.end();
+  if(remaining > 0){
+    return fail("download cut short");
+  }
+  return finish();
+}
+
+/**
+ * @brief Call after each pass of the control loop with a good sensor reading. Once a new
+ * image has made enough passes it is kept.
+ *
+ */
+void Firmware::healthy(){
+  if(!pending || ++passes < FW_HEALTHY_PASSES){
+    return;
+  }
+  esp_ota_mark_app_valid_cancel_rollback();
+  pending = false;
+  logEvent(LOG_UPDATE, UPDATE_VALID);
+}
+
+/**
+ * @brief Roll back to the previous image if this one is still on probation too long after boot
+ *
+ * @param now
+ */
+void Firmware::check(unsigned long now){
+  if(!pending || now < FW_HEALTH_DEADLINE){
+    return;
+  }
+  logEvent(LOG_UPDATE, UPDATE_ROLLBACK, passes);
+  event_log.spill();
+  esp_ota_mark_app_invalid_rollback_and_reboot();
+}
+
+/**
+ * @brief Returns where the current or last update got to
+ *
+ * @return FirmwareStatus
+ */
+FirmwareStatus Firmware::getStatus(){
+  return status;
+}
+
+/**
+ * @brief Returns why the last update failed
+ *
+ * @return const char* nullptr if it didn't
+ */
+const char* Firmware::getError(){
+  return error;
+}
+
+/**
+ * @brief Returns the bytes of the image written so far
+ *
+ * @return size_t
+ */
+size_t Firmware::getWritten(){
+  return written;
+}
+
+/**
+ * @brief Whether this image is waiting to prove itself after an update
+ *
+ * @return boolean
+ */
+boolean Firmware::getPending(){
+  return pending;
+}
+
+#endif
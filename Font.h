@@ -0,0 +1,243 @@
+#ifndef FONT_H
+#define FONT_H
+
+#include <TFT_eSPI.h>
+#include "Font_Atlas.h"
+
+#define ATLAS_GLYPHS 95 // Printable ASCII, 0x20 - 0x7E
+
+/**
+ * @brief Draws anti-aliased text from the pre-rasterized atlas in Font_Atlas.h straight into
+ * the buffer of a 16 bit sprite. Glyph metrics are cached in RAM on begin() so measuring and
+ * drawing a string never has to walk the tables in flash.
+ *
+ */
+class Font {
+  private:
+    const AtlasFont *atlas;
+    AtlasGlyph glyphs[ATLAS_GLYPHS];
+    uint8_t first;
+    uint8_t last;
+    uint8_t ascent;
+    uint8_t descent;
+    uint16_t lut[16]; // Colour of each alpha level, byte swapped to match the sprite buffer
+
+    const AtlasGlyph* glyph(char c);
+    boolean isNumeric(const char *str);
+    void blit(uint16_t *buf, int w, int h, const AtlasGlyph *g, int x, int y);
+    void blitFast(uint16_t *buf, int w, const AtlasGlyph *g, int x, int y);
+
+  public:
+    void begin(const AtlasFont *font, uint16_t fg, uint16_t bg);
+    void setColour(uint16_t fg, uint16_t bg);
+    int textWidth(const char *str);
+    int height();
+    void drawString(TFT_eSprite &img, const char *str, int x, int y, uint8_t datum);
+    void drawString(TFT_eSprite &img, const String &str, int x, int y, uint8_t datum);
+};
+
+/**
+ * @brief Caches the glyph metrics of the atlas font and sets the text colour
+ *
+ * @param font one of the fonts from Font_Atlas.h
+ * @param fg text colour
+ * @param bg colour that the text is blended against
+ */
+void Font::begin(const AtlasFont *font, uint16_t fg, uint16_t bg){
+  atlas = font;
+  first = pgm_read_byte(&font->first);
+  last = pgm_read_byte(&font->last);
+  ascent = pgm_read_byte(&font->ascent);
+  descent = pgm_read_byte(&font->descent);
+  memcpy_P(glyphs, font->glyphs, sizeof(AtlasGlyph) * ATLAS_GLYPHS);
+  setColour(fg, bg);
+}
+
+/**
+ * @brief Builds the 16 step blend between the background and text colour, anti-aliased edges
+ * are then a single lookup per pixel
+ *
+ * @param fg
+ * @param bg
+ */
+void Font::setColour(uint16_t fg, uint16_t bg){
+  for(int a = 0; a < 16; a++){
+    uint16_t r = (((fg >> 11) & 0x1F) * a + ((bg >> 11) & 0x1F) * (15 - a)) / 15;
+    uint16_t g = (((fg >> 5) & 0x3F) * a + ((bg >> 5) & 0x3F) * (15 - a)) / 15;
+    uint16_t b = ((fg & 0x1F) * a + (bg & 0x1F) * (15 - a)) / 15;
+    uint16_t colour = (r << 11) | (g << 5) | b;
+    lut[a] = (colour >> 8) | (colour << 8);
+  }
+}
+
+/**
+ * @brief Returns the cached metrics for a character, anything outside the atlas is drawn as a space
+ *
+ * @param c
+ * @return const AtlasGlyph*
+ */
+const AtlasGlyph* Font::glyph(char c){
+  if(c < first || c > last){
+    c = ' ';
+  }
+  return &glyphs[c - first];
+}
+
+/**
+ * @brief Temperatures and humidity make up most of what gets drawn, these only use the
+ * characters below
+ *
+ * @param str
+ * @return boolean
+ */
+boolean Font::isNumeric(const char *str){
+  for(; *str; str++){
+    if(!strchr("0123456789.-% c", *str)){
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Width in pixels of the string
+ *
+ * @param str
+ * @return int
+ */
+int Font::textWidth(const char *str){
+  int w = 0;
+  for(; *str; str++){
+    w += glyph(*str)->advance;
+  }
+  return w;
+}
+
+/**
+ * @brief Height in pixels of the line of text
+ *
+ * @return int
+ */
+int Font::height(){
+  return ascent + descent;
+}
+
+/**
+ * @brief Blends a glyph into the sprite buffer, clipping to the sprite
+ *
+ * @param buf sprite buffer
+ * @param w sprite width
+ * @param h sprite height
+ * @param g
+ * @param x top left of the glyph
+ * @param y top left of the glyph
+ */
+void Font::blit(uint16_t *buf, int w, int h, const AtlasGlyph *g, int x, int y){
+  const uint8_t *bitmap = atlas->bitmap + g->offset;
+  int row_bytes = (g->width + 1) / 2;
+  for(int gy = 0; gy < g->height; gy++){
+    int py = y + gy;
+    if(py < 0 || py >= h){
+      continue;
+    }
+    const uint8_t *row = bitmap + (gy * row_bytes);
+    for(int gx = 0; gx < g->width; gx++){
+      int px = x + gx;
+      if(px < 0 || px >= w){
+        continue;
+      }
+      uint8_t byte = pgm_read_byte(&row[gx >> 1]);
+      uint8_t a = (gx & 1) ? (byte & 0x0F) : (byte >> 4);
+      if(a){
+        buf[(py * w) + px] = lut[a];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Same as blit() for glyphs already known to be inside the sprite, two pixels are
+ * written per byte of the atlas without any bounds checks
+ *
+ * @param buf sprite buffer
+ * @param w sprite width
+ * @param g
+ * @param x top left of the glyph
+ * @param y top left of the glyph
+ */
+void Font::blitFast(uint16_t *buf, int w, const AtlasGlyph *g, int x, int y){
+  const uint8_t *src = atlas->bitmap + g->offset;
+  int pairs = g->width / 2;
+  for(int gy = 0; gy < g->height; gy++){
+    uint16_t *dst = buf + ((y + gy) * w) + x;
+    for(int i = 0; i < pairs; i++){
+      uint8_t byte = pgm_read_byte(src++);
+      if(byte >> 4) dst[0] = lut[byte >> 4];
+      if(byte & 0x0F) dst[1] = lut[byte & 0x0F];
+      dst += 2;
+    }
+    if(g->width & 1){
+      uint8_t byte = pgm_read_byte(src++);
+      if(byte >> 4) dst[0] = lut[byte >> 4];
+    }
+  }
+}
+
+/**
+ * @brief Draws the string into a 16 bit sprite, positioned the same way as TFT_eSPI drawString
+ *
+ * @param img
+ * @param str
+ * @param x
+ * @param y
+ * @param datum TFT_eSPI text datum (TL_DATUM, MC_DATUM, ...)
+ */
+void Font::drawString(TFT_eSprite &img, const char *str, int x, int y, uint8_t datum){
+  uint16_t *buf = (uint16_t*)img.getPointer();
+  if(buf == nullptr){
+    return;
+  }
+  int w = img.width();
+  int h = img.height();
+  int width = textWidth(str);
+
+  // Horizontal alignment repeats every 3 datums, left/centre/right
+  if(datum % 3 == 1){
+    x -= width / 2;
+  } else if(datum % 3 == 2){
+    x -= width;
+  }
+  int baseline;
+  if(datum <= TR_DATUM){
+    baseline = y + ascent;
+  } else if(datum <= MR_DATUM){
+    baseline = y + (ascent - descent) / 2;
+  } else if(datum <= BR_DATUM){
+    baseline = y - descent;
+  } else {
+    baseline = y;
+  }
+
+  boolean numeric = isNumeric(str);
+  for(; *str; str++){
+    const AtlasGlyph *g = glyph(*str);
+    if(g->width){
+      // A glyph can be wider than its advance or reach past the font's ascent, so each one
+      // is checked against its own box
+      int gx = x + g->x_offset;
+      int gy = baseline + g->y_offset;
+      if(numeric && gx >= 0 && gx + g->width <= w && gy >= 0 && gy + g->height <= h){
+        blitFast(buf, w, g, gx, gy);
+      } else {
+        blit(buf, w, h, g, gx, gy);
+      }
+    }
+    x += g->advance;
+  }
+}
+
+void Font::drawString(TFT_eSprite &img, const String &str, int x, int y, uint8_t datum){
+  drawString(img, str.c_str(), x, y, datum);
+}
+
+#endif
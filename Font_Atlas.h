@@ -0,0 +1,4295 @@
+// Generated by   : tools/font_atlas.py
+// Generated from : DejaVuSans.ttf, DejaVuSansMono.ttf (Bitstream Vera license)
+// Glyph format   : 4-bit alpha, 2 pixels per byte, high nibble first, rows byte aligned
+// Memory usage   : 64468 bytes
+
+#ifndef FONT_ATLAS_H
+#define FONT_ATLAS_H
+
+#if defined(__AVR__)
+    #include <avr/pgmspace.h>
+#elif defined(__PIC32MX__)
+    #define PROGMEM
+#elif defined(__arm__)
+    #define PROGMEM
+#endif
+
+// Same layout as the Adafruit GFXglyph, offsets are relative to the baseline/cursor
+typedef struct {
+  uint16_t offset;  // Start of the glyph in the bitmap array
+  uint8_t width;
+  uint8_t height;
+  int8_t x_offset;
+  int8_t y_offset;  // Negative is above the baseline
+  uint8_t advance;
+} AtlasGlyph;
+
+typedef struct {
+  const uint8_t *bitmap;
+  const AtlasGlyph *glyphs;
+  uint8_t first;
+  uint8_t last;
+  uint8_t y_advance;
+  uint8_t ascent;   // Height of the digits above the baseline
+  uint8_t descent;  // Deepest glyph below the baseline
+} AtlasFont;
+
+// Atlas_Main, 46px em from DejaVuSans.ttf, replaces FF26 at text size 2
+const uint8_t Atlas_Main_Bitmap[33541] PROGMEM = {
+  0x88, 0x88, 0x40, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF,
+  0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+  0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80,
+  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x60, 0xCF, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0xBF, 0xFF, 0x40, 0xBF,
+  0xFF, 0x30, 0x9F, 0xFF, 0x00, 0x24, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0x60, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80,
+  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x48, 0x88, 0x20, 0x00, 0x08, 0x88, 0x60, 0x8F, 0xFF, 0x40,
+  0x00, 0x0F, 0xFF, 0xB0, 0x8F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xB0, 0x8F, 0xFF, 0x40, 0x00, 0x0F,
+  0xFF, 0xB0, 0x8F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xB0, 0x8F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xB0,
+  0x8F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xB0, 0x8F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xB0, 0x8F, 0xFF,
+  0x40, 0x00, 0x0F, 0xFF, 0xB0, 0x8F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xB0, 0x8F, 0xFF, 0x40, 0x00,
+  0x0F, 0xFF, 0xB0, 0x8F, 0xFF, 0x40, 0x00, 0x0F, 0xFF, 0xB0, 0x8F, 0xFF, 0x40, 0x00, 0x0F, 0xFF,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF0, 0x00, 0x00, 0x06, 0xFF, 0xF3, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x0E, 0xFF, 0xA0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0x00, 0x3F, 0xFF, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFB, 0x00, 0x00, 0x00, 0xAF, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xEF, 0xFA, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xF7, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xF3, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xBB, 0xBB, 0xBB, 0xBE, 0xFF, 0xEB, 0xBB, 0xBB, 0xBD, 0xFF, 0xFB, 0xBB, 0xBB,
+  0xBB, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x0B, 0xBB, 0xBB, 0xBB, 0xEF, 0xFF, 0xBB, 0xBB, 0xBB, 0xDF, 0xFF, 0xBB, 0xBB, 0xBB,
+  0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFC, 0x00, 0x00, 0x00, 0xAF, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xEF, 0xFA, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF5, 0x00, 0x00, 0x02, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF1, 0x00, 0x00, 0x06, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xC0, 0x00, 0x00, 0x09, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x0D, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x6B, 0xBB, 0xBB, 0xBB, 0xDF, 0xFF, 0xCB, 0xBB, 0xBB, 0xCF, 0xFF, 0xCB, 0xBB, 0xBB, 0xB6,
+  0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x00, 0x6B, 0xBB, 0xBB, 0xBD, 0xFF, 0xFC, 0xBB, 0xBB, 0xBC, 0xFF, 0xFC, 0xBB, 0xBB, 0xBB, 0xB6,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x06, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x0D, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xCF, 0xFB, 0x00, 0x00, 0x00, 0x9F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xDF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0xFF, 0xF4, 0x00, 0x00, 0x02, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x06, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x88, 0xEF, 0xDB, 0x88, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xEF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xD9, 0x30, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xD9, 0xDF, 0xB8, 0xBD, 0xFF, 0xFF, 0x80, 0x00, 0x03, 0xFF, 0xFF,
+  0xC4, 0x00, 0xBF, 0x80, 0x00, 0x26, 0xBF, 0x80, 0x00, 0x09, 0xFF, 0xFC, 0x10, 0x00, 0xBF, 0x80,
+  0x00, 0x00, 0x02, 0x40, 0x00, 0x0E, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xF0, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0,
+  0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF2, 0x00, 0x00, 0xBF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFA, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0xFF, 0xFF, 0xA2, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF,
+  0xFF, 0xA7, 0xCF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB,
+  0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x47, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x84,
+  0x8D, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x7F, 0xFF, 0xFD,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xDF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
+  0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0xFF,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xEF, 0xFF, 0x40, 0x4B, 0x20, 0x00,
+  0x00, 0x00, 0xBF, 0x80, 0x00, 0x09, 0xFF, 0xFE, 0x00, 0x4F, 0xF9, 0x50, 0x00, 0x00, 0xBF, 0x80,
+  0x01, 0x9F, 0xFF, 0xF8, 0x00, 0x4F, 0xFF, 0xFE, 0x98, 0x44, 0xCF, 0x97, 0xAF, 0xFF, 0xFF, 0xC0,
+  0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x10, 0x00, 0x03, 0x9D, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x60, 0x00, 0x00, 0x00, 0x00, 0x37, 0x9B, 0xEF, 0xFF, 0xFC,
+  0xB8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8B, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A,
+  0xEF, 0xFF, 0xD8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFB, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFC, 0xBE, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1E, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x30, 0x00, 0x8F, 0xFF,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF3,
+  0x00, 0x00, 0x0A, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xFF, 0x90, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xCF, 0xFC, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xAF,
+  0xFF, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x10,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x00, 0x00, 0x00,
+  0xDF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xCF,
+  0xFC, 0x00, 0x00, 0x08, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x90,
+  0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x2E, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0xFF, 0xF3, 0x00, 0x00, 0x09, 0xFF, 0xF4, 0x00, 0x00, 0xAF, 0xFD, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x30, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x04, 0xFF,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFC, 0xBE, 0xFF, 0xFE,
+  0x20, 0x00, 0x0D, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x8F, 0xFF, 0x20, 0x00, 0x00, 0x26, 0x88, 0x86, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x49, 0xEF, 0xFF, 0xC8, 0x10, 0x00, 0x02, 0xEF, 0xF8, 0x00, 0x00, 0x18, 0xFF,
+  0xFF, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xD1,
+  0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFB, 0x64, 0x6D, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFA, 0x00, 0x00, 0x4F, 0xFF, 0xA0, 0x00, 0x01, 0xCF, 0xFF,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xE2, 0x00, 0x00, 0xAF, 0xFE, 0x10,
+  0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00,
+  0x00, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xFF,
+  0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xA0, 0x00, 0x00, 0x04, 0xFF, 0xF4, 0x00,
+  0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFE, 0x20, 0x00, 0x00,
+  0x04, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+  0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFE, 0x10,
+  0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x6F, 0xFF, 0xA0, 0x00, 0x01, 0xCF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xE2,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x54, 0x6C, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFF,
+  0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBB, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x27, 0x8B, 0x86, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xEF, 0xFF,
+  0xFE, 0xB8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xE9, 0x88,
+  0x8A, 0xEF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF9, 0x10, 0x00,
+  0x00, 0x05, 0x9F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xA0, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF9, 0x6F, 0xFF, 0xFF,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x02, 0xEF, 0xFF, 0x90, 0x06, 0xFF, 0xFF,
+  0xF6, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFA, 0x00, 0x0B, 0xFF, 0xFC, 0x10, 0x00, 0x6F, 0xFF,
+  0xFF, 0x60, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0xF6, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF4, 0x00, 0x9F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x6F,
+  0xFF, 0xFF, 0x30, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0xDF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x06,
+  0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x6F, 0xFF, 0xFE, 0x30, 0x00, 0xCF, 0xFF, 0x20, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xFF, 0xFF, 0xE3, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x6F, 0xFF, 0xFE, 0x3C, 0xFF, 0xF3, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0xAF, 0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xD7, 0x30, 0x00,
+  0x26, 0x9F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x09, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x40, 0x00, 0x9F, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x02, 0x8E, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFA, 0x60, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x47, 0x89, 0xB8,
+  0x85, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x20, 0x8F, 0xFF, 0x40, 0x8F,
+  0xFF, 0x40, 0x8F, 0xFF, 0x40, 0x8F, 0xFF, 0x40, 0x8F, 0xFF, 0x40, 0x8F, 0xFF, 0x40, 0x8F, 0xFF,
+  0x40, 0x8F, 0xFF, 0x40, 0x8F, 0xFF, 0x40, 0x8F, 0xFF, 0x40, 0x8F, 0xFF, 0x40, 0x8F, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x8F, 0xFE, 0x10, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+  0xE1, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xDF, 0xFE, 0x10, 0x00, 0x00, 0x06,
+  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xA0, 0x00, 0x00,
+  0x00, 0x9F, 0xFF, 0x60, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x06, 0xFF, 0xFB, 0x00,
+  0x00, 0x00, 0x0A, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xC0, 0x00,
+  0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+  0xF7, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0xAF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF1,
+  0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFD, 0x00, 0x00, 0x00, 0x00,
+  0x6F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF6, 0x00,
+  0x00, 0x00, 0x00, 0xAF, 0xFD, 0x10, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF2, 0x00,
+  0x00, 0x00, 0x01, 0xEF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1E,
+  0xFF, 0xB0, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFB, 0x00, 0x00,
+  0x00, 0x00, 0xCF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x2F, 0xFF,
+  0xE0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+  0x05, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x60,
+  0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x8F,
+  0xFF, 0xB0, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xBF,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x70, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+  0x04, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF6, 0x00,
+  0x00, 0x00, 0x1F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0x40, 0x00, 0x00, 0x02, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x1E,
+  0xFF, 0xD0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xDF, 0xFC, 0x00, 0x00, 0x00,
+  0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00,
+  0x00, 0x01, 0x00, 0x0B, 0xB2, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x02, 0xBB, 0x00, 0x5F, 0xFF,
+  0x81, 0x00, 0x0B, 0xFB, 0x00, 0x01, 0x8F, 0xFF, 0x50, 0x29, 0xFF, 0xFD, 0x50, 0x0B, 0xFB, 0x00,
+  0x5D, 0xFF, 0xF9, 0x20, 0x00, 0x2A, 0xFF, 0xFB, 0x2B, 0xFB, 0x2B, 0xFF, 0xFA, 0x20, 0x00, 0x00,
+  0x00, 0x4B, 0xFF, 0xFE, 0xFE, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xFF,
+  0xFD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x9F, 0xFF, 0xFF, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8E, 0xFF, 0xCD,
+  0xFD, 0xCF, 0xFE, 0x81, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xE7, 0x0B, 0xFB, 0x07, 0xEF, 0xFE, 0x70,
+  0x00, 0x4D, 0xFF, 0xF9, 0x10, 0x0B, 0xFB, 0x00, 0x19, 0xFF, 0xFD, 0x40, 0x3F, 0xFC, 0x40, 0x00,
+  0x0B, 0xFB, 0x00, 0x00, 0x4C, 0xFF, 0x30, 0x08, 0x70, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xBB, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x49, 0xFF, 0xF7, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x43, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+  0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x4F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x28, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x8B, 0xFF, 0xF9, 0x88, 0x88, 0x88, 0x88, 0x88, 0x86, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6B, 0xBB, 0xB3, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x8F, 0xFF,
+  0xF4, 0x00, 0xAF, 0xFF, 0xE1, 0x00, 0xEF, 0xFF, 0x80, 0x03, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xF6,
+  0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x60, 0x00, 0x4F, 0xFD, 0x00, 0x00, 0x24, 0x42, 0x00,
+  0x00, 0x68, 0x88, 0x88, 0x88, 0x88, 0x88, 0x20, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xBF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x34, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x10, 0xBB, 0xBB, 0x80, 0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0xB0,
+  0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x88, 0x83, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xDF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2F, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xAF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0C, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+  0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF,
+  0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAF, 0xFF,
+  0xFF, 0xC7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x06,
+  0xFF, 0xFF, 0xFD, 0x88, 0x8C, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFE, 0x70, 0x00,
+  0x00, 0x4D, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x9F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF,
+  0xD0, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x08, 0xFF,
+  0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFC, 0x00, 0x0D, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0x20, 0x2F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+  0xFF, 0x60, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x90, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0xFF, 0xF0, 0xDF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF1, 0xFF, 0xFF,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF4, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0xFF, 0xF4, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0xFF, 0xFF,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0xFF, 0xF0, 0x9F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xD0, 0x8F, 0xFF,
+  0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xB0, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF,
+  0xFF, 0x40, 0x0A, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFE, 0x00, 0x06, 0xFF,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xF9, 0x00, 0x00, 0xDF, 0xFF, 0xD1, 0x00, 0x00,
+  0x00, 0x00, 0xAF, 0xFF, 0xF2, 0x00, 0x00, 0x6F, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x06, 0xFF, 0xFF,
+  0x90, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD6, 0x10, 0x05, 0xAF, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x01,
+  0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFF, 0xFF, 0xFE, 0x81, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x88, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x47, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0x04, 0x79, 0xCF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0xFE, 0xB8, 0x52, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x3B, 0xBB, 0xBB, 0xBB, 0xFF, 0xFF,
+  0xDB, 0xBB, 0xBB, 0xBB, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+  0xBE, 0xFF, 0xFF, 0xFB, 0x83, 0x00, 0x00, 0x00, 0x05, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xB3, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x8F, 0xFF,
+  0xFF, 0xFF, 0xBB, 0xBB, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x8F, 0xFF, 0xC7, 0x30, 0x00, 0x00, 0x06,
+  0xDF, 0xFF, 0xFF, 0x30, 0x8F, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xA0, 0x53,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+  0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+  0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xEF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3E, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xF6,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xDF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+  0xBB, 0xB8, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xBF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x01, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x79, 0xBF, 0xFF, 0xFF, 0xFE, 0xB7, 0x20, 0x00, 0x00, 0x00, 0x06, 0xEF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFD, 0xBB, 0xBB, 0xDF, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x08,
+  0xFA, 0x74, 0x00, 0x00, 0x00, 0x02, 0x8E, 0xFF, 0xFF, 0xB0, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xEF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFB, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
+  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x8E, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x8B, 0xBB, 0xBB, 0xFF, 0xFF, 0xFF,
+  0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xA4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xBF, 0xFF,
+  0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x20, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFB, 0x00, 0x8D, 0x61, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xF4, 0x00, 0x8F, 0xFF, 0xB8, 0x64, 0x44, 0x44, 0x8A, 0xFF, 0xFF,
+  0xFF, 0x80, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x8F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x70, 0x00, 0x00, 0x05, 0x9D, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x88, 0x9B, 0x98, 0x84, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xCF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xA8, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x28, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xF7, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E,
+  0xFF, 0xB0, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x20, 0x08,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x08, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xC0, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xAF, 0xFF, 0x40, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF,
+  0xF8, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xD1, 0x00, 0x00,
+  0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x40, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x1E, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+  0x60, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0xBF, 0xFF, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBD, 0xFF, 0xFF, 0xBB, 0xBB, 0x80, 0xBF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x86, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x43, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x04, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x9D, 0xFF, 0xFF, 0xFC, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0xDB, 0xBB, 0xBC, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFA, 0x61,
+  0x00, 0x00, 0x00, 0x18, 0xEF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1C, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xF6,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFD,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF9, 0x00, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF3, 0x00, 0x8D, 0x71, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x8F, 0xFF, 0xFF, 0xA0, 0x00, 0x8F, 0xFF, 0xB8, 0x64, 0x44, 0x46, 0x9E, 0xFF, 0xFF, 0xFD, 0x10,
+  0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x8F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x28, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x88, 0xAB, 0x88, 0x74, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x16, 0xAE, 0xFF, 0xFF, 0xFC, 0x95, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0xEF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
+  0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xCB, 0xBB, 0xDF, 0xFF, 0xF4, 0x00, 0x00, 0x01, 0xCF,
+  0xFF, 0xFD, 0x61, 0x00, 0x00, 0x01, 0x59, 0xF4, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x91, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x4F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xDF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0xFF, 0xF5, 0x00, 0x00, 0x02, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF2,
+  0x00, 0x6A, 0xFF, 0xFF, 0xFC, 0x82, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x3C, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x91, 0x00, 0x00, 0xAF, 0xFF, 0xC3, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x30,
+  0x00, 0xBF, 0xFF, 0xCE, 0xFF, 0xFE, 0x98, 0x88, 0xCF, 0xFF, 0xFF, 0xD1, 0x00, 0xBF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x04, 0xDF, 0xFF, 0xFA, 0x00, 0xBF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+  0x00, 0x1E, 0xFF, 0xFF, 0x30, 0xBF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+  0x90, 0xBF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xE0, 0xAF, 0xFF, 0xFD,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF2, 0x8F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+  0xF4, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x1F, 0xFF, 0xF9,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x08, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF,
+  0xF0, 0x02, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xA0, 0x00, 0x9F, 0xFF,
+  0xE1, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x60, 0x00, 0x2F, 0xFF, 0xFC, 0x10, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0xFD, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xE8, 0x20, 0x01, 0x5B, 0xFF, 0xFF, 0xF3,
+  0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x88, 0xA8, 0x84, 0x00, 0x00, 0x00,
+  0x00, 0x28, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x20, 0x4F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
+  0x00, 0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xEF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xD0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF,
+  0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF1,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0D, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xDF, 0xFF, 0xFF, 0xEA, 0x61, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x09, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xEA, 0x88, 0x89,
+  0xDF, 0xFF, 0xFF, 0xB0, 0x00, 0x02, 0xFF, 0xFF, 0xF8, 0x10, 0x00, 0x00, 0x07, 0xEF, 0xFF, 0xF6,
+  0x00, 0x09, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFD, 0x00, 0x0D, 0xFF, 0xFD,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x20, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0xFF, 0xFF, 0x40, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+  0x40, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x0D, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x20, 0x08, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0xFF, 0xFC, 0x00, 0x02, 0xEF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF5,
+  0x00, 0x00, 0x6F, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x06, 0xEF,
+  0xFF, 0xFB, 0x88, 0x8A, 0xEF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x29, 0xEF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x10, 0x00,
+  0x00, 0x00, 0x05, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x6F, 0xFF,
+  0xFF, 0x95, 0x30, 0x24, 0x8D, 0xFF, 0xFF, 0x90, 0x00, 0x05, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0x00,
+  0x01, 0x9F, 0xFF, 0xF8, 0x00, 0x1E, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF,
+  0x40, 0x6F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0x90, 0xAF, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xE0, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xCF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xF0, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0xBF, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xEF, 0xFF, 0xC0, 0x5F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+  0x80, 0x0D, 0xFF, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x20, 0x04, 0xFF, 0xFF,
+  0xFD, 0x73, 0x00, 0x02, 0x6C, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x06, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x78, 0x8B, 0x98, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xEF, 0xFF, 0xFE, 0xA6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xE9, 0x88, 0x8D,
+  0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xFE, 0x20,
+  0x00, 0x0D, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0x90, 0x00, 0x5F, 0xFF, 0xF9,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF2, 0x00, 0x9F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0E, 0xFF, 0xF8, 0x00, 0xCF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFE,
+  0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x30, 0xFF, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF,
+  0xB0, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xC0, 0xBF, 0xFF, 0xD0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF0, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xFF, 0xF0, 0x2F, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF,
+  0xF0, 0x0A, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0xEF, 0xFF,
+  0xFD, 0x61, 0x00, 0x15, 0xBF, 0xFF, 0xEF, 0xFF, 0xF0, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x8F, 0xFF, 0xF0, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xAF, 0xFF,
+  0xC0, 0x00, 0x00, 0x18, 0xEF, 0xFF, 0xFF, 0xFF, 0xE7, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x04, 0x88, 0x98, 0x84, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xEF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0x40,
+  0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x00, 0x04, 0xCF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xD9,
+  0x64, 0x44, 0x47, 0xCF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFB, 0x10, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+  0x88, 0xAA, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xBB, 0xB3, 0x8F, 0xFF, 0xF4, 0x8F,
+  0xFF, 0xF4, 0x8F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B,
+  0xBB, 0xB3, 0x8F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF4, 0x8F, 0xFF,
+  0xF4, 0x00, 0x6B, 0xBB, 0xB3, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x8F, 0xFF,
+  0xF4, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xBB, 0xB3, 0x00, 0x8F, 0xFF,
+  0xF4, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0xAF, 0xFF, 0xE1, 0x00, 0xEF, 0xFF,
+  0x80, 0x03, 0xFF, 0xFD, 0x00, 0x07, 0xFF, 0xF6, 0x00, 0x0B, 0xFF, 0xD0, 0x00, 0x0F, 0xFF, 0x60,
+  0x00, 0x4F, 0xFD, 0x00, 0x00, 0x24, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x8E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x28, 0xDF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x6C, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xEF, 0xFF, 0xFF, 0xFF,
+  0xFD, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xCF, 0xFF, 0xFF, 0xFF, 0xFE, 0x95, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+  0xDF, 0xFF, 0xFF, 0xFF, 0xFC, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+  0xFF, 0xFF, 0xD8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF,
+  0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF,
+  0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xBF, 0xFF, 0xFF, 0xFF,
+  0xFD, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7D, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xEF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xA6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6B, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xDF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8E, 0xFF,
+  0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xFF,
+  0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xBF,
+  0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x78,
+  0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x4F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x4F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x4F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+  0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB8, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFB, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFB, 0x38, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFC, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0xFF, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0xFF, 0xFF, 0xFF, 0xE9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+  0xEF, 0xFF, 0xFF, 0xFF, 0xFD, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0xCF, 0xFF, 0xFF, 0xFF, 0xFE, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x38, 0xEF, 0xFF, 0xFF, 0xFF, 0xFC, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x6A, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x28, 0xDF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7C, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xAF, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x38, 0xDF, 0xFF, 0xFF, 0xFF, 0xFD, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+  0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+  0xFF, 0xFF, 0xFB, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF,
+  0xD7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFE, 0x83, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7B, 0xFF, 0xFF, 0xFE, 0xA5, 0x00, 0x00, 0x00, 0x04, 0xBF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x30, 0x00, 0xBF, 0xFF, 0xFF, 0xB8, 0x89, 0xDF, 0xFF, 0xFF, 0xE1, 0x00, 0xBF, 0xFB, 0x60, 0x00,
+  0x00, 0x05, 0xEF, 0xFF, 0xF8, 0x00, 0xBC, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x00,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+  0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1C, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xF9, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF,
+  0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBB,
+  0xBB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x44, 0x85, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBC, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFF, 0xD8,
+  0x51, 0x00, 0x00, 0x00, 0x48, 0xCF, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C,
+  0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9F, 0xFF, 0xFC, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xEF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xCF,
+  0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x19, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x90, 0x00, 0x00, 0x08, 0xFF, 0xF7,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF4, 0x00,
+  0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xCF, 0xFD, 0x00, 0x00, 0xBF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x06, 0xAF, 0xFF, 0xFE, 0x94,
+  0x00, 0x8B, 0xB6, 0x00, 0x00, 0x4F, 0xFF, 0x60, 0x04, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x01, 0xBF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xF8, 0x00, 0x00, 0x0A, 0xFF, 0xB0, 0x09, 0xFF, 0xD0, 0x00,
+  0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xBF, 0xF8, 0x00, 0x00, 0x05, 0xFF, 0xF2,
+  0x0E, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x41, 0x14, 0x8E, 0xFF, 0xFF, 0xF8, 0x00,
+  0x00, 0x00, 0xEF, 0xF6, 0x5F, 0xFF, 0x10, 0x00, 0x00, 0x04, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x03,
+  0xEF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x8F, 0xFB, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0xFB, 0xBF, 0xF8, 0x00, 0x00,
+  0x00, 0x1F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0xFB,
+  0xCF, 0xF5, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF8, 0x00,
+  0x00, 0x00, 0x8F, 0xFB, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0xFB, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x9F, 0xF9, 0xFF, 0xF4, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xCF, 0xF8,
+  0xEF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00,
+  0x00, 0x02, 0xFF, 0xF3, 0xBF, 0xF7, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xFF, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0xD0, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF8, 0x00, 0x00, 0x2E, 0xFF, 0x80, 0x8F, 0xFC, 0x00, 0x00,
+  0x00, 0x0A, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x01, 0xCF, 0xFD, 0x00,
+  0x3F, 0xFF, 0x20, 0x00, 0x00, 0x04, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xF8, 0x00,
+  0x4C, 0xFF, 0xE3, 0x00, 0x0E, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFB, 0x64, 0x45, 0x9F,
+  0xFF, 0xFF, 0xF9, 0x6A, 0xFF, 0xFE, 0x60, 0x00, 0x08, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x1C, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xBF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00,
+  0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xE8, 0x10, 0x00, 0x00,
+  0x00, 0x9F, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x04, 0x9D, 0xFF, 0xFB, 0x82, 0x00, 0xBF, 0xFB, 0x85,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF,
+  0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1C, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xF8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4D, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xE8, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x6C, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6E, 0xFF, 0xFF, 0xFD, 0x97, 0x44, 0x44, 0x68, 0xBF, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37,
+  0xAB, 0xFF, 0xFF, 0xDB, 0x85, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x88, 0x88, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xEF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0B, 0xFF, 0xF9, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2F, 0xFF, 0xF2, 0xAF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0xC0, 0x5F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xDF, 0xFF, 0x60, 0x0E, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xFF, 0xFF, 0x10, 0x09, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0xFF, 0xF9, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0xF5, 0x00, 0x00, 0xDF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xCF, 0xFF, 0x80, 0x00, 0x00, 0x2F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0xFF, 0x30, 0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E,
+  0xFF, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
+  0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+  0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+  0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+  0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+  0xFD, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFC,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x2F, 0xFF, 0xF7,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x90, 0x00, 0x00, 0x8F, 0xFF, 0xF2,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xE1, 0x00, 0x00, 0xDF, 0xFF, 0xA0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF6, 0x00, 0x05, 0xFF, 0xFF, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFB, 0x00, 0x0A, 0xFF, 0xFF, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x20, 0x1F, 0xFF, 0xFA, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xF5, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xD0, 0x48, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x74, 0x10, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFA, 0x60, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+  0x20, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0x00,
+  0x8F, 0xFF, 0xF4, 0x44, 0x44, 0x44, 0x44, 0x8C, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x8F, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x50, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xDF, 0xFF, 0xB0, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0,
+  0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0A, 0xFF, 0xFF, 0x20, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x05, 0xCF, 0xFF, 0xF8,
+  0x00, 0x00, 0x8F, 0xFF, 0xFB, 0xBB, 0xBB, 0xBB, 0xBB, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x94, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x36, 0xBF, 0xFF,
+  0xFE, 0x30, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xFF, 0xC0, 0x00,
+  0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF7, 0x00, 0x8F, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFD, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x10, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0xFF, 0xFF, 0x40, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+  0x40, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x40, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x20, 0x8F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFE, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0xDF, 0xFF, 0xF8, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8E, 0xFF, 0xFF,
+  0xE2, 0x00, 0x8F, 0xFF, 0xFB, 0xBB, 0xBB, 0xBB, 0xBB, 0xDF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x8F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x20, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFB, 0x96, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xAD, 0xFF, 0xFF, 0xFF, 0xC9, 0x61,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x94, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0x00, 0x00,
+  0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xCB, 0x88, 0xAB, 0xEF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x2D, 0xFF,
+  0xFF, 0xFB, 0x61, 0x00, 0x00, 0x00, 0x03, 0x8E, 0xFF, 0xFB, 0x00, 0x01, 0xCF, 0xFF, 0xFE, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8F, 0xFB, 0x00, 0x08, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xCB, 0x00, 0x3F, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x00, 0xAF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+  0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0D,
+  0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x04, 0xFF, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFB, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xEF, 0xFB, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xD8, 0x54,
+  0x00, 0x24, 0x7A, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x88, 0xAB, 0x88, 0x52, 0x00, 0x00, 0x00, 0x48, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x85, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF4, 0x44, 0x44, 0x44,
+  0x46, 0x8A, 0xEF, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0xBF, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xEF, 0xFF, 0xFC, 0x10, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3E, 0xFF, 0xFF, 0x80, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xFF, 0xFF, 0xF1, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0xFF, 0xF7, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+  0xFF, 0xFC, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+  0xFF, 0x10, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+  0x40, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x80,
+  0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0x8F,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xB0, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x8F, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xB0, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xB0, 0x8F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x60, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x30, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0xF9, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xEF, 0xFF, 0xF4, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+  0xFF, 0xB0, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFF,
+  0x30, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0xFF, 0xF7, 0x00,
+  0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8D, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+  0x8F, 0xFF, 0xFB, 0xBB, 0xBB, 0xBB, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x8F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x20, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFB, 0xB8, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x86, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFB, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x8F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x8F, 0xFF, 0xF4, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x43, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+  0xB0, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+  0xBB, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x86, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+  0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x8F, 0xFF, 0xF4, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x43, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xFB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x30, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x40, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x9C, 0xFF, 0xFF, 0xFF, 0xFB,
+  0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFB, 0x40, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xDB, 0xA8, 0x8B, 0xCF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFC, 0x61, 0x00, 0x00, 0x00, 0x00, 0x59, 0xEF, 0xFF, 0xF0,
+  0x00, 0x01, 0xCF, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xEF, 0xF0, 0x00,
+  0x08, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xF0, 0x00, 0x4F,
+  0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xAF, 0xFF,
+  0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xD0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x86, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFB, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFB, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFB, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x49, 0xFF, 0xFB,
+  0x1F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x0D,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x09, 0xFF,
+  0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x05, 0xFF, 0xFF,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x00, 0xEF, 0xFF, 0xF2,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x00, 0x8F, 0xFF, 0xFA, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x00, 0x1D, 0xFF, 0xFF, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x00, 0x04, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0xFB, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xD8, 0x64, 0x10,
+  0x03, 0x46, 0x9E, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x02, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x88, 0x9B, 0x98, 0x84, 0x20, 0x00,
+  0x00, 0x00, 0x48, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x88, 0x8F,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+  0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+  0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xFB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+  0xBB, 0xBB, 0xBD, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+  0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+  0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x48, 0x88, 0x80, 0x8F,
+  0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF,
+  0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0,
+  0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F,
+  0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF,
+  0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0,
+  0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F, 0xFF, 0xF0, 0x8F,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x88, 0x88, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x0A, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF5, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xD0, 0x48, 0x9B, 0xEF, 0xFF,
+  0xFF, 0x70, 0x8F, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x8F, 0xFF,
+  0xFD, 0x93, 0x00, 0x00, 0x24, 0x44, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x88, 0x88, 0x85, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3C, 0xFF, 0xFF, 0xC1, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF,
+  0xFF, 0xFC, 0x10, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0x90,
+  0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x06,
+  0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x09, 0xFF, 0xFF, 0xE5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x9F, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x09, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xF1, 0x9F, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xFC, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xF9, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF6, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x6F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x06, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xF0, 0x00, 0x6F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x06, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x6F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x06,
+  0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x6F, 0xFF,
+  0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF9,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x90, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x90, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF9, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x90, 0x48, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xFB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB6, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x48, 0x88, 0x88, 0x83,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x88, 0x88, 0x82, 0x8F, 0xFF, 0xFF, 0xF9,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xF4, 0x8F, 0xFF, 0xFF, 0xFF,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xF4, 0x8F, 0xFF, 0xFF, 0xFF,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xF4, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF4, 0x8F, 0xFF, 0xFA, 0xFF,
+  0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x9F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF6, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x5F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0xEF,
+  0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF9, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x9F,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF5, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x3F,
+  0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x0D,
+  0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x80, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x07,
+  0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x20, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x02,
+  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0xAF, 0xFF, 0x20, 0x00, 0x00, 0x07, 0xFF, 0xF6, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x6F, 0xFF, 0x80, 0x00, 0x00, 0x0D, 0xFF, 0xF1, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x09, 0xFF, 0xF5, 0x00, 0x00, 0x9F, 0xFF, 0x50, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x03, 0xFF, 0xF9, 0x00, 0x01, 0xEF, 0xFD, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0xDF, 0xFF, 0x10, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x7F, 0xFF, 0x60, 0x0B, 0xFF, 0xF2, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x2F, 0xFF, 0xC0, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x0A, 0xFF, 0xF2, 0x8F, 0xFF, 0x60, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x06, 0xFF, 0xF8, 0xDF, 0xFF, 0x10, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0xEF, 0xFE, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x04, 0x88, 0x88, 0x20, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x48, 0x88, 0x88, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x88, 0x8F, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+  0x8F, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF,
+  0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xFB, 0xFF, 0xFC, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF4, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+  0xFF, 0x8F, 0xFF, 0xF0, 0x4F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF,
+  0xF0, 0x09, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x02, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x9F, 0xFF, 0xE1, 0x00,
+  0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x08, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F,
+  0xFF, 0xF0, 0x00, 0x01, 0xEF, 0xFF, 0x90, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x8F, 0xFF, 0xF2, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x1E, 0xFF,
+  0xF9, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x30, 0x00,
+  0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xB0, 0x00, 0x08, 0xFF, 0xFF,
+  0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFB, 0x00, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x05, 0xFF, 0xFF, 0x40, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0xD0, 0x08, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF6, 0x08, 0xFF,
+  0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x08, 0xFF, 0xFF, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x68, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9F, 0xFF, 0xE8, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2F, 0xFF, 0xFE, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xFF, 0xFF, 0x8F,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xBF, 0xFF, 0xFF, 0xFC,
+  0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xFD, 0xA8, 0x89, 0xCF,
+  0xFF, 0xFF, 0xFE, 0x60, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xF9, 0x20, 0x00, 0x00, 0x01,
+  0x8E, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xAF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x4F, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xCF, 0xFF, 0xF6, 0x00, 0x00, 0xAF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0xFF, 0xFF, 0x60, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0xFF, 0xA0, 0x0B, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xDF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF3, 0x3F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF5, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF4, 0x0D, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x09, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x05, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0xEF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x20, 0x00, 0x8F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF9, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3E, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0x95, 0x30, 0x02, 0x48,
+  0xEF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x48, 0x89, 0xA8, 0x85,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x86, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x92, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x8F, 0xFF, 0xF4, 0x44, 0x44, 0x44, 0x59, 0xEF, 0xFF, 0xFF,
+  0x80, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xF2, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+  0xFF, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x30, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x40, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x20, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+  0xFF, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFC, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x1A, 0xFF, 0xFF, 0xF2, 0x00, 0x8F, 0xFF, 0xF4, 0x44, 0x44, 0x44, 0x69, 0xEF, 0xFF, 0xFF,
+  0x80, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x8F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x92, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x88, 0x88, 0x88, 0x85, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x38, 0xBF, 0xFF, 0xFF, 0xFC, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xEF, 0xFF, 0xFF, 0xFD, 0xA8, 0x89, 0xCF, 0xFF, 0xFF, 0xFE, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x3E, 0xFF, 0xFF, 0xF9, 0x20, 0x00, 0x00, 0x01, 0x8E, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x01,
+  0xCF, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x08,
+  0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x4F,
+  0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xF6, 0x00, 0x00, 0xAF,
+  0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFD, 0x00, 0x02, 0xFF,
+  0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x60, 0x07, 0xFF,
+  0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xA0, 0x0B, 0xFF,
+  0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xE0, 0x0F, 0xFF,
+  0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF3, 0x3F, 0xFF,
+  0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF5, 0x4F, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x4F, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x8F, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x8F, 0xFF,
+  0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x6F, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x4F, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x4F, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF7, 0x1F, 0xFF,
+  0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF4, 0x0D, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x09, 0xFF,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x05, 0xFF,
+  0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0xEF,
+  0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x20, 0x00, 0x8F,
+  0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF9, 0x00, 0x00, 0x1D,
+  0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x05,
+  0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0xFF, 0xFF, 0xFF, 0x95, 0x30, 0x02, 0x48, 0xEF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x48, 0x89, 0xB8, 0xEF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x30, 0x00, 0x48, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x86, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF4, 0x44, 0x44, 0x44, 0x58, 0xDF, 0xFF, 0xFF,
+  0xB0, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xF4, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF,
+  0xFE, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF9, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x04, 0x9F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x60, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFB, 0xBB, 0xBB, 0xBF, 0xFF, 0xFF,
+  0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x28, 0xEF, 0xFF, 0xF6,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFE, 0x20, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xEF, 0xFF, 0xD0, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
+  0xFF, 0xFD, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF,
+  0x60, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xD0, 0x00,
+  0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFD, 0x00, 0x8F, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x69, 0xDF, 0xFF, 0xFF, 0xFD, 0xB8, 0x51,
+  0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0x00, 0x00, 0x1C,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xFC, 0xA8,
+  0x88, 0xBD, 0xFF, 0xFF, 0xF8, 0x00, 0x0A, 0xFF, 0xFF, 0xE8, 0x10, 0x00, 0x00, 0x00, 0x16, 0xAF,
+  0xF8, 0x00, 0x3F, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x87, 0x00, 0x8F, 0xFF,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFA, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC9, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFB, 0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x92,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x58, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x26, 0xAF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8F, 0xFF,
+  0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F,
+  0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF5, 0xA8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0xF1, 0xBF, 0xE8, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xFF, 0x90, 0xBF, 0xFF,
+  0xFD, 0x86, 0x40, 0x00, 0x24, 0x8D, 0xFF, 0xFF, 0xFD, 0x10, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+  0x20, 0x00, 0x00, 0x58, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x47, 0x88, 0xBA, 0x88, 0x64, 0x00, 0x00, 0x00, 0x00, 0x28, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x82, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x7F, 0xFF, 0xF7, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x88, 0x86, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB,
+  0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0xFA, 0xEF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8,
+  0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x9F, 0xFF, 0xF1,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF4, 0x6F, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF1, 0x1F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0xFF, 0xFF, 0xA0, 0x09, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+  0x60, 0x02, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x6F,
+  0xFF, 0xFF, 0xD7, 0x41, 0x00, 0x25, 0x9E, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x88, 0xB9, 0x88, 0x51, 0x00, 0x00, 0x00, 0x00, 0x48,
+  0x88, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x88, 0x80, 0x4F,
+  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xA0, 0x0D,
+  0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x50, 0x08,
+  0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFE, 0x00, 0x02,
+  0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00,
+  0xAF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF2, 0x00, 0x00,
+  0x6F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xC0, 0x00, 0x00,
+  0x0E, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+  0x08, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+  0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+  0x00, 0xCF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+  0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xDF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x0C, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xEF, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9F, 0xFF, 0xE1, 0x00, 0x00, 0x8F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF6, 0x00, 0x00, 0xEF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFC, 0x00, 0x05, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x20, 0x0A, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xD0, 0x7F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF5, 0xCF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFC, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+  0x88, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x88, 0x88, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x68, 0x88, 0x80, 0x3F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xA0, 0x0E, 0xFF, 0xF9, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
+  0x70, 0x0A, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x30, 0x07, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xCF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFF,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFA, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
+  0xFF, 0xFA, 0x00, 0x00, 0xEF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF6, 0xCF, 0xFC,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF7, 0x00, 0x00, 0xAF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xF2, 0x8F, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00,
+  0x7F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xD0, 0x6F, 0xFF, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x9F, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x90,
+  0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xA0, 0x00, 0x00, 0x0E, 0xFF, 0xF9, 0x00,
+  0x00, 0x00, 0x00, 0x5F, 0xFF, 0x60, 0x0D, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x70,
+  0x00, 0x00, 0x0A, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x20, 0x09, 0xFF, 0xF1, 0x00,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xCF,
+  0xFE, 0x00, 0x06, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF,
+  0xFF, 0x60, 0x00, 0x00, 0x01, 0xFF, 0xFA, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+  0xFA, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x90, 0x00, 0x00, 0x05, 0xFF, 0xF7, 0x00, 0x00, 0xDF,
+  0xFC, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xD0, 0x00, 0x00,
+  0x08, 0xFF, 0xF3, 0x00, 0x00, 0x9F, 0xFF, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x7F, 0xFF, 0xF2, 0x00, 0x00, 0x0C, 0xFF, 0xE0, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0x00,
+  0x9F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF6, 0x00, 0x00, 0x1F, 0xFF, 0xA0, 0x00,
+  0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0xDF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF9,
+  0x00, 0x00, 0x4F, 0xFF, 0x70, 0x00, 0x00, 0x0E, 0xFF, 0xB0, 0x00, 0x02, 0xFF, 0xFF, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFD, 0x00, 0x00, 0x8F, 0xFF, 0x30, 0x00, 0x00, 0x0A, 0xFF, 0xF0,
+  0x00, 0x06, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x20, 0x00, 0xBF, 0xFE,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x09, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0xFF, 0x50, 0x00, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x0C, 0xFF, 0xFA,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x80, 0x04, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+  0xEF, 0xFB, 0x00, 0x1F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xC0, 0x08,
+  0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x00, 0x5F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0xFF, 0xF1, 0x0B, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x8F,
+  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5, 0x0F, 0xFF, 0xB0, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xFF, 0x80, 0xCF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF,
+  0xF8, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xB1, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+  0xF5, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFC, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x88, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x88, 0x88, 0x10, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFA, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xE1, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x01,
+  0xDF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x08, 0xFF,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFA,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x30, 0x00, 0x01, 0xDF, 0xFF, 0xE1, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xC0, 0x00, 0x08, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x4F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x31, 0xDF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xC8, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0xEF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xDF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xFF,
+  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x4B, 0xFF,
+  0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x02, 0xEF, 0xFF,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xD1, 0x00, 0x7F, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x40, 0x00, 0x0B, 0xFF, 0xFF, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x01, 0xDF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x4F, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xB0, 0x00, 0x01, 0xDF, 0xFF, 0xD1,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF7, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x20, 0x5F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xB0, 0x78, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x88, 0x88, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x0B, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0xEF, 0xFF, 0xC0, 0x02, 0xEF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF,
+  0x30, 0x00, 0x5F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00,
+  0x0A, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xB0, 0x00, 0x00, 0x01, 0xEF,
+  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x30, 0x00,
+  0x00, 0x02, 0xEF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xC1, 0x00, 0x00, 0x0B,
+  0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xF7,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x02, 0xEF, 0xFF, 0xB0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xD1, 0x0B, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0xEF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xDF, 0xFF, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+  0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xA0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x80, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x8F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x24, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x5E, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6F, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xEF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
+  0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF9,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xCF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF,
+  0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF,
+  0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFE, 0xBB, 0xBB, 0xBB, 0xBB,
+  0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0xFF, 0xFF, 0x44, 0x44, 0x42, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x44, 0x44, 0x42, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x78, 0x87,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+  0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+  0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
+  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xAF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xCF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xEF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0D, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x44, 0x42, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x24, 0x44, 0x47, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00,
+  0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00,
+  0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04,
+  0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+  0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00,
+  0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00,
+  0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04,
+  0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+  0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x24,
+  0x44, 0x47, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x88, 0x88, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xCF, 0xFF, 0xFC, 0x7E, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1C, 0xFF, 0xFF, 0x91, 0x03, 0xEF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xCF, 0xFF, 0xF9, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xF6,
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFE, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xE3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x50, 0x00, 0x09, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0xE3, 0x00, 0x9F, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0xFF, 0xFE, 0x30, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x20, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x6B, 0xBB, 0xBB,
+  0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x60, 0x8B, 0xBB, 0x60, 0x00, 0x00, 0x00,
+  0x3E, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xB0,
+  0x00, 0x00, 0x00, 0x06, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x40, 0x00, 0x00, 0x00,
+  0x09, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x18, 0x88, 0x30,
+  0x00, 0x00, 0x00, 0x37, 0x8B, 0xBB, 0xB8, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAE, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC5, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90,
+  0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xDB, 0xBB, 0xDF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x8F, 0xD8, 0x40,
+  0x00, 0x00, 0x01, 0x6D, 0xFF, 0xFF, 0x60, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF,
+  0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00,
+  0x00, 0x27, 0x9B, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x4C, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+  0x9F, 0xFF, 0xFF, 0xDA, 0x88, 0x64, 0x44, 0x44, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xB3, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xFF, 0xFF, 0x0A, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+  0x0F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x3F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+  0xFF, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x1F, 0xFF, 0xF5, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xFF, 0x0C, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x2C, 0xFF,
+  0xFF, 0xFF, 0x06, 0xFF, 0xFF, 0xD6, 0x00, 0x00, 0x28, 0xEF, 0xFA, 0xFF, 0xFF, 0x00, 0xCF, 0xFF,
+  0xFF, 0xFC, 0xBE, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x10, 0xFF, 0xFF, 0x00, 0x01, 0x8E, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+  0x01, 0x58, 0x9B, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x27, 0x9B, 0xBB, 0x84, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0xFF, 0x40, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x41,
+  0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0x5C, 0xFF, 0xFE, 0xBB, 0xBF,
+  0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xCF, 0xFD, 0x60, 0x00, 0x01, 0x8E, 0xFF, 0xFF, 0x40,
+  0x00, 0xBF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF, 0xFE,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF,
+  0x10, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x50, 0xBF, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF,
+  0xB0, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0xBF, 0xFF, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF,
+  0x80, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xF2,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x10, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0D, 0xFF, 0xFA, 0x00, 0xBF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF6,
+  0x00, 0xBF, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF, 0xBF,
+  0xFE, 0x81, 0x00, 0x02, 0x9F, 0xFF, 0xFF, 0x30, 0x00, 0xBF, 0xFF, 0x4C, 0xFF, 0xFF, 0xDB, 0xEF,
+  0xFF, 0xFF, 0xF6, 0x00, 0x00, 0xBF, 0xFF, 0x41, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+  0x00, 0xBF, 0xFF, 0x40, 0x08, 0xEF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x89, 0xB8, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x8B, 0xBB,
+  0xB9, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x20, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xFE,
+  0xBB, 0xBE, 0xFF, 0xFF, 0x80, 0x00, 0x0A, 0xFF, 0xFF, 0xE8, 0x20, 0x00, 0x00, 0x26, 0xBF, 0x80,
+  0x00, 0x7F, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0x50, 0x01, 0xEF, 0xFF, 0xD1, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0C, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF7, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5F, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x00, 0x09, 0xFF, 0xFF, 0xF9,
+  0x50, 0x00, 0x00, 0x48, 0xDF, 0x80, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0xFF,
+  0x80, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x29,
+  0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0xAB, 0x88, 0x51,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x03, 0x8A, 0xBB, 0xA7, 0x20, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFF,
+  0xFF, 0xFB, 0x20, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x0F,
+  0xFF, 0xF0, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xCB, 0xBD, 0xFF, 0xFE, 0x3F, 0xFF, 0xF0, 0x00, 0x2E,
+  0xFF, 0xFF, 0x82, 0x00, 0x00, 0x4C, 0xFF, 0xBF, 0xFF, 0xF0, 0x00, 0x9F, 0xFF, 0xF6, 0x00, 0x00,
+  0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF,
+  0xFF, 0xF0, 0x08, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF0, 0x0D, 0xFF,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF0, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+  0xFF, 0xF0, 0x6F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x8F, 0xFF,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0xFF, 0xF0, 0x5F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x4F, 0xFF,
+  0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x0C, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+  0xFF, 0xF0, 0x08, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF0, 0x02, 0xFF,
+  0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xF0, 0x00, 0x9F, 0xFF, 0xF7, 0x00, 0x00,
+  0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xF0, 0x00, 0x1D, 0xFF, 0xFF, 0xA3, 0x00, 0x00, 0x6D, 0xFF, 0xBF,
+  0xFF, 0xF0, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xEB, 0xCF, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0x00, 0x00,
+  0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF,
+  0xFF, 0xF9, 0x10, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x02, 0x68, 0xAA, 0x86, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x8B, 0xBB, 0xA8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x60, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFB, 0x10, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFC, 0xBB, 0xDF, 0xFF, 0xFF,
+  0xC1, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xD6, 0x10, 0x00, 0x03, 0xAF, 0xFF, 0xFA, 0x00, 0x00, 0x5F,
+  0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0xDF, 0xFF, 0xA0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9F, 0xFF, 0xB0, 0x06, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0xFF, 0xF2, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF7, 0x0F, 0xFF,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF9, 0x4F, 0xFF, 0xF1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x5F, 0xFF, 0xFB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBC,
+  0xFF, 0xFB, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x8F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x8F, 0xFF, 0xE8, 0x88, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x86, 0x6F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xDF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x5F,
+  0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xE0, 0x00, 0x08, 0xFF, 0xFF, 0xFA, 0x51,
+  0x00, 0x00, 0x04, 0x7B, 0xFF, 0xF0, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFC, 0xCF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x00, 0x00, 0x05, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+  0x00, 0x18, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x68,
+  0x8B, 0xA8, 0x85, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7B, 0xCF, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+  0x2F, 0xFF, 0xFE, 0x98, 0x88, 0x88, 0x00, 0x00, 0x8F, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x44, 0x44,
+  0xFF, 0xFF, 0x74, 0x44, 0x44, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00,
+  0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x8A, 0xBB, 0xA7, 0x20, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFF,
+  0xFF, 0xFB, 0x20, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x0F,
+  0xFF, 0xF0, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xCB, 0xBD, 0xFF, 0xFE, 0x3F, 0xFF, 0xF0, 0x00, 0x3F,
+  0xFF, 0xFF, 0x81, 0x00, 0x00, 0x3B, 0xFF, 0xBF, 0xFF, 0xF0, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xF0, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+  0xFF, 0xF0, 0x09, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x0E, 0xFF,
+  0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF0, 0x2F, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0xFF, 0xF0, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x8F, 0xFF,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x8F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0xFF, 0xF0, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x3F, 0xFF,
+  0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF0, 0x0A, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+  0xFF, 0xF0, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xF0, 0x00, 0xDF,
+  0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xF0, 0x00, 0x5F, 0xFF, 0xFE, 0x40, 0x00,
+  0x00, 0x08, 0xFF, 0xDF, 0xFF, 0xF0, 0x00, 0x09, 0xFF, 0xFF, 0xFD, 0x88, 0x89, 0xEF, 0xFF, 0x4F,
+  0xFF, 0xF0, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+  0x07, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x17, 0xBE, 0xFF,
+  0xDA, 0x61, 0x00, 0x4F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
+  0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xFF, 0xFE, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF,
+  0xF8, 0x00, 0x00, 0x08, 0xFD, 0x84, 0x00, 0x00, 0x02, 0x7D, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x08,
+  0xFF, 0xFF, 0xFE, 0xBC, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x02, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x78, 0x88, 0x88, 0x52, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+  0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0xFF, 0x40, 0x00, 0x16, 0x8B, 0xBB, 0x86, 0x10, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x07,
+  0xEF, 0xFF, 0xFF, 0xFF, 0xE7, 0x00, 0x00, 0xBF, 0xFF, 0x41, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x90, 0x00, 0xBF, 0xFF, 0x4A, 0xFF, 0xFF, 0xEB, 0xEF, 0xFF, 0xFF, 0xF7, 0x00, 0xBF, 0xFF, 0xBF,
+  0xFD, 0x61, 0x00, 0x02, 0x8F, 0xFF, 0xFE, 0x10, 0xBF, 0xFF, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x06,
+  0xFF, 0xFF, 0x70, 0xBF, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0xBF, 0xFF,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF0, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1F, 0xFF, 0xF2, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF,
+  0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4,
+  0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF,
+  0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0x34, 0x44,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x44, 0x20, 0xBF, 0xFF, 0x80,
+  0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF,
+  0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF,
+  0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80,
+  0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF,
+  0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B,
+  0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF,
+  0xF8, 0x00, 0x00, 0x03, 0x44, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x44, 0x42, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00,
+  0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
+  0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B,
+  0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF,
+  0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
+  0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00,
+  0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00,
+  0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B,
+  0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF,
+  0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xF6, 0x00, 0x00, 0x0E, 0xFF, 0xF4, 0x00, 0x00, 0x4F, 0xFF, 0xF0,
+  0x00, 0x05, 0xEF, 0xFF, 0xA0, 0xBF, 0xFF, 0xFF, 0xFF, 0x40, 0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0xBF,
+  0xFF, 0xFD, 0x60, 0x00, 0x68, 0x88, 0x40, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x44, 0x44,
+  0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xE3, 0x00, 0xBF, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFE, 0x30, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x06,
+  0xFF, 0xFF, 0xC1, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFB, 0x10, 0x00,
+  0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40,
+  0x00, 0x01, 0xAF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x1C, 0xFF, 0xFF,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x03, 0xDF, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0xFF, 0x40, 0x3E, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x46,
+  0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x9F, 0xFF, 0xFC, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0xFF, 0xEF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x5C,
+  0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x41, 0xCF, 0xFF, 0xF9, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x1C, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0xFF, 0x40, 0x00, 0x9F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40,
+  0x00, 0x09, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x9F, 0xFF,
+  0xFA, 0x10, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xC1, 0x00, 0x00,
+  0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0xBF, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x7F, 0xFF, 0xFC, 0x10, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xC1,
+  0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFC, 0x10, 0xBF, 0xFF, 0x80,
+  0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF,
+  0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF,
+  0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80,
+  0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF,
+  0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF,
+  0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80,
+  0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0x34, 0x44, 0x10, 0x00, 0x16, 0x9B, 0xBB, 0x83, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x8B, 0xBB, 0x86, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x08, 0xEF, 0xFF, 0xFF,
+  0xFF, 0xB2, 0x00, 0x00, 0x05, 0xDF, 0xFF, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0xBF, 0xFF, 0x41, 0xCF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0xBF,
+  0xFF, 0x4C, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFF, 0xC0, 0x09, 0xFF, 0xFF, 0xEB, 0xEF, 0xFF, 0xFF,
+  0xE2, 0x00, 0xBF, 0xFF, 0xBF, 0xFC, 0x50, 0x00, 0x04, 0xCF, 0xFF, 0xF6, 0x5F, 0xFE, 0x81, 0x00,
+  0x02, 0xAF, 0xFF, 0xFA, 0x00, 0xBF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFD, 0xEF,
+  0xC2, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x20, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0x70, 0xBF, 0xFF, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x90, 0xBF, 0xFF,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0xB0, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0xFF, 0xC0, 0xBF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xBF, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0,
+  0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0xFF, 0xF0, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xBF, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xBF,
+  0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0xFF, 0xF0, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xBF, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xBF, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+  0xF0, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0xFF, 0xF0, 0x34, 0x44, 0x10, 0x00, 0x16, 0x8B, 0xBB, 0x86, 0x10, 0x00, 0x00, 0xBF,
+  0xFF, 0x40, 0x07, 0xEF, 0xFF, 0xFF, 0xFF, 0xE7, 0x00, 0x00, 0xBF, 0xFF, 0x41, 0xAF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x90, 0x00, 0xBF, 0xFF, 0x4A, 0xFF, 0xFF, 0xEB, 0xEF, 0xFF, 0xFF, 0xF7, 0x00,
+  0xBF, 0xFF, 0xBF, 0xFD, 0x61, 0x00, 0x02, 0x8F, 0xFF, 0xFE, 0x10, 0xBF, 0xFF, 0xFF, 0xA1, 0x00,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0x70, 0xBF, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0xB0, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF0, 0xBF, 0xFF, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF2, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xF4, 0xBF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF,
+  0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4,
+  0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+  0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF4, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x58, 0xAB, 0xBB, 0x85, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x8E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xEB, 0xBD, 0xFF, 0xFF, 0xFF,
+  0x60, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x9F,
+  0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFB, 0x00, 0x02, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0xFF, 0xFF, 0x40, 0x08, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF,
+  0xFF, 0xA0, 0x0D, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x1F, 0xFF,
+  0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x4F, 0xFF, 0xF2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF7, 0x6F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+  0xFF, 0xF8, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x8F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x8F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x5F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
+  0xFF, 0xF8, 0x4F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF7, 0x1F, 0xFF,
+  0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x0C, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF0, 0x08, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF,
+  0xFF, 0x90, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x8F,
+  0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFB, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xD6, 0x00,
+  0x00, 0x5B, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xFE, 0xDF, 0xFF, 0xFF, 0xFE,
+  0x30, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x6D, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x89,
+  0xA8, 0x74, 0x00, 0x00, 0x00, 0x00, 0x34, 0x44, 0x10, 0x00, 0x27, 0x9B, 0xBB, 0x84, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0xFF, 0x40, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0x41, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0x5C, 0xFF, 0xFE, 0xBB,
+  0xBF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xCF, 0xFD, 0x60, 0x00, 0x01, 0x8E, 0xFF, 0xFF,
+  0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xD0, 0x00, 0xBF, 0xFF,
+  0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xFC, 0x00, 0xBF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0x10, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x50, 0xBF, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+  0xFF, 0xB0, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xB0, 0xBF, 0xFF,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+  0xFF, 0x80, 0xBF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x40, 0xBF, 0xFF,
+  0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x10, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0D, 0xFF, 0xFA, 0x00, 0xBF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+  0xF6, 0x00, 0xBF, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xC0, 0x00, 0xBF, 0xFF,
+  0xBF, 0xFE, 0x81, 0x00, 0x02, 0x9F, 0xFF, 0xFF, 0x30, 0x00, 0xBF, 0xFF, 0x4C, 0xFF, 0xFF, 0xDB,
+  0xEF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0xBF, 0xFF, 0x41, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60,
+  0x00, 0x00, 0xBF, 0xFF, 0x40, 0x08, 0xEF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0x40, 0x00, 0x05, 0x89, 0xB8, 0x72, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x88, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8A, 0xBB, 0xA7, 0x20, 0x00, 0x04,
+  0x44, 0x40, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x20, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+  0x6E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x0F, 0xFF, 0xF0, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xCB,
+  0xBD, 0xFF, 0xFE, 0x3F, 0xFF, 0xF0, 0x00, 0x2E, 0xFF, 0xFF, 0x82, 0x00, 0x00, 0x4C, 0xFF, 0xBF,
+  0xFF, 0xF0, 0x00, 0x9F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xF0, 0x02, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xF0, 0x08, 0xFF, 0xFE, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF0, 0x0D, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+  0xFF, 0xF0, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x4F, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF0, 0x6F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0xFF, 0xF0, 0x8F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x8F, 0xFF,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x5F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0x4F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
+  0xFF, 0xF0, 0x1F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF0, 0x0C, 0xFF,
+  0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF0, 0x08, 0xFF, 0xFE, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF0, 0x02, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF,
+  0xFF, 0xF0, 0x00, 0x9F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xF0, 0x00, 0x1D,
+  0xFF, 0xFF, 0xA3, 0x00, 0x00, 0x6D, 0xFF, 0xBF, 0xFF, 0xF0, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xEB,
+  0xCF, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x0F,
+  0xFF, 0xF0, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xFF, 0xF9, 0x10, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x02, 0x68, 0xAA, 0x86, 0x10, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x88, 0x80, 0x34, 0x44, 0x10, 0x00, 0x16, 0x8B, 0xBB, 0x80, 0xBF, 0xFF,
+  0x40, 0x08, 0xEF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0x41, 0xCF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF,
+  0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xBF, 0xFE, 0x83, 0x00, 0x02, 0x80, 0xBF, 0xFF,
+  0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x58, 0xBB, 0xBB, 0xB8, 0x84, 0x00, 0x00,
+  0x00, 0x02, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x20, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xEF, 0xFF, 0xFF, 0xDB, 0xBB, 0xBE, 0xFF, 0xFF, 0x40, 0x0A, 0xFF,
+  0xFE, 0x82, 0x00, 0x00, 0x00, 0x16, 0xAF, 0x40, 0x1F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x10, 0x4F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD7, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFD, 0x97, 0x30, 0x00, 0x00, 0x00, 0x00, 0x6E,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x93, 0x00, 0x00, 0x00, 0x02, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xB2, 0x00, 0x00, 0x00, 0x01, 0x69, 0xDF, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x59, 0xDF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xDF, 0xFF, 0xF5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF8, 0x8A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
+  0xFF, 0xF5, 0x8F, 0xFD, 0x84, 0x10, 0x00, 0x00, 0x39, 0xFF, 0xFF, 0xD0, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xBB, 0xCF, 0xFF, 0xFF, 0xFE, 0x30, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00,
+  0x16, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x10, 0x00, 0x00, 0x00, 0x25, 0x88, 0xAB, 0x88,
+  0x63, 0x00, 0x00, 0x00, 0x00, 0x03, 0x44, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x34, 0x4C, 0xFF, 0xF9,
+  0x44, 0x44, 0x44, 0x44, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0B, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFA,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF,
+  0xFA, 0x88, 0x88, 0x88, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x08, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x28, 0xBD, 0xFF, 0xFF, 0xFF, 0x44, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x44, 0x40, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xFF, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+  0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF0, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+  0xFF, 0xF0, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF0, 0xBF, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x8F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x0B,
+  0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF,
+  0xFF, 0xB5, 0x00, 0x02, 0x7D, 0xFF, 0xCF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x5F, 0xFF, 0xF0, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x4F, 0xFF, 0xF0, 0x00,
+  0x03, 0xBF, 0xFF, 0xFF, 0xFF, 0xE7, 0x00, 0x4F, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0x78, 0xB9, 0x85,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+  0x44, 0x30, 0x6F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x90, 0x1E,
+  0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x30, 0x09, 0xFF, 0xFB, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFD, 0x00, 0x04, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00, 0xDF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0xFF, 0xF2, 0x00, 0x00, 0x8F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xA0, 0x00,
+  0x00, 0x2F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0x60, 0x00, 0x00, 0x0B, 0xFF,
+  0xF9, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x2F,
+  0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xD0, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x0D, 0xFF, 0xF7, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFD,
+  0x00, 0x00, 0x09, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x30, 0x00, 0x0E,
+  0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x90, 0x00, 0x6F, 0xFF, 0xE0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE0, 0x00, 0xAF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1E, 0xFF, 0xF5, 0x02, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xFF, 0xFA, 0x07, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x1D,
+  0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x9F, 0xFF, 0xF2, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x44,
+  0x41, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x43, 0xDF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xCF,
+  0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF8, 0x9F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x01,
+  0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF4, 0x6F, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x05, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF0, 0x2F, 0xFF, 0xF1, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xB0, 0x0D, 0xFF, 0xF5, 0x00,
+  0x00, 0x00, 0x0D, 0xFF, 0xDF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x70, 0x08, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x2F, 0xFF, 0x8D, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x30, 0x05, 0xFF,
+  0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x49, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x01,
+  0xFF, 0xFF, 0x10, 0x00, 0x00, 0x9F, 0xFF, 0x06, 0xFF, 0xF4, 0x00, 0x00, 0x07, 0xFF, 0xFA, 0x00,
+  0x00, 0xCF, 0xFF, 0x60, 0x00, 0x00, 0xDF, 0xFB, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x0A, 0xFF, 0xF7,
+  0x00, 0x00, 0x8F, 0xFF, 0x90, 0x00, 0x02, 0xFF, 0xF7, 0x00, 0xCF, 0xFC, 0x00, 0x00, 0x0E, 0xFF,
+  0xF3, 0x00, 0x00, 0x5F, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xF3, 0x00, 0x8F, 0xFF, 0x10, 0x00, 0x4F,
+  0xFF, 0xD0, 0x00, 0x00, 0x0F, 0xFF, 0xF2, 0x00, 0x0A, 0xFF, 0xE0, 0x00, 0x5F, 0xFF, 0x50, 0x00,
+  0x8F, 0xFF, 0x90, 0x00, 0x00, 0x0B, 0xFF, 0xF6, 0x00, 0x0E, 0xFF, 0xA0, 0x00, 0x1F, 0xFF, 0x80,
+  0x00, 0xBF, 0xFF, 0x60, 0x00, 0x00, 0x08, 0xFF, 0xFA, 0x00, 0x3F, 0xFF, 0x70, 0x00, 0x0C, 0xFF,
+  0xC0, 0x00, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x04, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x20, 0x00, 0x08,
+  0xFF, 0xF2, 0x05, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x30, 0xBF, 0xFD, 0x00, 0x00,
+  0x04, 0xFF, 0xF6, 0x08, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x70, 0xFF, 0xF9, 0x00,
+  0x00, 0x00, 0xFF, 0xF9, 0x0C, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xA4, 0xFF, 0xF6,
+  0x00, 0x00, 0x00, 0xBF, 0xFD, 0x1F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0xFF,
+  0xF2, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF,
+  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xEF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+  0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xDF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF4, 0x00, 0x00,
+  0x00, 0x03, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x44, 0x44, 0x10, 0x06, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFB, 0x00, 0x00, 0x9F, 0xFF, 0xF4, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xE1, 0x00, 0x00, 0x1C, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00,
+  0x09, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0xFF, 0xFF, 0x40, 0x00, 0x0C, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF,
+  0xFF, 0xE1, 0x00, 0x8F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFB, 0x05,
+  0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x9E, 0xFF, 0xFC, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+  0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x7F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x6F, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF,
+  0xB0, 0x00, 0xAF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFE, 0x10, 0x00, 0x1E,
+  0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x90,
+  0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+  0x2E, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0xCF, 0xFF, 0xE2,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xC1, 0x00, 0x08, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFF, 0xF9, 0x00, 0x5F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0xFF, 0x60, 0x24, 0x44, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0x30,
+  0x6F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x90, 0x0E, 0xFF, 0xF6,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x30, 0x08, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1E, 0xFF, 0xF6, 0x00, 0x00, 0xAF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE1,
+  0x00, 0x00, 0x5F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x90, 0x00, 0x00, 0x0D,
+  0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x08, 0xFF, 0xFC, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+  0x1E, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x0D, 0xFF, 0xF6, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+  0xFC, 0x00, 0x00, 0x09, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0x30, 0x00,
+  0x1E, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x90, 0x00, 0x6F, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE1, 0x00, 0xCF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF6, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xFF, 0xFC, 0x09, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF,
+  0x4E, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xDF, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xDF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xD0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF,
+  0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x88, 0x87, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x10, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x8F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x40, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4E, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
+  0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xE3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F,
+  0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF,
+  0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF,
+  0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE4, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x8B, 0xBF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFD, 0x85, 0x44, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0xDF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+  0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0D, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xF3, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x68, 0x9E, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF,
+  0xFF, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFD, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3B, 0xBF, 0xFF, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xEF, 0xFF,
+  0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0A, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
+  0xFF, 0xFF, 0xFB, 0xBB, 0x60, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+  0x78, 0x88, 0x40, 0x14, 0x44, 0x30, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F,
+  0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF,
+  0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0,
+  0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F,
+  0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF,
+  0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0,
+  0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F,
+  0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF,
+  0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x4F, 0xFF, 0xB0, 0x3B, 0xBB, 0x80,
+  0x4F, 0xFF, 0xCB, 0x86, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xE6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x14, 0x44,
+  0x7A, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xA8, 0x74, 0x20, 0x00, 0x00, 0x00, 0x00, 0x04, 0xCF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x1A, 0xFF, 0xFF, 0xFF, 0xCB, 0x60, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF8, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0B, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF6, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCF,
+  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xBB, 0xDF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0xFF, 0xFF, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFD, 0x81, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x88, 0x84, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02,
+  0x7A, 0xBB, 0xB9, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x00, 0x04, 0xBF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFB, 0x01, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE9, 0x50, 0x00, 0x00, 0x39, 0xFF, 0xFB, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xBF, 0xFF, 0xFF, 0xF9, 0x4F, 0xFF, 0xE9, 0x40, 0x00, 0x15, 0x9E,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x4F, 0xF8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5A,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x92, 0x00, 0x4E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+  0x9B, 0xFF, 0xDA, 0x72, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const AtlasGlyph Atlas_Main_Glyphs[95] PROGMEM = {
+  {     0,  0,  0,   0,   0, 15 },  // ' '
+  {     0,  5, 34,   7, -34, 18 },  // '!'
+  {   102, 13, 13,   4, -34, 21 },  // '"'
+  {   193, 32, 33,   3, -33, 39 },  // '#'
+  {   721, 23, 42,   3, -35, 29 },  // '$'
+  {  1225, 40, 36,   2, -35, 44 },  // '%'
+  {  1945, 32, 36,   3, -35, 36 },  // '&'
+  {  2521,  5, 13,   4, -34, 13 },  // '''
+  {  2560, 11, 41,   4, -35, 18 },  // '('
+  {  2806, 11, 41,   3, -35, 18 },  // ')'
+  {  3052, 21, 22,   1, -35, 23 },  // '*'
+  {  3294, 30, 29,   4, -29, 39 },  // '+'
+  {  3729,  8, 12,   3,  -6, 15 },  // ','
+  {  3777, 13,  5,   2, -15, 17 },  // '-'
+  {  3812,  5,  6,   5,  -6, 15 },  // '.'
+  {  3830, 16, 39,   0, -34, 15 },  // '/'
+  {  4142, 24, 36,   3, -35, 29 },  // '0'
+  {  4574, 20, 34,   5, -34, 29 },  // '1'
+  {  4914, 22, 35,   3, -35, 29 },  // '2'
+  {  5299, 23, 36,   3, -35, 29 },  // '3'
+  {  5731, 25, 34,   2, -34, 29 },  // '4'
+  {  6173, 23, 35,   3, -34, 29 },  // '5'
+  {  6593, 24, 36,   3, -35, 29 },  // '6'
+  {  7025, 23, 34,   3, -34, 29 },  // '7'
+  {  7433, 23, 36,   3, -35, 29 },  // '8'
+  {  7865, 23, 36,   3, -35, 29 },  // '9'
+  {  8297,  6, 24,   5, -24, 15 },  // ':'
+  {  8369,  8, 30,   3, -24, 15 },  // ';'
+  {  8489, 30, 25,   4, -27, 39 },  // '<'
+  {  8864, 30, 13,   4, -21, 39 },  // '='
+  {  9059, 30, 25,   4, -27, 39 },  // '>'
+  {  9434, 19, 35,   3, -35, 24 },  // '?'
+  {  9784, 40, 41,   3, -33, 46 },  // '@'
+  { 10604, 31, 34,   0, -34, 31 },  // 'A'
+  { 11148, 25, 34,   4, -34, 32 },  // 'B'
+  { 11590, 28, 36,   2, -35, 32 },  // 'C'
+  { 12094, 29, 34,   4, -34, 35 },  // 'D'
+  { 12604, 22, 34,   4, -34, 29 },  // 'E'
+  { 12978, 20, 34,   4, -34, 26 },  // 'F'
+  { 13318, 30, 36,   2, -35, 36 },  // 'G'
+  { 13858, 26, 34,   4, -34, 35 },  // 'H'
+  { 14300,  5, 34,   4, -34, 14 },  // 'I'
+  { 14402, 12, 44,  -3, -34, 14 },  // 'J'
+  { 14666, 27, 34,   4, -34, 30 },  // 'K'
+  { 15142, 22, 34,   4, -34, 26 },  // 'L'
+  { 15516, 32, 34,   4, -34, 40 },  // 'M'
+  { 16060, 26, 34,   4, -34, 34 },  // 'N'
+  { 16502, 32, 36,   2, -35, 36 },  // 'O'
+  { 17078, 23, 34,   4, -34, 28 },  // 'P'
+  { 17486, 32, 41,   2, -35, 36 },  // 'Q'
+  { 18142, 27, 34,   4, -34, 32 },  // 'R'
+  { 18618, 24, 36,   3, -35, 29 },  // 'S'
+  { 19050, 30, 34,  -1, -34, 28 },  // 'T'
+  { 19560, 26, 35,   4, -34, 34 },  // 'U'
+  { 20015, 31, 34,   0, -34, 31 },  // 'V'
+  { 20559, 43, 34,   1, -34, 45 },  // 'W'
+  { 21307, 29, 34,   1, -34, 32 },  // 'X'
+  { 21817, 28, 34,   0, -34, 28 },  // 'Y'
+  { 22293, 28, 34,   2, -34, 32 },  // 'Z'
+  { 22769, 10, 41,   4, -35, 18 },  // '['
+  { 22974, 16, 39,   0, -34, 15 },  // '\\'
+  { 23286, 10, 41,   4, -35, 18 },  // ']'
+  { 23491, 29, 13,   5, -34, 39 },  // '^'
+  { 23686, 25,  4,  -1,   7, 23 },  // '_'
+  { 23738, 11,  9,   4, -37, 23 },  // '`'
+  { 23792, 22, 27,   2, -26, 28 },  // 'a'
+  { 24089, 23, 36,   4, -35, 29 },  // 'b'
+  { 24521, 21, 27,   2, -26, 25 },  // 'c'
+  { 24818, 23, 36,   2, -35, 29 },  // 'd'
+  { 25250, 24, 27,   2, -26, 28 },  // 'e'
+  { 25574, 16, 35,   1, -35, 16 },  // 'f'
+  { 25854, 23, 36,   2, -26, 29 },  // 'g'
+  { 26286, 22, 35,   4, -35, 29 },  // 'h'
+  { 26671,  5, 35,   4, -35, 13 },  // 'i'
+  { 26776, 10, 45,  -1, -35, 13 },  // 'j'
+  { 27001, 23, 35,   4, -35, 27 },  // 'k'
+  { 27421,  5, 35,   4, -35, 13 },  // 'l'
+  { 27526, 37, 26,   4, -26, 45 },  // 'm'
+  { 28020, 22, 26,   4, -26, 29 },  // 'n'
+  { 28306, 24, 27,   2, -26, 28 },  // 'o'
+  { 28630, 23, 36,   4, -26, 29 },  // 'p'
+  { 29062, 23, 36,   2, -26, 29 },  // 'q'
+  { 29494, 15, 26,   4, -26, 19 },  // 'r'
+  { 29702, 20, 27,   2, -26, 24 },  // 's'
+  { 29972, 16, 33,   1, -33, 18 },  // 't'
+  { 30236, 21, 27,   4, -26, 29 },  // 'u'
+  { 30533, 25, 26,   1, -26, 27 },  // 'v'
+  { 30871, 34, 26,   2, -26, 38 },  // 'w'
+  { 31313, 25, 26,   1, -26, 27 },  // 'x'
+  { 31651, 25, 36,   1, -26, 27 },  // 'y'
+  { 32119, 21, 26,   2, -26, 24 },  // 'z'
+  { 32405, 19, 43,   5, -35, 29 },  // '{'
+  { 32835,  5, 47,   5, -36, 15 },  // '|'
+  { 32976, 19, 43,   5, -35, 29 },  // '}'
+  { 33406, 30,  9,   4, -19, 39 },  // '~'
+};
+
+const AtlasFont Atlas_Main PROGMEM = {Atlas_Main_Bitmap, Atlas_Main_Glyphs, 0x20, 0x7E, 54, 35, 11};
+
+// Atlas_Header, 23px em from DejaVuSans.ttf, replaces FF26 at text size 1
+const uint8_t Atlas_Header_Bitmap[8881] PROGMEM = {
+  0x6B, 0x80, 0x8F, 0xB0, 0x8F, 0xB0, 0x8F, 0xB0, 0x8F, 0xB0, 0x8F, 0xB0, 0x8F, 0xB0, 0x8F, 0xB0,
+  0x8F, 0xB0, 0x8F, 0xA0, 0x5F, 0x80, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x80, 0x8F, 0xB0,
+  0x8F, 0xB0, 0x8B, 0x00, 0x6B, 0x30, 0xBF, 0x00, 0x8F, 0x40, 0xBF, 0x00, 0x8F, 0x40, 0xBF, 0x00,
+  0x8F, 0x40, 0xBF, 0x00, 0x8F, 0x40, 0xBF, 0x00, 0x8F, 0x40, 0x68, 0x00, 0x48, 0x20, 0x00, 0x00,
+  0x00, 0x06, 0x80, 0x00, 0x68, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0xDE, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0x80, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x50, 0x06, 0xF7,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x10, 0x09, 0xF3, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xFF, 0xBB,
+  0xBE, 0xFB, 0xBB, 0x60, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x08,
+  0xF5, 0x00, 0x6F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF1, 0x00, 0x9F, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xC0, 0x00, 0xDE, 0x00, 0x00, 0x00, 0x14, 0x44, 0x7F, 0xA4, 0x45, 0xFC, 0x44, 0x41,
+  0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x14, 0x44, 0xCF, 0x44, 0x4B, 0xF6,
+  0x44, 0x41, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x0D, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00,
+  0x2F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x6F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0B,
+  0xF1, 0x00, 0x9F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x01, 0x6A, 0xCE, 0xBB, 0x83, 0x00, 0x1C,
+  0xFF, 0xCE, 0xBF, 0xFB, 0x00, 0xAF, 0x91, 0x4B, 0x00, 0x58, 0x00, 0xFF, 0x10, 0x4B, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0x4B, 0x00, 0x00, 0x00, 0xDF, 0x90, 0x4B, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0xCD,
+  0x51, 0x00, 0x00, 0x04, 0xAF, 0xFF, 0xFF, 0x92, 0x00, 0x00, 0x01, 0x7D, 0xAF, 0xFE, 0x10, 0x00,
+  0x00, 0x4B, 0x02, 0xCF, 0x80, 0x00, 0x00, 0x4B, 0x00, 0x6F, 0xB0, 0x00, 0x00, 0x4B, 0x00, 0x7F,
+  0xA0, 0xB4, 0x00, 0x4B, 0x03, 0xEF, 0x60, 0xFF, 0xDB, 0x9E, 0xCF, 0xF9, 0x00, 0x38, 0xBF, 0xFF,
+  0xEA, 0x50, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xFD, 0x50, 0x00,
+  0x00, 0x02, 0xEB, 0x00, 0x00, 0x1D, 0xE8, 0x6D, 0xF4, 0x00, 0x00, 0x0A, 0xF2, 0x00, 0x00, 0x7F,
+  0x80, 0x03, 0xFA, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0xAF, 0x20, 0x00, 0xDF, 0x00, 0x00, 0xDD,
+  0x10, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x08, 0xF5, 0x00, 0x00, 0x00, 0xAF, 0x20, 0x00,
+  0xDF, 0x00, 0x2E, 0xB0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x03, 0xFA, 0x00, 0xAF, 0x20, 0x00, 0x00,
+  0x00, 0x1D, 0xE8, 0x7D, 0xF4, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0xFD, 0x50, 0x0D,
+  0xD1, 0x02, 0x9B, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x50, 0x3E, 0xEB, 0xCF, 0x80, 0x00,
+  0x00, 0x00, 0x02, 0xEA, 0x00, 0xBF, 0x30, 0x0B, 0xF3, 0x00, 0x00, 0x00, 0x0B, 0xE2, 0x00, 0xFB,
+  0x00, 0x05, 0xF8, 0x00, 0x00, 0x00, 0x5F, 0x80, 0x04, 0xFB, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x01,
+  0xDD, 0x00, 0x02, 0xFB, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0xED, 0x00, 0x08,
+  0xF6, 0x00, 0x00, 0x2F, 0xA0, 0x00, 0x00, 0x8F, 0x92, 0x5E, 0xD1, 0x00, 0x00, 0xBE, 0x20, 0x00,
+  0x00, 0x09, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x24, 0x40, 0x00, 0x00,
+  0x01, 0x8E, 0xFF, 0xEA, 0x50, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xBB, 0xDF, 0xB0, 0x00, 0x00, 0x00,
+  0x6F, 0xE3, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x9F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0C, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0xFE, 0x4C, 0xFC, 0x10, 0x00, 0x0B, 0xF6, 0x1E, 0xF4, 0x01, 0xCF, 0xC1, 0x00, 0x0C, 0xF3, 0x6F,
+  0xC0, 0x00, 0x1C, 0xFC, 0x10, 0x2F, 0xD0, 0x8F, 0x90, 0x00, 0x01, 0xCF, 0xC1, 0x8F, 0x80, 0x8F,
+  0xB0, 0x00, 0x00, 0x1E, 0xFC, 0xEE, 0x10, 0x5F, 0xF2, 0x00, 0x00, 0x03, 0xEF, 0xF6, 0x00, 0x0D,
+  0xFC, 0x20, 0x00, 0x03, 0xCF, 0xFC, 0x10, 0x03, 0xEF, 0xFA, 0x88, 0xCF, 0xF9, 0xEF, 0xC1, 0x00,
+  0x29, 0xFF, 0xFF, 0xFB, 0x40, 0x3E, 0xF9, 0x00, 0x00, 0x14, 0x44, 0x20, 0x00, 0x00, 0x00, 0x8B,
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x68, 0x00, 0x06, 0x80, 0x00, 0x4F, 0x90, 0x00, 0xBF, 0x20, 0x04,
+  0xF9, 0x00, 0x0B, 0xF5, 0x00, 0x2F, 0xE0, 0x00, 0x7F, 0xA0, 0x00, 0xAF, 0x80, 0x00, 0xCF, 0x40,
+  0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0xFF, 0x40, 0x00, 0xBF, 0x60, 0x00,
+  0x8F, 0x80, 0x00, 0x5F, 0xC0, 0x00, 0x0E, 0xF1, 0x00, 0x08, 0xF7, 0x00, 0x02, 0xFD, 0x00, 0x00,
+  0x8F, 0x50, 0x00, 0x1E, 0xD0, 0x86, 0x00, 0x00, 0x9F, 0x40, 0x00, 0x2F, 0xB0, 0x00, 0x0A, 0xF4,
+  0x00, 0x05, 0xFA, 0x00, 0x00, 0xEF, 0x10, 0x00, 0xAF, 0x60, 0x00, 0x8F, 0x90, 0x00, 0x5F, 0xC0,
+  0x00, 0x4F, 0xF0, 0x00, 0x4F, 0xF0, 0x00, 0x4F, 0xF0, 0x00, 0x4F, 0xE0, 0x00, 0x7F, 0xB0, 0x00,
+  0x8F, 0x80, 0x00, 0xCF, 0x50, 0x02, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x0D, 0xF2, 0x00, 0x6F, 0x80,
+  0x00, 0xDE, 0x10, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+  0x1D, 0x70, 0x0F, 0x80, 0x2B, 0x80, 0x07, 0xEC, 0x4F, 0x88, 0xFB, 0x20, 0x00, 0x18, 0xEF, 0xFB,
+  0x40, 0x00, 0x00, 0x02, 0xBF, 0xE7, 0x00, 0x00, 0x02, 0x9F, 0x8F, 0xAD, 0xD6, 0x00, 0x2E, 0xB3,
+  0x0F, 0x80, 0x8E, 0x80, 0x04, 0x00, 0x0F, 0x80, 0x02, 0x20, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x24, 0x44, 0x44, 0x7F, 0x94, 0x44, 0x44, 0x30, 0x8F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x6B, 0xBB, 0xBB, 0xCF, 0xDB, 0xBB, 0xBB, 0x80, 0x00, 0x00,
+  0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x03, 0xBB,
+  0x04, 0xFF, 0x07, 0xFD, 0x0A, 0xF6, 0x0E, 0xD0, 0x2B, 0x50, 0x44, 0x44, 0x44, 0x10, 0xFF, 0xFF,
+  0xFF, 0x40, 0x88, 0x88, 0x88, 0x20, 0x6B, 0x80, 0x8F, 0xB0, 0x8F, 0xB0, 0x00, 0x00, 0x03, 0xB8,
+  0x00, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x0D, 0xF1, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x7F, 0x70,
+  0x00, 0x00, 0xCF, 0x20, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x0A, 0xF3, 0x00,
+  0x00, 0x1F, 0xD0, 0x00, 0x00, 0x5F, 0x80, 0x00, 0x00, 0x9F, 0x50, 0x00, 0x00, 0xEE, 0x00, 0x00,
+  0x05, 0xF9, 0x00, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x0D, 0xF1, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00,
+  0x8F, 0x70, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x05, 0xCF, 0xFE,
+  0x92, 0x00, 0x00, 0x6F, 0xFD, 0xBE, 0xFE, 0x30, 0x03, 0xFF, 0x60, 0x01, 0xAF, 0xC0, 0x0A, 0xF9,
+  0x00, 0x00, 0x1E, 0xF5, 0x0F, 0xF5, 0x00, 0x00, 0x09, 0xF9, 0x4F, 0xF0, 0x00, 0x00, 0x07, 0xFD,
+  0x6F, 0xE0, 0x00, 0x00, 0x04, 0xFF, 0x8F, 0xB0, 0x00, 0x00, 0x04, 0xFF, 0x8F, 0xB0, 0x00, 0x00,
+  0x04, 0xFF, 0x8F, 0xB0, 0x00, 0x00, 0x04, 0xFF, 0x7F, 0xD0, 0x00, 0x00, 0x04, 0xFF, 0x4F, 0xF0,
+  0x00, 0x00, 0x06, 0xFE, 0x1F, 0xF3, 0x00, 0x00, 0x08, 0xFA, 0x0C, 0xF8, 0x00, 0x00, 0x0D, 0xF6,
+  0x06, 0xFE, 0x30, 0x00, 0x8F, 0xE1, 0x00, 0x9F, 0xE8, 0x8B, 0xFF, 0x50, 0x00, 0x08, 0xFF, 0xFF,
+  0xD5, 0x00, 0x00, 0x00, 0x14, 0x43, 0x00, 0x00, 0x03, 0x68, 0xBB, 0x80, 0x00, 0x00, 0x8F, 0xFF,
+  0xFF, 0xB0, 0x00, 0x00, 0x8E, 0xB8, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xB0,
+  0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0x8C,
+  0xFF, 0xFD, 0x81, 0x00, 0x4F, 0xFF, 0xFB, 0xEF, 0xFC, 0x10, 0x4E, 0x82, 0x00, 0x05, 0xEF, 0xB0,
+  0x11, 0x00, 0x00, 0x00, 0x6F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xEF, 0x70, 0x00, 0x00,
+  0x00, 0x1C, 0xFB, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xC1, 0x00, 0x00, 0x00, 0x1C, 0xFC, 0x10, 0x00,
+  0x00, 0x01, 0xCF, 0xC1, 0x00, 0x00, 0x00, 0x1C, 0xFC, 0x10, 0x00, 0x00, 0x01, 0xCF, 0xC1, 0x00,
+  0x00, 0x00, 0x0A, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x4F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF4, 0x06, 0xAD, 0xFF, 0xFE, 0x93, 0x00, 0x0B, 0xFF, 0xEB, 0xEF, 0xFF, 0x60,
+  0x07, 0x51, 0x00, 0x02, 0xCF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF5, 0x00, 0x00, 0x00, 0x00,
+  0x0D, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF3, 0x00, 0x00, 0x00, 0x02, 0xCF, 0x90, 0x00, 0x04,
+  0xFF, 0xFF, 0xE8, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x05, 0xCF, 0xC1,
+  0x00, 0x00, 0x00, 0x00, 0x1D, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x35, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x4F, 0xEB,
+  0x88, 0xBE, 0xFF, 0x90, 0x2A, 0xFF, 0xFF, 0xFF, 0xC5, 0x00, 0x00, 0x04, 0x44, 0x42, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2B, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xD4, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x44,
+  0xFF, 0x00, 0x00, 0x00, 0x05, 0xF8, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x1E, 0xD1, 0x04, 0xFF, 0x00,
+  0x00, 0x00, 0xAF, 0x50, 0x04, 0xFF, 0x00, 0x00, 0x05, 0xFA, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x1E,
+  0xE1, 0x00, 0x04, 0xFF, 0x00, 0x00, 0xAF, 0x70, 0x00, 0x04, 0xFF, 0x00, 0x00, 0xFF, 0xBB, 0xBB,
+  0xBC, 0xFF, 0xBB, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x06, 0xBB, 0xBB, 0xBB, 0xBB, 0x60, 0x08, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x08, 0xF9, 0x44, 0x44, 0x44, 0x20, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFD, 0xFF, 0xFD, 0x81,
+  0x00, 0x08, 0xFF, 0xCB, 0xFF, 0xFD, 0x30, 0x04, 0x50, 0x00, 0x06, 0xEF, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF6, 0x25, 0x00, 0x00, 0x02, 0xCF,
+  0xE1, 0x4F, 0xEB, 0x88, 0xBF, 0xFF, 0x50, 0x3C, 0xFF, 0xFF, 0xFF, 0xA3, 0x00, 0x00, 0x04, 0x44,
+  0x41, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0xFD, 0x90, 0x00, 0x00, 0x1A, 0xFF, 0xFB, 0xEF, 0xF0,
+  0x00, 0x00, 0x9F, 0xE5, 0x00, 0x01, 0x60, 0x00, 0x04, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF1, 0x8E,
+  0xFF, 0xD8, 0x00, 0x00, 0x4F, 0xEC, 0xFD, 0xBC, 0xFF, 0xA0, 0x00, 0x8F, 0xFF, 0x70, 0x00, 0x5F,
+  0xF8, 0x00, 0x6F, 0xFB, 0x00, 0x00, 0x08, 0xFD, 0x00, 0x4F, 0xF6, 0x00, 0x00, 0x04, 0xFF, 0x10,
+  0x3F, 0xF4, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x0E, 0xF5, 0x00, 0x00, 0x03, 0xFF, 0x20, 0x09, 0xF9,
+  0x00, 0x00, 0x06, 0xFE, 0x00, 0x04, 0xFF, 0x30, 0x00, 0x3E, 0xF8, 0x00, 0x00, 0x8F, 0xF9, 0x88,
+  0xEF, 0xC1, 0x00, 0x00, 0x07, 0xEF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x04, 0x44, 0x10, 0x00,
+  0x00, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x44, 0x44, 0x44,
+  0x47, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x09, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF6, 0x00, 0x00,
+  0x00, 0x00, 0x6F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x08, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x5F,
+  0xF2, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xA0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x50, 0x00, 0x00, 0x00,
+  0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF2, 0x00, 0x00,
+  0x00, 0x00, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xFF, 0xC6, 0x00, 0x02, 0xEF, 0xFC,
+  0xBD, 0xFF, 0x90, 0x0A, 0xFD, 0x30, 0x00, 0x7F, 0xF5, 0x0F, 0xF6, 0x00, 0x00, 0x0C, 0xF8, 0x0F,
+  0xF4, 0x00, 0x00, 0x08, 0xFB, 0x0D, 0xF6, 0x00, 0x00, 0x0C, 0xF7, 0x05, 0xFE, 0x30, 0x00, 0x7F,
+  0xE1, 0x00, 0x5D, 0xFC, 0xBD, 0xFB, 0x30, 0x00, 0x5C, 0xFF, 0xFF, 0xE9, 0x20, 0x06, 0xFE, 0x61,
+  0x03, 0xAF, 0xE3, 0x2F, 0xF4, 0x00, 0x00, 0x0A, 0xFA, 0x6F, 0xE0, 0x00, 0x00, 0x04, 0xFF, 0x8F,
+  0xC0, 0x00, 0x00, 0x04, 0xFF, 0x5F, 0xF1, 0x00, 0x00, 0x06, 0xFE, 0x1E, 0xF9, 0x00, 0x00, 0x2E,
+  0xF9, 0x06, 0xFF, 0xD8, 0x89, 0xEF, 0xE2, 0x00, 0x5D, 0xFF, 0xFF, 0xFA, 0x20, 0x00, 0x00, 0x34,
+  0x44, 0x10, 0x00, 0x00, 0x18, 0xDF, 0xFD, 0x81, 0x00, 0x02, 0xEF, 0xFB, 0xBF, 0xFC, 0x10, 0x0B,
+  0xFC, 0x20, 0x01, 0xCF, 0xA0, 0x3F, 0xF2, 0x00, 0x00, 0x2F, 0xF3, 0x8F, 0xC0, 0x00, 0x00, 0x0B,
+  0xF8, 0x8F, 0xB0, 0x00, 0x00, 0x0B, 0xFB, 0x8F, 0xB0, 0x00, 0x00, 0x0B, 0xFE, 0x5F, 0xF1, 0x00,
+  0x00, 0x0E, 0xFF, 0x1E, 0xF9, 0x00, 0x00, 0x9F, 0xFF, 0x05, 0xFF, 0xC8, 0x8B, 0xFC, 0xFF, 0x00,
+  0x5D, 0xFF, 0xFF, 0x85, 0xFE, 0x00, 0x00, 0x34, 0x41, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0D,
+  0xF7, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE1, 0x02, 0x10, 0x00, 0x04, 0xEF, 0x80, 0x08, 0xFB, 0x88,
+  0xCF, 0xF9, 0x00, 0x06, 0xEF, 0xFF, 0xFD, 0x70, 0x00, 0x00, 0x03, 0x44, 0x30, 0x00, 0x00, 0x4F,
+  0xF0, 0x4F, 0xF0, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3B, 0xB0, 0x4F, 0xF0, 0x4F, 0xF0, 0x04, 0xFF, 0x04, 0xFF, 0x04, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBB, 0x04, 0xFF, 0x07, 0xFD, 0x0A,
+  0xF6, 0x0E, 0xD0, 0x2B, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x8D, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x17, 0xCF, 0xFF, 0x90, 0x00, 0x00, 0x00,
+  0x6A, 0xFF, 0xFD, 0x82, 0x00, 0x00, 0x04, 0x9E, 0xFF, 0xE8, 0x30, 0x00, 0x00, 0x28, 0xDF, 0xFE,
+  0x95, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFC, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xB6,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7D, 0xFF, 0xFA, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+  0xEF, 0xFE, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x9E, 0xFF, 0xE8, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x6A, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x80, 0x48, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x60, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x48, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x80, 0x8F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x94, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6C, 0xFF,
+  0xFC, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xDF, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x8D, 0xFF, 0xE9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x9F, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x49, 0xEF, 0xFE, 0x83, 0x00, 0x00, 0x03, 0x8D,
+  0xFF, 0xF9, 0x50, 0x00, 0x00, 0x27, 0xCF, 0xFF, 0xB6, 0x10, 0x00, 0x00, 0x00, 0x8F, 0xFD, 0x72,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9E, 0xFF,
+  0xD8, 0x10, 0x4F, 0xFE, 0xBD, 0xFF, 0xC0, 0x4B, 0x40, 0x00, 0x6F, 0xF6, 0x10, 0x00, 0x00, 0x0B,
+  0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0xF3, 0x00, 0x00, 0x03, 0xEF, 0x80,
+  0x00, 0x00, 0x3E, 0xF9, 0x00, 0x00, 0x01, 0xEF, 0x90, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00,
+  0x08, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x04, 0x84, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xB8, 0x00, 0x00, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x08, 0xFB,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5A, 0xEF, 0xFF, 0xFD, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xA8, 0x88, 0x8C, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0x06, 0xEE, 0x81, 0x00, 0x00, 0x00, 0x4B, 0xF9, 0x00, 0x00, 0x00, 0x3F,
+  0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x01, 0xDE, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0xF4, 0x00, 0x08, 0xF5, 0x00, 0x03, 0xBF, 0xFD, 0x83, 0xB3, 0x01, 0xEB, 0x00, 0x0D,
+  0xC0, 0x00, 0x3E, 0xFA, 0x8A, 0xFC, 0xF4, 0x00, 0x8F, 0x20, 0x3F, 0x70, 0x00, 0xBF, 0x60, 0x00,
+  0x6F, 0xF4, 0x00, 0x5F, 0x40, 0x6F, 0x40, 0x01, 0xFC, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x4F, 0x80,
+  0x8F, 0x10, 0x04, 0xF8, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x4F, 0x40, 0x8F, 0x20, 0x04, 0xF8, 0x00,
+  0x00, 0x08, 0xF4, 0x00, 0x7F, 0x30, 0x6F, 0x40, 0x01, 0xFC, 0x00, 0x00, 0x0B, 0xF4, 0x01, 0xDD,
+  0x00, 0x3F, 0x70, 0x00, 0xBF, 0x60, 0x00, 0x6F, 0xF4, 0x19, 0xF4, 0x00, 0x0D, 0xD0, 0x00, 0x3E,
+  0xFC, 0x8B, 0xFC, 0xFB, 0xEE, 0x60, 0x00, 0x07, 0xF7, 0x00, 0x03, 0xAF, 0xFC, 0x64, 0xFD, 0x82,
+  0x00, 0x00, 0x00, 0xCE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xE4,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x03, 0xEF, 0x92, 0x00, 0x00, 0x02, 0x8E,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xDB, 0x8A, 0xCF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x28, 0xBF, 0xFF, 0xC8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xB4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xDF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFD, 0xFE, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xF7, 0xBF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0x6F, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x7F, 0xB0, 0x1F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x60, 0x09, 0xF8, 0x00,
+  0x00, 0x00, 0x03, 0xFE, 0x10, 0x05, 0xFD, 0x00, 0x00, 0x00, 0x08, 0xF9, 0x00, 0x00, 0xDF, 0x50,
+  0x00, 0x00, 0x0E, 0xF5, 0x00, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0x6F, 0xE4, 0x44, 0x44, 0x6F, 0xF1,
+  0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x02, 0xFF, 0xBB, 0xBB, 0xBB, 0xBC, 0xFD,
+  0x00, 0x08, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x30, 0x0D, 0xF7, 0x00, 0x00, 0x00, 0x00, 0xAF,
+  0x90, 0x4F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xE0, 0x9F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x1E,
+  0xF6, 0x8B, 0xBB, 0xBB, 0xBA, 0x71, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0x00, 0xBF,
+  0x80, 0x00, 0x25, 0xCF, 0xE1, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x1F, 0xF6, 0x00, 0xBF, 0x80, 0x00,
+  0x00, 0x0B, 0xF8, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0E, 0xF5, 0x00, 0xBF, 0x80, 0x00, 0x01, 0x9F,
+  0xE1, 0x00, 0xBF, 0xDB, 0xBB, 0xDF, 0xFA, 0x30, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00,
+  0xBF, 0x80, 0x00, 0x02, 0x8F, 0xF4, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x08, 0xFD, 0x00, 0xBF, 0x80,
+  0x00, 0x00, 0x04, 0xFF, 0x10, 0xBF, 0x80, 0x00, 0x00, 0x04, 0xFF, 0x30, 0xBF, 0x80, 0x00, 0x00,
+  0x08, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0xBF, 0xDB, 0xBB, 0xDF, 0xFF, 0xC1,
+  0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x49, 0xDF, 0xFF, 0xD9, 0x40, 0x00,
+  0x09, 0xFF, 0xFD, 0xBC, 0xFF, 0xF8, 0x00, 0xAF, 0xF8, 0x20, 0x00, 0x16, 0xDB, 0x07, 0xFF, 0x60,
+  0x00, 0x00, 0x00, 0x16, 0x0E, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x03, 0x01, 0xCF, 0xE4, 0x00, 0x00, 0x02,
+  0xAB, 0x00, 0x2C, 0xFF, 0xD9, 0x88, 0xCF, 0xFA, 0x00, 0x01, 0x8D, 0xFF, 0xFF, 0xFD, 0x71, 0x00,
+  0x00, 0x00, 0x24, 0x44, 0x20, 0x00, 0x8B, 0xBB, 0xBB, 0xB8, 0x72, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x35, 0x8E, 0xFF, 0x60, 0x00, 0xBF, 0x80,
+  0x00, 0x00, 0x01, 0xCF, 0xE2, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x1E, 0xF9, 0x00, 0xBF, 0x80,
+  0x00, 0x00, 0x00, 0x08, 0xFE, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x30, 0xBF, 0x80,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0x40, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xBF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0xBF, 0x80,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x0D, 0xFA, 0x00, 0xBF, 0x80,
+  0x00, 0x00, 0x00, 0x9F, 0xF4, 0x00, 0xBF, 0x80, 0x00, 0x01, 0x6C, 0xFF, 0x80, 0x00, 0xBF, 0xDB,
+  0xBC, 0xFF, 0xFF, 0xE6, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x96, 0x10, 0x00, 0x00, 0x8B, 0xBB,
+  0xBB, 0xBB, 0xBB, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xBF, 0x94, 0x44, 0x44, 0x44, 0x30,
+  0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x80, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x94,
+  0x44, 0x44, 0x44, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
+  0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF,
+  0xF4, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
+  0xBF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xBF,
+  0x80, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xDF, 0xFF, 0xEB, 0x71,
+  0x00, 0x00, 0x08, 0xFF, 0xFE, 0xBB, 0xFF, 0xFE, 0x50, 0x00, 0xAF, 0xF8, 0x20, 0x00, 0x03, 0x9F,
+  0x80, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0x60, 0x0E, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x0B, 0xBB, 0xBB,
+  0xB0, 0xBF, 0xB0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0xF0, 0x6F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x1F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0xF0, 0x09, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0x01, 0xCF, 0xD4, 0x00, 0x00, 0x00, 0x6F,
+  0xF0, 0x00, 0x2C, 0xFF, 0xD9, 0x88, 0xAD, 0xFF, 0xB0, 0x00, 0x00, 0x8D, 0xFF, 0xFF, 0xFF, 0xA4,
+  0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0x40, 0x00, 0x00, 0x8B, 0x60, 0x00, 0x00, 0x00, 0x3B, 0xB0,
+  0xBF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0xBF, 0x80,
+  0x00, 0x00, 0x00, 0x4F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0xBF, 0x80, 0x00, 0x00,
+  0x00, 0x4F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0xBF,
+  0x80, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0xBF, 0x80, 0x00,
+  0x00, 0x00, 0x4F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x00,
+  0x4F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xF0,
+  0x8B, 0x60, 0xBF, 0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF, 0x80,
+  0xBF, 0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF, 0x80, 0xBF, 0x80,
+  0xBF, 0x80, 0x00, 0x00, 0x8B, 0x60, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
+  0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
+  0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
+  0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00,
+  0xBF, 0x80, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0xDF, 0x70, 0x00, 0x03, 0xFF, 0x30, 0x14, 0x7D,
+  0xFD, 0x00, 0x4F, 0xFF, 0xE3, 0x00, 0x28, 0x86, 0x10, 0x00, 0x8B, 0x60, 0x00, 0x00, 0x04, 0xBB,
+  0x60, 0xBF, 0x80, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0xBF, 0x80, 0x00, 0x06, 0xFF, 0x90, 0x00, 0xBF,
+  0x80, 0x00, 0x6F, 0xF7, 0x00, 0x00, 0xBF, 0x80, 0x07, 0xFF, 0x60, 0x00, 0x00, 0xBF, 0x80, 0x9F,
+  0xF6, 0x00, 0x00, 0x00, 0xBF, 0x89, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xBF, 0xEF, 0xE4, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x8C, 0xFE, 0x30, 0x00, 0x00, 0x00,
+  0xBF, 0x81, 0xCF, 0xE3, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x1C, 0xFE, 0x30, 0x00, 0x00, 0xBF, 0x80,
+  0x01, 0xCF, 0xE3, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x1C, 0xFE, 0x30, 0x00, 0xBF, 0x80, 0x00, 0x01,
+  0xCF, 0xE3, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x1C, 0xFE, 0x30, 0xBF, 0x80, 0x00, 0x00, 0x01, 0xCF,
+  0xE3, 0x8B, 0x60, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xB0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x8B, 0xB9, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xB6, 0xBF,
+  0xFF, 0x20, 0x00, 0x00, 0x04, 0xFF, 0xF8, 0xBF, 0xEF, 0x80, 0x00, 0x00, 0x09, 0xFC, 0xF8, 0xBF,
+  0x9F, 0xD0, 0x00, 0x00, 0x1E, 0xE8, 0xF8, 0xBF, 0x8A, 0xF4, 0x00, 0x00, 0x6F, 0x88, 0xF8, 0xBF,
+  0x86, 0xF9, 0x00, 0x00, 0xCF, 0x38, 0xF8, 0xBF, 0x80, 0xEE, 0x10, 0x02, 0xFC, 0x08, 0xF8, 0xBF,
+  0x80, 0x8F, 0x60, 0x08, 0xF6, 0x08, 0xF8, 0xBF, 0x80, 0x3F, 0xB0, 0x0D, 0xF1, 0x08, 0xF8, 0xBF,
+  0x80, 0x0C, 0xF2, 0x5F, 0x90, 0x08, 0xF8, 0xBF, 0x80, 0x07, 0xF8, 0x9F, 0x50, 0x08, 0xF8, 0xBF,
+  0x80, 0x01, 0xFD, 0xFD, 0x00, 0x08, 0xF8, 0xBF, 0x80, 0x00, 0xAF, 0xF8, 0x00, 0x08, 0xF8, 0xBF,
+  0x80, 0x00, 0x4B, 0xB2, 0x00, 0x08, 0xF8, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0xBF,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x8B,
+  0xB7, 0x00, 0x00, 0x00, 0x3B, 0xB0, 0xBF, 0xFE, 0x10, 0x00, 0x00, 0x4F, 0xF0, 0xBF, 0xFF, 0x80,
+  0x00, 0x00, 0x4F, 0xF0, 0xBF, 0xBF, 0xE1, 0x00, 0x00, 0x4F, 0xF0, 0xBF, 0x8B, 0xF8, 0x00, 0x00,
+  0x4F, 0xF0, 0xBF, 0x84, 0xFF, 0x20, 0x00, 0x4F, 0xF0, 0xBF, 0x80, 0x9F, 0x90, 0x00, 0x4F, 0xF0,
+  0xBF, 0x80, 0x2F, 0xF2, 0x00, 0x4F, 0xF0, 0xBF, 0x80, 0x09, 0xFB, 0x00, 0x4F, 0xF0, 0xBF, 0x80,
+  0x02, 0xFF, 0x40, 0x4F, 0xF0, 0xBF, 0x80, 0x00, 0x8F, 0xB0, 0x4F, 0xF0, 0xBF, 0x80, 0x00, 0x1E,
+  0xF4, 0x4F, 0xF0, 0xBF, 0x80, 0x00, 0x08, 0xFC, 0x4F, 0xF0, 0xBF, 0x80, 0x00, 0x01, 0xEF, 0x9F,
+  0xF0, 0xBF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x0D, 0xFF, 0xF0, 0xBF,
+  0x80, 0x00, 0x00, 0x06, 0xFF, 0xF0, 0x00, 0x00, 0x4A, 0xEF, 0xFF, 0xA6, 0x00, 0x00, 0x00, 0x1A,
+  0xFF, 0xFB, 0xBE, 0xFF, 0xB1, 0x00, 0x00, 0xBF, 0xE7, 0x00, 0x00, 0x6E, 0xFC, 0x10, 0x08, 0xFF,
+  0x40, 0x00, 0x00, 0x03, 0xEF, 0x80, 0x0E, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF1, 0x5F, 0xF2,
+  0x00, 0x00, 0x00, 0x00, 0x1F, 0xF6, 0x8F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0xAF, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0xFB, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFB, 0xBF, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xFB, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0x6F, 0xF1,
+  0x00, 0x00, 0x00, 0x00, 0x0E, 0xF8, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF2, 0x09, 0xFE,
+  0x20, 0x00, 0x00, 0x01, 0xDF, 0xB0, 0x01, 0xDF, 0xC3, 0x00, 0x00, 0x2C, 0xFE, 0x20, 0x00, 0x3D,
+  0xFF, 0xB8, 0x8A, 0xFF, 0xE3, 0x00, 0x00, 0x01, 0x8E, 0xFF, 0xFF, 0xE9, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x34, 0x44, 0x00, 0x00, 0x00, 0x8B, 0xBB, 0xBB, 0xB8, 0x30, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x00, 0xBF, 0x80, 0x00, 0x4A, 0xFF, 0x70, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0xD0, 0xBF, 0x80,
+  0x00, 0x00, 0x6F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x4F, 0xF0, 0xBF, 0x80, 0x00, 0x00, 0x8F, 0xF0,
+  0xBF, 0x80, 0x00, 0x03, 0xEF, 0xA0, 0xBF, 0xB8, 0x88, 0xBF, 0xFE, 0x20, 0xBF, 0xFF, 0xFF, 0xFF,
+  0xA2, 0x00, 0xBF, 0x94, 0x44, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xEF,
+  0xFF, 0xA6, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFB, 0xBE, 0xFF, 0xB1, 0x00, 0x00, 0xBF, 0xE7, 0x00,
+  0x00, 0x6E, 0xFC, 0x10, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xEF, 0x80, 0x0E, 0xF9, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xF1, 0x5F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF6, 0x8F, 0xD0, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xF9, 0xAF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFB, 0xBF, 0xB0, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xFB, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFB, 0x8F, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFA, 0x6F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF7, 0x1F, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x6F, 0xF2, 0x09, 0xFE, 0x20, 0x00, 0x00, 0x01, 0xDF, 0xB0, 0x01, 0xDF, 0xC3, 0x00,
+  0x00, 0x2C, 0xFE, 0x20, 0x00, 0x3D, 0xFF, 0xB8, 0x8A, 0xFF, 0xE3, 0x00, 0x00, 0x01, 0x8E, 0xFF,
+  0xFF, 0xFB, 0x10, 0x00, 0x00, 0x00, 0x00, 0x34, 0x4C, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xCF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFC, 0x10, 0x8B, 0xBB, 0xBB, 0xB8,
+  0x40, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x49, 0xFF, 0x80,
+  0x00, 0xBF, 0x80, 0x00, 0x00, 0xAF, 0xD0, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x5F, 0xF0, 0x00, 0xBF,
+  0x80, 0x00, 0x00, 0x5F, 0xF0, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x9F, 0xD0, 0x00, 0xBF, 0x80, 0x00,
+  0x17, 0xFF, 0x80, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xB1,
+  0x00, 0x00, 0xBF, 0x80, 0x00, 0x2C, 0xFC, 0x10, 0x00, 0xBF, 0x80, 0x00, 0x01, 0xDF, 0x80, 0x00,
+  0xBF, 0x80, 0x00, 0x00, 0x6F, 0xE1, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x0D, 0xF8, 0x00, 0xBF, 0x80,
+  0x00, 0x00, 0x06, 0xFE, 0x20, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xDF, 0x90, 0xBF, 0x80, 0x00, 0x00,
+  0x00, 0x6F, 0xF2, 0x00, 0x29, 0xDF, 0xFF, 0xEB, 0x71, 0x00, 0x03, 0xEF, 0xFD, 0xBB, 0xFF, 0xF4,
+  0x00, 0x1E, 0xFB, 0x20, 0x00, 0x05, 0x94, 0x00, 0x6F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFB, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB8, 0x50, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0xFF, 0xFE,
+  0x60, 0x00, 0x00, 0x00, 0x25, 0x8C, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xFF, 0x40, 0x89, 0x30, 0x00, 0x00, 0x1C, 0xFD, 0x00, 0x8F, 0xFD, 0x98, 0x8A,
+  0xEF, 0xF5, 0x00, 0x28, 0xDF, 0xFF, 0xFF, 0xFA, 0x30, 0x00, 0x00, 0x01, 0x44, 0x44, 0x10, 0x00,
+  0x00, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x44,
+  0x44, 0x44, 0xFF, 0x74, 0x44, 0x44, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xBB, 0x30, 0x00, 0x00, 0x00, 0x6B, 0x80, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0x8F, 0xB0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0xFF, 0x40, 0x00, 0x00, 0x00,
+  0x8F, 0xB0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x8F, 0xB0,
+  0xFF, 0x40, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x8F, 0xB0, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0xCF, 0x80, 0x00, 0x00,
+  0x00, 0x9F, 0xA0, 0x9F, 0xC0, 0x00, 0x00, 0x01, 0xEF, 0x70, 0x4F, 0xF8, 0x00, 0x00, 0x09, 0xFE,
+  0x10, 0x08, 0xFF, 0xD8, 0x89, 0xDF, 0xF6, 0x00, 0x00, 0x5D, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00,
+  0x00, 0x24, 0x44, 0x20, 0x00, 0x00, 0x8B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xB5, 0x6F, 0xF1,
+  0x00, 0x00, 0x00, 0x00, 0x5F, 0xF1, 0x0E, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xA0, 0x08, 0xFC,
+  0x00, 0x00, 0x00, 0x01, 0xFF, 0x50, 0x03, 0xFF, 0x20, 0x00, 0x00, 0x07, 0xFD, 0x00, 0x00, 0xCF,
+  0x80, 0x00, 0x00, 0x0C, 0xF8, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x3F, 0xF2, 0x00, 0x00, 0x1F,
+  0xF5, 0x00, 0x00, 0x8F, 0xC0, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x00, 0xEF, 0x60, 0x00, 0x00, 0x05,
+  0xFF, 0x10, 0x05, 0xFE, 0x10, 0x00, 0x00, 0x00, 0xDF, 0x60, 0x0A, 0xF9, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xC0, 0x1F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00,
+  0x0B, 0xF8, 0xCF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xEF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF6, 0x00, 0x00, 0x00, 0x2B, 0xB2,
+  0x00, 0x00, 0x00, 0xBB, 0x80, 0x00, 0x00, 0x05, 0xBA, 0x0E, 0xF6, 0x00, 0x00, 0x04, 0xFF, 0xE0,
+  0x00, 0x00, 0x09, 0xFA, 0x0A, 0xF9, 0x00, 0x00, 0x07, 0xFD, 0xF3, 0x00, 0x00, 0x0D, 0xF7, 0x07,
+  0xFD, 0x00, 0x00, 0x0A, 0xF8, 0xF7, 0x00, 0x00, 0x2F, 0xF3, 0x03, 0xFF, 0x20, 0x00, 0x0E, 0xD2,
+  0xFA, 0x00, 0x00, 0x6F, 0xE0, 0x00, 0xEF, 0x60, 0x00, 0x3F, 0x90, 0xDE, 0x00, 0x00, 0x9F, 0xA0,
+  0x00, 0xAF, 0x90, 0x00, 0x7F, 0x60, 0x9F, 0x30, 0x00, 0xDF, 0x70, 0x00, 0x7F, 0xD0, 0x00, 0xAF,
+  0x20, 0x6F, 0x70, 0x02, 0xFF, 0x30, 0x00, 0x3F, 0xF2, 0x00, 0xED, 0x00, 0x2F, 0xA0, 0x06, 0xFE,
+  0x00, 0x00, 0x0E, 0xF6, 0x03, 0xFA, 0x00, 0x0D, 0xE0, 0x09, 0xFA, 0x00, 0x00, 0x0A, 0xF9, 0x07,
+  0xF7, 0x00, 0x09, 0xF3, 0x0D, 0xF7, 0x00, 0x00, 0x07, 0xFD, 0x0A, 0xF3, 0x00, 0x07, 0xF7, 0x2F,
+  0xF3, 0x00, 0x00, 0x03, 0xFF, 0x2E, 0xE0, 0x00, 0x03, 0xFA, 0x6F, 0xE0, 0x00, 0x00, 0x00, 0xEF,
+  0x8F, 0xA0, 0x00, 0x00, 0xEE, 0x9F, 0xA0, 0x00, 0x00, 0x00, 0xAF, 0xEF, 0x70, 0x00, 0x00, 0xAF,
+  0xEF, 0x60, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x30, 0x00, 0x00, 0x7F, 0xFF, 0x20, 0x00, 0x00, 0x00,
+  0x3F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0x03, 0xBB, 0x20, 0x00, 0x00, 0x01, 0xAB,
+  0x50, 0x00, 0xAF, 0xB0, 0x00, 0x00, 0x08, 0xFC, 0x00, 0x00, 0x1E, 0xF7, 0x00, 0x00, 0x4F, 0xF3,
+  0x00, 0x00, 0x05, 0xFE, 0x20, 0x01, 0xDF, 0x80, 0x00, 0x00, 0x00, 0xAF, 0xB0, 0x09, 0xFC, 0x00,
+  0x00, 0x00, 0x00, 0x1E, 0xF7, 0x5F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFE, 0xEF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xAF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xF8, 0xAF, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0xAF, 0xC0, 0x1E, 0xF7, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x30, 0x06, 0xFE, 0x20,
+  0x00, 0x00, 0x1E, 0xF8, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0xAF, 0xC0, 0x00, 0x00, 0x2E, 0xF7,
+  0x00, 0x05, 0xFF, 0x30, 0x00, 0x00, 0x07, 0xFE, 0x20, 0x1E, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF,
+  0xB0, 0x8B, 0x80, 0x00, 0x00, 0x00, 0x07, 0xB9, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x08,
+  0xFD, 0x10, 0x00, 0x00, 0xCF, 0x80, 0x00, 0xCF, 0x80, 0x00, 0x08, 0xFD, 0x10, 0x00, 0x3F, 0xF4,
+  0x00, 0x3F, 0xF4, 0x00, 0x00, 0x08, 0xFD, 0x10, 0xCF, 0x80, 0x00, 0x00, 0x00, 0xCF, 0x88, 0xFC,
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x8B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xB6, 0xBF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x34, 0x44, 0x44, 0x44, 0x44, 0xCF, 0xE2, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xE1, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xEF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD1, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF6, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x88,
+  0x88, 0x60, 0xFF, 0xFF, 0xB0, 0xFF, 0x44, 0x30, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x88, 0x60, 0xFF, 0xFF, 0xB0, 0xAB, 0x00,
+  0x00, 0x00, 0x9F, 0x50, 0x00, 0x00, 0x5F, 0x90, 0x00, 0x00, 0x0E, 0xE0, 0x00, 0x00, 0x0A, 0xF3,
+  0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x20, 0x00, 0x00, 0x7F,
+  0x70, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x0C, 0xF1, 0x00, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x03,
+  0xFA, 0x00, 0x00, 0x00, 0xDF, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x00, 0x00, 0x5F, 0x90, 0x00, 0x00,
+  0x0E, 0xE0, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x01, 0x43, 0x68, 0x88,
+  0x80, 0xBF, 0xFF, 0xF0, 0x34, 0x4F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00,
+  0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F,
+  0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x68, 0x8F, 0xF0, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x8B, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x9F,
+  0xE4, 0xCF, 0xC1, 0x00, 0x00, 0x00, 0x09, 0xFD, 0x30, 0x1A, 0xFC, 0x10, 0x00, 0x00, 0x9F, 0xC1,
+  0x00, 0x00, 0x9F, 0xC1, 0x00, 0x09, 0xFC, 0x10, 0x00, 0x00, 0x08, 0xFC, 0x10, 0x38, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x58, 0x50, 0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x30, 0x4F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xB0, 0x28, 0x88, 0x88, 0x88, 0x88, 0x88, 0x60, 0x78, 0x20, 0x00, 0x6F, 0xC0, 0x00,
+  0x06, 0xF8, 0x00, 0x00, 0x9F, 0x50, 0x00, 0x08, 0xA1, 0x02, 0x6A, 0xBD, 0xBA, 0x40, 0x00, 0x0B,
+  0xFF, 0xFD, 0xFF, 0xF9, 0x00, 0x08, 0x61, 0x00, 0x06, 0xEF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x6F,
+  0xA0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x49, 0xCF, 0xFF, 0xFF, 0xF0, 0x09, 0xFF, 0xDB,
+  0xBB, 0xBF, 0xF0, 0x4F, 0xE4, 0x00, 0x00, 0x0F, 0xF0, 0x8F, 0x80, 0x00, 0x00, 0x4F, 0xF0, 0x8F,
+  0x80, 0x00, 0x00, 0x8F, 0xF0, 0x7F, 0xC0, 0x00, 0x03, 0xFF, 0xF0, 0x2E, 0xFC, 0x88, 0x9F, 0x9F,
+  0xF0, 0x03, 0xDF, 0xFF, 0xF8, 0x0F, 0xF0, 0x00, 0x04, 0x44, 0x10, 0x00, 0x00, 0x88, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x42, 0x9B, 0xCA, 0x40,
+  0x00, 0xFF, 0x7E, 0xFC, 0xFF, 0xF8, 0x00, 0xFF, 0xFA, 0x10, 0x07, 0xFF, 0x40, 0xFF, 0xD0, 0x00,
+  0x00, 0x8F, 0xC0, 0xFF, 0x70, 0x00, 0x00, 0x2F, 0xF2, 0xFF, 0x40, 0x00, 0x00, 0x0D, 0xF4, 0xFF,
+  0x40, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x50, 0x00, 0x00, 0x0F,
+  0xF3, 0xFF, 0x90, 0x00, 0x00, 0x5F, 0xE0, 0xFF, 0xF5, 0x00, 0x01, 0xDF, 0x80, 0xFF, 0xCF, 0x98,
+  0x8D, 0xFC, 0x10, 0xFF, 0x48, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x14, 0x42, 0x00, 0x00, 0x00,
+  0x04, 0x9B, 0xDB, 0xA6, 0x10, 0x00, 0x9F, 0xFF, 0xDF, 0xFF, 0x40, 0x08, 0xFE, 0x70, 0x00, 0x28,
+  0x30, 0x2F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFC, 0x10, 0x00, 0x01,
+  0x10, 0x03, 0xEF, 0xD8, 0x88, 0xAF, 0x40, 0x00, 0x2A, 0xFF, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0x14,
+  0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x84, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xF8, 0x00, 0x18, 0xBD, 0xB8, 0x18, 0xF8, 0x01, 0xCF, 0xFD, 0xEF, 0xC8, 0xF8, 0x0A, 0xFC, 0x20,
+  0x04, 0xEE, 0xF8, 0x3F, 0xF2, 0x00, 0x00, 0x4F, 0xF8, 0x8F, 0xA0, 0x00, 0x00, 0x0D, 0xF8, 0xAF,
+  0x80, 0x00, 0x00, 0x09, 0xF8, 0xBF, 0x80, 0x00, 0x00, 0x08, 0xF8, 0xBF, 0x80, 0x00, 0x00, 0x08,
+  0xF8, 0x8F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x6F, 0xD0, 0x00, 0x00, 0x1F, 0xF8, 0x0D, 0xF8, 0x00,
+  0x00, 0xAF, 0xF8, 0x05, 0xFF, 0xB8, 0x8B, 0xFA, 0xF8, 0x00, 0x5E, 0xFF, 0xFD, 0x58, 0xF8, 0x00,
+  0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x04, 0x9B, 0xCB, 0x82, 0x00, 0x00, 0x9F, 0xFF, 0xEF, 0xFE,
+  0x30, 0x08, 0xFE, 0x50, 0x01, 0x8F, 0xE1, 0x2F, 0xF3, 0x00, 0x00, 0x0A, 0xF7, 0x7F, 0xA0, 0x00,
+  0x00, 0x04, 0xFB, 0xAF, 0xB8, 0x88, 0x88, 0x89, 0xFE, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF,
+  0x94, 0x44, 0x44, 0x44, 0x44, 0x8F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE1, 0x00, 0x00, 0x00,
+  0x00, 0x0C, 0xFC, 0x10, 0x00, 0x00, 0x24, 0x03, 0xEF, 0xE8, 0x88, 0x8C, 0xF8, 0x00, 0x19, 0xFF,
+  0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x27, 0x88, 0x40, 0x00, 0x08,
+  0xFF, 0xFF, 0x80, 0x00, 0x2F, 0xF6, 0x44, 0x20, 0x00, 0x7F, 0xA0, 0x00, 0x00, 0x00, 0x8F, 0x80,
+  0x00, 0x00, 0x48, 0xBF, 0xB8, 0x88, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x8F, 0x80, 0x00,
+  0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00,
+  0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00,
+  0x8F, 0x80, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x8F,
+  0x80, 0x00, 0x00, 0x00, 0x18, 0xBD, 0xB7, 0x14, 0x84, 0x01, 0xCF, 0xFD, 0xEF, 0xC8, 0xF8, 0x0B,
+  0xFC, 0x20, 0x04, 0xEE, 0xF8, 0x3F, 0xF2, 0x00, 0x00, 0x4F, 0xF8, 0x8F, 0x90, 0x00, 0x00, 0x0C,
+  0xF8, 0xBF, 0x80, 0x00, 0x00, 0x09, 0xF8, 0xBF, 0x80, 0x00, 0x00, 0x08, 0xF8, 0xBF, 0x80, 0x00,
+  0x00, 0x08, 0xF8, 0x8F, 0x90, 0x00, 0x00, 0x0C, 0xF8, 0x4F, 0xE1, 0x00, 0x00, 0x2F, 0xF8, 0x0C,
+  0xFC, 0x10, 0x02, 0xCF, 0xF8, 0x03, 0xEF, 0xFB, 0xBF, 0xC8, 0xF8, 0x00, 0x29, 0xEF, 0xE9, 0x18,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF1, 0x03, 0x83, 0x00,
+  0x06, 0xEF, 0x80, 0x04, 0xFF, 0xFF, 0xFF, 0xFB, 0x10, 0x01, 0x68, 0xBB, 0xB9, 0x50, 0x00, 0x88,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x42, 0x9B,
+  0xDB, 0x60, 0x00, 0xFF, 0x7E, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xFA, 0x20, 0x07, 0xFF, 0x20, 0xFF,
+  0xB0, 0x00, 0x00, 0xCF, 0x70, 0xFF, 0x50, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x8F,
+  0x80, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x40, 0x00,
+  0x00, 0x8F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0x80, 0xFF,
+  0x40, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0x80, 0x68, 0x20, 0xBF, 0x40, 0xBF,
+  0x40, 0x34, 0x10, 0x00, 0x00, 0x68, 0x20, 0xBF, 0x40, 0xBF, 0x40, 0xBF, 0x40, 0xBF, 0x40, 0xBF,
+  0x40, 0xBF, 0x40, 0xBF, 0x40, 0xBF, 0x40, 0xBF, 0x40, 0xBF, 0x40, 0xBF, 0x40, 0xBF, 0x40, 0x00,
+  0x06, 0x82, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x03, 0x41, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0x82, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF4,
+  0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF4, 0x00,
+  0x0B, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x0B, 0xF4, 0x00, 0x0E, 0xF3, 0x00, 0x6F, 0xE0, 0x8F, 0xFF,
+  0x80, 0x6B, 0xA5, 0x00, 0x88, 0x20, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x40, 0x00, 0x01, 0x88, 0x50, 0xFF, 0x40, 0x00, 0x1C, 0xFA, 0x10, 0xFF, 0x40,
+  0x03, 0xDF, 0x90, 0x00, 0xFF, 0x40, 0x3E, 0xF7, 0x00, 0x00, 0xFF, 0x46, 0xFF, 0x60, 0x00, 0x00,
+  0xFF, 0x9F, 0xE4, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xFF, 0x7E, 0xF9, 0x00,
+  0x00, 0x00, 0xFF, 0x43, 0xEF, 0x90, 0x00, 0x00, 0xFF, 0x40, 0x3E, 0xF9, 0x00, 0x00, 0xFF, 0x40,
+  0x03, 0xEF, 0x90, 0x00, 0xFF, 0x40, 0x00, 0x3C, 0xF9, 0x00, 0xFF, 0x40, 0x00, 0x01, 0xCF, 0x90,
+  0x68, 0x20, 0xBF, 0x40, 0xBF, 0x40, 0xBF, 0x40, 0xBF, 0x40, 0xBF, 0x40, 0xBF, 0x40, 0xBF, 0x40,
+  0xBF, 0x40, 0xBF, 0x40, 0xBF, 0x40, 0xBF, 0x40, 0xBF, 0x40, 0xBF, 0x40, 0xBF, 0x40, 0xBF, 0x40,
+  0xBF, 0x40, 0xBF, 0x40, 0x88, 0x22, 0x9B, 0xDA, 0x30, 0x01, 0x8B, 0xCA, 0x50, 0x00, 0xFF, 0x7E,
+  0xFF, 0xFF, 0xF4, 0x3E, 0xFF, 0xFF, 0xF6, 0x00, 0xFF, 0xF9, 0x10, 0x19, 0xFD, 0xCA, 0x20, 0x09,
+  0xFE, 0x00, 0xFF, 0xB0, 0x00, 0x01, 0xFF, 0xD1, 0x00, 0x00, 0xDF, 0x40, 0xFF, 0x50, 0x00, 0x00,
+  0xCF, 0x80, 0x00, 0x00, 0xBF, 0x70, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x80,
+  0xFF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x40,
+  0x00, 0x00, 0xBF, 0x80, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0x40,
+  0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
+  0xBF, 0x80, 0xFF, 0x40, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xBF, 0x80, 0xFF, 0x40, 0x00, 0x00,
+  0xBF, 0x40, 0x00, 0x00, 0xBF, 0x80, 0x88, 0x22, 0x9B, 0xDB, 0x60, 0x00, 0xFF, 0x7E, 0xFF, 0xFF,
+  0xF8, 0x00, 0xFF, 0xFA, 0x20, 0x07, 0xFF, 0x20, 0xFF, 0xB0, 0x00, 0x00, 0xCF, 0x70, 0xFF, 0x50,
+  0x00, 0x00, 0x8F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0x80,
+  0xFF, 0x40, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x40, 0x00, 0x00,
+  0x8F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x40,
+  0x00, 0x00, 0x8F, 0x80, 0x00, 0x06, 0xAB, 0xCB, 0x60, 0x00, 0x01, 0xCF, 0xFF, 0xEF, 0xFC, 0x10,
+  0x0A, 0xFE, 0x40, 0x04, 0xCF, 0xB0, 0x3F, 0xF3, 0x00, 0x00, 0x3F, 0xF4, 0x8F, 0xC0, 0x00, 0x00,
+  0x0A, 0xF8, 0xAF, 0x80, 0x00, 0x00, 0x08, 0xFB, 0xBF, 0x80, 0x00, 0x00, 0x08, 0xFB, 0xBF, 0x80,
+  0x00, 0x00, 0x08, 0xFB, 0x8F, 0x90, 0x00, 0x00, 0x08, 0xFA, 0x6F, 0xE1, 0x00, 0x00, 0x0D, 0xF6,
+  0x0D, 0xF9, 0x00, 0x00, 0x9F, 0xE1, 0x04, 0xFF, 0xB8, 0x8B, 0xFF, 0x50, 0x00, 0x3D, 0xFF, 0xFF,
+  0xD4, 0x00, 0x00, 0x00, 0x34, 0x43, 0x00, 0x00, 0x88, 0x22, 0x9B, 0xCA, 0x40, 0x00, 0xFF, 0x7E,
+  0xFC, 0xFF, 0xF8, 0x00, 0xFF, 0xFA, 0x10, 0x07, 0xFF, 0x40, 0xFF, 0xD0, 0x00, 0x00, 0x8F, 0xC0,
+  0xFF, 0x70, 0x00, 0x00, 0x2F, 0xF2, 0xFF, 0x40, 0x00, 0x00, 0x0D, 0xF4, 0xFF, 0x40, 0x00, 0x00,
+  0x0B, 0xF4, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x50, 0x00, 0x00, 0x0F, 0xF3, 0xFF, 0x90,
+  0x00, 0x00, 0x5F, 0xE0, 0xFF, 0xF5, 0x00, 0x01, 0xDF, 0x80, 0xFF, 0xCF, 0x98, 0x8D, 0xFC, 0x10,
+  0xFF, 0x48, 0xFF, 0xFF, 0xB1, 0x00, 0xFF, 0x40, 0x14, 0x42, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xBD, 0xB8, 0x14, 0x84, 0x01, 0xCF, 0xFD, 0xEF, 0xC8, 0xF8,
+  0x0A, 0xFC, 0x20, 0x04, 0xEE, 0xF8, 0x3F, 0xF2, 0x00, 0x00, 0x4F, 0xF8, 0x8F, 0xA0, 0x00, 0x00,
+  0x0D, 0xF8, 0xAF, 0x80, 0x00, 0x00, 0x09, 0xF8, 0xBF, 0x80, 0x00, 0x00, 0x08, 0xF8, 0xBF, 0x80,
+  0x00, 0x00, 0x08, 0xF8, 0x8F, 0x80, 0x00, 0x00, 0x0B, 0xF8, 0x6F, 0xD0, 0x00, 0x00, 0x1F, 0xF8,
+  0x0D, 0xF8, 0x00, 0x00, 0xAF, 0xF8, 0x05, 0xFF, 0xB8, 0x8B, 0xFA, 0xF8, 0x00, 0x5E, 0xFF, 0xFD,
+  0x58, 0xF8, 0x00, 0x00, 0x44, 0x40, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0xB6,
+  0x88, 0x22, 0x9B, 0xC6, 0xFF, 0x7E, 0xFF, 0xF8, 0xFF, 0xFA, 0x20, 0x02, 0xFF, 0xD0, 0x00, 0x00,
+  0xFF, 0x60, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
+  0xFF, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x40, 0x00, 0x00,
+  0xFF, 0x40, 0x00, 0x00, 0x00, 0x6B, 0xBD, 0xBA, 0x71, 0x1C, 0xFF, 0xEB, 0xFF, 0xF4, 0x7F, 0xC2,
+  0x00, 0x02, 0x73, 0xAF, 0x50, 0x00, 0x00, 0x00, 0x9F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xFC, 0x84,
+  0x00, 0x00, 0x06, 0xEF, 0xFF, 0xFA, 0x30, 0x00, 0x04, 0x8B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x1A,
+  0xFA, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x51, 0x00, 0x00, 0x08, 0xFA, 0xBF, 0xA8, 0x88, 0xAF, 0xF4,
+  0x8D, 0xFF, 0xFF, 0xFD, 0x40, 0x00, 0x24, 0x44, 0x20, 0x00, 0x00, 0x34, 0x10, 0x00, 0x00, 0x00,
+  0xBF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x48, 0xDF,
+  0x98, 0x88, 0x40, 0x8F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40,
+  0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00,
+  0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00,
+  0x00, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x6F, 0xFC, 0xBB, 0x60, 0x00, 0x06, 0xCF, 0xFF, 0x80, 0x88,
+  0x00, 0x00, 0x00, 0x48, 0x40, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x8F,
+  0x80, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x00, 0x00,
+  0x00, 0x8F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0x80, 0xFF,
+  0x00, 0x00, 0x00, 0xAF, 0x80, 0xEF, 0x30, 0x00, 0x00, 0xEF, 0x80, 0xAF, 0xA0, 0x00, 0x09, 0xFF,
+  0x80, 0x4F, 0xFB, 0x88, 0xDE, 0xAF, 0x80, 0x06, 0xEF, 0xFF, 0xD3, 0x8F, 0x80, 0x00, 0x14, 0x43,
+  0x00, 0x00, 0x00, 0x28, 0x80, 0x00, 0x00, 0x00, 0x38, 0x60, 0x0D, 0xF5, 0x00, 0x00, 0x00, 0x9F,
+  0x80, 0x08, 0xF9, 0x00, 0x00, 0x01, 0xFF, 0x20, 0x02, 0xFF, 0x10, 0x00, 0x06, 0xFC, 0x00, 0x00,
+  0xCF, 0x60, 0x00, 0x0C, 0xF6, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x2F, 0xF1, 0x00, 0x00, 0x1F, 0xF2,
+  0x00, 0x8F, 0x90, 0x00, 0x00, 0x09, 0xF8, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x05, 0xFD, 0x05, 0xFD,
+  0x00, 0x00, 0x00, 0x00, 0xDF, 0x49, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xAF, 0xF2, 0x00, 0x00,
+  0x00, 0x00, 0x2F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x60, 0x00, 0x00, 0x88, 0x10,
+  0x00, 0x07, 0x86, 0x00, 0x00, 0x28, 0x60, 0xBF, 0x50, 0x00, 0x2F, 0xFD, 0x00, 0x00, 0x8F, 0x80,
+  0x8F, 0x80, 0x00, 0x6F, 0xEF, 0x30, 0x00, 0xBF, 0x50, 0x4F, 0xD0, 0x00, 0x9F, 0x8F, 0x70, 0x01,
+  0xFF, 0x10, 0x0E, 0xF2, 0x00, 0xDE, 0x2F, 0xA0, 0x05, 0xFC, 0x00, 0x0A, 0xF6, 0x02, 0xFA, 0x0D,
+  0xE0, 0x08, 0xF8, 0x00, 0x07, 0xF9, 0x06, 0xF6, 0x08, 0xF3, 0x0C, 0xF4, 0x00, 0x03, 0xFD, 0x0A,
+  0xF2, 0x05, 0xF8, 0x1F, 0xF0, 0x00, 0x00, 0xEF, 0x3E, 0xD0, 0x01, 0xFB, 0x5F, 0xB0, 0x00, 0x00,
+  0xAF, 0x9F, 0x90, 0x00, 0xCF, 0x9F, 0x70, 0x00, 0x00, 0x6F, 0xEF, 0x60, 0x00, 0x8F, 0xFF, 0x30,
+  0x00, 0x00, 0x2F, 0xFF, 0x10, 0x00, 0x4F, 0xFE, 0x00, 0x00, 0x00, 0x0D, 0xFC, 0x00, 0x00, 0x0F,
+  0xFA, 0x00, 0x00, 0x05, 0x86, 0x00, 0x00, 0x01, 0x88, 0x30, 0x03, 0xEF, 0x50, 0x00, 0x09, 0xFC,
+  0x00, 0x00, 0x6F, 0xE2, 0x00, 0x6F, 0xE2, 0x00, 0x00, 0x09, 0xFC, 0x03, 0xEF, 0x50, 0x00, 0x00,
+  0x01, 0xCF, 0x9C, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x8D, 0xF8,
+  0x00, 0x00, 0x00, 0x0B, 0xFA, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0xD1, 0x00, 0x7F, 0xE1, 0x00,
+  0x04, 0xFF, 0x30, 0x00, 0x0A, 0xFB, 0x00, 0x1D, 0xF8, 0x00, 0x00, 0x01, 0xDF, 0x80, 0x28, 0x80,
+  0x00, 0x00, 0x00, 0x38, 0x60, 0x0D, 0xF5, 0x00, 0x00, 0x00, 0xAF, 0x80, 0x07, 0xFA, 0x00, 0x00,
+  0x02, 0xFF, 0x20, 0x01, 0xFF, 0x20, 0x00, 0x08, 0xFA, 0x00, 0x00, 0x9F, 0x80, 0x00, 0x0D, 0xF5,
+  0x00, 0x00, 0x4F, 0xD0, 0x00, 0x5F, 0xD0, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0xAF, 0x80, 0x00, 0x00,
+  0x06, 0xFA, 0x02, 0xFF, 0x20, 0x00, 0x00, 0x01, 0xEF, 0x28, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x9F,
+  0x8D, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0xFF, 0x40, 0x00, 0x00, 0x00, 0x03, 0xBB, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x68, 0x88, 0x88, 0x88,
+  0x88, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x09, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE3,
+  0x00, 0x00, 0x06, 0xFF, 0x30, 0x00, 0x00, 0x3E, 0xF6, 0x00, 0x00, 0x02, 0xEF, 0x70, 0x00, 0x00,
+  0x1C, 0xF9, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x09, 0xFC, 0x10, 0x00, 0x00, 0x8F, 0xE2,
+  0x00, 0x00, 0x00, 0xFF, 0xDB, 0xBB, 0xBB, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03,
+  0x78, 0x60, 0x00, 0x00, 0xBF, 0xFF, 0xB0, 0x00, 0x06, 0xFE, 0x54, 0x30, 0x00, 0x08, 0xF8, 0x00,
+  0x00, 0x00, 0x0A, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00,
+  0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0x00, 0x00, 0x00, 0x3F, 0xF3, 0x00, 0x00, 0xBB,
+  0xFF, 0x80, 0x00, 0x00, 0xFF, 0xFC, 0x40, 0x00, 0x00, 0x00, 0x7F, 0xE2, 0x00, 0x00, 0x00, 0x0C,
+  0xF6, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF8,
+  0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFD, 0x10,
+  0x00, 0x00, 0x01, 0xEF, 0xFD, 0x80, 0x00, 0x00, 0x27, 0xAB, 0x80, 0x86, 0xFB, 0xFB, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+  0xFB, 0xFB, 0x86, 0x88, 0x52, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x44, 0x8F, 0xE0,
+  0x00, 0x00, 0x00, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00,
+  0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF5, 0x00, 0x00,
+  0x00, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xDB, 0x80, 0x00, 0x00, 0x8D, 0xFF, 0xB0, 0x00,
+  0x07, 0xFD, 0x20, 0x00, 0x00, 0x0B, 0xF7, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0B,
+  0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x00, 0x0D, 0xF4,
+  0x00, 0x00, 0x00, 0x4F, 0xF1, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0xBB, 0x96, 0x00, 0x00,
+  0x00, 0x01, 0x7B, 0xFC, 0x95, 0x00, 0x00, 0x04, 0x90, 0x4E, 0xFF, 0xFF, 0xFF, 0xD8, 0x88, 0xAF,
+  0xB0, 0x8D, 0x61, 0x01, 0x6B, 0xFF, 0xFF, 0xFB, 0x20, 0x41, 0x00, 0x00, 0x00, 0x26, 0x87, 0x20,
+  0x00,
+};
+
+const AtlasGlyph Atlas_Header_Glyphs[95] PROGMEM = {
+  {     0,  0,  0,   0,   0,  7 },  // ' '
+  {     0,  3, 17,   3, -17,  9 },  // '!'
+  {    34,  7,  7,   2, -17, 11 },  // '"'
+  {    62, 17, 17,   1, -17, 19 },  // '#'
+  {   215, 11, 22,   2, -18, 15 },  // '$'
+  {   347, 20, 18,   1, -17, 22 },  // '%'
+  {   527, 16, 18,   1, -17, 18 },  // '&'
+  {   671,  2,  7,   2, -17,  6 },  // '''
+  {   678,  5, 21,   2, -18,  9 },  // '('
+  {   741,  5, 21,   2, -18,  9 },  // ')'
+  {   804, 11, 11,   0, -17, 12 },  // '*'
+  {   870, 15, 15,   2, -15, 19 },  // '+'
+  {   990,  4,  6,   1,  -3,  7 },  // ','
+  {  1002,  7,  3,   1,  -8,  8 },  // '-'
+  {  1014,  3,  3,   2,  -3,  7 },  // '.'
+  {  1020,  8, 20,   0, -17,  8 },  // '/'
+  {  1100, 12, 18,   1, -17, 15 },  // '0'
+  {  1208, 11, 17,   2, -17, 15 },  // '1'
+  {  1310, 12, 17,   1, -17, 15 },  // '2'
+  {  1412, 12, 18,   1, -17, 15 },  // '3'
+  {  1520, 13, 17,   1, -17, 15 },  // '4'
+  {  1639, 12, 18,   1, -17, 15 },  // '5'
+  {  1747, 13, 18,   1, -17, 15 },  // '6'
+  {  1873, 11, 17,   2, -17, 15 },  // '7'
+  {  1975, 12, 18,   1, -17, 15 },  // '8'
+  {  2083, 12, 18,   1, -17, 15 },  // '9'
+  {  2191,  3, 12,   2, -12,  8 },  // ':'
+  {  2215,  4, 15,   1, -12,  8 },  // ';'
+  {  2245, 15, 13,   2, -14, 19 },  // '<'
+  {  2349, 15,  7,   2, -11, 19 },  // '='
+  {  2405, 15, 13,   2, -14, 19 },  // '>'
+  {  2509, 10, 17,   1, -17, 12 },  // '?'
+  {  2594, 21, 21,   1, -17, 23 },  // '@'
+  {  2825, 16, 17,   0, -17, 16 },  // 'A'
+  {  2961, 13, 17,   2, -17, 16 },  // 'B'
+  {  3080, 14, 18,   1, -17, 16 },  // 'C'
+  {  3206, 15, 17,   2, -17, 18 },  // 'D'
+  {  3342, 11, 17,   2, -17, 15 },  // 'E'
+  {  3444, 10, 17,   2, -17, 13 },  // 'F'
+  {  3529, 15, 18,   1, -17, 18 },  // 'G'
+  {  3673, 13, 17,   2, -17, 17 },  // 'H'
+  {  3792,  3, 17,   2, -17,  7 },  // 'I'
+  {  3826,  7, 22,  -2, -17,  7 },  // 'J'
+  {  3914, 14, 17,   2, -17, 15 },  // 'K'
+  {  4033, 11, 17,   2, -17, 13 },  // 'L'
+  {  4135, 16, 17,   2, -17, 20 },  // 'M'
+  {  4271, 13, 17,   2, -17, 17 },  // 'N'
+  {  4390, 16, 18,   1, -17, 18 },  // 'O'
+  {  4534, 11, 17,   2, -17, 14 },  // 'P'
+  {  4636, 16, 20,   1, -17, 18 },  // 'Q'
+  {  4796, 14, 17,   2, -17, 16 },  // 'R'
+  {  4915, 13, 18,   1, -17, 15 },  // 'S'
+  {  5041, 14, 17,   0, -17, 14 },  // 'T'
+  {  5160, 13, 18,   2, -17, 17 },  // 'U'
+  {  5286, 16, 17,   0, -17, 16 },  // 'V'
+  {  5422, 22, 17,   0, -17, 23 },  // 'W'
+  {  5609, 15, 17,   0, -17, 16 },  // 'X'
+  {  5745, 14, 17,   0, -17, 14 },  // 'Y'
+  {  5864, 14, 17,   1, -17, 16 },  // 'Z'
+  {  5983,  5, 21,   2, -18,  9 },  // '['
+  {  6046,  8, 20,   0, -17,  8 },  // '\\'
+  {  6126,  5, 21,   2, -18,  9 },  // ']'
+  {  6189, 15,  7,   2, -17, 19 },  // '^'
+  {  6245, 13,  3,  -1,   3, 12 },  // '_'
+  {  6266,  6,  5,   2, -19, 12 },  // '`'
+  {  6281, 11, 14,   1, -13, 14 },  // 'a'
+  {  6365, 12, 19,   2, -18, 15 },  // 'b'
+  {  6479, 11, 14,   1, -13, 13 },  // 'c'
+  {  6563, 12, 19,   1, -18, 15 },  // 'd'
+  {  6677, 12, 14,   1, -13, 14 },  // 'e'
+  {  6761,  9, 18,   0, -18,  8 },  // 'f'
+  {  6851, 12, 18,   1, -13, 15 },  // 'g'
+  {  6959, 11, 18,   2, -18, 15 },  // 'h'
+  {  7067,  3, 18,   2, -18,  6 },  // 'i'
+  {  7103,  6, 23,  -1, -18,  6 },  // 'j'
+  {  7172, 11, 18,   2, -18, 13 },  // 'k'
+  {  7280,  3, 18,   2, -18,  6 },  // 'l'
+  {  7316, 19, 13,   2, -13, 22 },  // 'm'
+  {  7446, 11, 13,   2, -13, 15 },  // 'n'
+  {  7524, 12, 14,   1, -13, 14 },  // 'o'
+  {  7608, 12, 18,   2, -13, 15 },  // 'p'
+  {  7716, 12, 18,   1, -13, 15 },  // 'q'
+  {  7824,  8, 13,   2, -13,  9 },  // 'r'
+  {  7876, 10, 14,   1, -13, 12 },  // 's'
+  {  7946,  9, 17,   0, -17,  9 },  // 't'
+  {  8031, 11, 14,   2, -13, 15 },  // 'u'
+  {  8115, 13, 13,   0, -13, 14 },  // 'v'
+  {  8206, 17, 13,   1, -13, 19 },  // 'w'
+  {  8323, 13, 13,   0, -13, 14 },  // 'x'
+  {  8414, 13, 18,   0, -13, 14 },  // 'y'
+  {  8540, 10, 13,   1, -13, 12 },  // 'z'
+  {  8605,  9, 22,   3, -18, 15 },  // '{'
+  {  8715,  2, 24,   3, -18,  8 },  // '|'
+  {  8739,  9, 22,   3, -18, 15 },  // '}'
+  {  8849, 15,  4,   2,  -9, 19 },  // '~'
+};
+
+const AtlasFont Atlas_Header PROGMEM = {Atlas_Header_Bitmap, Atlas_Header_Glyphs, 0x20, 0x7E, 27, 17, 6};
+
+// Atlas_Table, 29px em from DejaVuSansMono.ttf, replaces FM9 at text size 2
+const uint8_t Atlas_Table_Bitmap[13076] PROGMEM = {
+  0x34, 0x41, 0xBF, 0xF4, 0xBF, 0xF4, 0xBF, 0xF4, 0xBF, 0xF4, 0xBF, 0xF4, 0xBF, 0xF4, 0xBF, 0xF4,
+  0xBF, 0xF4, 0xBF, 0xF4, 0xBF, 0xF4, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x24, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x68, 0x82, 0xBF, 0xF4, 0xBF, 0xF4, 0xBF, 0xF4, 0x14, 0x41, 0x00, 0x34,
+  0x30, 0x4F, 0xF4, 0x00, 0xBF, 0xB0, 0x4F, 0xF4, 0x00, 0xBF, 0xB0, 0x4F, 0xF4, 0x00, 0xBF, 0xB0,
+  0x4F, 0xF4, 0x00, 0xBF, 0xB0, 0x4F, 0xF4, 0x00, 0xBF, 0xB0, 0x4F, 0xF4, 0x00, 0xBF, 0xB0, 0x4F,
+  0xF4, 0x00, 0xBF, 0xB0, 0x3B, 0xB3, 0x00, 0x8B, 0x80, 0x00, 0x00, 0x00, 0x08, 0xB7, 0x00, 0x0B,
+  0xB4, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF6, 0x00, 0x3F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF2,
+  0x00, 0x7F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0xAF, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0xAF, 0x90, 0x00, 0xEF, 0x50, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x60, 0x03, 0xFF, 0x10, 0x00, 0x04,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x01, 0x44, 0x4B, 0xFA, 0x44, 0x4E, 0xF8, 0x44, 0x42, 0x00, 0x00, 0x0D, 0xF6, 0x00, 0x2F,
+  0xF2, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xD0,
+  0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x00, 0xDF, 0x60, 0x00, 0x00, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+  0x44, 0x49, 0xFD, 0x44, 0x4C, 0xF9, 0x44, 0x43, 0x00, 0x00, 0x0A, 0xF9, 0x00, 0x0E, 0xF5, 0x00,
+  0x00, 0x00, 0x00, 0x0E, 0xF6, 0x00, 0x3F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF2, 0x00, 0x7F,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x80,
+  0x00, 0xEF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x01, 0x68, 0xDE, 0xA8,
+  0x52, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x07, 0xFF, 0xB6, 0x9C, 0x58, 0xCF, 0x80,
+  0x0E, 0xFB, 0x00, 0x8B, 0x00, 0x03, 0x40, 0x4F, 0xF5, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x4F, 0xF4,
+  0x00, 0x8B, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x82, 0x8B,
+  0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xFD, 0x84, 0x00, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0xFF, 0xD5,
+  0x00, 0x00, 0x00, 0x15, 0xBE, 0xEF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x8B, 0x04, 0xDF, 0xF4, 0x00,
+  0x00, 0x00, 0x8B, 0x00, 0x3F, 0xF9, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00,
+  0x8B, 0x00, 0x0F, 0xFB, 0x36, 0x00, 0x00, 0x8B, 0x00, 0x5F, 0xF7, 0x4F, 0xD8, 0x41, 0x8B, 0x28,
+  0xEF, 0xC1, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x30, 0x01, 0x69, 0xBF, 0xFF, 0xEA, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x44, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xE8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xBB, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE3,
+  0x00, 0x3E, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0x80, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xA0, 0x00, 0x0B, 0xF6, 0x00, 0x00,
+  0x00, 0x00, 0x1E, 0xF9, 0x44, 0xAF, 0xD1, 0x00, 0x00, 0x49, 0x20, 0x03, 0xEF, 0xFF, 0xFE, 0x30,
+  0x01, 0x7D, 0xFD, 0x50, 0x00, 0x28, 0xBB, 0x81, 0x04, 0x9F, 0xFA, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0xDF, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x49, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x7D, 0xFD, 0x82, 0x01, 0x9E, 0xFE, 0x81, 0x00, 0x09, 0xFA, 0x50, 0x00, 0x1C, 0xFF, 0xDF, 0xFC,
+  0x10, 0x02, 0x20, 0x00, 0x00, 0x9F, 0x91, 0x02, 0xCF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x10,
+  0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0xEF, 0x10, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xC2, 0x02, 0xCF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9E, 0xFD, 0x81, 0x00,
+  0x00, 0x00, 0x00, 0x38, 0x88, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0x70,
+  0x00, 0x00, 0x00, 0x01, 0xDF, 0xFD, 0xBB, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00,
+  0x04, 0x50, 0x00, 0x00, 0x00, 0x09, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xCF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFD, 0xFF, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xCF, 0xC1, 0x7F, 0xF8, 0x00, 0x00, 0x3B, 0xB0, 0x06, 0xFF, 0x30, 0x0B,
+  0xFF, 0x40, 0x00, 0x4F, 0xF0, 0x0D, 0xF9, 0x00, 0x01, 0xEF, 0xE1, 0x00, 0x4F, 0xE0, 0x1F, 0xF6,
+  0x00, 0x00, 0x4F, 0xFB, 0x00, 0x6F, 0xB0, 0x4F, 0xF4, 0x00, 0x00, 0x08, 0xFF, 0x70, 0x9F, 0x80,
+  0x3F, 0xF7, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0xEF, 0x30, 0x0E, 0xFB, 0x00, 0x00, 0x00, 0x2E, 0xFF,
+  0xFB, 0x00, 0x09, 0xFF, 0x70, 0x00, 0x00, 0x05, 0xFF, 0xF2, 0x00, 0x02, 0xEF, 0xF8, 0x10, 0x00,
+  0x4C, 0xFF, 0xF7, 0x00, 0x00, 0x3E, 0xFF, 0xFC, 0xBE, 0xFF, 0xEC, 0xFF, 0x30, 0x00, 0x02, 0x9F,
+  0xFF, 0xFF, 0xE8, 0x12, 0xEF, 0xD1, 0x00, 0x00, 0x01, 0x48, 0x74, 0x00, 0x00, 0x00, 0x00, 0x24,
+  0x40, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x6B,
+  0xB0, 0x00, 0x02, 0xEF, 0x40, 0x00, 0x09, 0xFB, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0xAF, 0xB0,
+  0x00, 0x02, 0xFF, 0x60, 0x00, 0x08, 0xFF, 0x10, 0x00, 0x0D, 0xFA, 0x00, 0x00, 0x3F, 0xF7, 0x00,
+  0x00, 0x8F, 0xF4, 0x00, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0xFF, 0xB0, 0x00,
+  0x00, 0xFF, 0xB0, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0xEF, 0xC0, 0x00, 0x00, 0xBF, 0xF0, 0x00,
+  0x00, 0x9F, 0xF1, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x0D, 0xFC, 0x00,
+  0x00, 0x07, 0xFF, 0x20, 0x00, 0x01, 0xFF, 0x70, 0x00, 0x00, 0x9F, 0xD0, 0x00, 0x00, 0x2F, 0xF5,
+  0x00, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x01, 0xAB, 0x40, 0xBF, 0x80, 0x00, 0x00, 0x4F, 0xF2, 0x00,
+  0x00, 0x0B, 0xF9, 0x00, 0x00, 0x05, 0xFF, 0x20, 0x00, 0x00, 0xDF, 0x90, 0x00, 0x00, 0x8F, 0xE1,
+  0x00, 0x00, 0x4F, 0xF6, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x08, 0xFF,
+  0x20, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0x60, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x04, 0xFF,
+  0x80, 0x00, 0x07, 0xFF, 0x50, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x09, 0xFF, 0x10, 0x00, 0x0C, 0xFD,
+  0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0x9F, 0xE0, 0x00, 0x01, 0xEF, 0x80,
+  0x00, 0x06, 0xFF, 0x20, 0x00, 0x0D, 0xF8, 0x00, 0x00, 0x6F, 0xE1, 0x00, 0x00, 0x9B, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x3D, 0x40, 0x00, 0xF8, 0x00, 0x18, 0x90, 0x5E, 0xF9, 0x10,
+  0xF8, 0x06, 0xEF, 0xA0, 0x01, 0x8E, 0xE7, 0xFA, 0xBF, 0xB4, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xD4,
+  0x00, 0x00, 0x00, 0x00, 0x6E, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x5D, 0xF9, 0xFB, 0xDF, 0x81, 0x00,
+  0x4B, 0xFC, 0x40, 0xF8, 0x18, 0xFE, 0x80, 0x4E, 0x70, 0x00, 0xF8, 0x00, 0x3B, 0xB0, 0x01, 0x00,
+  0x00, 0xF8, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB6,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0,
+  0x00, 0x00, 0x00, 0x34, 0x44, 0x44, 0x9F, 0xF4, 0x44, 0x44, 0x41, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x8F, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x44, 0x43, 0x00, 0xFF, 0xFB, 0x00, 0xFF, 0xFB, 0x00, 0xFF, 0xFA, 0x02,
+  0xFF, 0xF4, 0x06, 0xFF, 0xB0, 0x09, 0xFF, 0x40, 0x0D, 0xFB, 0x00, 0x2F, 0xF2, 0x00, 0xFF, 0xFF,
+  0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0x44, 0x44, 0x44, 0x42, 0x44, 0x42, 0xFF, 0xF8, 0xFF, 0xF8,
+  0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0B, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x9F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF7,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFB, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5B, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x88,
+  0x50, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xFD, 0x50, 0x00, 0x00, 0xCF, 0xFE, 0xBC, 0xFF, 0xF5,
+  0x00, 0x08, 0xFF, 0x91, 0x00, 0x6F, 0xFE, 0x10, 0x1E, 0xFE, 0x10, 0x00, 0x08, 0xFF, 0x70, 0x6F,
+  0xF8, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x9F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF2, 0xCF, 0xF0, 0x00,
+  0x00, 0x00, 0x8F, 0xF4, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0xFF, 0xB0, 0x02, 0x85, 0x00,
+  0x5F, 0xF8, 0xFF, 0xB0, 0x0E, 0xFF, 0x60, 0x4F, 0xF8, 0xFF, 0xB0, 0x3F, 0xFF, 0x80, 0x4F, 0xF8,
+  0xFF, 0xB0, 0x0C, 0xFF, 0x40, 0x4F, 0xF8, 0xFF, 0xB0, 0x00, 0x42, 0x00, 0x5F, 0xF8, 0xFF, 0xE0,
+  0x00, 0x00, 0x00, 0x8F, 0xF7, 0xCF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x9F, 0xF4, 0x00, 0x00,
+  0x00, 0xCF, 0xF1, 0x6F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xC0, 0x1E, 0xFE, 0x10, 0x00, 0x08, 0xFF,
+  0x60, 0x08, 0xFF, 0xC2, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0xAF, 0xFF, 0xDF, 0xFF, 0xE3, 0x00, 0x00,
+  0x08, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x14, 0x86, 0x30, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x44, 0x00, 0x00, 0x00, 0x15, 0x8B, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0x00,
+  0x00, 0x00, 0x8F, 0xFC, 0x9D, 0xFF, 0x00, 0x00, 0x00, 0x44, 0x10, 0x0B, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00,
+  0x00, 0x00, 0x28, 0x88, 0x8D, 0xFF, 0x88, 0x88, 0x40, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x04, 0x78, 0x87, 0x30, 0x00, 0x00, 0x39, 0xEF,
+  0xFF, 0xFF, 0xFD, 0x40, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0xBF, 0x95, 0x00, 0x02,
+  0x9F, 0xFE, 0x20, 0x72, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFE, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC,
+  0x10, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFE, 0x30, 0x00, 0x00,
+  0x00, 0x01, 0xEF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x01, 0xCF,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFC, 0x88, 0x88,
+  0x88, 0x88, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x00, 0x14, 0x78, 0x87, 0x30, 0x00, 0x00, 0x6D, 0xFF, 0xFF, 0xFF, 0xFD, 0x50, 0x00, 0x8F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x8A, 0x62, 0x00, 0x01, 0x8F, 0xFF, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0x30,
+  0x00, 0x04, 0x88, 0x8A, 0xFF, 0xE6, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFA, 0x20, 0x00, 0x00, 0x08,
+  0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8F, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF3, 0x40,
+  0x00, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0xFC, 0x74, 0x00, 0x04, 0x9F, 0xFF, 0x60, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF9, 0x00, 0x8C, 0xFF, 0xFF, 0xFF, 0xFC, 0x50, 0x00, 0x00, 0x14, 0x58, 0x74, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xB8, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x38, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x0A, 0xF8, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x4F, 0xE1, 0x08, 0xFF,
+  0x40, 0x00, 0x00, 0x01, 0xDF, 0x70, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x08, 0xFC, 0x00, 0x08, 0xFF,
+  0x40, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00, 0xCF, 0x90, 0x00, 0x08, 0xFF,
+  0x40, 0x00, 0x07, 0xFE, 0x10, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x2E, 0xF7, 0x00, 0x00, 0x08, 0xFF,
+  0x40, 0x00, 0x8F, 0xE4, 0x44, 0x44, 0x49, 0xFF, 0x74, 0x40, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF,
+  0x40, 0x00, 0x04, 0x44, 0x44, 0x44, 0x44, 0x43, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00,
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x0F, 0xF9, 0x44, 0x44, 0x44, 0x43, 0x00, 0x0F, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xCF, 0xFD, 0x94, 0x00,
+  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x0F, 0xC8, 0x88, 0x8C, 0xFF, 0xF9, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x6F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0,
+  0x20, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x80, 0xFA, 0x63, 0x00, 0x16, 0xCF, 0xFD, 0x10, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xE9, 0x10, 0x00, 0x00, 0x34, 0x78, 0x64,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x78, 0x87, 0x30, 0x00, 0x00, 0x04, 0xDF, 0xFF, 0xFF, 0xFD,
+  0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xF8, 0x10, 0x00, 0x59, 0x00, 0x0B,
+  0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF2, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xB0, 0x4A, 0xFF, 0xD9,
+  0x40, 0x00, 0xFF, 0x86, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0xFF, 0xBF, 0xE8, 0x44, 0x8E, 0xFF, 0x50,
+  0xFF, 0xFE, 0x30, 0x00, 0x03, 0xFF, 0xD0, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x9F, 0xF4, 0xFF, 0xF3,
+  0x00, 0x00, 0x00, 0x6F, 0xF8, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0xCF, 0xF0, 0x00, 0x00,
+  0x00, 0x4F, 0xF8, 0xAF, 0xF2, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x6F, 0xF6, 0x00, 0x00, 0x00, 0x8F,
+  0xF5, 0x1F, 0xFC, 0x00, 0x00, 0x01, 0xDF, 0xF1, 0x08, 0xFF, 0xA2, 0x00, 0x2C, 0xFF, 0x80, 0x01,
+  0xCF, 0xFF, 0xCD, 0xFF, 0xFC, 0x10, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x14,
+  0x77, 0x41, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x44, 0x44, 0x44, 0x44, 0x45, 0xFF, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xEF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x2F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xEF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF7, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xDF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x0A, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x88, 0x86, 0x20, 0x00, 0x00, 0x00, 0x05, 0xDF, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x6F,
+  0xFF, 0xCB, 0xBE, 0xFF, 0xC1, 0x00, 0x02, 0xFF, 0xE4, 0x00, 0x01, 0xBF, 0xF9, 0x00, 0x08, 0xFF,
+  0x80, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x09, 0xFF, 0x40, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x09, 0xFF,
+  0x40, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x07, 0xFF, 0x60, 0x00, 0x00, 0x0D, 0xFD, 0x00, 0x01, 0xEF,
+  0xC1, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x00, 0x3E, 0xFD, 0x74, 0x59, 0xFF, 0x90, 0x00, 0x00, 0x01,
+  0x9F, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFF, 0xFC, 0x40, 0x00, 0x01, 0xCF,
+  0xF8, 0x10, 0x05, 0xCF, 0xF6, 0x00, 0x08, 0xFF, 0x70, 0x00, 0x00, 0x1D, 0xFE, 0x10, 0x0E, 0xFE,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0x60, 0x1F, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x3F, 0xFB,
+  0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x0C, 0xFF,
+  0x60, 0x00, 0x00, 0x0D, 0xFF, 0x50, 0x06, 0xFF, 0xE6, 0x00, 0x02, 0xAF, 0xFC, 0x00, 0x00, 0x9F,
+  0xFF, 0xFB, 0xDF, 0xFF, 0xE3, 0x00, 0x00, 0x06, 0xDF, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x00,
+  0x03, 0x58, 0x64, 0x10, 0x00, 0x00, 0x00, 0x00, 0x15, 0x88, 0x84, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xEF, 0xFF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xCB, 0xDF, 0xFF, 0x50, 0x00, 0x04, 0xFF,
+  0xE3, 0x00, 0x05, 0xEF, 0xE1, 0x00, 0x0A, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xF7, 0x00, 0x0F, 0xFD,
+  0x00, 0x00, 0x00, 0x0E, 0xFC, 0x00, 0x3F, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x00, 0x4F, 0xF8,
+  0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x50, 0x0F, 0xFB,
+  0x00, 0x00, 0x00, 0x0D, 0xFF, 0x80, 0x0C, 0xFF, 0x20, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x08, 0xFF,
+  0xA0, 0x00, 0x01, 0xCF, 0xFF, 0x80, 0x01, 0xCF, 0xFD, 0x88, 0x8D, 0xFB, 0xFF, 0x80, 0x00, 0x3C,
+  0xFF, 0xFF, 0xFF, 0x94, 0xFF, 0x70, 0x00, 0x00, 0x6A, 0xBB, 0xA6, 0x05, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFD, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xF2, 0x00, 0x00, 0xA8,
+  0x40, 0x02, 0x6E, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x8E,
+  0xFF, 0xFF, 0xFD, 0x60, 0x00, 0x00, 0x00, 0x00, 0x46, 0x85, 0x30, 0x00, 0x00, 0x00, 0xFF, 0xF8,
+  0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x44, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x44, 0x42, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00,
+  0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00, 0x44, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x43, 0x00, 0xFF, 0xFB,
+  0x00, 0xFF, 0xFB, 0x00, 0xFF, 0xFA, 0x02, 0xFF, 0xF4, 0x06, 0xFF, 0xB0, 0x09, 0xFF, 0x40, 0x0D,
+  0xFB, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x28, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+  0x02, 0x8E, 0xFF, 0xFF, 0x92, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xFC, 0x61, 0x00, 0x00, 0x28, 0xEF,
+  0xFF, 0xD8, 0x20, 0x00, 0x00, 0x5B, 0xFF, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x71,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xEF, 0xFF,
+  0xD7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xFA, 0x60, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x8E, 0xFF, 0xFE, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x28, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xA4, 0x34, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x41, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x41, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x88, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x82, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFD, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFF,
+  0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xEF, 0xFF, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x16,
+  0xBF, 0xFF, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8D, 0xFF, 0xFE, 0x81, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x49, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6C, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+  0x05, 0x9F, 0xFF, 0xFB, 0x60, 0x00, 0x00, 0x38, 0xDF, 0xFF, 0xE8, 0x20, 0x00, 0x01, 0x7C, 0xFF,
+  0xFF, 0xB6, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFE, 0x82, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFA, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x78,
+  0x86, 0x20, 0x00, 0x18, 0xDF, 0xFF, 0xFF, 0xF9, 0x10, 0x8F, 0xFF, 0xDB, 0xEF, 0xFF, 0xC0, 0x8E,
+  0x82, 0x00, 0x04, 0xEF, 0xF6, 0x42, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0xFB, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF9, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xF4, 0x00, 0x00, 0x00,
+  0x1C, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xCF, 0xF9, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00,
+  0x00, 0x6F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x44,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x9B, 0xBA, 0x61, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x40, 0x00, 0x00, 0x01, 0xCF, 0xFA, 0x74, 0x47, 0xDF, 0xF3, 0x00, 0x00, 0x1C, 0xFD, 0x40,
+  0x00, 0x00, 0x1A, 0xFD, 0x00, 0x00, 0x9F, 0xD1, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x50, 0x04, 0xFF,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x09, 0xF9, 0x00, 0x00, 0x28, 0xBB, 0x92, 0x7F, 0xA0,
+  0x0E, 0xF3, 0x00, 0x06, 0xEF, 0xFF, 0xFE, 0x7F, 0xB0, 0x4F, 0xE0, 0x00, 0x2E, 0xFC, 0x64, 0x7E,
+  0xFF, 0xB0, 0x7F, 0xB0, 0x00, 0x9F, 0xC1, 0x00, 0x03, 0xEF, 0xB0, 0x8F, 0x80, 0x00, 0xEF, 0x50,
+  0x00, 0x00, 0x8F, 0xB0, 0x8F, 0x80, 0x02, 0xFF, 0x10, 0x00, 0x00, 0x5F, 0xB0, 0x8F, 0x80, 0x04,
+  0xFF, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x8F, 0x80, 0x00, 0xFF, 0x20, 0x00, 0x00, 0x7F, 0xB0, 0x8F,
+  0x90, 0x00, 0xDF, 0x80, 0x00, 0x00, 0xBF, 0xB0, 0x5F, 0xC0, 0x00, 0x8F, 0xE4, 0x00, 0x08, 0xFF,
+  0xB0, 0x2F, 0xF1, 0x00, 0x0C, 0xFF, 0xCB, 0xDF, 0xDF, 0xB0, 0x0C, 0xF8, 0x00, 0x01, 0x9F, 0xFF,
+  0xFB, 0x5F, 0xB0, 0x06, 0xFE, 0x10, 0x00, 0x02, 0x44, 0x30, 0x00, 0x00, 0x00, 0xDF, 0x90, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xD9, 0x88, 0x9D, 0x60, 0x00,
+  0x00, 0x00, 0x01, 0x8E, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x88, 0x84,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xCF, 0xEF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x7E, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0xFF, 0x2A, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFD, 0x06, 0xFF, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x1F, 0xF8, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF5, 0x00, 0xDF,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF0, 0x00, 0x8F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xB0,
+  0x00, 0x5F, 0xF7, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x70, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0x30, 0x00, 0x0B, 0xFF, 0x10, 0x00, 0x00, 0x0D, 0xFD, 0x00, 0x00, 0x07, 0xFF, 0x50, 0x00,
+  0x00, 0x3F, 0xFE, 0xBB, 0xBB, 0xBC, 0xFF, 0x90, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE0, 0x00, 0x00, 0xCF, 0xF8, 0x88, 0x88, 0x88, 0xBF, 0xF4, 0x00, 0x02, 0xFF, 0xB0, 0x00, 0x00,
+  0x00, 0x5F, 0xF8, 0x00, 0x06, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x0A, 0xFF, 0x30,
+  0x00, 0x00, 0x00, 0x0A, 0xFF, 0x30, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x70, 0x5F,
+  0xF9, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x34, 0x44, 0x44, 0x41, 0x00, 0x00, 0x00, 0xBF,
+  0xFF, 0xFF, 0xFF, 0xFB, 0x60, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x10, 0xBF, 0xF7, 0x44,
+  0x44, 0x7D, 0xFF, 0xA0, 0xBF, 0xF4, 0x00, 0x00, 0x01, 0xDF, 0xF2, 0xBF, 0xF4, 0x00, 0x00, 0x00,
+  0x8F, 0xF4, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0xAF, 0xF4,
+  0xBF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0xBF, 0xF9, 0x88, 0x88, 0xAF, 0xFE, 0x30, 0xBF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x82, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x10, 0xBF, 0xF4, 0x00, 0x00,
+  0x28, 0xFF, 0xC1, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x0E,
+  0xFD, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xBF,
+  0xF4, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x9F, 0xFA, 0xBF, 0xF7, 0x44,
+  0x47, 0x8D, 0xFF, 0xF3, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0xBF, 0xFF, 0xFF, 0xFF, 0xDB,
+  0x71, 0x00, 0x00, 0x00, 0x01, 0x58, 0x88, 0x51, 0x00, 0x00, 0x01, 0x8F, 0xFF, 0xFF, 0xFF, 0xA2,
+  0x00, 0x1C, 0xFF, 0xFD, 0xBD, 0xFF, 0xF4, 0x00, 0xCF, 0xFA, 0x20, 0x00, 0x28, 0xE4, 0x08, 0xFF,
+  0xA0, 0x00, 0x00, 0x00, 0x22, 0x1E, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF9, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xBF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x33, 0x00, 0xCF, 0xFC, 0x50, 0x00, 0x39, 0xF4, 0x00, 0x1C,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x8D, 0xFF, 0xFF, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x35,
+  0x86, 0x40, 0x00, 0x44, 0x44, 0x30, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFB, 0x71, 0x00,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x60, 0x00, 0xFF, 0xC4, 0x44, 0x7B, 0xFF, 0xF6, 0x00, 0xFF,
+  0xB0, 0x00, 0x00, 0x5F, 0xFF, 0x20, 0xFF, 0xB0, 0x00, 0x00, 0x07, 0xFF, 0x90, 0xFF, 0xB0, 0x00,
+  0x00, 0x01, 0xEF, 0xF0, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x8F, 0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x6F, 0xFA,
+  0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x6F, 0xFA, 0xFF, 0xB0,
+  0x00, 0x00, 0x00, 0x8F, 0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0xFF, 0xB0, 0x00, 0x00,
+  0x00, 0xBF, 0xF4, 0xFF, 0xB0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0xFF, 0xB0, 0x00, 0x00, 0x08, 0xFF,
+  0x90, 0xFF, 0xB0, 0x00, 0x00, 0x7F, 0xFE, 0x20, 0xFF, 0xC4, 0x48, 0x8D, 0xFF, 0xF5, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFD, 0x40, 0x00, 0xFF, 0xFF, 0xFF, 0xC9, 0x60, 0x00, 0x00, 0x14, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x41, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF4, 0x4F, 0xFC, 0x44, 0x44, 0x44, 0x44, 0x41, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFD, 0x88, 0x88,
+  0x88, 0x88, 0x80, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFD, 0x88, 0x88, 0x88, 0x88, 0x84, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 0x30, 0xBF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0xBF, 0xF7, 0x44, 0x44,
+  0x44, 0x44, 0x30, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x88, 0x88, 0x88, 0x86, 0x00, 0xBF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFB, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x37, 0x88, 0x73, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0xFF, 0xB4,
+  0x00, 0x00, 0x06, 0xFF, 0xFF, 0xBB, 0xFF, 0xFF, 0x00, 0x00, 0x6F, 0xFE, 0x60, 0x00, 0x05, 0xCF,
+  0x00, 0x01, 0xEF, 0xF3, 0x00, 0x00, 0x00, 0x09, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0D, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x3B, 0xBB, 0xBB,
+  0x80, 0x8F, 0xF8, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xB0, 0x8F, 0xF8, 0x00, 0x00, 0x28, 0x88, 0xFF,
+  0xB0, 0x5F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x2F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xB0, 0x0D, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xFF,
+  0xB0, 0x01, 0xEF, 0xF3, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x5F, 0xFE, 0x81, 0x00, 0x28, 0xFF,
+  0xB0, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0x92,
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x77, 0x41, 0x00, 0x00, 0x44, 0x30, 0x00, 0x00, 0x00, 0x14, 0x42,
+  0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xB0,
+  0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xB0, 0x00, 0x00,
+  0x00, 0x4F, 0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F,
+  0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xD8, 0x88, 0x88, 0x88, 0x9F, 0xF8, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xB0, 0x00,
+  0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x4F, 0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xF8,
+  0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xB0,
+  0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xB0, 0x00, 0x00,
+  0x00, 0x4F, 0xF8, 0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x80, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x14, 0x44, 0x4C, 0xFF, 0x74, 0x44, 0x20, 0x00,
+  0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B,
+  0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x28, 0x88, 0x8D, 0xFF, 0x98, 0x88, 0x40, 0x4F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x34,
+  0x44, 0x44, 0x44, 0x20, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x00, 0x00, 0x34, 0x44, 0x47, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0xFF, 0x80, 0x10, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x60, 0x87, 0x00, 0x00, 0x00, 0x0D,
+  0xFF, 0x30, 0x8F, 0xD6, 0x10, 0x02, 0x9F, 0xFC, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
+  0x28, 0xDF, 0xFF, 0xFF, 0xFC, 0x40, 0x00, 0x00, 0x02, 0x47, 0x84, 0x20, 0x00, 0x00, 0x44, 0x30,
+  0x00, 0x00, 0x00, 0x01, 0x44, 0x40, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x80, 0xFF, 0xB0,
+  0x00, 0x00, 0x01, 0xCF, 0xF9, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0x0C, 0xFF, 0x90, 0x00, 0xFF, 0xB0,
+  0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x09, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xB0,
+  0x00, 0x9F, 0xFA, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x09, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0xFF, 0xB0,
+  0x8F, 0xFC, 0x10, 0x00, 0x00, 0x00, 0xFF, 0xB6, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF,
+  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xCD, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0xFC,
+  0x15, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0x00, 0xAF, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xB0,
+  0x00, 0x1E, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x05, 0xFF, 0xD1, 0x00, 0x00, 0xFF, 0xB0,
+  0x00, 0x00, 0xAF, 0xF9, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0x1E, 0xFF, 0x50, 0x00, 0xFF, 0xB0,
+  0x00, 0x00, 0x07, 0xFF, 0xE1, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0xFA, 0x00, 0xFF, 0xB0,
+  0x00, 0x00, 0x00, 0x2E, 0xFF, 0x50, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE1, 0x44, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x82, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x34, 0x44, 0x00, 0x00, 0x00, 0x03, 0x44, 0x41,
+  0xBF, 0xFF, 0x50, 0x00, 0x00, 0x0D, 0xFF, 0xF4, 0xBF, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0xFF, 0xF4,
+  0xBF, 0xDF, 0xE0, 0x00, 0x00, 0x8F, 0xFF, 0xF4, 0xBF, 0xBB, 0xF5, 0x00, 0x00, 0xDF, 0xAF, 0xF4,
+  0xBF, 0xB6, 0xF9, 0x00, 0x03, 0xFC, 0x8F, 0xF4, 0xBF, 0xB1, 0xFE, 0x00, 0x08, 0xF7, 0x8F, 0xF4,
+  0xBF, 0xB0, 0xAF, 0x50, 0x0D, 0xF2, 0x8F, 0xF4, 0xBF, 0xB0, 0x6F, 0x90, 0x3F, 0xC0, 0x8F, 0xF4,
+  0xBF, 0xB0, 0x1F, 0xE0, 0x8F, 0x70, 0x8F, 0xF4, 0xBF, 0xB0, 0x0A, 0xF5, 0xEF, 0x20, 0x8F, 0xF4,
+  0xBF, 0xB0, 0x06, 0xFD, 0xFC, 0x00, 0x8F, 0xF4, 0xBF, 0xB0, 0x01, 0xFF, 0xF7, 0x00, 0x8F, 0xF4,
+  0xBF, 0xB0, 0x00, 0xAF, 0xF2, 0x00, 0x8F, 0xF4, 0xBF, 0xB0, 0x00, 0x48, 0x70, 0x00, 0x8F, 0xF4,
+  0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4,
+  0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4,
+  0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4,
+  0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x44, 0x42, 0x00, 0x00, 0x00, 0x14, 0x42, 0xFF,
+  0xFD, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xFF, 0xA0,
+  0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xBD, 0xF8, 0x00, 0x00,
+  0x4F, 0xF8, 0xFF, 0xB8, 0xFD, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xB2, 0xFF, 0x50, 0x00, 0x4F, 0xF8,
+  0xFF, 0xB0, 0x9F, 0xB0, 0x00, 0x4F, 0xF8, 0xFF, 0xB0, 0x4F, 0xF2, 0x00, 0x4F, 0xF8, 0xFF, 0xB0,
+  0x0D, 0xF8, 0x00, 0x4F, 0xF8, 0xFF, 0xB0, 0x07, 0xFE, 0x00, 0x4F, 0xF8, 0xFF, 0xB0, 0x01, 0xFF,
+  0x60, 0x4F, 0xF8, 0xFF, 0xB0, 0x00, 0x9F, 0xB0, 0x4F, 0xF8, 0xFF, 0xB0, 0x00, 0x3F, 0xF3, 0x4F,
+  0xF8, 0xFF, 0xB0, 0x00, 0x0C, 0xF9, 0x4F, 0xF8, 0xFF, 0xB0, 0x00, 0x06, 0xFE, 0x5F, 0xF8, 0xFF,
+  0xB0, 0x00, 0x01, 0xEF, 0x9F, 0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0xFF, 0xB0, 0x00,
+  0x00, 0x2F, 0xFF, 0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x0B, 0xFF, 0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x06,
+  0xFF, 0xF8, 0x00, 0x00, 0x03, 0x78, 0x85, 0x10, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFF, 0xE7,
+  0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFB, 0xDF, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF9, 0x10, 0x04, 0xEF,
+  0xF4, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x4F, 0xFA, 0x00, 0x09, 0xFF, 0x50, 0x00, 0x00, 0x0D,
+  0xFF, 0x10, 0x0D, 0xFF, 0x10, 0x00, 0x00, 0x09, 0xFF, 0x50, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x07,
+  0xFF, 0x80, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xA0, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x04,
+  0xFF, 0xB0, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x04,
+  0xFF, 0xB0, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x04,
+  0xFF, 0xB0, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x90, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x08,
+  0xFF, 0x80, 0x0D, 0xFF, 0x10, 0x00, 0x00, 0x09, 0xFF, 0x50, 0x09, 0xFF, 0x60, 0x00, 0x00, 0x0D,
+  0xFF, 0x10, 0x04, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x00, 0xBF, 0xFA, 0x20, 0x06, 0xEF,
+  0xF3, 0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xD5,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x48, 0x63, 0x00, 0x00, 0x00, 0x14, 0x44, 0x44, 0x42, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFD, 0x92, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x60, 0x00, 0x4F, 0xFC, 0x44, 0x44, 0x6C, 0xFF, 0xF4, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0xAF,
+  0xFA, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x0D,
+  0xFF, 0x20, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x40, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x0F,
+  0xFF, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x18, 0xFF,
+  0xF6, 0x00, 0x4F, 0xFE, 0xBB, 0xBD, 0xFF, 0xFF, 0x90, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8,
+  0x00, 0x00, 0x4F, 0xFD, 0x88, 0x88, 0x74, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x78, 0x85, 0x10,
+  0x00, 0x00, 0x00, 0x03, 0xBF, 0xFF, 0xFF, 0xE7, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFB, 0xDF, 0xFF,
+  0x80, 0x00, 0x00, 0xBF, 0xF9, 0x10, 0x04, 0xEF, 0xF4, 0x00, 0x04, 0xFF, 0xB0, 0x00, 0x00, 0x4F,
+  0xFA, 0x00, 0x09, 0xFF, 0x50, 0x00, 0x00, 0x0D, 0xFF, 0x10, 0x0D, 0xFF, 0x10, 0x00, 0x00, 0x09,
+  0xFF, 0x50, 0x0F, 0xFD, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x04,
+  0xFF, 0xA0, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x04,
+  0xFF, 0xB0, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x04,
+  0xFF, 0xB0, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xB0, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x04,
+  0xFF, 0xA0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x0D, 0xFF, 0x10, 0x00, 0x00, 0x09,
+  0xFF, 0x50, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x0D, 0xFF, 0x10, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F,
+  0xFA, 0x00, 0x00, 0xBF, 0xFA, 0x20, 0x06, 0xEF, 0xF3, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x60, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x01, 0x48, 0xAF, 0xF9,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F,
+  0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x00, 0x44, 0x44, 0x44, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xD8, 0x20, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE6,
+  0x00, 0x00, 0xFF, 0xF4, 0x44, 0x46, 0xCF, 0xFF, 0x30, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0A, 0xFF,
+  0xA0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
+  0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xFF,
+  0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0A, 0xFF, 0x80, 0x00, 0xFF, 0xF4, 0x44, 0x47, 0xBF, 0xFC,
+  0x10, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x81, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x20,
+  0x00, 0x00, 0xFF, 0xF0, 0x00, 0x28, 0xFF, 0xE1, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x6F, 0xFA,
+  0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x04, 0xFF,
+  0xB0, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x4F,
+  0xFB, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x06,
+  0xFF, 0xB0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x00, 0x00, 0x37, 0x88, 0x74, 0x00,
+  0x00, 0x00, 0x5D, 0xFF, 0xFF, 0xFF, 0xFA, 0x20, 0x06, 0xFF, 0xFF, 0xBB, 0xEF, 0xFF, 0x40, 0x4F,
+  0xFE, 0x60, 0x00, 0x02, 0x8E, 0x40, 0xAF, 0xF3, 0x00, 0x00, 0x00, 0x01, 0x10, 0xEF, 0xC0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xCF, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xE8, 0x51, 0x00, 0x00, 0x00,
+  0x08, 0xFF, 0xFF, 0xFF, 0xC8, 0x20, 0x00, 0x00, 0x4A, 0xFF, 0xFF, 0xFF, 0xE7, 0x00, 0x00, 0x00,
+  0x15, 0x8C, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xAF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x83, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF3, 0xBF,
+  0xA6, 0x10, 0x00, 0x5C, 0xFF, 0xB0, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x20, 0x49, 0xEF, 0xFF,
+  0xFF, 0xFE, 0x91, 0x00, 0x00, 0x02, 0x47, 0x85, 0x40, 0x00, 0x00, 0x14, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x30, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x4F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x14, 0x44, 0x44, 0x4C, 0xFF, 0x74, 0x44, 0x44, 0x30, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B,
+  0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x24, 0x41, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0xFF,
+  0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0xFF, 0xF0, 0x00,
+  0x00, 0x00, 0x8F, 0xF4, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+  0x8F, 0xF4, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF4,
+  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0xFF, 0xF0,
+  0x00, 0x00, 0x00, 0x8F, 0xF4, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0xFF, 0xF0, 0x00, 0x00,
+  0x00, 0x8F, 0xF4, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x8F,
+  0xF4, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0xBF, 0xF1, 0x00, 0x00, 0x00, 0x8F, 0xF3, 0x8F,
+  0xF7, 0x00, 0x00, 0x01, 0xDF, 0xE0, 0x2E, 0xFF, 0x71, 0x00, 0x4C, 0xFF, 0x80, 0x06, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x10, 0x00, 0x4B, 0xFF, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x24, 0x86, 0x40,
+  0x00, 0x00, 0x14, 0x43, 0x00, 0x00, 0x00, 0x00, 0x01, 0x44, 0x30, 0x0F, 0xFE, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xFF, 0x70, 0x0A, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x30, 0x07, 0xFF, 0x70,
+  0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x02, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00,
+  0xCF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF5, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0xCF, 0xF0,
+  0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xA0, 0x00, 0x00, 0x0E, 0xFC, 0x00, 0x00, 0x05,
+  0xFF, 0x70, 0x00, 0x00, 0x0A, 0xFF, 0x10, 0x00, 0x09, 0xFF, 0x20, 0x00, 0x00, 0x06, 0xFF, 0x50,
+  0x00, 0x0D, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0xCF, 0xD0, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF2, 0x00, 0xAF, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0x3F, 0xF6, 0x00, 0xEF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF9, 0x03, 0xFF, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0xFD, 0x07, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x3A,
+  0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0xEF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x44, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+  0x42, 0xEF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF6, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xF4, 0x8F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF0, 0x8F, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xBF, 0xE0, 0x4F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xB0, 0x3F, 0xF8,
+  0x00, 0x03, 0x44, 0x10, 0x00, 0xFF, 0x90, 0x0F, 0xF8, 0x00, 0x0F, 0xFF, 0x60, 0x02, 0xFF, 0x80,
+  0x0D, 0xFB, 0x00, 0x3F, 0xFF, 0x90, 0x04, 0xFF, 0x40, 0x0B, 0xFB, 0x00, 0x6F, 0xEF, 0xC0, 0x05,
+  0xFF, 0x30, 0x08, 0xFF, 0x00, 0x8F, 0x8F, 0xF0, 0x08, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0xCF, 0x4C,
+  0xF4, 0x08, 0xFD, 0x00, 0x04, 0xFF, 0x30, 0xFF, 0x08, 0xF8, 0x0B, 0xFB, 0x00, 0x02, 0xFF, 0x44,
+  0xFC, 0x06, 0xFA, 0x0B, 0xF8, 0x00, 0x00, 0xFF, 0x77, 0xF8, 0x02, 0xFD, 0x0F, 0xF7, 0x00, 0x00,
+  0xBF, 0x89, 0xF5, 0x00, 0xDF, 0x2F, 0xF4, 0x00, 0x00, 0xAF, 0x9D, 0xF2, 0x00, 0xAF, 0x8F, 0xF2,
+  0x00, 0x00, 0x8F, 0xCF, 0xD0, 0x00, 0x7F, 0xBF, 0xF0, 0x00, 0x00, 0x6F, 0xFF, 0xA0, 0x00, 0x3F,
+  0xFF, 0xC0, 0x00, 0x00, 0x4F, 0xFF, 0x70, 0x00, 0x0F, 0xFF, 0xA0, 0x00, 0x00, 0x0F, 0xFF, 0x30,
+  0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x03, 0x44,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x44, 0x30, 0x06, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x50,
+  0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x5F, 0xFA, 0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xDF,
+  0xE2, 0x00, 0x00, 0x08, 0xFF, 0x70, 0x00, 0x08, 0xFF, 0x70, 0x00, 0x00, 0x01, 0xDF, 0xE1, 0x00,
+  0x2E, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF8, 0x00, 0xAF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x0A,
+  0xFF, 0x34, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xBD, 0xFD, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF7,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x8B, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFD,
+  0x12, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF5, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x04,
+  0xFF, 0xB0, 0x00, 0x1E, 0xFD, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0x20, 0x00, 0x07, 0xFF, 0x80, 0x00,
+  0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0xDF, 0xE2, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x5F,
+  0xFA, 0x00, 0x0C, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x7F, 0xFA, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xFF, 0xD0, 0x24, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0x44, 0x40, 0x2F, 0xFD, 0x10,
+  0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1E, 0xFE, 0x10, 0x01,
+  0xDF, 0xE1, 0x00, 0x00, 0x00, 0x9F, 0xF6, 0x00, 0x00, 0x6F, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xC0,
+  0x00, 0x00, 0x0B, 0xFF, 0x20, 0x00, 0x0A, 0xFF, 0x40, 0x00, 0x00, 0x04, 0xFF, 0xA0, 0x00, 0x4F,
+  0xF9, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF4, 0x00, 0xBF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFB,
+  0x06, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x6D, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xDF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x24, 0x44, 0x44, 0x44, 0x44, 0x44,
+  0x44, 0x10, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x40, 0x24, 0x44, 0x44, 0x44, 0x44, 0x7F, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF,
+  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFD,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF4, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFD, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xAF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1E, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFD, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xFA, 0x88, 0x88, 0x88, 0x88, 0x88, 0x40, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x80, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x8F, 0xFF, 0xFF, 0x80, 0x8F, 0xFF,
+  0xFF, 0x80, 0x8F, 0xF4, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x8F, 0xF4,
+  0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x8F, 0xF4,
+  0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x8F, 0xF4,
+  0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x8F, 0xF4,
+  0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x8F, 0xF4,
+  0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x8F, 0xF7, 0x44, 0x20, 0x8F, 0xFF, 0xFF, 0x80, 0x6B, 0xBB,
+  0xBB, 0x60, 0x24, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF7, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xDF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0D, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1E, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF1, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFD,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E,
+  0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xBB, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x00,
+  0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x0B,
+  0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF,
+  0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x00, 0x0B, 0xFF, 0x44,
+  0x4C, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x24, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xEF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0xAF, 0xF7, 0xCF, 0xE3, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x70, 0x2E, 0xFD, 0x10, 0x00,
+  0x00, 0x6F, 0xF9, 0x00, 0x03, 0xEF, 0xC0, 0x00, 0x03, 0xEF, 0x90, 0x00, 0x00, 0x3E, 0xF9, 0x00,
+  0x1D, 0xF9, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x60, 0x8B, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xB2,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+  0xBB, 0xB6, 0x44, 0x30, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x00, 0x09, 0xFE, 0x10, 0x00, 0x00, 0xAF,
+  0xB0, 0x00, 0x00, 0x1C, 0xF8, 0x00, 0x00, 0x01, 0xEF, 0x40, 0x00, 0x00, 0x24, 0x30, 0x00, 0x00,
+  0x14, 0x44, 0x00, 0x00, 0x00, 0x05, 0x9D, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF6, 0x00, 0x0F, 0xB6, 0x30, 0x00, 0x5C, 0xFF, 0x40, 0x04, 0x00, 0x00, 0x00, 0x02, 0xFF,
+  0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF0, 0x00,
+  0x28, 0xBF, 0xFF, 0xFF, 0xFF, 0xF0, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x5F, 0xFD, 0x63,
+  0x00, 0x00, 0x8F, 0xF0, 0xDF, 0xE1, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0xCF, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0xFF, 0xB0, 0x00, 0x00, 0x0A, 0xFF, 0xF0,
+  0xAF, 0xF7, 0x00, 0x02, 0xAF, 0xEF, 0xF0, 0x3E, 0xFF, 0xEB, 0xCF, 0xFC, 0x8F, 0xF0, 0x03, 0xDF,
+  0xFF, 0xFF, 0x81, 0x8F, 0xF0, 0x00, 0x03, 0x68, 0x41, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0xF4, 0x00, 0x24, 0x30, 0x00, 0x00, 0x4F, 0xF4, 0x4D, 0xFF, 0xFE, 0x80, 0x00, 0x4F, 0xF8, 0xFF,
+  0xFF, 0xFF, 0xF9, 0x00, 0x4F, 0xFF, 0xE6, 0x00, 0x3C, 0xFF, 0x80, 0x4F, 0xFF, 0x50, 0x00, 0x01,
+  0xEF, 0xE0, 0x4F, 0xFD, 0x00, 0x00, 0x00, 0x8F, 0xF5, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0xF8,
+  0x4F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x4F, 0xF4,
+  0x00, 0x00, 0x00, 0x0F, 0xFB, 0x4F, 0xF7, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x4F, 0xF8, 0x00, 0x00,
+  0x00, 0x4F, 0xF8, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF5, 0x4F, 0xFF, 0x40, 0x00, 0x00, 0xDF,
+  0xE1, 0x4F, 0xFF, 0xE4, 0x00, 0x19, 0xFF, 0x80, 0x4F, 0xF8, 0xFF, 0xDB, 0xFF, 0xFC, 0x10, 0x4F,
+  0xF4, 0x6E, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x01, 0x48, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x44, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xFF, 0xFF, 0xFA, 0x40, 0x00, 0x09, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x00, 0x8F, 0xFD, 0x61, 0x00, 0x49, 0xF0, 0x04, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x40,
+  0x0A, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0A, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x30, 0x00,
+  0xBF, 0xFB, 0x30, 0x00, 0x17, 0xE0, 0x00, 0x1C, 0xFF, 0xFD, 0xBC, 0xFF, 0xF0, 0x00, 0x00, 0x8E,
+  0xFF, 0xFF, 0xFD, 0x80, 0x00, 0x00, 0x00, 0x35, 0x85, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00,
+  0x01, 0x44, 0x00, 0x0B, 0xFB, 0x00, 0x03, 0xBF, 0xFF, 0xF8, 0x1B, 0xFB, 0x00, 0x3E, 0xFF, 0xFF,
+  0xFF, 0xBB, 0xFB, 0x01, 0xEF, 0xF7, 0x10, 0x2B, 0xFF, 0xFB, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xDF,
+  0xFB, 0x0C, 0xFE, 0x10, 0x00, 0x00, 0x6F, 0xFB, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0x4F,
+  0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x0C, 0xFB, 0x4F, 0xF8, 0x00,
+  0x00, 0x00, 0x0B, 0xFB, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x0F, 0xFA, 0x00, 0x00, 0x00,
+  0x1F, 0xFB, 0x0D, 0xFE, 0x00, 0x00, 0x00, 0x5F, 0xFB, 0x08, 0xFF, 0x60, 0x00, 0x00, 0xBF, 0xFB,
+  0x01, 0xEF, 0xE4, 0x00, 0x19, 0xFF, 0xFB, 0x00, 0x6F, 0xFF, 0xDB, 0xFF, 0xCB, 0xFB, 0x00, 0x05,
+  0xDF, 0xFF, 0xFB, 0x1B, 0xFB, 0x00, 0x00, 0x04, 0x76, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+  0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFF, 0xFF, 0xD7, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x90, 0x00, 0x00, 0x8F, 0xFC, 0x40, 0x02, 0xAF, 0xF8, 0x00, 0x04, 0xFF, 0xB0, 0x00,
+  0x00, 0x0A, 0xFE, 0x10, 0x0A, 0xFF, 0x20, 0x00, 0x00, 0x03, 0xFF, 0x60, 0x0F, 0xFC, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x80, 0x3F, 0xFA, 0x44, 0x44, 0x44, 0x44, 0xDF, 0xB0, 0x4F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xB0, 0x4F, 0xFD, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x80, 0x4F, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFE, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0xBF, 0xFA, 0x20,
+  0x00, 0x05, 0x9F, 0x40, 0x00, 0x1C, 0xFF, 0xFD, 0xBC, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x8E, 0xFF,
+  0xFF, 0xFF, 0xC7, 0x10, 0x00, 0x00, 0x00, 0x35, 0x86, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+  0xEF, 0xFF, 0xF0, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x09, 0xFF, 0x84, 0x44,
+  0x40, 0x00, 0x00, 0x0D, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x3B, 0xBB, 0xBF, 0xFD, 0xBB, 0xBB, 0xB0, 0x4F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, 0x14, 0x44, 0x4F, 0xF9, 0x44, 0x44, 0x40, 0x00, 0x00, 0x0F, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x44, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF,
+  0xFF, 0xF8, 0x08, 0xB8, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0x9B, 0xFB, 0x01, 0xDF, 0xF8, 0x10, 0x2A,
+  0xFE, 0xFB, 0x07, 0xFF, 0x80, 0x00, 0x00, 0xCF, 0xFB, 0x0C, 0xFE, 0x10, 0x00, 0x00, 0x6F, 0xFB,
+  0x0F, 0xFB, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x4F, 0xF8,
+  0x00, 0x00, 0x00, 0x0B, 0xFB, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x0C, 0xFB, 0x4F, 0xF8, 0x00, 0x00,
+  0x00, 0x0F, 0xFB, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0x0C, 0xFF, 0x10, 0x00, 0x00, 0x6F,
+  0xFB, 0x06, 0xFF, 0x80, 0x00, 0x01, 0xDF, 0xFB, 0x00, 0xCF, 0xF9, 0x30, 0x3C, 0xFD, 0xFB, 0x00,
+  0x3E, 0xFF, 0xFF, 0xFF, 0x8B, 0xFB, 0x00, 0x01, 0x9E, 0xFF, 0xD7, 0x0B, 0xFB, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xF3, 0x00, 0x8A, 0x51, 0x00, 0x07, 0xFF, 0xB0, 0x00, 0x8F, 0xFF, 0xDC, 0xFF, 0xFC, 0x10,
+  0x00, 0x4B, 0xFF, 0xFF, 0xFE, 0x81, 0x00, 0x00, 0x00, 0x02, 0x44, 0x20, 0x00, 0x00, 0x4F, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0xF4, 0x00, 0x14, 0x41, 0x00, 0x00, 0x4F, 0xF4, 0x19, 0xFF, 0xFF, 0x91, 0x00, 0x4F,
+  0xF5, 0xCF, 0xFF, 0xFF, 0xFB, 0x00, 0x4F, 0xFD, 0xE6, 0x10, 0x5D, 0xFF, 0x50, 0x4F, 0xFF, 0x40,
+  0x00, 0x04, 0xFF, 0x90, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0xDF, 0xB0, 0x4F, 0xF8, 0x00, 0x00, 0x00,
+  0xBF, 0xC0, 0x4F, 0xF7, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0,
+  0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x4F, 0xF4,
+  0x00, 0x00, 0x00, 0xBF, 0xF0, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x4F, 0xF4, 0x00, 0x00,
+  0x00, 0xBF, 0xF0, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF,
+  0xF0, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x44, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0xBB, 0xBB, 0xBB, 0x30, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+  0x02, 0x44, 0x47, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0xFF, 0x40, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F,
+  0xF0, 0x00, 0x00, 0x00, 0x24, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBB, 0xBB, 0xBB, 0xB0, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x44, 0x44, 0x9F, 0xF0, 0x00,
+  0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00,
+  0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00,
+  0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F,
+  0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0,
+  0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0xDF, 0xC0, 0x14,
+  0x44, 0x4A, 0xFF, 0x80, 0x4F, 0xFF, 0xFF, 0xFC, 0x10, 0x4F, 0xFF, 0xFD, 0x81, 0x00, 0xBF, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x08, 0xBB, 0x60, 0xBF,
+  0xF0, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0xBF, 0xF0, 0x00, 0x09, 0xFF, 0x90, 0x00, 0xBF, 0xF0, 0x00,
+  0x9F, 0xF9, 0x00, 0x00, 0xBF, 0xF0, 0x09, 0xFF, 0x70, 0x00, 0x00, 0xBF, 0xF0, 0x9F, 0xF6, 0x00,
+  0x00, 0x00, 0xBF, 0xF9, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+  0xBF, 0xFE, 0x58, 0xFF, 0x80, 0x00, 0x00, 0xBF, 0xF3, 0x00, 0xCF, 0xF4, 0x00, 0x00, 0xBF, 0xF0,
+  0x00, 0x2E, 0xFE, 0x10, 0x00, 0xBF, 0xF0, 0x00, 0x06, 0xFF, 0xB0, 0x00, 0xBF, 0xF0, 0x00, 0x00,
+  0xAF, 0xF7, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x1D, 0xFF, 0x30, 0xBF, 0xF0, 0x00, 0x00, 0x04, 0xFF,
+  0xD1, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xFA, 0x34, 0x44, 0x44, 0x40, 0x00, 0x00, 0x00, 0xBF,
+  0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x8B, 0xBB, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x84, 0x44, 0x30, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+  0xFF, 0xB0, 0x00, 0x00, 0x00, 0x3A, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x14, 0x20, 0x00, 0x14, 0x20,
+  0x00, 0x6B, 0xB6, 0xEF, 0xFA, 0x08, 0xFF, 0xF9, 0x00, 0x8F, 0xFE, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF,
+  0x60, 0x8F, 0xF8, 0x02, 0xDF, 0xFA, 0x01, 0xDF, 0xA0, 0x8F, 0xF2, 0x00, 0x8F, 0xF4, 0x00, 0x8F,
+  0xE0, 0x8F, 0xF0, 0x00, 0x8F, 0xF0, 0x00, 0x6F, 0xF0, 0x8F, 0xF0, 0x00, 0x8F, 0xF0, 0x00, 0x4F,
+  0xF0, 0x8F, 0xF0, 0x00, 0x8F, 0xF0, 0x00, 0x4F, 0xF0, 0x8F, 0xF0, 0x00, 0x8F, 0xF0, 0x00, 0x4F,
+  0xF0, 0x8F, 0xF0, 0x00, 0x8F, 0xF0, 0x00, 0x4F, 0xF0, 0x8F, 0xF0, 0x00, 0x8F, 0xF0, 0x00, 0x4F,
+  0xF0, 0x8F, 0xF0, 0x00, 0x8F, 0xF0, 0x00, 0x4F, 0xF0, 0x8F, 0xF0, 0x00, 0x8F, 0xF0, 0x00, 0x4F,
+  0xF0, 0x8F, 0xF0, 0x00, 0x8F, 0xF0, 0x00, 0x4F, 0xF0, 0x8F, 0xF0, 0x00, 0x8F, 0xF0, 0x00, 0x4F,
+  0xF0, 0x8F, 0xF0, 0x00, 0x8F, 0xF0, 0x00, 0x4F, 0xF0, 0x8F, 0xF0, 0x00, 0x8F, 0xF0, 0x00, 0x4F,
+  0xF0, 0x00, 0x00, 0x00, 0x14, 0x41, 0x00, 0x00, 0x3B, 0xB3, 0x19, 0xFF, 0xFF, 0x91, 0x00, 0x4F,
+  0xF5, 0xCF, 0xFF, 0xFF, 0xFB, 0x00, 0x4F, 0xFD, 0xE6, 0x10, 0x5D, 0xFF, 0x50, 0x4F, 0xFF, 0x40,
+  0x00, 0x04, 0xFF, 0x90, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0xDF, 0xB0, 0x4F, 0xF8, 0x00, 0x00, 0x00,
+  0xBF, 0xC0, 0x4F, 0xF7, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0,
+  0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x4F, 0xF4,
+  0x00, 0x00, 0x00, 0xBF, 0xF0, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x4F, 0xF4, 0x00, 0x00,
+  0x00, 0xBF, 0xF0, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF,
+  0xF0, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x03, 0x44, 0x10, 0x00, 0x00, 0x00,
+  0x18, 0xEF, 0xFF, 0xFB, 0x40, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x0B, 0xFF, 0xA2,
+  0x01, 0x6E, 0xFF, 0x30, 0x4F, 0xFB, 0x00, 0x00, 0x04, 0xFF, 0xA0, 0x9F, 0xF4, 0x00, 0x00, 0x00,
+  0xCF, 0xF1, 0xCF, 0xE0, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xF8,
+  0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0xFF, 0xB0,
+  0x00, 0x00, 0x00, 0x4F, 0xF8, 0xDF, 0xE0, 0x00, 0x00, 0x00, 0x8F, 0xF5, 0xAF, 0xF3, 0x00, 0x00,
+  0x00, 0xAF, 0xF2, 0x6F, 0xFA, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x0C, 0xFF, 0x80, 0x00, 0x4E, 0xFF,
+  0x50, 0x03, 0xEF, 0xFF, 0xBD, 0xFF, 0xF9, 0x00, 0x00, 0x2B, 0xFF, 0xFF, 0xFE, 0x70, 0x00, 0x00,
+  0x00, 0x24, 0x86, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x30, 0x00, 0x00, 0x3B, 0xB3, 0x4D,
+  0xFF, 0xFE, 0x80, 0x00, 0x4F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x4F, 0xFF, 0xE6, 0x00, 0x4C,
+  0xFF, 0x60, 0x4F, 0xFF, 0x50, 0x00, 0x01, 0xEF, 0xD0, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0x8F, 0xF3,
+  0x4F, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x4F, 0xF7, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x4F, 0xF4,
+  0x00, 0x00, 0x00, 0x0F, 0xFB, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x4F, 0xF6, 0x00, 0x00,
+  0x00, 0x1F, 0xF9, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0xF8, 0x4F, 0xFC, 0x00, 0x00, 0x00, 0x8F,
+  0xF5, 0x4F, 0xFF, 0x40, 0x00, 0x01, 0xDF, 0xE0, 0x4F, 0xFF, 0xE4, 0x00, 0x1A, 0xFF, 0x80, 0x4F,
+  0xF8, 0xFF, 0xDB, 0xFF, 0xFC, 0x00, 0x4F, 0xF4, 0x6E, 0xFF, 0xFF, 0x91, 0x00, 0x4F, 0xF4, 0x01,
+  0x48, 0x52, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x19,
+  0xFF, 0xFF, 0x91, 0x8B, 0xB0, 0x01, 0xCF, 0xFF, 0xFF, 0xFC, 0xBF, 0xF0, 0x0B, 0xFF, 0xA2, 0x02,
+  0xAF, 0xFF, 0xF0, 0x4F, 0xFB, 0x00, 0x00, 0x0A, 0xFF, 0xF0, 0x9F, 0xF3, 0x00, 0x00, 0x03, 0xFF,
+  0xF0, 0xCF, 0xE0, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xFF,
+  0xB0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0xFF, 0xB0, 0x00,
+  0x00, 0x00, 0xBF, 0xF0, 0xDF, 0xD0, 0x00, 0x00, 0x00, 0xDF, 0xF0, 0xAF, 0xF2, 0x00, 0x00, 0x02,
+  0xFF, 0xF0, 0x6F, 0xF8, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x0D, 0xFF, 0x60, 0x00, 0x6F, 0xFF, 0xF0,
+  0x03, 0xFF, 0xFD, 0xBD, 0xFE, 0xCF, 0xF0, 0x00, 0x3D, 0xFF, 0xFF, 0xD3, 0xBF, 0xF0, 0x00, 0x00,
+  0x48, 0x85, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+  0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x14, 0x41, 0x00, 0x8B, 0x80,
+  0x3B, 0xFF, 0xFF, 0xB2, 0xBF, 0xB3, 0xEF, 0xFF, 0xFF, 0xF4, 0xBF, 0xBD, 0xF9, 0x44, 0x47, 0xD4,
+  0xBF, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF2, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x24, 0x43, 0x00, 0x00, 0x01, 0x8E, 0xFF, 0xFF, 0xFB, 0x50, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0,
+  0x8F, 0xF9, 0x20, 0x00, 0x49, 0xB0, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xB0, 0x00, 0x00,
+  0x00, 0x00, 0xCF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFE, 0x96, 0x30, 0x00, 0x00, 0x09, 0xFF,
+  0xFF, 0xFF, 0xA4, 0x00, 0x00, 0x49, 0xDF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0x5B, 0xFF, 0xF3,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x10, 0x00, 0x00, 0x00,
+  0x4F, 0xF8, 0xE9, 0x40, 0x00, 0x03, 0xCF, 0xF2, 0xFF, 0xFF, 0xBB, 0xDF, 0xFF, 0x80, 0x8D, 0xFF,
+  0xFF, 0xFF, 0xD5, 0x00, 0x00, 0x24, 0x78, 0x53, 0x00, 0x00, 0x00, 0x00, 0x04, 0x43, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x3B, 0xBB, 0xBF,
+  0xFE, 0xBB, 0xBB, 0xB6, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x14, 0x44, 0x4F, 0xFC, 0x44,
+  0x44, 0x42, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFB, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xA4, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xEF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x18, 0xCF, 0xFF, 0xF8, 0x3B, 0xB3, 0x00,
+  0x00, 0x00, 0x8B, 0xB0, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x4F, 0xF4, 0x00, 0x00, 0x00,
+  0xBF, 0xF0, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0,
+  0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x4F, 0xF4,
+  0x00, 0x00, 0x00, 0xBF, 0xF0, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x4F, 0xF4, 0x00, 0x00,
+  0x00, 0xBF, 0xF0, 0x4F, 0xF7, 0x00, 0x00, 0x00, 0xCF, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x01, 0xFF,
+  0xF0, 0x0F, 0xFC, 0x00, 0x00, 0x08, 0xFF, 0xF0, 0x0A, 0xFF, 0x70, 0x00, 0x7F, 0xEF, 0xF0, 0x04,
+  0xFF, 0xFF, 0xBF, 0xFA, 0xBF, 0xF0, 0x00, 0x6E, 0xFF, 0xFF, 0x81, 0xBF, 0xF0, 0x00, 0x01, 0x48,
+  0x52, 0x00, 0x00, 0x00, 0x5B, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x9B, 0x90, 0x2F, 0xF9, 0x00, 0x00,
+  0x00, 0x02, 0xFF, 0x80, 0x0B, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x30, 0x06, 0xFF, 0x50, 0x00,
+  0x00, 0x0C, 0xFD, 0x00, 0x01, 0xFF, 0x90, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xAF, 0xE0, 0x00,
+  0x00, 0x8F, 0xF2, 0x00, 0x00, 0x5F, 0xF5, 0x00, 0x00, 0xDF, 0xC0, 0x00, 0x00, 0x0E, 0xF9, 0x00,
+  0x03, 0xFF, 0x70, 0x00, 0x00, 0x09, 0xFF, 0x10, 0x08, 0xFF, 0x10, 0x00, 0x00, 0x04, 0xFF, 0x60,
+  0x0D, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xA0, 0x4F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF1,
+  0x9F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF6, 0xEF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFE,
+  0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+  0xF9, 0x00, 0x00, 0x00, 0xAB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xB4, 0xAF, 0xD0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7F, 0xF2, 0x7F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xE0, 0x4F,
+  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xA0, 0x0F, 0xF8, 0x00, 0x02, 0x43, 0x00, 0x01, 0xFF,
+  0x70, 0x0B, 0xFB, 0x00, 0x09, 0xFF, 0x10, 0x04, 0xFF, 0x30, 0x08, 0xFE, 0x00, 0x0D, 0xFF, 0x50,
+  0x08, 0xFF, 0x00, 0x04, 0xFF, 0x30, 0x2F, 0xDF, 0x90, 0x0A, 0xFB, 0x00, 0x01, 0xFF, 0x60, 0x7F,
+  0x6E, 0xD0, 0x0E, 0xF8, 0x00, 0x00, 0xCF, 0x80, 0xAF, 0x19, 0xF2, 0x2F, 0xF4, 0x00, 0x00, 0x8F,
+  0xC0, 0xFC, 0x06, 0xF7, 0x6F, 0xF0, 0x00, 0x00, 0x5F, 0xF4, 0xF8, 0x01, 0xFA, 0x8F, 0xC0, 0x00,
+  0x00, 0x2F, 0xFC, 0xF3, 0x00, 0xBF, 0xBF, 0x80, 0x00, 0x00, 0x0D, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
+  0x50, 0x00, 0x00, 0x09, 0xFF, 0x90, 0x00, 0x3F, 0xFF, 0x20, 0x00, 0x00, 0x07, 0xFF, 0x60, 0x00,
+  0x0D, 0xFD, 0x00, 0x00, 0x1A, 0xB9, 0x00, 0x00, 0x00, 0x06, 0xBB, 0x60, 0x06, 0xFF, 0x80, 0x00,
+  0x00, 0x2E, 0xFC, 0x00, 0x00, 0x9F, 0xF4, 0x00, 0x00, 0xCF, 0xE2, 0x00, 0x00, 0x1C, 0xFE, 0x10,
+  0x08, 0xFF, 0x50, 0x00, 0x00, 0x03, 0xEF, 0xA0, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF8,
+  0xEF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF,
+  0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFD,
+  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE2, 0xAF, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x60,
+  0x1D, 0xFE, 0x10, 0x00, 0x00, 0x5F, 0xF9, 0x00, 0x03, 0xFF, 0xB0, 0x00, 0x02, 0xEF, 0xD1, 0x00,
+  0x00, 0x7F, 0xF8, 0x00, 0x0C, 0xFF, 0x30, 0x00, 0x00, 0x0B, 0xFF, 0x40, 0x8F, 0xF7, 0x00, 0x00,
+  0x00, 0x01, 0xEF, 0xE1, 0x4B, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xB2, 0x1E, 0xFB, 0x00, 0x00,
+  0x00, 0x00, 0xEF, 0xC0, 0x09, 0xFF, 0x20, 0x00, 0x00, 0x05, 0xFF, 0x60, 0x03, 0xFF, 0x80, 0x00,
+  0x00, 0x0A, 0xFF, 0x10, 0x00, 0xCF, 0xD0, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0x6F, 0xF4, 0x00,
+  0x00, 0x7F, 0xF4, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x00, 0xCF, 0xD0, 0x00, 0x00, 0x09, 0xFF, 0x10,
+  0x03, 0xFF, 0x70, 0x00, 0x00, 0x04, 0xFF, 0x60, 0x08, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xDF, 0xC0,
+  0x0E, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF2, 0x5F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8,
+  0xAF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF,
+  0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F,
+  0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x02, 0x44, 0x8F, 0xFB,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFA, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xB0, 0x03, 0x44, 0x44, 0x44, 0x48, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFC, 0x10,
+  0x00, 0x00, 0x00, 0x01, 0xCF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFC,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x50, 0x00, 0x00,
+  0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x2E,
+  0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x4F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x7B, 0xFF, 0xF4, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4,
+  0x00, 0x00, 0x3F, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x6F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF2, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xB0, 0x00, 0x00, 0x8B, 0xCF, 0xFD, 0x30,
+  0x00, 0x00, 0xBF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x35, 0x8D, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x01,
+  0xEF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00,
+  0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x00, 0x00, 0x00,
+  0x5F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x85, 0x41, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF4,
+  0x00, 0x00, 0x00, 0x27, 0x9B, 0xB3, 0x24, 0x40, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0,
+  0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0,
+  0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0,
+  0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0, 0x8F, 0xF0,
+  0x6B, 0xB0, 0xBF, 0xFD, 0x92, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x18,
+  0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE0, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0,
+  0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0x8F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xEB, 0xB3,
+  0x00, 0x00, 0x01, 0x8F, 0xFF, 0xF4, 0x00, 0x00, 0x1C, 0xFF, 0x97, 0x41, 0x00, 0x00, 0x6F, 0xF7,
+  0x00, 0x00, 0x00, 0x00, 0x8F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+  0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xB0,
+  0x00, 0x00, 0x34, 0x7B, 0xFF, 0x70, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x8B, 0xB8,
+  0x50, 0x00, 0x00, 0x00, 0x04, 0xAF, 0xFF, 0xB6, 0x10, 0x00, 0x00, 0x84, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xE9, 0x64, 0x8D, 0xF4, 0xBF, 0x96, 0x47, 0x9F, 0xFF, 0xFF, 0xFF, 0xD2, 0x82, 0x00, 0x00, 0x01,
+  0x7C, 0xFF, 0xD8, 0x10,
+};
+
+const AtlasGlyph Atlas_Table_Glyphs[95] PROGMEM = {
+  {     0,  0,  0,   0,   0, 17 },  // ' '
+  {     0,  4, 22,   7, -22, 17 },  // '!'
+  {    44,  9,  9,   4, -22, 17 },  // '"'
+  {    89, 18, 21,   0, -21, 17 },  // '#'
+  {   278, 14, 27,   2, -22, 17 },  // '$'
+  {   467, 17, 21,   0, -21, 17 },  // '%'
+  {   656, 18, 23,   0, -22, 17 },  // '&'
+  {   863,  3,  9,   7, -22, 17 },  // '''
+  {   881,  7, 26,   6, -22, 17 },  // '('
+  {   985,  7, 26,   5, -22, 17 },  // ')'
+  {  1089, 13, 14,   2, -22, 17 },  // '*'
+  {  1187, 16, 16,   1, -17, 17 },  // '+'
+  {  1315,  6,  9,   5,  -5, 17 },  // ','
+  {  1342,  8,  3,   5,  -9, 17 },  // '-'
+  {  1354,  4,  5,   7,  -5, 17 },  // '.'
+  {  1364, 15, 25,   1, -22, 17 },  // '/'
+  {  1564, 14, 23,   2, -22, 17 },  // '0'
+  {  1725, 13, 22,   3, -22, 17 },  // '1'
+  {  1879, 13, 22,   2, -22, 17 },  // '2'
+  {  2033, 14, 23,   2, -22, 17 },  // '3'
+  {  2194, 15, 22,   1, -22, 17 },  // '4'
+  {  2370, 14, 23,   2, -22, 17 },  // '5'
+  {  2531, 14, 23,   2, -22, 17 },  // '6'
+  {  2692, 14, 22,   2, -22, 17 },  // '7'
+  {  2846, 15, 23,   1, -22, 17 },  // '8'
+  {  3030, 15, 23,   1, -22, 17 },  // '9'
+  {  3214,  4, 15,   7, -15, 17 },  // ':'
+  {  3244,  6, 19,   5, -15, 17 },  // ';'
+  {  3301, 16, 15,   1, -17, 17 },  // '<'
+  {  3421, 16,  9,   1, -14, 17 },  // '='
+  {  3493, 16, 15,   1, -17, 17 },  // '>'
+  {  3613, 12, 22,   3, -22, 17 },  // '?'
+  {  3745, 17, 25,   0, -20, 17 },  // '@'
+  {  3970, 17, 22,   0, -22, 17 },  // 'A'
+  {  4168, 14, 22,   2, -22, 17 },  // 'B'
+  {  4322, 14, 23,   2, -22, 17 },  // 'C'
+  {  4483, 14, 22,   2, -22, 17 },  // 'D'
+  {  4637, 14, 22,   2, -22, 17 },  // 'E'
+  {  4791, 13, 22,   3, -22, 17 },  // 'F'
+  {  4945, 15, 23,   1, -22, 17 },  // 'G'
+  {  5129, 14, 22,   2, -22, 17 },  // 'H'
+  {  5283, 13, 22,   2, -22, 17 },  // 'I'
+  {  5437, 13, 23,   1, -22, 17 },  // 'J'
+  {  5598, 16, 22,   2, -22, 17 },  // 'K'
+  {  5774, 14, 22,   3, -22, 17 },  // 'L'
+  {  5928, 16, 22,   1, -22, 17 },  // 'M'
+  {  6104, 14, 22,   2, -22, 17 },  // 'N'
+  {  6258, 15, 23,   1, -22, 17 },  // 'O'
+  {  6442, 15, 22,   2, -22, 17 },  // 'P'
+  {  6618, 15, 26,   1, -22, 17 },  // 'Q'
+  {  6826, 16, 22,   2, -22, 17 },  // 'R'
+  {  7002, 14, 23,   2, -22, 17 },  // 'S'
+  {  7163, 17, 22,   0, -22, 17 },  // 'T'
+  {  7361, 14, 23,   2, -22, 17 },  // 'U'
+  {  7522, 17, 22,   0, -22, 17 },  // 'V'
+  {  7720, 18, 22,   0, -22, 17 },  // 'W'
+  {  7918, 17, 22,   0, -22, 17 },  // 'X'
+  {  8116, 17, 22,   0, -22, 17 },  // 'Y'
+  {  8314, 15, 22,   2, -22, 17 },  // 'Z'
+  {  8490,  7, 26,   6, -22, 17 },  // '['
+  {  8594, 15, 25,   1, -22, 17 },  // '\\'
+  {  8794,  6, 26,   5, -22, 17 },  // ']'
+  {  8872, 16,  9,   1, -22, 17 },  // '^'
+  {  8944, 18,  2,   0,   5, 17 },  // '_'
+  {  8962,  7,  7,   4, -24, 17 },  // '`'
+  {  8990, 13, 18,   2, -17, 17 },  // 'a'
+  {  9116, 14, 23,   2, -22, 17 },  // 'b'
+  {  9277, 13, 18,   2, -17, 17 },  // 'c'
+  {  9403, 14, 23,   1, -22, 17 },  // 'd'
+  {  9564, 15, 18,   1, -17, 17 },  // 'e'
+  {  9708, 13, 22,   2, -22, 17 },  // 'f'
+  {  9862, 14, 24,   1, -17, 17 },  // 'g'
+  { 10030, 13, 22,   2, -22, 17 },  // 'h'
+  { 10184, 14, 22,   2, -22, 17 },  // 'i'
+  { 10338,  9, 28,   2, -22, 17 },  // 'j'
+  { 10478, 14, 22,   3, -22, 17 },  // 'k'
+  { 10632, 13, 23,   2, -23, 17 },  // 'l'
+  { 10793, 15, 17,   1, -17, 17 },  // 'm'
+  { 10929, 13, 17,   2, -17, 17 },  // 'n'
+  { 11048, 14, 18,   2, -17, 17 },  // 'o'
+  { 11174, 14, 23,   2, -17, 17 },  // 'p'
+  { 11335, 13, 23,   2, -17, 17 },  // 'q'
+  { 11496, 12, 17,   5, -17, 17 },  // 'r'
+  { 11598, 12, 18,   3, -17, 17 },  // 's'
+  { 11706, 14, 21,   1, -21, 17 },  // 't'
+  { 11853, 13, 17,   2, -16, 17 },  // 'u'
+  { 11972, 15, 16,   1, -16, 17 },  // 'v'
+  { 12100, 18, 16,   0, -16, 17 },  // 'w'
+  { 12244, 16, 16,   1, -16, 17 },  // 'x'
+  { 12372, 16, 22,   1, -16, 17 },  // 'y'
+  { 12548, 13, 16,   2, -16, 17 },  // 'z'
+  { 12660, 12, 27,   3, -22, 17 },  // '{'
+  { 12822,  3, 30,   7, -23, 17 },  // '|'
+  { 12882, 12, 27,   3, -22, 17 },  // '}'
+  { 13044, 16,  4,   1, -11, 17 },  // '~'
+};
+
+const AtlasFont Atlas_Table PROGMEM = {Atlas_Table_Bitmap, Atlas_Table_Glyphs, 0x20, 0x7E, 34, 22, 7};
+
+// Atlas_Second, 19px em from DejaVuSansMono.ttf, replaces FMO12 at text size 1
+const uint8_t Atlas_Second_Bitmap[5930] PROGMEM = {
+  0x3B, 0x80, 0x4F, 0xB0, 0x4F, 0xB0, 0x4F, 0xB0, 0x4F, 0xB0, 0x4F, 0xB0, 0x4F, 0xB0, 0x3F, 0x80,
+  0x0F, 0x80, 0x08, 0x40, 0x00, 0x00, 0x14, 0x30, 0x4F, 0xB0, 0x4F, 0xB0, 0x88, 0x03, 0xB3, 0xBB,
+  0x04, 0xF4, 0xBB, 0x04, 0xF4, 0xBB, 0x04, 0xF4, 0xBB, 0x04, 0xF4, 0x33, 0x01, 0x41, 0x00, 0x00,
+  0x3B, 0x30, 0x6B, 0x00, 0x00, 0x00, 0x7F, 0x10, 0xAC, 0x00, 0x00, 0x00, 0xAC, 0x00, 0xE8, 0x00,
+  0x00, 0x00, 0xE8, 0x03, 0xF5, 0x00, 0x0B, 0xBB, 0xFD, 0xBC, 0xFC, 0xB6, 0x0B, 0xBD, 0xFB, 0xBE,
+  0xEB, 0xB6, 0x00, 0x0A, 0xC0, 0x0D, 0x80, 0x00, 0x00, 0x0E, 0x80, 0x2F, 0x50, 0x00, 0x44, 0x6F,
+  0x84, 0x8F, 0x54, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x44, 0xCC, 0x44, 0xF9, 0x44, 0x10,
+  0x00, 0xE8, 0x03, 0xF5, 0x00, 0x00, 0x03, 0xF5, 0x07, 0xF1, 0x00, 0x00, 0x07, 0xF1, 0x0A, 0xC0,
+  0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x02, 0x99, 0x20,
+  0x00, 0x02, 0xBF, 0xFF, 0xFE, 0x60, 0x0C, 0xE4, 0x88, 0x38, 0x70, 0x3F, 0x80, 0x88, 0x00, 0x00,
+  0x4F, 0x80, 0x88, 0x00, 0x00, 0x0D, 0xE7, 0x98, 0x00, 0x00, 0x03, 0xCF, 0xFF, 0xA5, 0x00, 0x00,
+  0x03, 0xAD, 0xDF, 0x90, 0x00, 0x00, 0x88, 0x0B, 0xF3, 0x00, 0x00, 0x88, 0x08, 0xF4, 0x22, 0x00,
+  0x88, 0x09, 0xF3, 0x4F, 0xA7, 0x9A, 0x9F, 0x90, 0x17, 0xAE, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x88,
+  0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x34, 0x10, 0x00,
+  0x00, 0x00, 0x0A, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x7E, 0x30, 0x9E, 0x00, 0x00, 0x00, 0xB8, 0x00,
+  0x0F, 0x40, 0x00, 0x00, 0x8B, 0x00, 0x4F, 0x20, 0x00, 0x00, 0x2E, 0xC9, 0xE8, 0x00, 0x5A, 0xA0,
+  0x02, 0x89, 0x62, 0x8D, 0xB6, 0x00, 0x00, 0x05, 0xAE, 0x82, 0x00, 0x00, 0x18, 0xDB, 0x60, 0x7D,
+  0xE8, 0x10, 0x08, 0x20, 0x05, 0xF8, 0x6D, 0xA0, 0x00, 0x00, 0x0B, 0x80, 0x05, 0xF1, 0x00, 0x00,
+  0x0B, 0x80, 0x04, 0xF1, 0x00, 0x00, 0x06, 0xE6, 0x5C, 0xB0, 0x00, 0x00, 0x00, 0x8E, 0xFA, 0x10,
+  0x00, 0x08, 0xEF, 0xFD, 0x00, 0x00, 0x00, 0x8F, 0xA5, 0x6B, 0x00, 0x00, 0x00, 0xBD, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x2F,
+  0xE1, 0x00, 0x00, 0x00, 0x03, 0xEC, 0xFB, 0x00, 0x00, 0x00, 0x0C, 0xD1, 0x7F, 0x80, 0x04, 0xF3,
+  0x4F, 0x60, 0x0A, 0xF4, 0x06, 0xF0, 0x8F, 0x40, 0x01, 0xDE, 0x18, 0xD0, 0x7F, 0x50, 0x00, 0x4F,
+  0xBD, 0x90, 0x3F, 0xB0, 0x00, 0x08, 0xFE, 0x10, 0x09, 0xFB, 0x54, 0x6C, 0xFF, 0x30, 0x00, 0x8E,
+  0xFF, 0xFB, 0x3E, 0xD1, 0x00, 0x00, 0x44, 0x20, 0x00, 0x00, 0xB6, 0xF8, 0xF8, 0xF8, 0xF8, 0x42,
+  0x00, 0x38, 0x10, 0x00, 0xCB, 0x00, 0x06, 0xF4, 0x00, 0x0D, 0xC0, 0x00, 0x3F, 0x70, 0x00, 0x8F,
+  0x30, 0x00, 0xBF, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xFB, 0x00, 0x00, 0xFC, 0x00,
+  0x00, 0xBF, 0x00, 0x00, 0x8F, 0x30, 0x00, 0x4F, 0x70, 0x00, 0x0D, 0xC0, 0x00, 0x06, 0xF3, 0x00,
+  0x00, 0xD9, 0x00, 0x00, 0x38, 0x10, 0x57, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x0B, 0xB0, 0x00, 0x06,
+  0xF4, 0x00, 0x01, 0xFA, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x7F, 0x70, 0x00, 0x4F,
+  0x80, 0x00, 0x4F, 0x80, 0x00, 0x7F, 0x70, 0x00, 0x8F, 0x40, 0x00, 0xBF, 0x00, 0x01, 0xFA, 0x00,
+  0x06, 0xF5, 0x00, 0x0B, 0xD0, 0x00, 0x4F, 0x50, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00,
+  0x00, 0x14, 0x00, 0xB4, 0x01, 0x30, 0x3E, 0x91, 0xB4, 0x6E, 0x80, 0x01, 0x8D, 0xED, 0xB3, 0x00,
+  0x00, 0x19, 0xFD, 0x40, 0x00, 0x18, 0xD8, 0xB8, 0xCB, 0x30, 0x3A, 0x20, 0xB4, 0x07, 0x80, 0x00,
+  0x00, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00,
+  0x00, 0x3B, 0xBB, 0xBF, 0xDB, 0xBB, 0x60, 0x3B, 0xBB, 0xBF, 0xDB, 0xBB, 0x60, 0x00, 0x00, 0x0F,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xBB, 0x04, 0xFF, 0x07, 0xFB, 0x0A, 0xF4, 0x0E, 0xB0, 0x2B,
+  0x40, 0xBF, 0xFF, 0xF4, 0x68, 0x88, 0x82, 0x6B, 0x80, 0x8F, 0xB0, 0x8F, 0xB0, 0x00, 0x00, 0x00,
+  0x0A, 0x90, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0x06, 0xF7,
+  0x00, 0x00, 0x00, 0x0B, 0xE1, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0xBE, 0x10, 0x00,
+  0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00,
+  0x9F, 0x20, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x1E, 0xB0,
+  0x00, 0x00, 0x00, 0x8F, 0x50, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF,
+  0xB2, 0x00, 0x08, 0xFC, 0x88, 0xFC, 0x10, 0x1E, 0xD1, 0x00, 0x8F, 0x70, 0x6F, 0x80, 0x00, 0x1F,
+  0xC0, 0x8F, 0x40, 0x00, 0x0C, 0xF0, 0xBF, 0x40, 0x31, 0x0B, 0xF3, 0xBF, 0x25, 0xFC, 0x0B, 0xF4,
+  0xBF, 0x17, 0xFD, 0x0B, 0xF4, 0xBF, 0x40, 0x41, 0x0B, 0xF3, 0x8F, 0x40, 0x00, 0x0C, 0xF0, 0x7F,
+  0x70, 0x00, 0x1F, 0xD0, 0x2F, 0xD0, 0x00, 0x6F, 0x80, 0x08, 0xFA, 0x46, 0xEE, 0x10, 0x00, 0x8F,
+  0xFF, 0xD3, 0x00, 0x00, 0x02, 0x43, 0x00, 0x00, 0x37, 0xAB, 0xB3, 0x00, 0x00, 0xBF, 0xFE, 0xF4,
+  0x00, 0x00, 0x64, 0x18, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xF4, 0x00,
+  0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00,
+  0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00,
+  0x08, 0xF4, 0x00, 0x00, 0x48, 0x8B, 0xF9, 0x88, 0x20, 0x8F, 0xFF, 0xFF, 0xFF, 0x40, 0x29, 0xDF,
+  0xFF, 0x91, 0x00, 0x8F, 0xC8, 0x8B, 0xFE, 0x10, 0x52, 0x00, 0x00, 0xAF, 0x80, 0x00, 0x00, 0x00,
+  0x4F, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x03, 0xFC,
+  0x00, 0x00, 0x00, 0x1E, 0xE2, 0x00, 0x00, 0x01, 0xCE, 0x30, 0x00, 0x00, 0x1C, 0xE3, 0x00, 0x00,
+  0x01, 0xCF, 0x60, 0x00, 0x00, 0x09, 0xF6, 0x00, 0x00, 0x00, 0x7F, 0xC8, 0x88, 0x88, 0x60, 0x8F,
+  0xFF, 0xFF, 0xFF, 0xB0, 0x2A, 0xEF, 0xFF, 0x92, 0x00, 0x4E, 0xA8, 0x8A, 0xFE, 0x10, 0x10, 0x00,
+  0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x5F, 0x80, 0x00, 0x14, 0x46,
+  0xEE, 0x20, 0x00, 0x4F, 0xFF, 0xB1, 0x00, 0x00, 0x14, 0x79, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x5F,
+  0x90, 0x00, 0x00, 0x00, 0x0D, 0xF0, 0x00, 0x00, 0x00, 0x0D, 0xF0, 0x10, 0x00, 0x00, 0x4F, 0xC0,
+  0xBB, 0x84, 0x58, 0xEF, 0x50, 0x8E, 0xFF, 0xFF, 0xD5, 0x00, 0x00, 0x24, 0x43, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0xB8, 0x00, 0x00, 0x00, 0x5F, 0xFB, 0x00, 0x00, 0x01, 0xEA, 0xFB, 0x00, 0x00, 0x08,
+  0xC4, 0xFB, 0x00, 0x00, 0x4F, 0x44, 0xFB, 0x00, 0x00, 0xD9, 0x04, 0xFB, 0x00, 0x08, 0xE1, 0x04,
+  0xFB, 0x00, 0x3F, 0x70, 0x04, 0xFB, 0x00, 0xBD, 0x00, 0x04, 0xFB, 0x00, 0xFD, 0xBB, 0xBC, 0xFE,
+  0xB6, 0xBB, 0xBB, 0xBC, 0xFE, 0xB6, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00,
+  0x00, 0x00, 0x04, 0xFB, 0x00, 0x0B, 0xBB, 0xBB, 0xBB, 0x00, 0x0F, 0xEB, 0xBB, 0xBB, 0x00, 0x0F,
+  0xB0, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xB1, 0x30, 0x00, 0x00, 0x0F, 0xFF,
+  0xFF, 0xA2, 0x00, 0x0D, 0x88, 0x8C, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x9F, 0x80, 0x00, 0x00, 0x00,
+  0x2F, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x10, 0x00, 0x00, 0x8F,
+  0x90, 0xBA, 0x74, 0x69, 0xFE, 0x20, 0x8F, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x44, 0x42, 0x00, 0x00,
+  0x00, 0x3B, 0xFF, 0xFC, 0x20, 0x03, 0xEF, 0x98, 0x8D, 0x40, 0x0D, 0xE3, 0x00, 0x00, 0x10, 0x5F,
+  0x80, 0x00, 0x00, 0x00, 0x8F, 0x30, 0x22, 0x00, 0x00, 0xBF, 0x3C, 0xFF, 0xE7, 0x00, 0xBF, 0xDA,
+  0x56, 0xCF, 0x70, 0xBF, 0xB0, 0x00, 0x1F, 0xD0, 0xBF, 0x60, 0x00, 0x0B, 0xF2, 0x9F, 0x40, 0x00,
+  0x0B, 0xF4, 0x7F, 0x60, 0x00, 0x0B, 0xF3, 0x2F, 0xB0, 0x00, 0x1E, 0xE0, 0x0A, 0xFA, 0x45, 0xCF,
+  0x80, 0x01, 0x9F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x44, 0x10, 0x00, 0x8B, 0xBB, 0xBB, 0xBB, 0xB0,
+  0x8B, 0xBB, 0xBB, 0xCF, 0xC0, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0xCF, 0x10, 0x00,
+  0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x0E, 0xD0, 0x00, 0x00, 0x00,
+  0x6F, 0x80, 0x00, 0x00, 0x00, 0xBF, 0x20, 0x00, 0x00, 0x02, 0xFB, 0x00, 0x00, 0x00, 0x08, 0xF6,
+  0x00, 0x00, 0x00, 0x0D, 0xE1, 0x00, 0x00, 0x00, 0x5F, 0x90, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x00,
+  0x00, 0x01, 0x9F, 0xFF, 0xD5, 0x00, 0x0C, 0xF9, 0x57, 0xEF, 0x50, 0x5F, 0x90, 0x00, 0x4F, 0xB0,
+  0x8F, 0x80, 0x00, 0x0F, 0xF0, 0x5F, 0x80, 0x00, 0x1F, 0xA0, 0x0C, 0xE5, 0x02, 0xAE, 0x30, 0x00,
+  0x9F, 0xFF, 0xD2, 0x00, 0x09, 0xF9, 0x88, 0xED, 0x30, 0x6F, 0x80, 0x00, 0x2E, 0xD0, 0xBF, 0x30,
+  0x00, 0x0B, 0xF3, 0xBF, 0x20, 0x00, 0x0B, 0xF4, 0x9F, 0x60, 0x00, 0x1E, 0xF1, 0x3F, 0xE7, 0x45,
+  0xBF, 0x80, 0x05, 0xDF, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0x44, 0x10, 0x00, 0x02, 0xAF, 0xFF, 0xA2,
+  0x00, 0x1E, 0xF8, 0x68, 0xFD, 0x10, 0x7F, 0x80, 0x00, 0x7F, 0x70, 0xBF, 0x20, 0x00, 0x0F, 0xB0,
+  0xBF, 0x00, 0x00, 0x0F, 0xF0, 0xBF, 0x10, 0x00, 0x0F, 0xF0, 0x8F, 0x60, 0x00, 0x5F, 0xF4, 0x2F,
+  0xE6, 0x45, 0xED, 0xF4, 0x05, 0xEF, 0xFF, 0x89, 0xF0, 0x00, 0x04, 0x42, 0x0B, 0xF0, 0x00, 0x00,
+  0x00, 0x1F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x09, 0x84, 0x6B, 0xFB, 0x00, 0x0A, 0xFF, 0xFF,
+  0x81, 0x00, 0x00, 0x24, 0x41, 0x00, 0x00, 0x6B, 0x80, 0x8F, 0xB0, 0x8F, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x80, 0x8F, 0xB0, 0x8F, 0xB0, 0x06, 0xB8, 0x08, 0xFB, 0x08,
+  0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBB, 0x04, 0xFF, 0x07, 0xFB, 0x0A,
+  0xF4, 0x0E, 0xB0, 0x2B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x06, 0xBF,
+  0x80, 0x00, 0x00, 0x39, 0xEF, 0xD8, 0x20, 0x01, 0x6C, 0xFE, 0x94, 0x00, 0x00, 0x3E, 0xFB, 0x61,
+  0x00, 0x00, 0x00, 0x3F, 0xF9, 0x50, 0x00, 0x00, 0x00, 0x02, 0x8D, 0xFD, 0x82, 0x00, 0x00, 0x00,
+  0x00, 0x49, 0xFF, 0xC7, 0x10, 0x00, 0x00, 0x00, 0x17, 0xDF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x40, 0x3B, 0xBB, 0xBB, 0xBB, 0xBB, 0x60, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xBB, 0xBB, 0xBB, 0xBB, 0x60, 0x3B,
+  0xBB, 0xBB, 0xBB, 0xBB, 0x60, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xE8, 0x20, 0x00, 0x00,
+  0x00, 0x06, 0xAF, 0xFB, 0x60, 0x00, 0x00, 0x00, 0x02, 0x7D, 0xFE, 0x82, 0x00, 0x00, 0x00, 0x00,
+  0x39, 0xEF, 0x70, 0x00, 0x00, 0x00, 0x28, 0xDF, 0x80, 0x00, 0x01, 0x6B, 0xFF, 0x94, 0x00, 0x04,
+  0x9E, 0xFD, 0x71, 0x00, 0x00, 0x4F, 0xF9, 0x40, 0x00, 0x00, 0x00, 0x36, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x39, 0xEF, 0xFD, 0x50, 0xBE, 0x88, 0x8F, 0xF4, 0x51, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x04,
+  0xF9, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x3F, 0xA0,
+  0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x24, 0x10, 0x00, 0x00, 0x24, 0x20,
+  0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x02, 0x9C, 0xFD, 0x91, 0x00, 0x00,
+  0x6E, 0xD8, 0x88, 0xEC, 0x10, 0x04, 0xF9, 0x00, 0x00, 0x1E, 0x80, 0x0D, 0xB0, 0x00, 0x00, 0x08,
+  0xC0, 0x3F, 0x40, 0x08, 0xEF, 0xBA, 0xF0, 0x8E, 0x00, 0x8F, 0x84, 0x9F, 0xF0, 0xAB, 0x00, 0xE8,
+  0x00, 0x0A, 0xF0, 0xBB, 0x03, 0xF4, 0x00, 0x07, 0xF0, 0xBB, 0x03, 0xF4, 0x00, 0x08, 0xF0, 0xAB,
+  0x00, 0xE9, 0x00, 0x0B, 0xF0, 0x7E, 0x00, 0x7F, 0x98, 0xAF, 0xF0, 0x2F, 0x60, 0x07, 0xCF, 0xA7,
+  0xB0, 0x0B, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xE9,
+  0x86, 0x85, 0x00, 0x00, 0x01, 0x6B, 0xEF, 0xD7, 0x00, 0x00, 0x00, 0x7B, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0xCF, 0xF5, 0x00, 0x00, 0x00, 0x02, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xF4, 0xCD, 0x00,
+  0x00, 0x00, 0x0B, 0xE0, 0x8F, 0x30, 0x00, 0x00, 0x1F, 0xA0, 0x4F, 0x80, 0x00, 0x00, 0x6F, 0x60,
+  0x0E, 0xC0, 0x00, 0x00, 0xAF, 0x20, 0x0A, 0xF2, 0x00, 0x00, 0xED, 0x00, 0x07, 0xF6, 0x00, 0x05,
+  0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x08, 0xF9, 0x88, 0x88, 0xDF, 0x10, 0x0D, 0xE0, 0x00, 0x00, 0x8F,
+  0x50, 0x3F, 0xA0, 0x00, 0x00, 0x4F, 0x90, 0x8F, 0x70, 0x00, 0x00, 0x0F, 0xE0, 0x6B, 0xBB, 0xBB,
+  0x94, 0x00, 0x8F, 0xDB, 0xBB, 0xFF, 0x50, 0x8F, 0x80, 0x00, 0x3F, 0xD0, 0x8F, 0x80, 0x00, 0x0C,
+  0xF0, 0x8F, 0x80, 0x00, 0x0E, 0xF0, 0x8F, 0x94, 0x44, 0xAF, 0x80, 0x8F, 0xFF, 0xFF, 0xE8, 0x00,
+  0x8F, 0xB8, 0x88, 0xBF, 0x80, 0x8F, 0x80, 0x00, 0x0A, 0xF3, 0x8F, 0x80, 0x00, 0x06, 0xF8, 0x8F,
+  0x80, 0x00, 0x06, 0xF8, 0x8F, 0x80, 0x00, 0x0A, 0xF6, 0x8F, 0xB8, 0x88, 0xDF, 0xC0, 0x8F, 0xFF,
+  0xFF, 0xC8, 0x10, 0x00, 0x19, 0xEF, 0xFD, 0x80, 0x01, 0xCF, 0xB8, 0x8B, 0xF0, 0x0A, 0xF7, 0x00,
+  0x00, 0x40, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x00, 0x00,
+  0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x00, 0x00,
+  0x8F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, 0x20, 0x03,
+  0xEF, 0x84, 0x48, 0xE0, 0x00, 0x3B, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x24, 0x41, 0x00, 0x8B, 0xBB,
+  0xB8, 0x20, 0x00, 0xBF, 0xCB, 0xCF, 0xF6, 0x00, 0xBF, 0x40, 0x03, 0xDF, 0x40, 0xBF, 0x40, 0x00,
+  0x4F, 0xA0, 0xBF, 0x40, 0x00, 0x0F, 0xF0, 0xBF, 0x40, 0x00, 0x0B, 0xF3, 0xBF, 0x40, 0x00, 0x0B,
+  0xF4, 0xBF, 0x40, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0x0E, 0xF0,
+  0xBF, 0x40, 0x00, 0x4F, 0xC0, 0xBF, 0x40, 0x01, 0xCF, 0x50, 0xBF, 0x98, 0xAE, 0xF9, 0x00, 0xBF,
+  0xFF, 0xEA, 0x40, 0x00, 0x3B, 0xBB, 0xBB, 0xBB, 0xB0, 0x4F, 0xEB, 0xBB, 0xBB, 0xB0, 0x4F, 0xB0,
+  0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xC4, 0x44,
+  0x44, 0x30, 0x4F, 0xFF, 0xFF, 0xFF, 0xB0, 0x4F, 0xD8, 0x88, 0x88, 0x60, 0x4F, 0xB0, 0x00, 0x00,
+  0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00,
+  0x4F, 0xD8, 0x88, 0x88, 0x82, 0x4F, 0xFF, 0xFF, 0xFF, 0xF4, 0x8B, 0xBB, 0xBB, 0xBB, 0x30, 0xBF,
+  0xBB, 0xBB, 0xBB, 0x30, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00,
+  0x00, 0x00, 0x00, 0xBF, 0x44, 0x44, 0x43, 0x00, 0xBF, 0xFF, 0xFF, 0xFB, 0x00, 0xBF, 0x88, 0x88,
+  0x86, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00,
+  0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4A, 0xFF, 0xFB, 0x40, 0x05, 0xFE, 0x88, 0x8D, 0xB0, 0x1E, 0xE3, 0x00, 0x00, 0x60, 0x7F,
+  0x80, 0x00, 0x00, 0x00, 0xBF, 0x30, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x08, 0xFF, 0xF4, 0xFF, 0x00, 0x04, 0x8B, 0xF4, 0xCF, 0x20, 0x00,
+  0x08, 0xF4, 0x8F, 0x60, 0x00, 0x08, 0xF4, 0x2F, 0xD1, 0x00, 0x08, 0xF4, 0x08, 0xFC, 0x64, 0x6C,
+  0xF4, 0x00, 0x6E, 0xFF, 0xFE, 0x70, 0x00, 0x00, 0x34, 0x30, 0x00, 0x8B, 0x30, 0x00, 0x08, 0xB3,
+  0xBF, 0x40, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0x0B, 0xF4, 0xBF,
+  0x40, 0x00, 0x0B, 0xF4, 0xBF, 0x74, 0x44, 0x4C, 0xF4, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0xBF, 0x98,
+  0x88, 0x8D, 0xF4, 0xBF, 0x40, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00,
+  0x0B, 0xF4, 0xBF, 0x40, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0x0B,
+  0xF4, 0x3B, 0xBB, 0xBB, 0xBB, 0x60, 0x3B, 0xBC, 0xFE, 0xBB, 0x60, 0x00, 0x04, 0xFB, 0x00, 0x00,
+  0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00,
+  0x04, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x04,
+  0xFB, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x28, 0x89, 0xFD,
+  0x88, 0x40, 0x4F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x6B, 0xBB, 0xB8, 0x00, 0x6B, 0xBB, 0xFB, 0x00,
+  0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0xFB, 0x00,
+  0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0xFB, 0x00,
+  0x00, 0x00, 0xFB, 0x60, 0x00, 0x05, 0xFA, 0xFB, 0x64, 0x6C, 0xF6, 0x9E, 0xFF, 0xFF, 0x80, 0x00,
+  0x34, 0x40, 0x00, 0x8B, 0x30, 0x00, 0x06, 0xB8, 0x00, 0xBF, 0x40, 0x00, 0x6F, 0xC1, 0x00, 0xBF,
+  0x40, 0x03, 0xEC, 0x10, 0x00, 0xBF, 0x40, 0x3E, 0xE2, 0x00, 0x00, 0xBF, 0x43, 0xEE, 0x30, 0x00,
+  0x00, 0xBF, 0x7E, 0xE3, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xBF, 0xE6, 0xFE,
+  0x10, 0x00, 0x00, 0xBF, 0x50, 0x8F, 0xA0, 0x00, 0x00, 0xBF, 0x40, 0x0C, 0xF5, 0x00, 0x00, 0xBF,
+  0x40, 0x03, 0xFE, 0x10, 0x00, 0xBF, 0x40, 0x00, 0x8F, 0xA0, 0x00, 0xBF, 0x40, 0x00, 0x0D, 0xF5,
+  0x00, 0xBF, 0x40, 0x00, 0x04, 0xFE, 0x10, 0xBB, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0x88, 0x88, 0x88, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3B, 0xB6, 0x00,
+  0x01, 0xBB, 0x60, 0x4F, 0xFC, 0x00, 0x06, 0xEF, 0x80, 0x4F, 0xAF, 0x20, 0x0A, 0x9F, 0x80, 0x4F,
+  0x8D, 0x70, 0x1F, 0x5F, 0x80, 0x4F, 0x88, 0xC0, 0x6E, 0x0F, 0x80, 0x4F, 0x83, 0xF2, 0xA9, 0x0F,
+  0x80, 0x4F, 0x80, 0xD8, 0xF5, 0x0F, 0x80, 0x4F, 0x80, 0x8F, 0xE0, 0x0F, 0x80, 0x4F, 0x80, 0x3F,
+  0x90, 0x0F, 0x80, 0x4F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x4F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x4F,
+  0x80, 0x00, 0x00, 0x0F, 0x80, 0x4F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x4F, 0x80, 0x00, 0x00, 0x0F,
+  0x80, 0x8B, 0x90, 0x00, 0x08, 0xB3, 0xBF, 0xF3, 0x00, 0x0B, 0xF4, 0xBF, 0xE9, 0x00, 0x0B, 0xF4,
+  0xBF, 0x8F, 0x10, 0x0B, 0xF4, 0xBF, 0x2F, 0x70, 0x0B, 0xF4, 0xBF, 0x0A, 0xD0, 0x0B, 0xF4, 0xBF,
+  0x05, 0xF4, 0x0B, 0xF4, 0xBF, 0x00, 0xDA, 0x0B, 0xF4, 0xBF, 0x00, 0x8F, 0x2B, 0xF4, 0xBF, 0x00,
+  0x1F, 0x8B, 0xF4, 0xBF, 0x00, 0x09, 0xDB, 0xF4, 0xBF, 0x00, 0x04, 0xFF, 0xF4, 0xBF, 0x00, 0x00,
+  0xDF, 0xF4, 0xBF, 0x00, 0x00, 0x7F, 0xF4, 0x00, 0x8E, 0xFF, 0xB3, 0x00, 0x09, 0xFB, 0x88, 0xFE,
+  0x20, 0x3F, 0xB0, 0x00, 0x6F, 0x90, 0x8F, 0x60, 0x00, 0x0E, 0xE0, 0xBF, 0x40, 0x00, 0x0B, 0xF3,
+  0xBF, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0x08, 0xF4, 0xFF, 0x00, 0x00, 0x08, 0xF4, 0xCF,
+  0x00, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0x0B, 0xF4, 0x8F, 0x60, 0x00, 0x0E, 0xF0, 0x4F, 0xB0,
+  0x00, 0x4F, 0xA0, 0x0B, 0xFA, 0x46, 0xEF, 0x30, 0x01, 0xBF, 0xFF, 0xE5, 0x00, 0x00, 0x02, 0x44,
+  0x00, 0x00, 0x3B, 0xBB, 0xBB, 0xA6, 0x00, 0x4F, 0xEB, 0xBB, 0xFF, 0x90, 0x4F, 0xB0, 0x00, 0x2D,
+  0xF4, 0x4F, 0xB0, 0x00, 0x08, 0xF8, 0x4F, 0xB0, 0x00, 0x08, 0xF8, 0x4F, 0xB0, 0x00, 0x09, 0xF7,
+  0x4F, 0xB0, 0x03, 0x8F, 0xE2, 0x4F, 0xFF, 0xFF, 0xFE, 0x50, 0x4F, 0xD8, 0x88, 0x40, 0x00, 0x4F,
+  0xB0, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x4F, 0xB0,
+  0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x8E, 0xFF, 0xB3, 0x00, 0x09, 0xFB, 0x88,
+  0xFE, 0x20, 0x3F, 0xB0, 0x00, 0x6F, 0x90, 0x8F, 0x60, 0x00, 0x0E, 0xE0, 0xBF, 0x40, 0x00, 0x0B,
+  0xF3, 0xBF, 0x00, 0x00, 0x0B, 0xF4, 0xFF, 0x00, 0x00, 0x08, 0xF4, 0xFF, 0x00, 0x00, 0x08, 0xF4,
+  0xCF, 0x00, 0x00, 0x0B, 0xF4, 0xBF, 0x40, 0x00, 0x0B, 0xF4, 0x8F, 0x60, 0x00, 0x0E, 0xF0, 0x4F,
+  0xB0, 0x00, 0x4F, 0xA0, 0x0B, 0xFA, 0x46, 0xEF, 0x30, 0x01, 0xBF, 0xFF, 0xE5, 0x00, 0x00, 0x02,
+  0x49, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x05, 0x00, 0x8B, 0xBB, 0xBB,
+  0x71, 0x00, 0x00, 0xBF, 0xCB, 0xBD, 0xFD, 0x10, 0x00, 0xBF, 0x40, 0x00, 0x9F, 0x90, 0x00, 0xBF,
+  0x40, 0x00, 0x2F, 0xC0, 0x00, 0xBF, 0x40, 0x00, 0x1F, 0xD0, 0x00, 0xBF, 0x40, 0x00, 0x6F, 0xA0,
+  0x00, 0xBF, 0x98, 0x88, 0xFD, 0x20, 0x00, 0xBF, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0xBF, 0x74, 0x49,
+  0xF8, 0x00, 0x00, 0xBF, 0x40, 0x00, 0xBF, 0x30, 0x00, 0xBF, 0x40, 0x00, 0x4F, 0xB0, 0x00, 0xBF,
+  0x40, 0x00, 0x0B, 0xF4, 0x00, 0xBF, 0x40, 0x00, 0x04, 0xFB, 0x00, 0xBF, 0x40, 0x00, 0x00, 0xCF,
+  0x40, 0x01, 0x9E, 0xFF, 0xEA, 0x40, 0x1C, 0xF9, 0x88, 0x9E, 0x80, 0x7F, 0x70, 0x00, 0x01, 0x30,
+  0xBF, 0x10, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x00, 0x00, 0x6F, 0xD6, 0x10, 0x00, 0x00, 0x09,
+  0xFF, 0xFD, 0x82, 0x00, 0x00, 0x38, 0xCF, 0xFE, 0x30, 0x00, 0x00, 0x01, 0x8F, 0xD0, 0x00, 0x00,
+  0x00, 0x0B, 0xF2, 0x00, 0x00, 0x00, 0x08, 0xF4, 0x31, 0x00, 0x00, 0x1D, 0xF0, 0x8E, 0x85, 0x46,
+  0xCF, 0x80, 0x4C, 0xFF, 0xFF, 0xE8, 0x00, 0x00, 0x14, 0x44, 0x00, 0x00, 0x6B, 0xBB, 0xBB, 0xBB,
+  0xBB, 0xB0, 0x6B, 0xBB, 0xCF, 0xEB, 0xBB, 0xB0, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00,
+  0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0,
+  0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00,
+  0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00,
+  0x8B, 0x30, 0x00, 0x08, 0xB0, 0xBF, 0x40, 0x00, 0x0B, 0xF0, 0xBF, 0x40, 0x00, 0x0B, 0xF0, 0xBF,
+  0x40, 0x00, 0x0B, 0xF0, 0xBF, 0x40, 0x00, 0x0B, 0xF0, 0xBF, 0x40, 0x00, 0x0B, 0xF0, 0xBF, 0x40,
+  0x00, 0x0B, 0xF0, 0xBF, 0x40, 0x00, 0x0B, 0xF0, 0xBF, 0x40, 0x00, 0x0B, 0xF0, 0x9F, 0x40, 0x00,
+  0x0B, 0xF0, 0x8F, 0x40, 0x00, 0x0B, 0xF0, 0x7F, 0x80, 0x00, 0x1F, 0xD0, 0x1E, 0xE8, 0x45, 0xCF,
+  0x70, 0x03, 0xBF, 0xFF, 0xE8, 0x00, 0x00, 0x02, 0x44, 0x00, 0x00, 0x4B, 0x70, 0x00, 0x00, 0x2B,
+  0x80, 0x1F, 0xC0, 0x00, 0x00, 0x6F, 0x80, 0x0C, 0xF1, 0x00, 0x00, 0x9F, 0x30, 0x08, 0xF6, 0x00,
+  0x00, 0xEE, 0x00, 0x03, 0xF9, 0x00, 0x03, 0xF9, 0x00, 0x00, 0xDD, 0x00, 0x07, 0xF6, 0x00, 0x00,
+  0x9F, 0x20, 0x0A, 0xF1, 0x00, 0x00, 0x5F, 0x70, 0x0F, 0xB0, 0x00, 0x00, 0x1F, 0xA0, 0x4F, 0x70,
+  0x00, 0x00, 0x0A, 0xE0, 0x8F, 0x30, 0x00, 0x00, 0x07, 0xF3, 0xBD, 0x00, 0x00, 0x00, 0x02, 0xF8,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0xBA,
+  0x00, 0x00, 0x00, 0x06, 0xB4, 0xBF, 0x00, 0x00, 0x00, 0x08, 0xF4, 0xAF, 0x10, 0x00, 0x00, 0x0A,
+  0xF1, 0x8F, 0x40, 0x00, 0x00, 0x0B, 0xF0, 0x5F, 0x50, 0x6F, 0xC0, 0x0E, 0xB0, 0x4F, 0x80, 0x8F,
+  0xF0, 0x0F, 0x90, 0x0F, 0x80, 0xCA, 0xF4, 0x2F, 0x80, 0x0E, 0xB0, 0xF5, 0xD7, 0x4F, 0x50, 0x0B,
+  0xB4, 0xF1, 0xAA, 0x6F, 0x40, 0x08, 0xF7, 0xD0, 0x7D, 0x8F, 0x00, 0x08, 0xFA, 0x90, 0x3F, 0x9D,
+  0x00, 0x04, 0xFE, 0x70, 0x0F, 0xFB, 0x00, 0x03, 0xFF, 0x30, 0x0B, 0xF8, 0x00, 0x00, 0xFE, 0x00,
+  0x08, 0xF8, 0x00, 0x0A, 0xB1, 0x00, 0x00, 0x4B, 0x80, 0x06, 0xF9, 0x00, 0x00, 0xDE, 0x20, 0x00,
+  0xBF, 0x30, 0x07, 0xF8, 0x00, 0x00, 0x2F, 0xB0, 0x1E, 0xC0, 0x00, 0x00, 0x08, 0xF6, 0x9F, 0x30,
+  0x00, 0x00, 0x01, 0xDE, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xE1, 0x00, 0x00, 0x00, 0x00, 0xBF,
+  0xF5, 0x00, 0x00, 0x00, 0x05, 0xF8, 0xDD, 0x10, 0x00, 0x00, 0x1E, 0xE1, 0x5F, 0x80, 0x00, 0x00,
+  0x9F, 0x50, 0x0B, 0xF2, 0x00, 0x04, 0xFB, 0x00, 0x03, 0xFB, 0x00, 0x0D, 0xF2, 0x00, 0x00, 0x9F,
+  0x60, 0x8F, 0x80, 0x00, 0x00, 0x1E, 0xE1, 0x5B, 0x70, 0x00, 0x00, 0x2B, 0x90, 0x0D, 0xF2, 0x00,
+  0x00, 0x9F, 0x50, 0x04, 0xF9, 0x00, 0x04, 0xFB, 0x00, 0x00, 0xBF, 0x30, 0x0B, 0xF2, 0x00, 0x00,
+  0x2F, 0xB0, 0x5F, 0x80, 0x00, 0x00, 0x08, 0xF4, 0xDE, 0x10, 0x00, 0x00, 0x01, 0xEF, 0xF6, 0x00,
+  0x00, 0x00, 0x00, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F,
+  0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00,
+  0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x3B, 0xBB, 0xBB, 0xBB, 0xB8,
+  0x3B, 0xBB, 0xBB, 0xBD, 0xF9, 0x00, 0x00, 0x00, 0x1E, 0xE1, 0x00, 0x00, 0x00, 0xAF, 0x50, 0x00,
+  0x00, 0x05, 0xFA, 0x00, 0x00, 0x00, 0x1E, 0xE1, 0x00, 0x00, 0x00, 0x8F, 0x50, 0x00, 0x00, 0x04,
+  0xFA, 0x00, 0x00, 0x00, 0x1D, 0xE1, 0x00, 0x00, 0x00, 0x8F, 0x50, 0x00, 0x00, 0x04, 0xFA, 0x00,
+  0x00, 0x00, 0x0C, 0xE1, 0x00, 0x00, 0x00, 0x7F, 0xB8, 0x88, 0x88, 0x86, 0x8F, 0xFF, 0xFF, 0xFF,
+  0xFB, 0x68, 0x88, 0x20, 0xBF, 0xFF, 0x40, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00,
+  0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF,
+  0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00, 0x00, 0xBF, 0x00,
+  0x00, 0xBF, 0xBB, 0x30, 0x68, 0x88, 0x20, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00,
+  0x00, 0x1E, 0xC0, 0x00, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x00,
+  0x00, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x2F, 0xA0, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x00,
+  0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00,
+  0x0B, 0xE1, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x10, 0x00, 0x00, 0x00,
+  0x6F, 0x60, 0x00, 0x00, 0x00, 0x0A, 0x90, 0x68, 0x88, 0x20, 0xBF, 0xFF, 0x40, 0x00, 0x8F, 0x40,
+  0x00, 0x8F, 0x40, 0x00, 0x8F, 0x40, 0x00, 0x8F, 0x40, 0x00, 0x8F, 0x40, 0x00, 0x8F, 0x40, 0x00,
+  0x8F, 0x40, 0x00, 0x8F, 0x40, 0x00, 0x8F, 0x40, 0x00, 0x8F, 0x40, 0x00, 0x8F, 0x40, 0x00, 0x8F,
+  0x40, 0x00, 0x8F, 0x40, 0x00, 0x8F, 0x40, 0x8B, 0xDF, 0x40, 0x68, 0x88, 0x20, 0x00, 0x00, 0x6B,
+  0xA1, 0x00, 0x00, 0x00, 0x03, 0xFD, 0xF9, 0x00, 0x00, 0x00, 0x2E, 0xC1, 0x8F, 0x70, 0x00, 0x01,
+  0xCE, 0x10, 0x09, 0xF5, 0x00, 0x09, 0xE3, 0x00, 0x00, 0x9E, 0x30, 0x14, 0x20, 0x00, 0x00, 0x04,
+  0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42, 0x88, 0x88, 0x88, 0x88, 0x88, 0x84, 0x14, 0x20, 0x00,
+  0x1C, 0xD1, 0x00, 0x01, 0xCA, 0x00, 0x00, 0x3E, 0x70, 0x00, 0x02, 0x40, 0x02, 0x68, 0xB8, 0x60,
+  0x00, 0x0F, 0xFD, 0xBE, 0xFC, 0x10, 0x08, 0x20, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xB0,
+  0x00, 0x38, 0x88, 0x8F, 0xB0, 0x1B, 0xFE, 0xBB, 0xBF, 0xB0, 0x7F, 0x80, 0x00, 0x0F, 0xB0, 0xBF,
+  0x00, 0x00, 0x1F, 0xB0, 0xBF, 0x10, 0x00, 0x8F, 0xB0, 0x7F, 0xA4, 0x48, 0xEF, 0xB0, 0x08, 0xFF,
+  0xFE, 0x3F, 0xB0, 0x00, 0x24, 0x40, 0x00, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00,
+  0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x4F, 0x82, 0x89, 0x71,
+  0x00, 0x4F, 0xAE, 0xDD, 0xFC, 0x10, 0x4F, 0xF6, 0x00, 0x6F, 0x90, 0x4F, 0xC0, 0x00, 0x0C, 0xF1,
+  0x4F, 0x80, 0x00, 0x08, 0xF4, 0x4F, 0x80, 0x00, 0x08, 0xF4, 0x4F, 0x80, 0x00, 0x08, 0xF4, 0x4F,
+  0xA0, 0x00, 0x09, 0xF3, 0x4F, 0xE1, 0x00, 0x1E, 0xD0, 0x4F, 0xFC, 0x44, 0xAF, 0x70, 0x4F, 0x8B,
+  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x34, 0x10, 0x00, 0x00, 0x02, 0x89, 0x87, 0x10, 0x00, 0x8F, 0xFC,
+  0xCF, 0xB0, 0x05, 0xFC, 0x20, 0x02, 0x70, 0x0D, 0xF1, 0x00, 0x00, 0x00, 0x1F, 0xB0, 0x00, 0x00,
+  0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
+  0x0A, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xEE, 0x84, 0x47, 0xA0, 0x00, 0x3B, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x24, 0x41, 0x00, 0x00, 0x00, 0x00, 0x08, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00,
+  0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x48, 0x96, 0x0F, 0xB0, 0x08, 0xFE, 0xBF,
+  0x9F, 0xB0, 0x3F, 0xC1, 0x01, 0xDF, 0xB0, 0x8F, 0x50, 0x00, 0x6F, 0xB0, 0xBF, 0x00, 0x00, 0x2F,
+  0xB0, 0xBF, 0x00, 0x00, 0x0F, 0xB0, 0xBF, 0x00, 0x00, 0x0F, 0xB0, 0xBF, 0x10, 0x00, 0x4F, 0xB0,
+  0x7F, 0x60, 0x00, 0x8F, 0xB0, 0x1E, 0xE6, 0x47, 0xEF, 0xB0, 0x03, 0xDF, 0xFE, 0x6F, 0xB0, 0x00,
+  0x04, 0x41, 0x00, 0x00, 0x00, 0x17, 0x89, 0x61, 0x00, 0x03, 0xEF, 0xCC, 0xFC, 0x10, 0x1E, 0xE3,
+  0x00, 0x4F, 0xB0, 0x7F, 0x60, 0x00, 0x09, 0xF1, 0xBF, 0x00, 0x00, 0x08, 0xF4, 0xBF, 0xFF, 0xFF,
+  0xFF, 0xF4, 0xBF, 0x44, 0x44, 0x44, 0x41, 0xAF, 0x10, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00,
+  0x10, 0x0B, 0xF9, 0x44, 0x59, 0xE0, 0x01, 0x8F, 0xFF, 0xFE, 0x90, 0x00, 0x00, 0x44, 0x30, 0x00,
+  0x00, 0x00, 0x04, 0x88, 0x60, 0x00, 0x00, 0xAF, 0xFF, 0xB0, 0x00, 0x03, 0xFA, 0x00, 0x00, 0x00,
+  0x07, 0xF4, 0x00, 0x00, 0x28, 0x8B, 0xF9, 0x88, 0x60, 0x4F, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x08,
+  0xF4, 0x00, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xF4,
+  0x00, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xF4, 0x00,
+  0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x48, 0x96, 0x04, 0x30,
+  0x07, 0xFF, 0xBF, 0x9F, 0xB0, 0x2F, 0xC1, 0x01, 0xDF, 0xB0, 0x8F, 0x50, 0x00, 0x6F, 0xB0, 0xBF,
+  0x00, 0x00, 0x2F, 0xB0, 0xBF, 0x00, 0x00, 0x0F, 0xB0, 0xBF, 0x00, 0x00, 0x0F, 0xB0, 0xAF, 0x20,
+  0x00, 0x4F, 0xB0, 0x6F, 0x80, 0x00, 0x9F, 0xB0, 0x0C, 0xF8, 0x59, 0xDF, 0xB0, 0x01, 0xAF, 0xFC,
+  0x3F, 0xB0, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x0A, 0x96, 0x48, 0xEC,
+  0x00, 0x08, 0xDF, 0xFF, 0x91, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00,
+  0x4F, 0x80, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x4F, 0x81, 0x7A, 0x82, 0x00, 0x4F,
+  0x9E, 0xDD, 0xFE, 0x10, 0x4F, 0xF6, 0x00, 0x8F, 0x70, 0x4F, 0xC0, 0x00, 0x1F, 0xB0, 0x4F, 0x80,
+  0x00, 0x0F, 0xB0, 0x4F, 0x80, 0x00, 0x0F, 0xB0, 0x4F, 0x80, 0x00, 0x0F, 0xB0, 0x4F, 0x80, 0x00,
+  0x0F, 0xB0, 0x4F, 0x80, 0x00, 0x0F, 0xB0, 0x4F, 0x80, 0x00, 0x0F, 0xB0, 0x4F, 0x80, 0x00, 0x0F,
+  0xB0, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x86, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+  0x00, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x00,
+  0xFB, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFB,
+  0x00, 0x00, 0x14, 0x44, 0xFC, 0x44, 0x41, 0x4F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x48, 0x20,
+  0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x6B, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0x88, 0x88, 0x20,
+  0x04, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x8F, 0x40,
+  0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x8F, 0x40,
+  0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x9F, 0x20,
+  0x28, 0x89, 0xFB, 0x00, 0x4F, 0xFE, 0x91, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00,
+  0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x58,
+  0x30, 0xBF, 0x00, 0x07, 0xF9, 0x00, 0xBF, 0x00, 0x9F, 0x90, 0x00, 0xBF, 0x09, 0xF7, 0x00, 0x00,
+  0xBF, 0x9F, 0x90, 0x00, 0x00, 0xBF, 0xFD, 0xE3, 0x00, 0x00, 0xBF, 0x63, 0xFC, 0x10, 0x00, 0xBF,
+  0x00, 0x7F, 0x80, 0x00, 0xBF, 0x00, 0x0B, 0xF5, 0x00, 0xBF, 0x00, 0x01, 0xEE, 0x20, 0xBF, 0x00,
+  0x00, 0x5F, 0xC0, 0x48, 0x88, 0x80, 0x00, 0x00, 0x6B, 0xBE, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0,
+  0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00,
+  0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00,
+  0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00,
+  0x09, 0xF2, 0x00, 0x00, 0x00, 0x04, 0xFC, 0x88, 0x40, 0x00, 0x00, 0x6D, 0xFF, 0x80, 0x84, 0x7A,
+  0x51, 0x79, 0x40, 0xFD, 0xCE, 0xFC, 0xCE, 0xF2, 0xFC, 0x05, 0xFC, 0x05, 0xF6, 0xF8, 0x00, 0xF8,
+  0x00, 0xF8, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0xF8, 0x00, 0xF8, 0x00,
+  0xF8, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+  0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x28, 0x41, 0x7A, 0x82, 0x00, 0x4F, 0x9E, 0xDD, 0xFE, 0x10, 0x4F,
+  0xF6, 0x00, 0x8F, 0x70, 0x4F, 0xC0, 0x00, 0x1F, 0xB0, 0x4F, 0x80, 0x00, 0x0F, 0xB0, 0x4F, 0x80,
+  0x00, 0x0F, 0xB0, 0x4F, 0x80, 0x00, 0x0F, 0xB0, 0x4F, 0x80, 0x00, 0x0F, 0xB0, 0x4F, 0x80, 0x00,
+  0x0F, 0xB0, 0x4F, 0x80, 0x00, 0x0F, 0xB0, 0x4F, 0x80, 0x00, 0x0F, 0xB0, 0x00, 0x28, 0xA8, 0x60,
+  0x00, 0x06, 0xFF, 0xBE, 0xFB, 0x00, 0x1E, 0xE2, 0x00, 0x9F, 0x80, 0x7F, 0x60, 0x00, 0x1E, 0xD0,
+  0xAF, 0x30, 0x00, 0x0B, 0xF0, 0xBF, 0x00, 0x00, 0x0B, 0xF4, 0xBF, 0x10, 0x00, 0x0B, 0xF3, 0x8F,
+  0x40, 0x00, 0x0C, 0xF0, 0x5F, 0x90, 0x00, 0x2F, 0xB0, 0x0C, 0xF8, 0x45, 0xCF, 0x40, 0x01, 0xBF,
+  0xFF, 0xE6, 0x00, 0x00, 0x02, 0x44, 0x00, 0x00, 0x28, 0x42, 0x89, 0x71, 0x00, 0x4F, 0xBF, 0xDD,
+  0xFC, 0x10, 0x4F, 0xF6, 0x00, 0x6F, 0x90, 0x4F, 0xC0, 0x00, 0x0C, 0xF0, 0x4F, 0x80, 0x00, 0x08,
+  0xF4, 0x4F, 0x80, 0x00, 0x08, 0xF4, 0x4F, 0x80, 0x00, 0x08, 0xF4, 0x4F, 0x90, 0x00, 0x0A, 0xF2,
+  0x4F, 0xE1, 0x00, 0x1E, 0xD0, 0x4F, 0xFB, 0x44, 0xBF, 0x70, 0x4F, 0x8C, 0xFF, 0xF8, 0x00, 0x4F,
+  0x80, 0x34, 0x10, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x00, 0x4F, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x86, 0x04, 0x30, 0x06, 0xFF, 0xCF, 0xBF, 0xB0, 0x1E, 0xD2, 0x01,
+  0xCF, 0xB0, 0x7F, 0x60, 0x00, 0x5F, 0xB0, 0x9F, 0x30, 0x00, 0x0F, 0xB0, 0xBF, 0x00, 0x00, 0x0F,
+  0xB0, 0xBF, 0x10, 0x00, 0x0F, 0xB0, 0x8F, 0x40, 0x00, 0x1F, 0xB0, 0x6F, 0x80, 0x00, 0x6F, 0xB0,
+  0x0D, 0xF7, 0x46, 0xEF, 0xB0, 0x03, 0xDF, 0xFF, 0x6F, 0xB0, 0x00, 0x04, 0x42, 0x0F, 0xB0, 0x00,
+  0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x68, 0x02,
+  0x8B, 0x82, 0xBF, 0x4E, 0xFF, 0xFB, 0xBF, 0xD7, 0x10, 0x26, 0xBF, 0x80, 0x00, 0x00, 0xBF, 0x40,
+  0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00,
+  0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x02, 0x89, 0x98, 0x30, 0x5F, 0xFB,
+  0xBF, 0xF0, 0xDE, 0x20, 0x00, 0x60, 0xFB, 0x00, 0x00, 0x00, 0xCF, 0x82, 0x00, 0x00, 0x3D, 0xFF,
+  0xEA, 0x40, 0x00, 0x47, 0xAF, 0xF2, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x04, 0xF8, 0xD8, 0x44,
+  0x5C, 0xF3, 0xCF, 0xFF, 0xFE, 0x60, 0x00, 0x44, 0x30, 0x00, 0x00, 0x04, 0x30, 0x00, 0x00, 0x00,
+  0x0F, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x68, 0x8F, 0xD8, 0x88, 0x40, 0xBF, 0xFF,
+  0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xB0,
+  0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x00,
+  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x0A, 0xF9, 0x54, 0x20, 0x00, 0x01, 0xAE, 0xFF, 0x80,
+  0x14, 0x20, 0x00, 0x04, 0x30, 0x4F, 0x80, 0x00, 0x0F, 0xB0, 0x4F, 0x80, 0x00, 0x0F, 0xB0, 0x4F,
+  0x80, 0x00, 0x0F, 0xB0, 0x4F, 0x80, 0x00, 0x0F, 0xB0, 0x4F, 0x80, 0x00, 0x0F, 0xB0, 0x4F, 0x80,
+  0x00, 0x0F, 0xB0, 0x4F, 0x80, 0x00, 0x0F, 0xB0, 0x1F, 0xA0, 0x00, 0x6F, 0xB0, 0x0C, 0xF8, 0x46,
+  0xDF, 0xB0, 0x03, 0xEF, 0xFE, 0x3F, 0xB0, 0x00, 0x04, 0x40, 0x00, 0x00, 0x86, 0x00, 0x00, 0x02,
+  0x84, 0xBF, 0x10, 0x00, 0x08, 0xF3, 0x6F, 0x60, 0x00, 0x0D, 0xD0, 0x1F, 0xA0, 0x00, 0x5F, 0x70,
+  0x0A, 0xF1, 0x00, 0x9F, 0x20, 0x06, 0xF6, 0x00, 0xEC, 0x00, 0x00, 0xEA, 0x05, 0xF6, 0x00, 0x00,
+  0x9F, 0x29, 0xF1, 0x00, 0x00, 0x5F, 0x8E, 0xA0, 0x00, 0x00, 0x0D, 0xFF, 0x60, 0x00, 0x00, 0x08,
+  0xFE, 0x10, 0x00, 0x86, 0x00, 0x00, 0x00, 0x02, 0x84, 0xCD, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x8F,
+  0x10, 0x00, 0x00, 0x0A, 0xF0, 0x5F, 0x50, 0x04, 0x20, 0x0D, 0xB0, 0x1F, 0x80, 0x4F, 0xA0, 0x1F,
+  0x80, 0x0D, 0xB0, 0x8C, 0xE0, 0x5F, 0x50, 0x09, 0xF0, 0xC6, 0xE4, 0x8F, 0x10, 0x06, 0xF4, 0xF1,
+  0x98, 0xBC, 0x00, 0x02, 0xFB, 0xC0, 0x6C, 0xE8, 0x00, 0x00, 0xEF, 0x80, 0x1F, 0xF6, 0x00, 0x00,
+  0xAF, 0x30, 0x0C, 0xF2, 0x00, 0x07, 0x81, 0x00, 0x00, 0x58, 0x20, 0x04, 0xF9, 0x00, 0x03, 0xFA,
+  0x00, 0x00, 0x8F, 0x50, 0x1D, 0xD1, 0x00, 0x00, 0x0B, 0xE2, 0xAF, 0x30, 0x00, 0x00, 0x01, 0xED,
+  0xF7, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xF6, 0x00, 0x00, 0x00,
+  0x0A, 0xF4, 0xCE, 0x30, 0x00, 0x00, 0x7F, 0x80, 0x2E, 0xC1, 0x00, 0x03, 0xFB, 0x00, 0x05, 0xF9,
+  0x00, 0x1D, 0xE2, 0x00, 0x00, 0x9F, 0x60, 0x86, 0x00, 0x00, 0x01, 0x85, 0xAF, 0x20, 0x00, 0x07,
+  0xF6, 0x5F, 0x80, 0x00, 0x0C, 0xE0, 0x0D, 0xD0, 0x00, 0x3F, 0x80, 0x08, 0xF4, 0x00, 0x8F, 0x30,
+  0x02, 0xF9, 0x00, 0xEC, 0x00, 0x00, 0xAE, 0x15, 0xF6, 0x00, 0x00, 0x6F, 0x6A, 0xF1, 0x00, 0x00,
+  0x0E, 0xBF, 0x90, 0x00, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x05,
+  0xF8, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0x00, 0x00, 0x28, 0xAF, 0x90, 0x00, 0x00, 0x4F, 0xE9, 0x10,
+  0x00, 0x00, 0x88, 0x88, 0x88, 0x86, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x09, 0xF6, 0x00, 0x00,
+  0x6F, 0x80, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x1E, 0xD1, 0x00, 0x00, 0xCE, 0x30, 0x00, 0x09, 0xF6,
+  0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0xFE, 0x88, 0x88, 0x86, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00,
+  0x26, 0x84, 0x00, 0x08, 0xFF, 0xF8, 0x00, 0x0E, 0xD1, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x0F,
+  0xB0, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x5F, 0x80, 0x00, 0x47, 0xDE,
+  0x30, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0x9F, 0x60, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x0F,
+  0xB0, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x0F, 0xB0, 0x00, 0x00, 0x0D,
+  0xF6, 0x42, 0x00, 0x03, 0xCF, 0xF8, 0x84, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8,
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x84, 0x87, 0x40, 0x00, 0x00, 0xFF, 0xFC,
+  0x10, 0x00, 0x00, 0x8F, 0x60, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x4F,
+  0x80, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x0B, 0xF8, 0x52, 0x00, 0x03,
+  0xDF, 0xF8, 0x00, 0x0D, 0xE4, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x4F,
+  0x80, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x00, 0x4F, 0x80, 0x00, 0x44, 0xCF, 0x30, 0x00, 0xFF, 0xE8,
+  0x00, 0x00, 0x00, 0x14, 0x30, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xFD, 0x62, 0x28, 0x70, 0x4D, 0x74,
+  0x7B, 0xFF, 0xFF, 0x50, 0x21, 0x00, 0x00, 0x27, 0x62, 0x00,
+};
+
+const AtlasGlyph Atlas_Second_Glyphs[95] PROGMEM = {
+  {     0,  0,  0,   0,   0, 11 },  // ' '
+  {     0,  3, 14,   4, -14, 11 },  // '!'
+  {    28,  6,  6,   3, -14, 11 },  // '"'
+  {    46, 12, 14,   0, -14, 11 },  // '#'
+  {   130, 10, 18,   1, -15, 11 },  // '$'
+  {   220, 12, 14,   0, -14, 11 },  // '%'
+  {   304, 12, 15,   0, -14, 11 },  // '&'
+  {   394,  2,  6,   5, -14, 11 },  // '''
+  {   400,  5, 18,   4, -15, 11 },  // '('
+  {   454,  5, 18,   3, -15, 11 },  // ')'
+  {   508,  9,  9,   1, -14, 11 },  // '*'
+  {   553, 11, 10,   0, -11, 11 },  // '+'
+  {   613,  4,  6,   3,  -3, 11 },  // ','
+  {   625,  6,  2,   3,  -6, 11 },  // '-'
+  {   631,  3,  3,   4,  -3, 11 },  // '.'
+  {   637,  9, 16,   1, -14, 11 },  // '/'
+  {   717, 10, 15,   1, -14, 11 },  // '0'
+  {   792,  9, 14,   2, -14, 11 },  // '1'
+  {   862,  9, 14,   1, -14, 11 },  // '2'
+  {   932,  9, 15,   1, -14, 11 },  // '3'
+  {  1007, 10, 14,   1, -14, 11 },  // '4'
+  {  1077,  9, 15,   1, -14, 11 },  // '5'
+  {  1152, 10, 15,   1, -14, 11 },  // '6'
+  {  1227,  9, 14,   1, -14, 11 },  // '7'
+  {  1297, 10, 15,   1, -14, 11 },  // '8'
+  {  1372, 10, 15,   1, -14, 11 },  // '9'
+  {  1447,  3, 10,   4, -10, 11 },  // ':'
+  {  1467,  4, 13,   3, -10, 11 },  // ';'
+  {  1493, 11, 10,   0, -11, 11 },  // '<'
+  {  1553, 11,  6,   0,  -9, 11 },  // '='
+  {  1589, 11, 10,   0, -11, 11 },  // '>'
+  {  1649,  8, 14,   2, -14, 11 },  // '?'
+  {  1705, 11, 16,   0, -13, 11 },  // '@'
+  {  1801, 11, 14,   0, -14, 11 },  // 'A'
+  {  1885, 10, 14,   1, -14, 11 },  // 'B'
+  {  1955,  9, 15,   1, -14, 11 },  // 'C'
+  {  2030, 10, 14,   1, -14, 11 },  // 'D'
+  {  2100, 10, 14,   1, -14, 11 },  // 'E'
+  {  2170,  9, 14,   2, -14, 11 },  // 'F'
+  {  2240, 10, 15,   1, -14, 11 },  // 'G'
+  {  2315, 10, 14,   1, -14, 11 },  // 'H'
+  {  2385,  9, 14,   1, -14, 11 },  // 'I'
+  {  2455,  8, 15,   1, -14, 11 },  // 'J'
+  {  2515, 11, 14,   1, -14, 11 },  // 'K'
+  {  2599,  9, 14,   2, -14, 11 },  // 'L'
+  {  2669, 11, 14,   0, -14, 11 },  // 'M'
+  {  2753, 10, 14,   1, -14, 11 },  // 'N'
+  {  2823, 10, 15,   1, -14, 11 },  // 'O'
+  {  2898, 10, 14,   1, -14, 11 },  // 'P'
+  {  2968, 10, 17,   1, -14, 11 },  // 'Q'
+  {  3053, 11, 14,   1, -14, 11 },  // 'R'
+  {  3137, 10, 15,   1, -14, 11 },  // 'S'
+  {  3212, 11, 14,   0, -14, 11 },  // 'T'
+  {  3296,  9, 15,   1, -14, 11 },  // 'U'
+  {  3371, 11, 14,   0, -14, 11 },  // 'V'
+  {  3455, 12, 14,   0, -14, 11 },  // 'W'
+  {  3539, 12, 14,   0, -14, 11 },  // 'X'
+  {  3623, 11, 14,   0, -14, 11 },  // 'Y'
+  {  3707, 10, 14,   1, -14, 11 },  // 'Z'
+  {  3777,  5, 18,   4, -15, 11 },  // '['
+  {  3831,  9, 16,   1, -14, 11 },  // '\\'
+  {  3911,  5, 18,   3, -15, 11 },  // ']'
+  {  3965, 11,  6,   0, -14, 11 },  // '^'
+  {  4001, 12,  2,   0,   3, 11 },  // '_'
+  {  4013,  5,  5,   2, -16, 11 },  // '`'
+  {  4028,  9, 12,   1, -11, 11 },  // 'a'
+  {  4088, 10, 16,   1, -15, 11 },  // 'b'
+  {  4168,  9, 12,   1, -11, 11 },  // 'c'
+  {  4228,  9, 16,   1, -15, 11 },  // 'd'
+  {  4308, 10, 12,   1, -11, 11 },  // 'e'
+  {  4368,  9, 15,   1, -15, 11 },  // 'f'
+  {  4443,  9, 15,   1, -11, 11 },  // 'g'
+  {  4518,  9, 15,   1, -15, 11 },  // 'h'
+  {  4593, 10, 15,   1, -15, 11 },  // 'i'
+  {  4668,  7, 19,   1, -15, 11 },  // 'j'
+  {  4744,  9, 15,   2, -15, 11 },  // 'k'
+  {  4819,  9, 15,   1, -15, 11 },  // 'l'
+  {  4894, 10, 11,   1, -11, 11 },  // 'm'
+  {  4949,  9, 11,   1, -11, 11 },  // 'n'
+  {  5004, 10, 12,   1, -11, 11 },  // 'o'
+  {  5064, 10, 15,   1, -11, 11 },  // 'p'
+  {  5139,  9, 15,   1, -11, 11 },  // 'q'
+  {  5214,  8, 11,   3, -11, 11 },  // 'r'
+  {  5258,  8, 12,   2, -11, 11 },  // 's'
+  {  5306,  9, 14,   1, -14, 11 },  // 't'
+  {  5376,  9, 12,   1, -11, 11 },  // 'u'
+  {  5436, 10, 11,   1, -11, 11 },  // 'v'
+  {  5491, 12, 11,   0, -11, 11 },  // 'w'
+  {  5557, 11, 11,   0, -11, 11 },  // 'x'
+  {  5623, 10, 15,   1, -11, 11 },  // 'y'
+  {  5698,  8, 11,   2, -11, 11 },  // 'z'
+  {  5742,  8, 18,   2, -15, 11 },  // '{'
+  {  5814,  2, 20,   5, -15, 11 },  // '|'
+  {  5834,  8, 18,   2, -15, 11 },  // '}'
+  {  5906, 11,  4,   0,  -8, 11 },  // '~'
+};
+
+const AtlasFont Atlas_Second PROGMEM = {Atlas_Second_Bitmap, Atlas_Second_Glyphs, 0x20, 0x7E, 22, 14, 5};
+
+#endif
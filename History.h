@@ -0,0 +1,85 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include "Temperature.h"
+
+#define HISTORY_SIZE 288           // 24 hours of samples
+#define HISTORY_INTERVAL 300000    // One sample every 5 minutes
+
+/**
+ * @brief One sample of the history graph, 12 bytes
+ *
+ */
+struct HistorySample {
+  uint32_t time;                   // Epoch seconds, seconds since boot before the clock was set
+  deci_celsius temp;
+  deci_celsius heat;
+  deci_celsius cool;
+  uint8_t humd;
+  uint8_t on;                      // Heating or cooling ran at the time of the sample
+};
+
+/**
+ * @brief Fixed ring of the last day of temperatures and targets for the web dashboard
+ *
+ */
+class History {
+  private:
+    HistorySample samples[HISTORY_SIZE];
+    uint16_t count = 0;
+    uint16_t next = 0;
+    unsigned long sampled_at = 0;
+
+  public:
+    boolean due(unsigned long now);
+    const HistorySample& add(const HistorySample &s, unsigned long now);
+    const HistorySample& get(uint16_t i);
+    uint16_t getCount();
+};
+
+/**
+ * @brief Whether it is time for the next sample
+ *
+ * @param now
+ * @return boolean
+ */
+boolean History::due(unsigned long now){
+  return count == 0 || now - sampled_at >= HISTORY_INTERVAL;
+}
+
+/**
+ * @brief Add a sample, overwriting the oldest once the day is full
+ *
+ * @param s
+ * @param now
+ * @return const HistorySample& the copy in the ring
+ */
+const HistorySample& History::add(const HistorySample &s, unsigned long now){
+  HistorySample &slot = samples[next];
+  slot = s;
+  next = (next + 1) % HISTORY_SIZE;
+  if(count < HISTORY_SIZE) count++;
+  sampled_at = now;
+  return slot;
+}
+
+/**
+ * @brief Returns a sample, oldest first
+ *
+ * @param i 0 to getCount() - 1
+ * @return const HistorySample&
+ */
+const HistorySample& History::get(uint16_t i){
+  return samples[(next + HISTORY_SIZE - count + i) % HISTORY_SIZE];
+}
+
+/**
+ * @brief Returns the number of samples kept
+ *
+ * @return uint16_t
+ */
+uint16_t History::getCount(){
+  return count;
+}
+
+#endif
@@ -0,0 +1,260 @@
+#ifndef HUMIDITY_H
+#define HUMIDITY_H
+
+#include "Temperature.h"
+#include "Event_Log.h"
+#include "Trace.h"
+
+#define HUMD_BAND 2.0           // Symmetric hysteresis around the target, in % RH
+#define HUMD_MIN_ON 600000      // Humidifier stays on at least 10 minutes
+#define HUMD_MIN_OFF 900000     // and off at least 15 minutes
+#define HUMD_OUTDOOR_STALE 3600000 // Outdoor readings older than an hour are ignored
+#define HUMD_FLOOR 15.0         // Never aim lower than this, the air gets too dry
+#define HUMD_MARGIN 5.0         // Stay this far under the point where windows start to sweat
+#define GLASS_FACTOR 0.35       // Fraction of the indoor/outdoor difference seen across the glass (double pane)
+#define DAY_MS 86400000
+
+/**
+ * @brief Runs the humidifier relay. The users target is treated as an upper limit, when it is cold
+ * outside the target is pulled down so that the dew point of the indoor air stays below the
+ * temperature of the inside of the windows.
+ *
+ */
+class Humidity {
+  private:
+    int pin;
+    boolean on = false;
+    boolean locked = false;
+    float setpoint = 30;
+    float target = 30;
+    deci_celsius outdoor = DECI_INVALID;
+    unsigned long outdoor_at = 0;
+    unsigned long changed_at = 0;
+    unsigned long day_start = 0;
+    uint16_t cycles_today = 0;
+    uint16_t cycles_yesterday = 0;
+    void set(boolean val, unsigned long now);
+
+  public:
+    Humidity(int humdPin);
+    void begin();
+    float getSetpoint();
+    float getTarget();
+    boolean getOn();
+    uint16_t getCyclesToday();
+    uint16_t getCyclesYesterday();
+    deci_celsius getOutdoorTemp();
+    void setSetpoint(float humd);
+    void setOutdoorTemp(deci_celsius temp, unsigned long now);
+    void lock(boolean val, unsigned long now);
+    float safeTarget(deci_celsius indoor, unsigned long now);
+    void keep(float humd, deci_celsius indoor, unsigned long now);
+    void reset(unsigned long now);
+};
+
+/**
+ * @brief Saturation vapour pressure in hPa (Magnus formula)
+ *
+ * @param c temperature in celsius
+ * @return float
+ */
+float saturation(float c){
+  return 6.112 * exp((17.62 * c) / (243.12 + c));
+}
+
+/**
+ * @brief Construct a new Humidity:: Humidity object on the given relay pin
+ *
+ * @param humdPin
+ */
+Humidity::Humidity(int humdPin){
+  pin = humdPin;
+}
+
+/**
+ * @brief Sets the relay pin to output and makes sure the humidifier starts off
+ *
+ */
+void Humidity::begin(){
+  pinMode(pin, OUTPUT);
+  digitalWrite(pin, HIGH);
+}
+
+/**
+ * @brief Returns the users humidity setting
+ *
+ * @return float
+ */
+float Humidity::getSetpoint(){
+  return setpoint;
+}
+
+/**
+ * @brief Returns the target the humidifier is actually working towards
+ *
+ * @return float
+ */
+float Humidity::getTarget(){
+  return target;
+}
+
+/**
+ * @brief Returns whether the humidifier relay is on
+ *
+ * @return boolean
+ */
+boolean Humidity::getOn(){
+  return on;
+}
+
+/**
+ * @brief Returns the number of times the humidifier has turned on so far in the current 24 hours
+ *
+ * @return uint16_t
+ */
+uint16_t Humidity::getCyclesToday(){
+  return cycles_today;
+}
+
+/**
+ * @brief Returns the number of times the humidifier turned on in the previous 24 hours
+ *
+ * @return uint16_t
+ */
+uint16_t Humidity::getCyclesYesterday(){
+  return cycles_yesterday;
+}
+
+/**
+ * @brief Returns the last outdoor temperature reported
+ *
+ * @return deci_celsius
+ */
+deci_celsius Humidity::getOutdoorTemp(){
+  return outdoor;
+}
+
+/**
+ * @brief Sets the users humidity setting
+ *
+ * @param humd
+ */
+void Humidity::setSetpoint(float humd){
+  setpoint = humd;
+  target = humd;
+}
+
+/**
+ * @brief Record the outdoor temperature from the weather source or an outside room module
+ *
+ * @param temp
+ * @param now millis() of the reading
+ */
+void Humidity::setOutdoorTemp(deci_celsius temp, unsigned long now){
+  if(!isValid(temp)){
+    return;
+  }
+  outdoor = temp;
+  outdoor_at = now;
+}
+
+/**
+ * @brief Turn the humidifier off and keep it off regardless of humidity, i.e. while updating
+ * firmware. The minimum on time is ignored.
+ *
+ * @param val
+ * @param now
+ */
+void Humidity::lock(boolean val, unsigned long now){
+  locked = val;
+  if(locked && on){
+    set(false, now);
+  }
+}
+
+/**
+ * @brief Works out the highest humidity that won't condense on the windows. The inside of the
+ * glass sits part way between the indoor and outdoor temperature, the indoor air can hold
+ * moisture up to the saturation pressure at that temperature.
+ *
+ * Falls back to the setpoint when there is no recent outdoor reading.
+ *
+ * @param indoor
+ * @param now
+ * @return float
+ */
+float Humidity::safeTarget(deci_celsius indoor, unsigned long now){
+  if(!isValid(indoor) || !isValid(outdoor) || now - outdoor_at > HUMD_OUTDOOR_STALE){
+    return setpoint;
+  }
+  float t_in = toCelsius(indoor);
+  float t_glass = t_in - (GLASS_FACTOR * (t_in - toCelsius(outdoor)));
+  float limit = (100.0 * saturation(t_glass) / saturation(t_in)) - HUMD_MARGIN;
+  return constrain(limit, HUMD_FLOOR, setpoint);
+}
+
+/**
+ * @brief Turns the relay on or off and counts the cycles
+ *
+ * @param val
+ * @param now
+ */
+void Humidity::set(boolean val, unsigned long now){
+  logEvent(LOG_RELAY, pin, val);
+  trace.decision(pin, val, now);
+  if(!traceReplaying()){
+    digitalWrite(pin, val ? LOW : HIGH); // Active low
+  }
+  if(val){
+    cycles_today++;
+  }
+  on = val;
+  changed_at = now;
+}
+
+/**
+ * @brief Takes an input humidity and determines whether the humidifier should turn on or off.
+ * The relay is held in its current state until the minimum on/off time has passed.
+ *
+ * @param humd current indoor humidity
+ * @param indoor current indoor temperature
+ * @param now
+ */
+void Humidity::keep(float humd, deci_celsius indoor, unsigned long now){
+  if(now - day_start >= DAY_MS){
+    cycles_yesterday = cycles_today;
+    cycles_today = 0;
+    day_start = now;
+  }
+  target = safeTarget(indoor, now);
+  if(isnan(humd) || locked){
+    if(on) set(false, now);
+    return;
+  }
+  if(on){
+    if(humd > target + HUMD_BAND && now - changed_at >= HUMD_MIN_ON){
+      set(false, now);
+    }
+  } else {
+    if(humd < target - HUMD_BAND && now - changed_at >= HUMD_MIN_OFF){
+      set(true, now);
+    }
+  }
+}
+
+/**
+ * @brief Start over as if the humidifier had just turned off at now with no outdoor reading,
+ * for a trace replay. Call with it locked off, the pin isn't touched.
+ *
+ * @param now
+ */
+void Humidity::reset(unsigned long now){
+  on = false;
+  changed_at = day_start = now;
+  cycles_today = cycles_yesterday = 0;
+  outdoor = DECI_INVALID;
+  outdoor_at = 0;
+  target = setpoint;
+}
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdarg.h>
+#include "Temperature.h"
+
+#define METRICS_BUFFER 1536
+
+typedef void (*MetricsFlush)(const char *buf, size_t len);
+
+/**
+ * @brief Writes metrics in the Prometheus text format into a buffer allocated once up front.
+ * Nothing is allocated while rendering, when the buffer fills it is handed to the flush
+ * callback (i.e. sent as a chunk of the HTTP response) and reused, so a scrape costs the same
+ * however many metrics there are.
+ *
+ */
+class MetricsWriter {
+  private:
+    char buf[METRICS_BUFFER];
+    size_t n = 0;
+    MetricsFlush out = nullptr;
+    void append(const char *fmt, ...);
+
+  public:
+    void begin(MetricsFlush flush);
+    void family(const char *name, const char *type, const char *help);
+    void sample(const char *name, const char *labels, long value);
+    void sample(const char *name, const char *labels, double value);
+    void temperature(const char *name, const char *labels, deci_celsius value);
+    void finish();
+};
+
+/**
+ * @brief Start a new scrape
+ *
+ * @param flush called with each full buffer
+ */
+void MetricsWriter::begin(MetricsFlush flush){
+  out = flush;
+  n = 0;
+}
+
+/**
+ * @brief printf onto the end of the buffer, flushing first if it doesn't fit
+ *
+ * @param fmt
+ * @param ...
+ */
+void MetricsWriter::append(const char *fmt, ...){
+  va_list args;
+  for(int attempt = 0; attempt < 2; attempt++){
+    va_start(args, fmt);
+    int len = vsnprintf(buf + n, sizeof(buf) - n, fmt, args);
+    va_end(args);
+    if(len >= 0 && n + len < sizeof(buf)){
+      n += len;
+      return;
+    }
+    // Didn't fit, send what's there and try again on an empty buffer
+    buf[n] = '\0';
+    if(out && n) out(buf, n);
+    n = 0;
+  }
+}
+
+/**
+ * @brief The HELP and TYPE lines for a metric
+ *
+ * @param name
+ * @param type gauge, counter or histogram
+ * @param help
+ */
+void MetricsWriter::family(const char *name, const char *type, const char *help){
+  append("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+/**
+ * @brief A sample with a whole number value
+ *
+ * @param name
+ * @param labels i.e. relay="heat", or empty
+ * @param value
+ */
+void MetricsWriter::sample(const char *name, const char *labels, long value){
+  append(labels[0] ? "%s{%s} %ld\n" : "%s%s %ld\n", name, labels, value);
+}
+
+/**
+ * @brief A sample with a decimal value, NaN is written the way Prometheus expects
+ *
+ * @param name
+ * @param labels
+ * @param value
+ */
+void MetricsWriter::sample(const char *name, const char *labels, double value){
+  if(isnan(value)){
+    append(labels[0] ? "%s{%s} NaN\n" : "%s%s NaN\n", name, labels);
+    return;
+  }
+  append(labels[0] ? "%s{%s} %.3f\n" : "%s%s %.3f\n", name, labels, value);
+}
+
+/**
+ * @brief A temperature sample in degrees, a failed reading is NaN
+ *
+ * @param name
+ * @param labels
+ * @param value
+ */
+void MetricsWriter::temperature(const char *name, const char *labels, deci_celsius value){
+  char temp_buf[8];
+  append(labels[0] ? "%s{%s} %s\n" : "%s%s %s\n", name, labels, isValid(value) ? formatDeci(temp_buf, value) : "NaN");
+}
+
+/**
+ * @brief Send whatever is left in the buffer
+ *
+ */
+void MetricsWriter::finish(){
+  if(out && n){
+    buf[n] = '\0';
+    out(buf, n);
+  }
+  n = 0;
+}
+
+#endif
@@ -0,0 +1,259 @@
+#ifndef OCCUPANCY_H
+#define OCCUPANCY_H
+
+#include <Preferences.h>
+#include "Temperature.h"
+#include "Clock.h"
+#include "Trace.h"
+
+#define OCC_BUCKET_MINUTES 15
+#define OCC_BUCKETS 672            // 15 minute buckets in a week
+#define OCC_RATE 3                 // Each week moves a bucket 1/8 of the way to what was seen
+#define OCC_LIKELY 128             // Score at which a bucket is expected to be occupied
+#define OCC_EMPTY_AFTER 1800000    // No presence anywhere for 30 minutes and the house is empty
+#define OCC_PREWARM 2              // Buckets ahead to look for an arrival, 30 minutes to warm up
+#define OCC_SAVE_BUCKETS 96        // Save what's been learned once a day
+#define SETBACK deci(3, 0)         // Heating is lowered (cooling raised) this much while empty
+
+/**
+ * @brief Where the current bucket has got to, the learned scores aren't part of it
+ *
+ */
+struct OccupancyState {
+  uint8_t current;
+  int bucket;
+  unsigned long updated_at;
+  unsigned long setback_ms;
+  boolean setback;
+};
+
+/**
+ * @brief Learns when the house is usually occupied from the presence reported by the room
+ * modules, and sets the temperature back while nobody is home.
+ *
+ * The week is split into 15 minute buckets. Each bucket keeps a bitset of the rooms that saw
+ * someone the last time it came round, and a score (0-255) of how likely the house is to be
+ * occupied then. The score decays towards what was seen each week, so the schedule it learns
+ * follows changes in routine over a few weeks.
+ *
+ * Setback only starts once the house has been empty for a while and no arrival is expected
+ * in the next OCC_PREWARM buckets, so it is back at temperature before people usually get home.
+ *
+ */
+class Occupancy {
+  private:
+    uint8_t seen[OCC_BUCKETS];
+    uint8_t score[OCC_BUCKETS];
+    uint8_t current = 0;          // Rooms seen so far in this bucket
+    int bucket = -1;
+    unsigned long presence_at = 0;
+    unsigned long updated_at = 0;
+    unsigned long setback_ms = 0;
+    boolean has_sensors = false;
+    boolean enabled = true;
+    boolean setback = false;
+    uint16_t unsaved = 0;
+    Preferences *prefs = nullptr;
+    void learn(int b);
+
+  public:
+    void begin(Preferences &preferences);
+    void presence(uint8_t room, unsigned long now);
+    void reset(unsigned long now);
+    void getState(OccupancyState &out);
+    void setState(const OccupancyState &state);
+    boolean update(int minute_of_week, unsigned long now);
+    boolean getSetback();
+    boolean getEmpty(unsigned long now);
+    boolean getEnabled();
+    void setEnabled(boolean val);
+    uint8_t getScore(int b);
+    uint8_t getSeen(int b);
+    uint32_t getSetbackMinutes();
+};
+
+/**
+ * @brief Load the learned scores. With nothing learned yet every bucket starts out as
+ * expected occupied, so there's no setback until the house has been watched for a while.
+ *
+ * @param preferences
+ */
+void Occupancy::begin(Preferences &preferences){
+  prefs = &preferences;
+  memset(seen, 0, sizeof(seen));
+  if(prefs->getBytesLength("Occupancy") != sizeof(score) ||
+     prefs->getBytes("Occupancy", score, sizeof(score)) != sizeof(score)){
+    memset(score, OCC_LIKELY, sizeof(score));
+  }
+  enabled = prefs->getBool("OccEnabled", true);
+}
+
+/**
+ * @brief A room module saw someone
+ *
+ * @param room index of the room, from Rooms
+ * @param now
+ */
+void Occupancy::presence(uint8_t room, unsigned long now){
+  // The first seven rooms get a bit each, the rest share the last one
+  current |= 1 << min(room, (uint8_t)7);
+  presence_at = now;
+  has_sensors = true;
+}
+
+/**
+ * @brief Forget what has been seen since boot, as if no room had reported yet, for a trace
+ * replay. The learned scores are kept.
+ *
+ * @param now
+ */
+void Occupancy::reset(unsigned long now){
+  bucket = -1;
+  current = 0;
+  has_sensors = false;
+  setback = false;
+  presence_at = updated_at = now;
+}
+
+/**
+ * @brief Copy out the current bucket
+ *
+ * @param out
+ */
+void Occupancy::getState(OccupancyState &out){
+  out = {current, bucket, updated_at, setback_ms, setback};
+}
+
+/**
+ * @brief Put back what getState() copied out
+ *
+ * @param state
+ */
+void Occupancy::setState(const OccupancyState &state){
+  current = state.current;
+  bucket = state.bucket;
+  updated_at = state.updated_at;
+  setback_ms = state.setback_ms;
+  setback = state.setback;
+}
+
+/**
+ * @brief Move a finished bucket's score towards what was seen in it
+ *
+ * @param b
+ */
+void Occupancy::learn(int b){
+  seen[b] = current;
+  int s = score[b];
+  s += ((current ? 255 : 0) - s) >> OCC_RATE;
+  score[b] = s;
+  if(++unsaved >= OCC_SAVE_BUCKETS && prefs){
+    prefs->putBytes("Occupancy", score, sizeof(score));
+    unsaved = 0;
+  }
+}
+
+/**
+ * @brief Call with the time regularly. Learns each bucket as it ends and decides whether
+ * the house should be set back.
+ *
+ * @param minute_of_week minutes since Sunday 00:00
+ * @param now
+ * @return boolean true if setback started or stopped
+ */
+boolean Occupancy::update(int minute_of_week, unsigned long now){
+  int b = (minute_of_week / OCC_BUCKET_MINUTES) % OCC_BUCKETS;
+  if(b != bucket){
+    // Nothing is learned from buckets before any room has reported, or on a simulated clock
+    if(bucket >= 0 && has_sensors && !replay_clock.active){
+      learn(bucket);
+    }
+    bucket = b;
+    current = 0;
+  }
+  if(setback){
+    setback_ms += now - updated_at;
+  }
+  updated_at = now;
+
+  boolean arriving = false;
+  for(int k = 1; k <= OCC_PREWARM; k++){
+    if(score[(b + k) % OCC_BUCKETS] >= OCC_LIKELY) arriving = true;
+  }
+  boolean want = enabled && getEmpty(now) && !arriving;
+  if(want == setback){
+    return false;
+  }
+  setback = want;
+  return true;
+}
+
+/**
+ * @brief Whether the temperature is set back right now
+ *
+ * @return boolean
+ */
+boolean Occupancy::getSetback(){
+  return setback;
+}
+
+/**
+ * @brief Whether the house looks empty, always false without any presence sensors
+ *
+ * @param now
+ * @return boolean
+ */
+boolean Occupancy::getEmpty(unsigned long now){
+  return has_sensors && now - presence_at >= OCC_EMPTY_AFTER;
+}
+
+/**
+ * @brief Returns whether occupancy setback is turned on
+ *
+ * @return boolean
+ */
+boolean Occupancy::getEnabled(){
+  return enabled;
+}
+
+/**
+ * @brief Turn occupancy setback on or off, learning carries on either way
+ *
+ * @param val
+ */
+void Occupancy::setEnabled(boolean val){
+  enabled = val;
+  if(prefs && !traceReplaying()) prefs->putBool("OccEnabled", val);
+}
+
+/**
+ * @brief Returns the learned score of a bucket
+ *
+ * @param b
+ * @return uint8_t 0 never occupied to 255 always
+ */
+uint8_t Occupancy::getScore(int b){
+  return score[b % OCC_BUCKETS];
+}
+
+/**
+ * @brief Returns the rooms seen in a bucket the last time it came round, one bit per room
+ * with bit 7 standing for the eighth room onwards
+ *
+ * @param b
+ * @return uint8_t
+ */
+uint8_t Occupancy::getSeen(int b){
+  return seen[b % OCC_BUCKETS];
+}
+
+/**
+ * @brief Minutes spent set back since boot, a rough measure of what it is saving
+ *
+ * @return uint32_t
+ */
+uint32_t Occupancy::getSetbackMinutes(){
+  return setback_ms / 60000;
+}
+
+#endif
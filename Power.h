@@ -0,0 +1,330 @@
+#ifndef POWER_H
+#define POWER_H
+
+#include "esp_pm.h"
+#include "esp_sleep.h"
+#include "driver/gpio.h"
+#include "soc/gpio_struct.h"
+#include "Backlight.h"
+
+#define TOUCH_INT 39               // FT6336 interrupt on the WT32-SC01, low while touched
+#define POWER_DIM_AFTER 60000      // No touch for a minute and the backlight dims
+#define POWER_OFF_AFTER 300000     // Five minutes and the screen goes off
+#define POWER_MAX_SLEEP 2000       // Longest the loop sleeps in one go
+#define POWER_WAKE_FADE 150        // Backlight fade on a touch, ms
+#define POWER_IDLE_FADE 1000       // Backlight fade going dim or off
+
+// Rough board current in each state, only used to estimate the average. Measure your own
+// board at the USB input and put the numbers here.
+#define POWER_MA_ON 180
+#define POWER_MA_DIM 110
+#define POWER_MA_OFF 70            // Screen off, CPU running
+#define POWER_MA_ASLEEP 25         // Screen off, light sleep between WiFi beacons
+
+enum PowerState : uint8_t { POWER_ON, POWER_DIM, POWER_OFF };
+
+const char* const power_names[3] = {"on", "dimmed", "off"};
+
+volatile uint32_t touch_int_us = 0;
+TaskHandle_t power_task = nullptr;
+
+/**
+ * @brief The touch controller pulled its interrupt low. Wakes the chip out of light sleep and
+ * the loop out of Power::sleep(). It is a level interrupt (the only kind that wakes from light
+ * sleep) so it disarms itself, a held finger would keep it firing.
+ *
+ * @param arg
+ */
+void IRAM_ATTR touchWake(void *arg){
+  GPIO.pin[TOUCH_INT].int_ena = 0;
+  touch_int_us = micros();
+  BaseType_t woken = pdFALSE;
+  if(power_task) vTaskNotifyGiveFromISR(power_task, &woken);
+  if(woken) portYIELD_FROM_ISR();
+}
+
+/**
+ * @brief Idle power management. The backlight dims after a minute without a touch and goes off
+ * after five, once it is off nothing is drawn and the loop sleeps between ticks and scheduled
+ * events. A touch wakes it straight away.
+ *
+ * Sleeping is waiting on a task notification with the CPU frequency lock let go, so with
+ * power management and tickless idle in the build the chip drops into automatic light sleep.
+ * That keeps the WiFi associated (it wakes for the beacons) where a forced light sleep would
+ * drop it. Without them the wait still idles the CPU.
+ *
+ */
+class Power {
+  private:
+    PowerState state = POWER_ON;
+    unsigned long touched_at = 0;
+    unsigned long changed_at = 0;
+    uint64_t state_ms[3] = {0, 0, 0};
+    uint64_t asleep_ms = 0;
+    uint32_t wakes = 0;
+    uint32_t woke_us = 0;
+    uint32_t latency = 0;
+    uint32_t latency_max = 0;
+    boolean waking = false;
+    boolean light_sleep = false;
+#if CONFIG_PM_ENABLE
+    esp_pm_lock_handle_t awake_lock = nullptr;
+#endif
+    void enter(PowerState s, unsigned long now);
+    void times(uint64_t ms[3], unsigned long now);
+
+  public:
+    void begin(unsigned long now);
+    boolean touch(unsigned long now);
+    boolean update(unsigned long now);
+    void sleep(unsigned long ms);
+    void frameDrawn();
+    PowerState getState();
+    boolean getScreenOn();
+    boolean getLightSleep();
+    uint32_t getAverageMa(unsigned long now);
+    uint64_t getAsleepMs();
+    uint32_t getLatency();
+    uint32_t getLatencyMax();
+    void report(Print &out, unsigned long now);
+};
+
+Power power;
+
+/**
+ * @brief Call from setup(), the loop task is the one woken by a touch. Turns on automatic
+ * light sleep if the build supports it and holds the CPU at full speed while the loop runs.
+ *
+ * @param now
+ */
+void Power::begin(unsigned long now){
+  touched_at = changed_at = now;
+  power_task = xTaskGetCurrentTaskHandle();
+
+  gpio_set_direction((gpio_num_t)TOUCH_INT, GPIO_MODE_INPUT);
+  gpio_set_intr_type((gpio_num_t)TOUCH_INT, GPIO_INTR_LOW_LEVEL);
+  gpio_install_isr_service(0);
+  gpio_isr_handler_add((gpio_num_t)TOUCH_INT, touchWake, nullptr);
+  gpio_intr_disable((gpio_num_t)TOUCH_INT);
+  esp_sleep_enable_gpio_wakeup();
+
+#if CONFIG_PM_ENABLE
+  esp_pm_config_esp32_t pm = {};
+  pm.max_freq_mhz = getCpuFrequencyMhz();
+  pm.min_freq_mhz = 80;
+  pm.light_sleep_enable = true;
+  light_sleep = esp_pm_configure(&pm) == ESP_OK;
+  if(!light_sleep){
+    // No tickless idle, frequency scaling alone
+    pm.light_sleep_enable = false;
+    esp_pm_configure(&pm);
+  }
+  esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "loop", &awake_lock);
+  esp_pm_lock_acquire(awake_lock);
+#endif
+}
+
+/**
+ * @brief Move to another state and set the backlight to match
+ *
+ * @param s
+ * @param now
+ */
+void Power::enter(PowerState s, unsigned long now){
+  state_ms[state] += now - changed_at;
+  changed_at = now;
+  state = s;
+  backlight.limit(s == POWER_ON ? BL_FULL : s == POWER_DIM ? BL_DIM : 0, s == POWER_ON ? POWER_WAKE_FADE : POWER_IDLE_FADE);
+}
+
+/**
+ * @brief The screen was touched
+ *
+ * @param now
+ * @return boolean true if the screen was off, the touch only wakes it and the caller has to
+ * draw it again then call frameDrawn()
+ */
+boolean Power::touch(unsigned long now){
+  touched_at = now;
+  if(state == POWER_ON){
+    return false;
+  }
+  boolean was_off = state == POWER_OFF;
+  enter(POWER_ON, now);
+  if(was_off){
+    // Time from the interrupt if it fired, otherwise from when the touch was noticed
+    uint32_t at = touch_int_us;
+    touch_int_us = 0;
+    woke_us = at ? at : micros();
+    waking = true;
+    wakes++;
+  }
+  return was_off;
+}
+
+/**
+ * @brief Dim and turn off the screen once it has been left alone long enough
+ *
+ * @param now
+ * @return boolean true if the state changed
+ */
+boolean Power::update(unsigned long now){
+  unsigned long idle = now - touched_at;
+  PowerState want = idle >= POWER_OFF_AFTER ? POWER_OFF : idle >= POWER_DIM_AFTER ? POWER_DIM : POWER_ON;
+  if(want == state || want < state){
+    // Only touch() brightens it again
+    return false;
+  }
+  enter(want, now);
+  return true;
+}
+
+/**
+ * @brief Block the loop for up to ms, returning early if the screen is touched. Does nothing
+ * unless the screen is off.
+ *
+ * @param ms until the next tick or scheduled event
+ */
+void Power::sleep(unsigned long ms){
+  // The LEDC clock stops in light sleep, so wait for the backlight to finish fading out
+  if(state != POWER_OFF || ms == 0 || backlight.getDuty() != 0 || gpio_get_level((gpio_num_t)TOUCH_INT) == 0){
+    return;
+  }
+  unsigned long started = millis();
+  touch_int_us = 0;
+  ulTaskNotifyTake(pdTRUE, 0);
+  gpio_wakeup_enable((gpio_num_t)TOUCH_INT, GPIO_INTR_LOW_LEVEL);
+  gpio_intr_enable((gpio_num_t)TOUCH_INT);
+#if CONFIG_PM_ENABLE
+  esp_pm_lock_release(awake_lock);
+#endif
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(min(ms, (unsigned long)POWER_MAX_SLEEP)));
+#if CONFIG_PM_ENABLE
+  esp_pm_lock_acquire(awake_lock);
+#endif
+  gpio_intr_disable((gpio_num_t)TOUCH_INT);
+  gpio_wakeup_disable((gpio_num_t)TOUCH_INT);
+  asleep_ms += millis() - started;
+}
+
+/**
+ * @brief The first frame after waking is on the screen, records how long waking took
+ *
+ */
+void Power::frameDrawn(){
+  if(!waking){
+    return;
+  }
+  waking = false;
+  latency = micros() - woke_us;
+  if(latency > latency_max) latency_max = latency;
+}
+
+/**
+ * @brief Returns the current state
+ *
+ * @return PowerState
+ */
+PowerState Power::getState(){
+  return state;
+}
+
+/**
+ * @brief Whether anything on the screen can be seen, nothing needs drawing when it can't
+ *
+ * @return boolean
+ */
+boolean Power::getScreenOn(){
+  return state != POWER_OFF;
+}
+
+/**
+ * @brief Whether the build has automatic light sleep, without it sleeping only idles the CPU
+ *
+ * @return boolean
+ */
+boolean Power::getLightSleep(){
+  return light_sleep;
+}
+
+/**
+ * @brief Time spent in each state since boot, up to now
+ *
+ * @param ms
+ * @param now
+ */
+void Power::times(uint64_t ms[3], unsigned long now){
+  for(int s = 0; s < 3; s++){
+    ms[s] = state_ms[s];
+  }
+  ms[state] += now - changed_at;
+}
+
+/**
+ * @brief Average current since boot, estimated from the time spent in each state and the
+ * POWER_MA_ figures
+ *
+ * @param now
+ * @return uint32_t milliamps
+ */
+uint32_t Power::getAverageMa(unsigned long now){
+  uint64_t ms[3];
+  times(ms, now);
+  uint64_t total = ms[POWER_ON] + ms[POWER_DIM] + ms[POWER_OFF];
+  if(!total){
+    return POWER_MA_ON;
+  }
+  uint64_t asleep = light_sleep ? min(asleep_ms, ms[POWER_OFF]) : 0;
+  uint64_t charge = ms[POWER_ON] * POWER_MA_ON + ms[POWER_DIM] * POWER_MA_DIM +
+    (ms[POWER_OFF] - asleep) * POWER_MA_OFF + asleep * POWER_MA_ASLEEP;
+  return charge / total;
+}
+
+/**
+ * @brief Time the loop has spent asleep since boot
+ *
+ * @return uint64_t milliseconds
+ */
+uint64_t Power::getAsleepMs(){
+  return asleep_ms;
+}
+
+/**
+ * @brief Time from the last wake up touch to the screen being drawn
+ *
+ * @return uint32_t microseconds
+ */
+uint32_t Power::getLatency(){
+  return latency;
+}
+
+/**
+ * @brief Longest wake up since boot
+ *
+ * @return uint32_t microseconds
+ */
+uint32_t Power::getLatencyMax(){
+  return latency_max;
+}
+
+/**
+ * @brief Print the time in each state, the estimated average current and the wake up times
+ *
+ * @param out
+ * @param now
+ */
+void Power::report(Print &out, unsigned long now){
+  uint64_t ms[3];
+  times(ms, now);
+  uint64_t total = max(ms[POWER_ON] + ms[POWER_DIM] + ms[POWER_OFF], (uint64_t)1);
+  out.printf("screen %s, light sleep %s\n", power_names[state], light_sleep ? "on" : "not in this build");
+  for(int s = 0; s < 3; s++){
+    out.printf("%-8s %10lu s %5.1f%%\n", power_names[s], (unsigned long)(ms[s] / 1000), ms[s] * 100.0 / total);
+  }
+  out.printf("%-8s %10lu s %5.1f%%\n", "asleep", (unsigned long)(asleep_ms / 1000), asleep_ms * 100.0 / total);
+  out.printf("average  %lu mA (estimated)\n", (unsigned long)getAverageMa(now));
+  out.printf("wakes    %lu, to first frame %lu us, max %lu us\n", (unsigned long)wakes,
+    (unsigned long)latency, (unsigned long)latency_max);
+}
+
+#endif
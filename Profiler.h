@@ -0,0 +1,237 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#define PROF_BUCKETS 88   // 4 buckets per power of two up to ~8 seconds
+
+/**
+ * Everything that gets timed. Add the name to prof_names in the same order.
+ */
+enum ProfSection : uint8_t {
+  PROF_LOOP, PROF_DHT, PROF_TIME, PROF_SCHEDULE, PROF_TEMPERATURE, PROF_WIFI, PROF_HTTP, PROF_TOUCH,
+  PROF_DRAW_MAIN, PROF_DRAW_ROOMS, PROF_DRAW_SCHEDULE, PROF_DRAW_SETTINGS, PROF_DRAW_MENU,
+  PROF_DRAW_WIFI, PROF_DRAW_TIME, PROF_DRAW_DHT_TEMP, PROF_DRAW_DHT_HUMD, PROF_DRAW_GOAL_TEMP,
+  PROF_DRAW_GOAL_HUMD, PROF_DRAW_NOTICE,
+  PROF_SECTIONS
+};
+
+const char* const prof_names[PROF_SECTIONS] = {
+  "loop", "dht", "time", "checkSchedule", "keepTemperature", "checkWifi", "http", "touch",
+  "draw.main", "draw.rooms", "draw.schedule", "draw.settings", "draw.navBar",
+  "draw.wifi", "draw.time", "draw.dhtTemp", "draw.dhtHumd", "draw.goalTemp",
+  "draw.goalHumd", "draw.notice"
+};
+
+/**
+ * @brief Fixed size histogram of durations in microseconds. Buckets are 4 to each power of two
+ * so percentiles come out within 25%, the maximum is kept exactly.
+ *
+ */
+struct ProfHistogram {
+  uint32_t buckets[PROF_BUCKETS];
+  uint32_t count;
+  uint32_t max;
+  uint64_t total;
+};
+
+/**
+ * @brief Times sections of the firmware with the CPU cycle counter. Recording a time is a
+ * cycle count read at each end, a division and a bucket increment, cheap enough to leave
+ * in around every draw call.
+ *
+ */
+class Profiler {
+  private:
+    ProfHistogram hist[PROF_SECTIONS];
+    uint32_t mhz = 240;
+    uint8_t bucketOf(uint32_t us);
+    uint32_t bucketTop(uint8_t b);
+
+  public:
+    void begin();
+    void reset();
+    void record(ProfSection s, uint32_t cycles);
+    uint32_t percentile(ProfSection s, uint8_t p);
+    uint32_t countUpTo(ProfSection s, uint32_t us);
+    uint64_t getTotal(ProfSection s);
+    uint32_t getMax(ProfSection s);
+    uint32_t getMean(ProfSection s);
+    uint32_t getCount(ProfSection s);
+    void report(Print &out);
+};
+
+Profiler profiler;
+
+/**
+ * @brief Records the time from construction to the end of the scope
+ *
+ */
+class ProfileScope {
+  private:
+    uint32_t start;
+    ProfSection section;
+  public:
+    ProfileScope(ProfSection s) : start(ESP.getCycleCount()), section(s){}
+    ~ProfileScope(){ profiler.record(section, ESP.getCycleCount() - start); }
+};
+
+// Time the rest of the enclosing scope, define NO_PROFILE to compile the timers out
+#ifdef NO_PROFILE
+#define PROFILE(section)
+#else
+#define PROFILE(section) ProfileScope prof_scope_(section)
+#endif
+
+/**
+ * @brief Reads the CPU clock used to turn cycles into microseconds
+ *
+ */
+void Profiler::begin(){
+  mhz = getCpuFrequencyMhz();
+  reset();
+}
+
+/**
+ * @brief Clear all the histograms
+ *
+ */
+void Profiler::reset(){
+  memset(hist, 0, sizeof(hist));
+}
+
+/**
+ * @brief The bucket a duration falls in, exact below 4us
+ *
+ * @param us
+ * @return uint8_t
+ */
+uint8_t Profiler::bucketOf(uint32_t us){
+  if(us < 4){
+    return us;
+  }
+  int msb = 31 - __builtin_clz(us);
+  int b = ((msb - 1) * 4) + ((us >> (msb - 2)) & 3);
+  return b < PROF_BUCKETS ? b : PROF_BUCKETS - 1;
+}
+
+/**
+ * @brief The largest duration that falls in a bucket
+ *
+ * @param b
+ * @return uint32_t
+ */
+uint32_t Profiler::bucketTop(uint8_t b){
+  if(b < 4){
+    return b;
+  }
+  int shift = (b / 4) - 1;
+  return (((4 + (b % 4)) << shift) + (1 << shift)) - 1;
+}
+
+/**
+ * @brief Add a duration
+ *
+ * @param s
+ * @param cycles
+ */
+void Profiler::record(ProfSection s, uint32_t cycles){
+  ProfHistogram &h = hist[s];
+  uint32_t us = cycles / mhz;
+  h.buckets[bucketOf(us)]++;
+  h.count++;
+  h.total += us;
+  if(us > h.max) h.max = us;
+}
+
+/**
+ * @brief Approximate percentile, the top of the bucket it lands in
+ *
+ * @param s
+ * @param p 1 to 100
+ * @return uint32_t microseconds
+ */
+uint32_t Profiler::percentile(ProfSection s, uint8_t p){
+  ProfHistogram &h = hist[s];
+  uint32_t want = (((uint64_t)h.count * p) + 99) / 100;
+  uint32_t seen = 0;
+  for(int i = 0; i < PROF_BUCKETS; i++){
+    seen += h.buckets[i];
+    if(seen >= want && seen > 0){
+      return min(bucketTop(i), h.max);
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief Number of times recorded in buckets that are entirely at or under us, for
+ * cumulative histogram buckets
+ *
+ * @param s
+ * @param us
+ * @return uint32_t
+ */
+uint32_t Profiler::countUpTo(ProfSection s, uint32_t us){
+  uint32_t n = 0;
+  for(int i = 0; i < PROF_BUCKETS && bucketTop(i) <= us; i++){
+    n += hist[s].buckets[i];
+  }
+  return n;
+}
+
+/**
+ * @brief Sum of every time recorded
+ *
+ * @param s
+ * @return uint64_t microseconds
+ */
+uint64_t Profiler::getTotal(ProfSection s){
+  return hist[s].total;
+}
+
+/**
+ * @brief Longest time recorded
+ *
+ * @param s
+ * @return uint32_t microseconds
+ */
+uint32_t Profiler::getMax(ProfSection s){
+  return hist[s].max;
+}
+
+/**
+ * @brief Average time
+ *
+ * @param s
+ * @return uint32_t microseconds
+ */
+uint32_t Profiler::getMean(ProfSection s){
+  return hist[s].count ? hist[s].total / hist[s].count : 0;
+}
+
+/**
+ * @brief Number of times recorded
+ *
+ * @param s
+ * @return uint32_t
+ */
+uint32_t Profiler::getCount(ProfSection s){
+  return hist[s].count;
+}
+
+/**
+ * @brief Print a table of every section that has run, times in microseconds
+ *
+ * @param out
+ */
+void Profiler::report(Print &out){
+  out.printf("%-16s %8s %8s %8s %8s %8s\n", "section", "count", "mean", "p50", "p99", "max");
+  for(int s = 0; s < PROF_SECTIONS; s++){
+    ProfSection sec = (ProfSection)s;
+    if(!hist[s].count) continue;
+    out.printf("%-16s %8lu %8lu %8lu %8lu %8lu\n", prof_names[s], (unsigned long)getCount(sec),
+      (unsigned long)getMean(sec), (unsigned long)percentile(sec, 50), (unsigned long)percentile(sec, 99),
+      (unsigned long)getMax(sec));
+  }
+}
+
+#endif
@@ -0,0 +1,412 @@
+#ifndef RELAY_H
+#define RELAY_H
+
+#include <Preferences.h>
+#include "Event_Log.h"
+#include "Trace.h"
+
+#define RELAY_MAX_STARTS 8          // Size of the start history, upper bound for cycles per hour
+#define RELAY_HOUR 3600000
+#define RELAY_DAY 86400000
+#define RELAY_STALE_SENSOR 600000   // Shut off if the controlling sensor hasn't reported in 10 minutes
+#define RELAY_PERSIST 900000        // Write runtime totals to flash every 15 minutes
+
+/**
+ * @brief Minimum/maximum times for one piece of equipment, all in milliseconds
+ *
+ */
+struct RelayLimits {
+  unsigned long min_on;
+  unsigned long min_off;
+  unsigned long max_run;
+  uint8_t max_starts_hour;
+};
+
+#define NOPIN -1
+
+/**
+ * @brief Safety governor for an active low relay. The controller only requests a state,
+ * the governor decides when the relay actually switches so that equipment is never short
+ * cycled, no matter how often the control loop runs.
+ *
+ * Also keeps track of runtime and starts for the day and since first boot, the totals are
+ * persisted periodically so they survive restarts.
+ *
+ */
+class Relay {
+  private:
+    int pin;
+    const char *key;
+    RelayLimits limits;
+    Preferences prefs;
+    boolean on = false;
+    boolean requested = false;
+    boolean failsafe = false;
+    boolean locked = false;
+    unsigned long changed_at = 0;
+    unsigned long sensor_at = 0;
+    unsigned long updated_at = 0;
+    unsigned long persisted_at = 0;
+    unsigned long day_start = 0;
+    unsigned long starts[RELAY_MAX_STARTS];
+    uint8_t start_count = 0;
+    uint8_t start_idx = 0;
+
+    // Accounting
+    unsigned long runtime_today = 0;  // ms
+    uint16_t cycles_today = 0;
+    unsigned long runtime_yesterday = 0;
+    uint16_t cycles_yesterday = 0;
+    uint32_t runtime_total = 0;       // seconds
+    uint32_t cycles_total = 0;
+    unsigned long runtime_unsaved = 0; // ms not yet added to runtime_total
+
+    void set(boolean val, unsigned long now);
+    boolean canStart(unsigned long now);
+    void account(unsigned long now);
+    void persist();
+
+  public:
+    Relay(int relayPin, const char *name, RelayLimits relayLimits);
+    void begin();
+    void request(boolean val, unsigned long now);
+    void sensorOk(unsigned long now);
+    void lock(boolean val, unsigned long now);
+    void update(unsigned long now);
+    void reset(unsigned long now);
+
+    boolean installed();
+    const char* getName();
+    boolean getOn();
+    boolean getRequested();
+    boolean getFailsafe();
+    unsigned long getSensorAt();
+    unsigned long getRuntimeToday();
+    uint16_t getCyclesToday();
+    unsigned long getRuntimeYesterday();
+    uint16_t getCyclesYesterday();
+    uint32_t getRuntimeTotal();
+    uint32_t getCyclesTotal();
+};
+
+/**
+ * @brief Construct a new Relay:: Relay object
+ *
+ * @param relayPin
+ * @param name short name used for the keys in preferences, must be unique per relay
+ * @param relayLimits
+ */
+Relay::Relay(int relayPin, const char *name, RelayLimits relayLimits){
+  pin = relayPin;
+  key = name;
+  limits = relayLimits;
+}
+
+/**
+ * @brief Turns the relay off and loads the runtime totals from preferences.
+ * The relay starts out as if it had just turned off so the minimum off time
+ * protects against a quick restart.
+ *
+ */
+void Relay::begin(){
+  if(!installed()){
+    return;
+  }
+  pinMode(pin, OUTPUT);
+  digitalWrite(pin, HIGH);
+  unsigned long now = clockMillis();
+  changed_at = now;
+  sensor_at = now;
+  updated_at = now;
+  persisted_at = now;
+  day_start = now;
+
+  prefs.begin("relay", false);
+  char k[16];
+  snprintf(k, sizeof(k), "%s_rt", key);
+  runtime_total = prefs.getUInt(k, 0);
+  snprintf(k, sizeof(k), "%s_cy", key);
+  cycles_total = prefs.getUInt(k, 0);
+}
+
+/**
+ * @brief Ask for the relay to be on or off, the change happens as soon as the limits allow it
+ *
+ * @param val
+ * @param now
+ */
+void Relay::request(boolean val, unsigned long now){
+  requested = val;
+  update(now);
+}
+
+/**
+ * @brief Called whenever the sensor controlling this relay gives a valid reading
+ *
+ * @param now
+ */
+void Relay::sensorOk(unsigned long now){
+  sensor_at = now;
+}
+
+/**
+ * @brief Force the relay off and keep it off regardless of requests, i.e. while updating firmware
+ *
+ * @param val
+ * @param now
+ */
+void Relay::lock(boolean val, unsigned long now){
+  locked = val;
+  update(now);
+}
+
+/**
+ * @brief Whether a start is allowed by the minimum off time and starts per hour
+ *
+ * @param now
+ * @return boolean
+ */
+boolean Relay::canStart(unsigned long now){
+  if(now - changed_at < limits.min_off){
+    return false;
+  }
+  // The oldest start we remember has to be over an hour old once we've hit the limit
+  uint8_t allowed = min(limits.max_starts_hour, (uint8_t)RELAY_MAX_STARTS);
+  if(start_count >= allowed){
+    uint8_t oldest = (start_idx + RELAY_MAX_STARTS - allowed) % RELAY_MAX_STARTS;
+    if(now - starts[oldest] < RELAY_HOUR){
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Switches the relay and records the start
+ *
+ * @param val
+ * @param now
+ */
+void Relay::set(boolean val, unsigned long now){
+  account(now);
+  logEvent(LOG_RELAY, pin, val);
+  trace.decision(pin, val, now);
+  // A trace replay makes the decisions without switching anything
+  if(!traceReplaying()){
+    digitalWrite(pin, val ? LOW : HIGH);
+  }
+  if(val){
+    starts[start_idx] = now;
+    start_idx = (start_idx + 1) % RELAY_MAX_STARTS;
+    if(start_count < RELAY_MAX_STARTS) start_count++;
+    cycles_today++;
+    cycles_total++;
+  }
+  on = val;
+  changed_at = now;
+}
+
+/**
+ * @brief Adds the time since the last update to the runtime counters and rolls the day over
+ *
+ * @param now
+ */
+void Relay::account(unsigned long now){
+  if(on){
+    runtime_today += now - updated_at;
+    runtime_unsaved += now - updated_at;
+  }
+  updated_at = now;
+  if(now - day_start >= RELAY_DAY){
+    runtime_yesterday = runtime_today;
+    cycles_yesterday = cycles_today;
+    runtime_today = 0;
+    cycles_today = 0;
+    day_start = now;
+  }
+}
+
+/**
+ * @brief Write the totals to preferences. Kept infrequent to save the flash.
+ *
+ */
+void Relay::persist(){
+  if(traceReplaying()){
+    return;
+  }
+  runtime_total += runtime_unsaved / 1000;
+  runtime_unsaved %= 1000;
+  char k[16];
+  snprintf(k, sizeof(k), "%s_rt", key);
+  prefs.putUInt(k, runtime_total);
+  snprintf(k, sizeof(k), "%s_cy", key);
+  prefs.putUInt(k, cycles_total);
+}
+
+/**
+ * @brief Applies the requested state within the limits. Should be called regularly, the
+ * maximum runtime and stale sensor checks only happen here.
+ *
+ * Safety cut offs (stale sensor, maximum runtime, lock) ignore the minimum on time.
+ *
+ * @param now
+ */
+void Relay::update(unsigned long now){
+  if(!installed()){
+    return;
+  }
+  account(now);
+  boolean was_failsafe = failsafe;
+  failsafe = now - sensor_at > RELAY_STALE_SENSOR;
+  if(failsafe && !was_failsafe){
+    event_log.fault(FAULT_FAILSAFE, pin);
+  }
+
+  if(on){
+    boolean overrun = now - changed_at >= limits.max_run;
+    if(overrun){
+      event_log.fault(FAULT_OVERRUN, pin);
+    }
+    if(failsafe || locked || overrun){
+      set(false, now);
+    } else if(!requested && now - changed_at >= limits.min_on){
+      set(false, now);
+    }
+  } else if(requested && !failsafe && !locked && canStart(now)){
+    set(true, now);
+  }
+
+  if(now - persisted_at >= RELAY_PERSIST){
+    persist();
+    persisted_at = now;
+  }
+}
+
+/**
+ * @brief Start over as if the relay had just turned off at now, with no starts in the last
+ * hour and a fresh sensor reading. Puts a trace replay on the trace's clock, so nothing from
+ * the real uptime carries into it. Call with the relay locked off, the pin isn't touched.
+ * The totals since first boot are left alone.
+ *
+ * @param now
+ */
+void Relay::reset(unsigned long now){
+  on = false;
+  requested = false;
+  failsafe = false;
+  changed_at = sensor_at = updated_at = persisted_at = day_start = now;
+  start_count = 0;
+  start_idx = 0;
+  runtime_today = runtime_yesterday = 0;
+  cycles_today = cycles_yesterday = 0;
+}
+
+/**
+ * @brief Whether there is a relay wired up, relays constructed with NOPIN never turn on
+ *
+ * @return boolean
+ */
+boolean Relay::installed(){
+  return pin != NOPIN;
+}
+
+/**
+ * @brief Returns the relay's short name
+ *
+ * @return const char*
+ */
+const char* Relay::getName(){
+  return key;
+}
+
+/**
+ * @brief Returns whether the relay is actually on
+ *
+ * @return boolean
+ */
+boolean Relay::getOn(){
+  return on;
+}
+
+/**
+ * @brief Returns when the controlling sensor last reported
+ *
+ * @return unsigned long
+ */
+unsigned long Relay::getSensorAt(){
+  return sensor_at;
+}
+
+/**
+ * @brief Returns the state the controller is asking for
+ *
+ * @return boolean
+ */
+boolean Relay::getRequested(){
+  return requested;
+}
+
+/**
+ * @brief Returns whether the relay is being held off because the sensor went quiet
+ *
+ * @return boolean
+ */
+boolean Relay::getFailsafe(){
+  return failsafe;
+}
+
+/**
+ * @brief Milliseconds the relay has been on in the current 24 hours
+ *
+ * @return unsigned long
+ */
+unsigned long Relay::getRuntimeToday(){
+  return runtime_today;
+}
+
+/**
+ * @brief Starts in the current 24 hours
+ *
+ * @return uint16_t
+ */
+uint16_t Relay::getCyclesToday(){
+  return cycles_today;
+}
+
+/**
+ * @brief Milliseconds the relay was on in the previous 24 hours
+ *
+ * @return unsigned long
+ */
+unsigned long Relay::getRuntimeYesterday(){
+  return runtime_yesterday;
+}
+
+/**
+ * @brief Starts in the previous 24 hours
+ *
+ * @return uint16_t
+ */
+uint16_t Relay::getCyclesYesterday(){
+  return cycles_yesterday;
+}
+
+/**
+ * @brief Seconds the relay has been on since the counters were first created
+ *
+ * @return uint32_t
+ */
+uint32_t Relay::getRuntimeTotal(){
+  return runtime_total + (runtime_unsaved / 1000);
+}
+
+/**
+ * @brief Starts since the counters were first created
+ *
+ * @return uint32_t
+ */
+uint32_t Relay::getCyclesTotal(){
+  return cycles_total;
+}
+
+#endif
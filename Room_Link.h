@@ -0,0 +1,126 @@
+#ifndef ROOM_LINK_H
+#define ROOM_LINK_H
+
+#include <AsyncUDP.h>
+#include "Rooms.h"
+#include "Room_Module/Wire_Format.h"
+
+#define LINK_QUEUE 8               // Reports waiting for the loop
+#define LINK_SAME_MS 5000          // Ages are whole seconds, a reading sent twice can come out a little apart
+
+static_assert(WIRE_NAME_LEN == ROOM_NAME_LEN, "room names are the same length on the wire");
+
+/**
+ * @brief Takes batched reports from the room modules over UDP. Reports are checked and
+ * acked from the network task as they arrive, so a module waiting for its ack isn't held up
+ * by the loop sleeping, and queued for the loop to put into Rooms.
+ *
+ */
+class RoomLink {
+  private:
+    AsyncUDP udp;
+    QueueHandle_t queue = nullptr;
+    uint16_t last_seq[MAX_ROOMS];
+    boolean heard[MAX_ROOMS];
+    uint32_t received = 0;
+    uint32_t duplicates = 0;
+    volatile uint32_t rejected = 0;
+    volatile uint32_t dropped = 0;
+    void packet(AsyncUDPPacket &p);
+
+  public:
+    boolean begin();
+    boolean poll(Rooms &list, unsigned long now);
+    void report(Print &out);
+};
+
+/**
+ * @brief Listen on WIRE_PORT, call once the WiFi is up
+ *
+ * @return boolean false if the port couldn't be opened
+ */
+boolean RoomLink::begin(){
+  memset(heard, 0, sizeof(heard));
+  queue = xQueueCreate(LINK_QUEUE, sizeof(WireReport));
+  if(!udp.listen(WIRE_PORT)){
+    return false;
+  }
+  udp.onPacket([this](AsyncUDPPacket &p){ packet(p); });
+  return true;
+}
+
+/**
+ * @brief A packet came in, runs on the network task. Anything that checks out is acked,
+ * repeats too since it means the last ack was lost, and left for poll() to sort out.
+ *
+ * @param p
+ */
+void RoomLink::packet(AsyncUDPPacket &p){
+  WireReport r;
+  if(!wireOpen(p.data(), p.length(), WIRE_REPORT, r) || r.count == 0 || r.count > WIRE_BATCH){
+    rejected++;
+    return;
+  }
+  if(xQueueSend(queue, &r, 0) != pdTRUE){
+    // No ack, the module keeps it and tries again later
+    dropped++;
+    return;
+  }
+  WireAck ack;
+  wireSeal(ack, WIRE_ACK, r.seq);
+  p.write((const uint8_t*)&ack, sizeof(ack));
+}
+
+/**
+ * @brief Put the queued reports into the rooms, each reading at the time the module took it.
+ * Readings no newer than the room's last are skipped, a module sends them again in its next
+ * report when an ack goes missing.
+ *
+ * @param list
+ * @param now clockMillis()
+ * @return boolean true if any readings were taken
+ */
+boolean RoomLink::poll(Rooms &list, unsigned long now){
+  WireReport r;
+  boolean any = false;
+  while(queue && xQueueReceive(queue, &r, 0) == pdTRUE){
+    char name[ROOM_NAME_LEN];
+    memcpy(name, r.room, ROOM_NAME_LEN - 1);
+    name[ROOM_NAME_LEN - 1] = 0;
+    int room = list.add(name);
+    if(room < 0){
+      continue;
+    }
+    if(heard[room] && last_seq[room] == r.seq){
+      duplicates++;
+      continue;
+    }
+    heard[room] = true;
+    last_seq[room] = r.seq;
+    received++;
+    for(int i = 0; i < r.count; i++){
+      const WireSample &s = r.samples[i];
+      if(s.temp < deci(-40, 0) || s.temp > deci(80, 0)) continue;
+      unsigned long at = now - min((unsigned long)s.ago * 1000, now - 1);
+      if((long)(at - list.get(room)->reading_at) <= LINK_SAME_MS){
+        // Already taken from a report whose ack was lost
+        continue;
+      }
+      list.reading(room, s.temp, s.humd <= 100 ? s.humd : ROOM_UNKNOWN, r.battery <= 100 ? r.battery : ROOM_UNKNOWN, at);
+      any = true;
+    }
+  }
+  return any;
+}
+
+/**
+ * @brief Print the report counts
+ *
+ * @param out
+ */
+void RoomLink::report(Print &out){
+  out.printf("port %u, %lu reports, %lu repeats, %lu bad, %lu dropped\n", WIRE_PORT, (unsigned long)received,
+    (unsigned long)duplicates, (unsigned long)rejected, (unsigned long)dropped);
+}
+
+#endif
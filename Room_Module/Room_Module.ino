@@ -0,0 +1,299 @@
+/**
+ * Room module for the Smart Thermostat. Wakes from deep sleep once a minute to read a DHT22
+ * and keeps the readings in RTC memory. The WiFi is only turned on when a reading has moved
+ * enough to matter, or once a heartbeat, and then the whole batch goes in one UDP report that
+ * is sent again until the thermostat acks it.
+ *
+ * Put a secrets.h next to this file with SSID_NAME and SSID_PASS, the same as the thermostat's.
+ * Define BASE_HOST "192.168.1.50" in it to send straight to the thermostat rather than broadcast.
+ */
+#include "WiFi.h"
+#include "WiFiUdp.h"
+#include "DHT.h"
+#include "esp_sleep.h"
+#include "Wire_Format.h"
+#include "secrets.h"
+
+#define ROOM_NAME "bedroom"        // Up to 15 characters, how the room shows on the thermostat
+#define DHTPIN 4
+#define DHTTYPE DHT22
+#define NOPIN -1
+#define BATTERY_PIN NOPIN          // ADC1 pin on a 2:1 divider from the cell (i.e. 35), NOPIN on mains
+
+#define SAMPLE_EVERY 60000         // ms between readings, asleep in between
+#define HEARTBEAT 1800             // Seconds, a report goes at least this often so the thermostat knows it's alive
+#define CHANGE_TEMP 3              // Tenths of a degree from the last report that is worth sending
+#define CHANGE_HUMD 3              // Percent
+#define WIFI_TIMEOUT 8000          // ms to join before giving up until the next wake
+#define ACK_TIMEOUT 150            // ms for the first ack, longer on each retry
+#define SEND_TRIES 4
+#define SAVED_MAGIC 0x524D4F44
+
+// Rough current in each state, only used for the battery estimate. Measure your own module
+// at the cell and put the numbers here, deep sleep is where nearly all the time goes.
+#define UA_ASLEEP 150              // Deep sleep, the DHT22 idling and the regulator's quiescent current
+#define UA_AWAKE 30000             // Reading the sensor at 80MHz, radio off
+#define UA_RADIO 120000            // Joining and sending
+#define BATTERY_MAH 2000
+
+/**
+ * @brief A reading waiting to be sent
+ *
+ */
+struct Held {
+  int16_t temp;
+  uint8_t humd;
+  uint32_t at;                     // seconds()
+};
+
+/**
+ * @brief Everything kept in RTC memory through deep sleep. Lost when the power goes, the
+ * magic is wrong then and it starts over.
+ *
+ */
+struct Saved {
+  uint32_t magic;
+  uint16_t seq;
+  uint8_t count;
+  Held held[WIRE_BATCH];           // Oldest first
+  boolean reported;                // Something has been acked since power up
+  int16_t sent_temp;               // Newest reading in the last acked report
+  uint8_t sent_humd;
+  uint32_t sent_at;
+  uint8_t misses;                  // Reports in a row that got no ack
+  uint32_t retry_at;
+  uint8_t channel;                 // AP the last join found, 0 to scan
+  uint8_t bssid[6];
+  // For the battery estimate
+  uint32_t wakes;
+  uint32_t sends;
+  uint64_t asleep_ms;
+  uint64_t awake_ms;
+  uint64_t radio_ms;
+};
+
+RTC_DATA_ATTR Saved saved;
+
+DHT dht(DHTPIN, DHTTYPE);
+WiFiUDP udp;
+
+void setup(){
+  setCpuFrequencyMhz(80);
+  Serial.begin(115200);
+  if(saved.magic != SAVED_MAGIC){
+    memset(&saved, 0, sizeof(saved));
+    saved.magic = SAVED_MAGIC;
+    saved.seq = esp_random();
+  }
+  saved.wakes++;
+
+  dht.begin();
+  uint32_t now = seconds();
+  float t = dht.readTemperature();
+  float h = dht.readHumidity();
+  if(t == t){
+    hold((int16_t)lroundf(t * 10), h == h ? (uint8_t)lroundf(h) : WIRE_UNKNOWN, now);
+  }
+  if(due(now)){
+    report(now);
+  }
+  printEstimate();
+  sleepUntilNext();
+}
+
+void loop(){
+  // Never gets here, every wake starts again at setup()
+}
+
+/**
+ * @brief Seconds since power up. The RTC keeps the system time going through deep sleep.
+ *
+ * @return uint32_t
+ */
+uint32_t seconds(){
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  return tv.tv_sec;
+}
+
+/**
+ * @brief Add a reading to the batch, the oldest goes when it's full
+ *
+ * @param temp tenths of a degree
+ * @param humd
+ * @param now
+ */
+void hold(int16_t temp, uint8_t humd, uint32_t now){
+  if(saved.count == WIRE_BATCH){
+    memmove(&saved.held[0], &saved.held[1], (WIRE_BATCH - 1) * sizeof(Held));
+    saved.count--;
+  }
+  saved.held[saved.count++] = {temp, humd, now};
+}
+
+/**
+ * @brief Whether to turn the WiFi on this wake. Only when the newest reading is far enough
+ * from the last one sent or the heartbeat is up, and not before the retry time after a miss.
+ *
+ * @param now
+ * @return boolean
+ */
+boolean due(uint32_t now){
+  if(saved.count == 0){
+    return false;
+  }
+  if(saved.misses && (int32_t)(now - saved.retry_at) < 0){
+    return false;
+  }
+  const Held &last = saved.held[saved.count - 1];
+  boolean humd_moved = last.humd != WIRE_UNKNOWN && saved.sent_humd != WIRE_UNKNOWN &&
+    abs((int)last.humd - saved.sent_humd) >= CHANGE_HUMD;
+  return !saved.reported || saved.misses || abs(last.temp - saved.sent_temp) >= CHANGE_TEMP ||
+    humd_moved || now - saved.sent_at >= HEARTBEAT;
+}
+
+/**
+ * @brief Join the WiFi, on the channel and AP of the last join if there was one which skips
+ * the scan
+ *
+ * @return boolean
+ */
+boolean join(){
+  WiFi.persistent(false);
+  WiFi.mode(WIFI_STA);
+  if(saved.channel){
+    WiFi.begin(SSID_NAME, SSID_PASS, saved.channel, saved.bssid);
+  } else {
+    WiFi.begin(SSID_NAME, SSID_PASS);
+  }
+  unsigned long started = millis();
+  while(WiFi.status() != WL_CONNECTED){
+    if(millis() - started >= WIFI_TIMEOUT){
+      // The AP may have moved channel, scan next time
+      saved.channel = 0;
+      return false;
+    }
+    delay(10);
+  }
+  saved.channel = WiFi.channel();
+  memcpy(saved.bssid, WiFi.BSSID(), sizeof(saved.bssid));
+  return true;
+}
+
+/**
+ * @brief Send the report until it's acked, waiting longer after each try
+ *
+ * @param r sealed
+ * @return boolean true once acked
+ */
+boolean deliver(const WireReport &r){
+  IPAddress base(255, 255, 255, 255);
+#ifdef BASE_HOST
+  base.fromString(BASE_HOST);
+#endif
+  uint8_t buf[sizeof(WireAck)];
+  WireAck ack;
+  udp.begin(WIRE_PORT);
+  for(int i = 0; i < SEND_TRIES; i++){
+    udp.beginPacket(base, WIRE_PORT);
+    udp.write((const uint8_t*)&r, sizeof(r));
+    udp.endPacket();
+    unsigned long sent = millis();
+    while(millis() - sent < ((unsigned long)ACK_TIMEOUT << i)){
+      int len = udp.parsePacket();
+      if(len > 0){
+        len = udp.read(buf, sizeof(buf));
+        if(wireOpen(buf, len, WIRE_ACK, ack) && ack.seq == r.seq){
+          udp.stop();
+          return true;
+        }
+      }
+      delay(2);
+    }
+  }
+  udp.stop();
+  return false;
+}
+
+/**
+ * @brief Battery level from the divider, a lithium cell read as empty at 3.3V and full at 4.2V
+ *
+ * @return uint8_t percent, WIRE_UNKNOWN without a battery pin
+ */
+uint8_t battery(){
+  if(BATTERY_PIN == NOPIN){
+    return WIRE_UNKNOWN;
+  }
+  int mv = analogReadMilliVolts(BATTERY_PIN) * 2;
+  return constrain((mv - 3300) / 9, 0, 100);
+}
+
+/**
+ * @brief Send the batch. Once acked the batch is cleared, otherwise it's kept and the next
+ * try backs off, doubling up to the heartbeat. Each report has a new seq, so one sent again
+ * later with newer readings added isn't taken for a repeat.
+ *
+ * @param now
+ */
+void report(uint32_t now){
+  unsigned long started = millis();
+  WireReport r;
+  memset(&r, 0, sizeof(r));
+  strncpy(r.room, ROOM_NAME, WIRE_NAME_LEN);
+  r.battery = battery();
+  r.count = saved.count;
+  for(int i = 0; i < saved.count; i++){
+    const Held &h = saved.held[i];
+    r.samples[i] = {h.temp, h.humd, (uint16_t)min(now - h.at, (uint32_t)UINT16_MAX)};
+  }
+  wireSeal(r, WIRE_REPORT, saved.seq++);
+
+  boolean acked = join() && deliver(r);
+  WiFi.disconnect(true);
+  WiFi.mode(WIFI_OFF);
+  saved.radio_ms += millis() - started;
+  saved.sends++;
+
+  if(!acked){
+    saved.misses = min(saved.misses + 1, 8);
+    saved.retry_at = now + min((SAMPLE_EVERY / 1000) << (saved.misses - 1), HEARTBEAT);
+    return;
+  }
+  const Held &last = saved.held[saved.count - 1];
+  saved.reported = true;
+  saved.sent_temp = last.temp;
+  saved.sent_humd = last.humd;
+  saved.sent_at = now;
+  saved.misses = 0;
+  saved.count = 0;
+}
+
+/**
+ * @brief Average current since power up, from the time spent asleep, awake and with the radio
+ * on and the UA_ figures, and how long BATTERY_MAH lasts at that
+ *
+ */
+void printEstimate(){
+  uint64_t awake = saved.awake_ms + millis();
+  uint64_t total = max(saved.asleep_ms + awake, (uint64_t)1);
+  uint64_t charge = saved.asleep_ms * UA_ASLEEP + (awake - saved.radio_ms) * UA_AWAKE + saved.radio_ms * UA_RADIO;
+  uint32_t ua = max(charge / total, (uint64_t)1);
+  Serial.printf("%lu wakes, %lu sends, %.2f%% awake, %lu uA average (estimated), %lu days on %u mAh\n",
+    (unsigned long)saved.wakes, (unsigned long)saved.sends, awake * 100.0 / total, (unsigned long)ua,
+    (unsigned long)(((uint64_t)BATTERY_MAH * 1000) / ua / 24), BATTERY_MAH);
+}
+
+/**
+ * @brief Deep sleep until the next reading is due, keeping to a SAMPLE_EVERY grid however
+ * long this wake took
+ *
+ */
+void sleepUntilNext(){
+  unsigned long awake = millis();
+  saved.awake_ms += awake;
+  unsigned long ms = SAMPLE_EVERY - min(awake, (unsigned long)SAMPLE_EVERY - 1000);
+  saved.asleep_ms += ms;
+  Serial.flush();
+  esp_sleep_enable_timer_wakeup((uint64_t)ms * 1000);
+  esp_deep_sleep_start();
+}
@@ -0,0 +1,112 @@
+#ifndef WIRE_FORMAT_H
+#define WIRE_FORMAT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// What a room module sends the thermostat over UDP, shared by both sketches. The thermostat
+// includes it from here so the two can't drift apart.
+
+#define WIRE_PORT 4210
+#define WIRE_MAGIC 0x5254          // "RT"
+#define WIRE_VERSION 1
+#define WIRE_BATCH 8               // Readings in one report
+#define WIRE_NAME_LEN 16           // Same as ROOM_NAME_LEN on the thermostat
+#define WIRE_UNKNOWN 255           // Humidity or battery the module doesn't have
+
+enum WireType : uint8_t { WIRE_REPORT = 1, WIRE_ACK = 2 };
+
+/**
+ * @brief One reading. Temperature is in tenths of a degree like deci_celsius.
+ *
+ */
+struct __attribute__((packed)) WireSample {
+  int16_t temp;
+  uint8_t humd;                    // Percent
+  uint16_t ago;                    // Seconds before the report was sent
+};
+
+/**
+ * @brief A batch of readings, oldest first. Each wake's report has a new seq, only the retries
+ * within one wake repeat it, and the thermostat drops those by seq. Readings sent again in a
+ * later report after a lost ack are skipped by their time instead (LINK_SAME_MS in Room_Link.h).
+ *
+ */
+struct __attribute__((packed)) WireReport {
+  uint16_t magic;
+  uint8_t version;
+  uint8_t type;
+  uint16_t seq;
+  char room[WIRE_NAME_LEN];        // Not always terminated when it fills the field
+  uint8_t battery;                 // Percent
+  uint8_t count;
+  WireSample samples[WIRE_BATCH];
+  uint32_t crc;
+};
+
+/**
+ * @brief The thermostat took the report with this seq
+ *
+ */
+struct __attribute__((packed)) WireAck {
+  uint16_t magic;
+  uint8_t version;
+  uint8_t type;
+  uint16_t seq;
+  uint32_t crc;
+};
+
+/**
+ * @brief CRC-32 (the zlib one), done a bit at a time so it needs no table and builds the
+ * same on an ESP8266
+ *
+ * @param data
+ * @param len
+ * @return uint32_t
+ */
+uint32_t wireCrc(const uint8_t *data, size_t len){
+  uint32_t crc = 0xFFFFFFFF;
+  for(size_t i = 0; i < len; i++){
+    crc ^= data[i];
+    for(int b = 0; b < 8; b++){
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+/**
+ * @brief Fill in the header and the CRC, the CRC covers everything before it
+ *
+ * @param msg a WireReport or WireAck
+ * @param type
+ * @param seq
+ */
+template<typename T> void wireSeal(T &msg, WireType type, uint16_t seq){
+  msg.magic = WIRE_MAGIC;
+  msg.version = WIRE_VERSION;
+  msg.type = type;
+  msg.seq = seq;
+  msg.crc = wireCrc((const uint8_t*)&msg, offsetof(T, crc));
+}
+
+/**
+ * @brief Check a received packet is whole and of the type expected, and copy it out
+ *
+ * @param data
+ * @param len
+ * @param type
+ * @param msg
+ * @return boolean false for anything else on the port, a short packet or a bad CRC
+ */
+template<typename T> bool wireOpen(const uint8_t *data, size_t len, WireType type, T &msg){
+  if(len != sizeof(T)){
+    return false;
+  }
+  memcpy(&msg, data, sizeof(T));
+  return msg.magic == WIRE_MAGIC && msg.version == WIRE_VERSION && msg.type == type &&
+    msg.crc == wireCrc((const uint8_t*)&msg, offsetof(T, crc));
+}
+
+#endif
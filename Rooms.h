@@ -0,0 +1,178 @@
+#ifndef ROOMS_H
+#define ROOMS_H
+
+#include "Temperature.h"
+
+#define MAX_ROOMS 32
+#define ROOM_NAME_LEN 16
+#define ROOM_SPARK 24              // Temperatures kept for the sparkline
+#define ROOM_SPARK_EVERY 1800000   // One every half hour, 12 hours of history
+#define ROOM_UNKNOWN 255           // Humidity or battery the module didn't send
+
+/**
+ * @brief A room module that has reported in
+ *
+ */
+struct Room {
+  char name[ROOM_NAME_LEN];
+  unsigned long presence_at;
+  unsigned long reading_at;        // 0 until the first reading
+  deci_celsius temp;
+  uint8_t humd;                    // Percent
+  uint8_t battery;                 // Percent
+  deci_celsius spark[ROOM_SPARK];  // Ring of past temperatures, oldest at spark_head once full
+  uint8_t spark_head;
+  uint8_t spark_count;
+  unsigned long spark_at;
+};
+
+/**
+ * @brief Fixed table of the room modules, a room gets the next free index the first time it
+ * reports and keeps it until restart
+ *
+ */
+class Rooms {
+  private:
+    Room rooms[MAX_ROOMS];
+    uint8_t count = 0;
+    uint32_t revision = 0;
+
+  public:
+    int find(const char *name);
+    int add(const char *name);
+    Room* get(int i);
+    uint8_t getCount();
+    uint32_t getRevision();
+    void presence(int i, unsigned long now);
+    void reading(int i, deci_celsius temp, uint8_t humd, uint8_t battery, unsigned long now);
+    uint8_t sparkline(int i, deci_celsius *out);
+};
+
+/**
+ * @brief Find a room by name
+ *
+ * @param name
+ * @return int -1 if it hasn't reported
+ */
+int Rooms::find(const char *name){
+  for(int i = 0; i < count; i++){
+    if(strncmp(rooms[i].name, name, ROOM_NAME_LEN - 1) == 0) return i;
+  }
+  return -1;
+}
+
+/**
+ * @brief Find a room by name or add it. Names go into JSON as they are, so quotes,
+ * backslashes and control characters aren't allowed.
+ *
+ * @param name
+ * @return int -1 if the name is empty or not allowed, or the table is full
+ */
+int Rooms::add(const char *name){
+  if(!name[0]){
+    return -1;
+  }
+  for(const char *c = name; *c; c++){
+    if(*c == '"' || *c == '\\' || (uint8_t)*c < 0x20){
+      return -1;
+    }
+  }
+  int i = find(name);
+  if(i >= 0 || count >= MAX_ROOMS){
+    return i;
+  }
+  memset(&rooms[count], 0, sizeof(Room));
+  strncpy(rooms[count].name, name, ROOM_NAME_LEN - 1);
+  rooms[count].temp = DECI_INVALID;
+  rooms[count].humd = ROOM_UNKNOWN;
+  rooms[count].battery = ROOM_UNKNOWN;
+  revision++;
+  return count++;
+}
+
+/**
+ * @brief Returns a room by index
+ *
+ * @param i
+ * @return Room* nullptr when out of range
+ */
+Room* Rooms::get(int i){
+  if(i < 0 || i >= count) return nullptr;
+  return &rooms[i];
+}
+
+/**
+ * @brief Returns the number of rooms that have reported
+ *
+ * @return uint8_t
+ */
+uint8_t Rooms::getCount(){
+  return count;
+}
+
+/**
+ * @brief Goes up every time a room is added or sends a reading, so a screen showing the
+ * rooms knows when to draw them again
+ *
+ * @return uint32_t
+ */
+uint32_t Rooms::getRevision(){
+  return revision;
+}
+
+/**
+ * @brief Record that someone was seen in a room
+ *
+ * @param i
+ * @param now
+ */
+void Rooms::presence(int i, unsigned long now){
+  if(i < 0 || i >= count) return;
+  rooms[i].presence_at = now;
+}
+
+/**
+ * @brief Record a room module's reading. The sparkline takes one every ROOM_SPARK_EVERY.
+ *
+ * @param i
+ * @param temp
+ * @param humd ROOM_UNKNOWN if the module has no humidity sensor
+ * @param battery ROOM_UNKNOWN if it runs off the mains
+ * @param now
+ */
+void Rooms::reading(int i, deci_celsius temp, uint8_t humd, uint8_t battery, unsigned long now){
+  if(i < 0 || i >= count || !isValid(temp)) return;
+  Room &r = rooms[i];
+  r.temp = temp;
+  r.humd = humd;
+  r.battery = battery;
+  r.reading_at = now;
+  if(r.spark_count == 0 || now - r.spark_at >= ROOM_SPARK_EVERY){
+    r.spark_at = now;
+    if(r.spark_count < ROOM_SPARK){
+      r.spark[r.spark_count++] = temp;
+    } else {
+      r.spark[r.spark_head] = temp;
+      r.spark_head = (r.spark_head + 1) % ROOM_SPARK;
+    }
+  }
+  revision++;
+}
+
+/**
+ * @brief Copy out a room's past temperatures oldest first
+ *
+ * @param i
+ * @param out room for ROOM_SPARK
+ * @return uint8_t how many there are
+ */
+uint8_t Rooms::sparkline(int i, deci_celsius *out){
+  if(i < 0 || i >= count) return 0;
+  const Room &r = rooms[i];
+  for(int k = 0; k < r.spark_count; k++){
+    out[k] = r.spark[(r.spark_head + k) % ROOM_SPARK];
+  }
+  return r.spark_count;
+}
+
+#endif
@@ -0,0 +1,400 @@
+#ifndef SCHEDULE_H
+#define SCHEDULE_H
+
+#include "Temperature.h"
+
+#define MAX_SLOTS 10
+#define DAY_MINUTES 1440
+#define WEEK_MINUTES 10080
+#define SLOT_STEP 15               // Minutes a slot moves per press in the editor
+#define DEADBAND deci(2, 0)        // Cooling target is always at least this far above heating
+#define MIN_TARGET deci(5, 0)
+#define MAX_TARGET deci(35, 0)
+
+/**
+ * @brief holds the number of schedule slots, and schedulable slots for a day
+ * Slots contains the hour, minute, and heating/cooling targets for each slot.
+ * Fixed size so the whole week lives in static memory.
+ */
+struct Schedule {
+  uint8_t len = 0;
+  struct Slot {
+    uint8_t hour;
+    uint8_t minute;
+    deci_celsius heat;
+    deci_celsius cool;
+  } Slot[MAX_SLOTS]; // Maximum 10 slots
+};
+
+/**
+ * @brief Minute of the day a slot starts at
+ *
+ * @param day
+ * @param s
+ * @return int
+ */
+int slotMinute(const struct Schedule &day, int s){
+  return (day.Slot[s].hour * 60) + day.Slot[s].minute;
+}
+
+/**
+ * @brief Checks a day has 1 to 10 slots in strictly increasing time order with sensible targets
+ *
+ * @param day
+ * @return boolean
+ */
+boolean validDay(const struct Schedule &day){
+  if(day.len < 1 || day.len > MAX_SLOTS){
+    return false;
+  }
+  for(int s = 0; s < day.len; s++){
+    if(day.Slot[s].hour > 23 || day.Slot[s].minute > 59){
+      return false;
+    }
+    if(s > 0 && slotMinute(day, s) <= slotMinute(day, s - 1)){
+      return false;
+    }
+    if(day.Slot[s].heat < MIN_TARGET || day.Slot[s].cool > MAX_TARGET){
+      return false;
+    }
+    if(day.Slot[s].cool - day.Slot[s].heat < DEADBAND){
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Checks every day of the week
+ *
+ * @param week
+ * @return boolean
+ */
+boolean validWeek(const struct Schedule week[7]){
+  for(int d = 0; d < 7; d++){
+    if(!validDay(week[d])){
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Edits a shadow copy of the weekly schedule from the screen. Nothing here touches the
+ * live schedule, the thermostat validates the shadow and commits the changed days in one go.
+ *
+ */
+class ScheduleEditor {
+  private:
+    struct Schedule shadow[7];
+    boolean editing = false;
+    uint8_t dirty = 0;
+    int selected = 0;
+    int clipboard = -1;
+    void resort(int d);
+
+  public:
+    void begin(const struct Schedule week[7]);
+    void finish();
+    boolean isEditing();
+    struct Schedule* getWeek();
+    uint8_t getDirty();
+    int getSelected();
+    boolean hasCopy();
+    boolean validate();
+
+    boolean select(int d, int s);
+    boolean addSlot(int d);
+    boolean deleteSlot(int d);
+    boolean moveSlot(int d, int minutes);
+    boolean changeHeat(int d, deci_celsius delta);
+    boolean changeCool(int d, deci_celsius delta);
+    void copy(int d);
+    boolean paste(int d);
+    boolean copyDay(int from, uint8_t days);
+};
+
+/**
+ * @brief Start editing from a copy of the live week
+ *
+ * @param week
+ */
+void ScheduleEditor::begin(const struct Schedule week[7]){
+  memcpy(shadow, week, sizeof(shadow));
+  editing = true;
+  dirty = 0;
+  selected = 0;
+  clipboard = -1;
+}
+
+/**
+ * @brief Stop editing, called after a commit or to throw the changes away
+ *
+ */
+void ScheduleEditor::finish(){
+  editing = false;
+  dirty = 0;
+}
+
+/**
+ * @brief Returns whether there is an edit in progress
+ *
+ * @return boolean
+ */
+boolean ScheduleEditor::isEditing(){
+  return editing;
+}
+
+/**
+ * @brief Returns the shadow copy being edited
+ *
+ * @return struct Schedule*
+ */
+struct Schedule* ScheduleEditor::getWeek(){
+  return shadow;
+}
+
+/**
+ * @brief Returns a bit for each day of the week (bit 0 is Sunday) that has been changed
+ *
+ * @return uint8_t
+ */
+uint8_t ScheduleEditor::getDirty(){
+  return dirty;
+}
+
+/**
+ * @brief Returns the selected slot
+ *
+ * @return int
+ */
+int ScheduleEditor::getSelected(){
+  return selected;
+}
+
+/**
+ * @brief Returns whether a day has been copied and can be pasted
+ *
+ * @return boolean
+ */
+boolean ScheduleEditor::hasCopy(){
+  return clipboard >= 0;
+}
+
+/**
+ * @brief Checks the changed days are valid
+ *
+ * @return boolean
+ */
+boolean ScheduleEditor::validate(){
+  for(int d = 0; d < 7; d++){
+    if((dirty & (1 << d)) && !validDay(shadow[d])){
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Select a slot on the given day
+ *
+ * @param d
+ * @param s
+ * @return boolean true if the selection changed
+ */
+boolean ScheduleEditor::select(int d, int s){
+  if(s < 0 || s >= shadow[d].len || s == selected){
+    return false;
+  }
+  selected = s;
+  return true;
+}
+
+/**
+ * @brief After the selected slot's time changes it is moved back into time order,
+ * the selection follows it
+ *
+ * @param d
+ */
+void ScheduleEditor::resort(int d){
+  struct Schedule &day = shadow[d];
+  while(selected > 0 && slotMinute(day, selected) < slotMinute(day, selected - 1)){
+    struct Schedule::Slot t = day.Slot[selected];
+    day.Slot[selected] = day.Slot[selected - 1];
+    day.Slot[selected - 1] = t;
+    selected--;
+  }
+  while(selected < day.len - 1 && slotMinute(day, selected) > slotMinute(day, selected + 1)){
+    struct Schedule::Slot t = day.Slot[selected];
+    day.Slot[selected] = day.Slot[selected + 1];
+    day.Slot[selected + 1] = t;
+    selected++;
+  }
+}
+
+/**
+ * @brief Adds a slot an hour after the selected one with the same targets, or an hour
+ * before when there is no room left in the day
+ *
+ * @param d
+ * @return boolean
+ */
+boolean ScheduleEditor::addSlot(int d){
+  struct Schedule &day = shadow[d];
+  if(day.len >= MAX_SLOTS){
+    return false;
+  }
+  struct Schedule::Slot slot = {6, 0, deci(21, 0), deci(25, 0)};
+  if(day.len > 0){
+    slot = day.Slot[selected];
+  }
+  day.Slot[day.len] = slot;
+  selected = day.len;
+  day.len++;
+  dirty |= 1 << d;
+  if(day.len > 1 && !moveSlot(d, 60)){
+    moveSlot(d, -60);
+  }
+  return true;
+}
+
+/**
+ * @brief Removes the selected slot, the last slot of a day can't be removed
+ *
+ * @param d
+ * @return boolean
+ */
+boolean ScheduleEditor::deleteSlot(int d){
+  struct Schedule &day = shadow[d];
+  if(day.len <= 1){
+    return false;
+  }
+  for(int s = selected; s < day.len - 1; s++){
+    day.Slot[s] = day.Slot[s + 1];
+  }
+  day.len--;
+  if(selected >= day.len){
+    selected = day.len - 1;
+  }
+  dirty |= 1 << d;
+  return true;
+}
+
+/**
+ * @brief Moves the selected slot earlier or later in the day, stepping over any slot
+ * already at that time
+ *
+ * @param d
+ * @param minutes
+ * @return boolean false if it would leave the day
+ */
+boolean ScheduleEditor::moveSlot(int d, int minutes){
+  struct Schedule &day = shadow[d];
+  int m = slotMinute(day, selected);
+  boolean taken;
+  do {
+    m += minutes;
+    if(m < 0 || m >= DAY_MINUTES){
+      return false;
+    }
+    taken = false;
+    for(int s = 0; s < day.len; s++){
+      if(s != selected && slotMinute(day, s) == m) taken = true;
+    }
+  } while(taken);
+  day.Slot[selected].hour = m / 60;
+  day.Slot[selected].minute = m % 60;
+  resort(d);
+  dirty |= 1 << d;
+  return true;
+}
+
+/**
+ * @brief Raise or lower the heating target of the selected slot, the cooling target is
+ * pushed up to keep the deadband
+ *
+ * @param d
+ * @param delta
+ * @return boolean
+ */
+boolean ScheduleEditor::changeHeat(int d, deci_celsius delta){
+  struct Schedule::Slot &slot = shadow[d].Slot[selected];
+  deci_celsius heat = slot.heat + delta;
+  if(heat < MIN_TARGET || heat + DEADBAND > MAX_TARGET){
+    return false;
+  }
+  slot.heat = heat;
+  if(slot.cool < heat + DEADBAND){
+    slot.cool = heat + DEADBAND;
+  }
+  dirty |= 1 << d;
+  return true;
+}
+
+/**
+ * @brief Raise or lower the cooling target of the selected slot, the heating target is
+ * pushed down to keep the deadband
+ *
+ * @param d
+ * @param delta
+ * @return boolean
+ */
+boolean ScheduleEditor::changeCool(int d, deci_celsius delta){
+  struct Schedule::Slot &slot = shadow[d].Slot[selected];
+  deci_celsius cool = slot.cool + delta;
+  if(cool > MAX_TARGET || cool - DEADBAND < MIN_TARGET){
+    return false;
+  }
+  slot.cool = cool;
+  if(slot.heat > cool - DEADBAND){
+    slot.heat = cool - DEADBAND;
+  }
+  dirty |= 1 << d;
+  return true;
+}
+
+/**
+ * @brief Remember a day to paste onto others
+ *
+ * @param d
+ */
+void ScheduleEditor::copy(int d){
+  clipboard = d;
+}
+
+/**
+ * @brief Paste the copied day onto the given day
+ *
+ * @param d
+ * @return boolean
+ */
+boolean ScheduleEditor::paste(int d){
+  if(clipboard < 0 || clipboard == d){
+    return false;
+  }
+  return copyDay(clipboard, 1 << d);
+}
+
+/**
+ * @brief Copy one day onto any number of other days
+ *
+ * @param from
+ * @param days bit for each day to copy onto, bit 0 is Sunday
+ * @return boolean
+ */
+boolean ScheduleEditor::copyDay(int from, uint8_t days){
+  days &= ~(1 << from) & 0x7F;
+  if(!days){
+    return false;
+  }
+  for(int d = 0; d < 7; d++){
+    if(days & (1 << d)){
+      shadow[d] = shadow[from];
+    }
+  }
+  dirty |= days;
+  selected = 0;
+  return true;
+}
+
+#endif
@@ -0,0 +1,384 @@
+#ifndef SCHEDULE_JSON_H
+#define SCHEDULE_JSON_H
+
+#include "Schedule.h"
+
+#define JSON_TOKEN_LEN 16 // Longest key or number accepted, anything longer is rejected
+
+/**
+ * The weekly schedule as JSON, one array of slots per day. "cool" may be left out, it then
+ * defaults to the heating target plus the deadband.
+ *
+ * {"sun":[{"hour":7,"minute":30,"heat":22.0,"cool":25.0}, ...], "mon":[...], ... "sat":[...]}
+ */
+const char* const json_days[7] = {"sun","mon","tue","wed","thu","fri","sat"};
+
+/**
+ * @brief Parses the JSON schedule a piece at a time as it arrives over the network. There is no
+ * document tree and no String building, characters go through a fixed token buffer and values
+ * are written straight into the week being built. All 7 days have to be present and valid.
+ *
+ */
+class ScheduleParser {
+  private:
+    enum State {
+      ROOT_OPEN, ROOT_KEY, DAY_OPEN, SLOT_OPEN, SLOT_KEY, SLOT_VALUE,
+      SLOT_NEXT, DAY_NEXT, ROOT_NEXT, DONE, FAILED
+    };
+    enum Token { T_OPEN_OBJ, T_CLOSE_OBJ, T_OPEN_ARR, T_CLOSE_ARR, T_COMMA, T_STRING, T_NUMBER };
+
+    struct Schedule week[7];
+    State state = ROOT_OPEN;
+    boolean colon = false;     // A ':' has to come before the next value
+    boolean in_string = false;
+    boolean in_number = false;
+    char token[JSON_TOKEN_LEN];
+    uint8_t token_len = 0;
+    int8_t day = -1;
+    int8_t field = -1;
+    uint8_t days_seen = 0;
+    uint8_t fields_seen = 0;
+    size_t pos = 0;
+    const char *error = nullptr;
+
+    void fail(const char *msg);
+    void push(char c);
+    void lex(char c);
+    void parse(Token t);
+    void value();
+    void endSlot();
+
+  public:
+    void begin();
+    void feed(const uint8_t *buf, size_t len);
+    boolean finish();
+    const struct Schedule* getWeek();
+    const char* getError();
+    size_t getErrorPos();
+};
+
+/**
+ * @brief Get ready for a new document
+ *
+ */
+void ScheduleParser::begin(){
+  memset(week, 0, sizeof(week));
+  state = ROOT_OPEN;
+  colon = false;
+  in_string = false;
+  in_number = false;
+  token_len = 0;
+  day = -1;
+  field = -1;
+  days_seen = 0;
+  fields_seen = 0;
+  pos = 0;
+  error = nullptr;
+}
+
+/**
+ * @brief Stop parsing, the first error is the one reported
+ *
+ * @param msg
+ */
+void ScheduleParser::fail(const char *msg){
+  if(state != FAILED){
+    error = msg;
+    state = FAILED;
+  }
+}
+
+/**
+ * @brief Add a character to the current token
+ *
+ * @param c
+ */
+void ScheduleParser::push(char c){
+  if(token_len >= JSON_TOKEN_LEN - 1){
+    fail("token too long");
+    return;
+  }
+  token[token_len++] = c;
+  token[token_len] = '\0';
+}
+
+/**
+ * @brief Feed the next chunk of the body, can be called with any size of chunk
+ *
+ * @param buf
+ * @param len
+ */
+void ScheduleParser::feed(const uint8_t *buf, size_t len){
+  for(size_t i = 0; i < len && state != FAILED; i++, pos++){
+    lex((char)buf[i]);
+  }
+}
+
+/**
+ * @brief Splits the characters into tokens. Strings are only ever keys here so escapes
+ * aren't supported.
+ *
+ * @param c
+ */
+void ScheduleParser::lex(char c){
+  if(in_string){
+    if(c == '"'){
+      in_string = false;
+      parse(T_STRING);
+    } else if(c == '\\' || (uint8_t)c < 0x20){
+      fail("bad string");
+    } else {
+      push(c);
+    }
+    return;
+  }
+  if(in_number){
+    if(isDigit(c) || c == '.' || c == '-'){
+      push(c);
+      return;
+    }
+    in_number = false;
+    parse(T_NUMBER);
+    if(state == FAILED) return;
+  }
+  switch(c){
+    case ' ': case '\t': case '\r': case '\n':
+      break;
+    case '{': parse(T_OPEN_OBJ); break;
+    case '}': parse(T_CLOSE_OBJ); break;
+    case '[': parse(T_OPEN_ARR); break;
+    case ']': parse(T_CLOSE_ARR); break;
+    case ',': parse(T_COMMA); break;
+    case ':':
+      if(colon) fail("unexpected ':'");
+      colon = true;
+      break;
+    case '"':
+      in_string = true;
+      token_len = 0;
+      token[0] = '\0';
+      break;
+    default:
+      if(isDigit(c) || c == '-'){
+        in_number = true;
+        token_len = 0;
+        push(c);
+      } else {
+        fail("unexpected character");
+      }
+  }
+}
+
+/**
+ * @brief Moves through the document structure one token at a time
+ *
+ * @param t
+ */
+void ScheduleParser::parse(Token t){
+  // Values follow a key and its colon, nothing else may have one
+  boolean wants_colon = state == DAY_OPEN || state == SLOT_VALUE;
+  if(colon != wants_colon){
+    fail(colon ? "unexpected ':'" : "expected ':'");
+    return;
+  }
+  colon = false;
+
+  switch(state){
+    case ROOT_OPEN:
+      if(t != T_OPEN_OBJ) return fail("expected '{'");
+      state = ROOT_KEY;
+      break;
+    case ROOT_KEY:
+      if(t != T_STRING) return fail("expected a day");
+      day = -1;
+      for(int d = 0; d < 7; d++){
+        if(strcmp(token, json_days[d]) == 0) day = d;
+      }
+      if(day < 0) return fail("unknown day");
+      if(days_seen & (1 << day)) return fail("day repeated");
+      days_seen |= 1 << day;
+      state = DAY_OPEN;
+      break;
+    case DAY_OPEN:
+      if(t != T_OPEN_ARR) return fail("expected '['");
+      state = SLOT_OPEN;
+      break;
+    case SLOT_OPEN:
+      if(t == T_CLOSE_ARR && week[day].len == 0){
+        state = ROOT_NEXT;
+        break;
+      }
+      if(t != T_OPEN_OBJ) return fail("expected '{'");
+      if(week[day].len >= MAX_SLOTS) return fail("too many slots");
+      fields_seen = 0;
+      state = SLOT_KEY;
+      break;
+    case SLOT_KEY:
+      if(t != T_STRING) return fail("expected a key");
+      if(strcmp(token, "hour") == 0) field = 0;
+      else if(strcmp(token, "minute") == 0) field = 1;
+      else if(strcmp(token, "heat") == 0) field = 2;
+      else if(strcmp(token, "cool") == 0) field = 3;
+      else return fail("unknown key");
+      if(fields_seen & (1 << field)) return fail("key repeated");
+      fields_seen |= 1 << field;
+      state = SLOT_VALUE;
+      break;
+    case SLOT_VALUE:
+      if(t != T_NUMBER) return fail("expected a number");
+      value();
+      if(state != FAILED) state = SLOT_NEXT;
+      break;
+    case SLOT_NEXT:
+      if(t == T_COMMA){
+        state = SLOT_KEY;
+      } else if(t == T_CLOSE_OBJ){
+        endSlot();
+      } else {
+        fail("expected ',' or '}'");
+      }
+      break;
+    case DAY_NEXT:
+      if(t == T_COMMA){
+        state = SLOT_OPEN;
+      } else if(t == T_CLOSE_ARR){
+        state = ROOT_NEXT;
+      } else {
+        fail("expected ',' or ']'");
+      }
+      break;
+    case ROOT_NEXT:
+      if(t == T_COMMA){
+        state = ROOT_KEY;
+      } else if(t == T_CLOSE_OBJ){
+        state = DONE;
+      } else {
+        fail("expected ',' or '}'");
+      }
+      break;
+    case DONE:
+      fail("data after the end");
+      break;
+    case FAILED:
+      break;
+  }
+}
+
+/**
+ * @brief Stores the number in the token into the current slot
+ *
+ */
+void ScheduleParser::value(){
+  struct Schedule::Slot &slot = week[day].Slot[week[day].len];
+  if(field < 2){
+    if(strchr(token, '.') || token[0] == '-' || token_len > 2){
+      return fail("bad time");
+    }
+    uint8_t v = atoi(token);
+    if(field == 0) slot.hour = v;
+    else slot.minute = v;
+    return;
+  }
+  if(token_len > 6){
+    return fail("bad temperature");
+  }
+  if(field == 2) slot.heat = parseDeci(token);
+  else slot.cool = parseDeci(token);
+}
+
+/**
+ * @brief A slot needs at least its time and heating target
+ *
+ */
+void ScheduleParser::endSlot(){
+  if((fields_seen & 0x07) != 0x07){
+    return fail("slot is missing hour, minute or heat");
+  }
+  struct Schedule::Slot &slot = week[day].Slot[week[day].len];
+  if(!(fields_seen & 0x08)){
+    slot.cool = slot.heat + DEADBAND;
+  }
+  week[day].len++;
+  state = DAY_NEXT;
+}
+
+/**
+ * @brief Call once the whole body has been fed in
+ *
+ * @return boolean true if the document was complete and is a valid schedule
+ */
+boolean ScheduleParser::finish(){
+  if(in_number && state != FAILED){
+    in_number = false;
+    parse(T_NUMBER);
+  }
+  if(state == FAILED){
+    return false;
+  }
+  if(state != DONE){
+    fail("unexpected end");
+    return false;
+  }
+  if(days_seen != 0x7F){
+    fail("missing days");
+    return false;
+  }
+  if(!validWeek(week)){
+    fail("invalid schedule");
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Returns the parsed week, only meaningful after finish() returns true
+ *
+ * @return const struct Schedule*
+ */
+const struct Schedule* ScheduleParser::getWeek(){
+  return week;
+}
+
+/**
+ * @brief Returns why the document was rejected
+ *
+ * @return const char*
+ */
+const char* ScheduleParser::getError(){
+  return error ? error : "";
+}
+
+/**
+ * @brief Returns the byte offset the error was found at
+ *
+ * @return size_t
+ */
+size_t ScheduleParser::getErrorPos(){
+  return pos;
+}
+
+/**
+ * @brief Writes one day as a JSON member, "mon":[{...},...], into buf. A full day fits in 512 bytes.
+ *
+ * @param buf
+ * @param size
+ * @param sched
+ * @param d
+ * @return size_t characters written
+ */
+size_t scheduleDayJson(char *buf, size_t size, const struct Schedule &sched, int d){
+  char heat[8];
+  char cool[8];
+  size_t n = snprintf(buf, size, "%s\"%s\":[", d == 0 ? "{" : ",", json_days[d]);
+  for(int s = 0; s < sched.len && n < size; s++){
+    n += snprintf(buf + n, size - n, "%s{\"hour\":%u,\"minute\":%u,\"heat\":%s,\"cool\":%s}",
+      s == 0 ? "" : ",", sched.Slot[s].hour, sched.Slot[s].minute,
+      formatDeci(heat, sched.Slot[s].heat), formatDeci(cool, sched.Slot[s].cool));
+  }
+  if(n < size){
+    n += snprintf(buf + n, size - n, "]%s", d == 6 ? "}" : "");
+  }
+  return min(n, size - 1);
+}
+
+#endif
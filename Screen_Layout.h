@@ -0,0 +1,353 @@
+#ifndef SCREEN_LAYOUT_H
+#define SCREEN_LAYOUT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define SCREEN_W 480
+#define SCREEN_H 320
+#define SCREEN_ROTATION 3          // TFT_eSPI rotation, landscape with the USB port on the left
+#define BODY_Y 40                  // The screen sprite is pushed this far down, under the header
+#define BODY_W 380                 // and is this wide, the nav bar down the right stays put
+
+// Slot list on the schedule screen
+#define SCHED_ROW_H 32
+#define SCHED_ROWS 5
+
+// Room list on the rooms screen
+#define ROOM_ROW_H 60
+
+/**
+ * @brief A rectangle in screen coordinates
+ *
+ */
+struct Rect {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+
+  constexpr int16_t right() const { return x + w; }
+  constexpr int16_t bottom() const { return y + h; }
+  constexpr int16_t cx() const { return x + (w / 2); }
+  constexpr int16_t cy() const { return y + (h / 2); }
+  constexpr bool contains(int px, int py) const { return px >= x && px < x + w && py >= y && py < y + h; }
+  constexpr bool overlaps(const Rect &o) const { return x < o.right() && o.x < right() && y < o.bottom() && o.y < bottom(); }
+  constexpr Rect grow(int px, int py) const { return Rect{(int16_t)(x - px), (int16_t)(y - py), (int16_t)(w + 2 * px), (int16_t)(h + 2 * py)}; }
+  // The same rectangle in the screen sprite, which starts under the header
+  constexpr Rect body() const { return Rect{x, (int16_t)(y - BODY_Y), w, h}; }
+};
+
+/**
+ * A touch in screen coordinates
+ */
+struct TouchPoint {
+  int16_t x;
+  int16_t y;
+};
+
+/**
+ * @brief The FT6206 reports touches in the panel's own portrait orientation, this turns one
+ * into screen coordinates for SCREEN_ROTATION. It all folds down to a subtraction at compile time.
+ *
+ * @param tx
+ * @param ty
+ * @return TouchPoint
+ */
+constexpr TouchPoint touchToScreen(int16_t tx, int16_t ty){
+  return SCREEN_ROTATION == 0 ? TouchPoint{tx, ty} :
+    SCREEN_ROTATION == 1 ? TouchPoint{ty, (int16_t)(SCREEN_H - tx)} :
+    SCREEN_ROTATION == 2 ? TouchPoint{(int16_t)(SCREEN_H - tx), (int16_t)(SCREEN_W - ty)} :
+    TouchPoint{(int16_t)(SCREEN_W - ty), tx};
+}
+
+static_assert(touchToScreen(0, 0).x == SCREEN_W && touchToScreen(0, 0).y == 0, "touch origin is the top right in landscape");
+static_assert(touchToScreen(SCREEN_H, SCREEN_W).x == 0 && touchToScreen(SCREEN_H, SCREEN_W).y == SCREEN_H, "touch far corner is the bottom left");
+
+/**
+ * The chrome masks Draw rasterizes in begin(), a widget drawn as an icon is exactly the size of its mask
+ */
+enum Icon : uint8_t {
+  ICON_BACK, ICON_PREV, ICON_NEXT, ICON_UP, ICON_DOWN, ICON_SCROLL_UP, ICON_SCROLL_DOWN,
+  ICON_HOME, ICON_CALENDAR, ICON_GEAR,
+  ICONS
+};
+
+constexpr int16_t icon_w[ICONS] = {100, 21, 21, 61, 61, 25, 25, 100, 100, 100};
+constexpr int16_t icon_h[ICONS] = {80, 41, 41, 31, 31, 25, 25, 80, 80, 80};
+
+/**
+ * @brief The rectangle an icon covers with its top left at x, y
+ *
+ * @param icon
+ * @param x
+ * @param y
+ * @return Rect
+ */
+constexpr Rect iconAt(Icon icon, int16_t x, int16_t y){
+  return Rect{x, y, icon_w[icon], icon_h[icon]};
+}
+
+/**
+ * Everything that can be touched
+ */
+enum WidgetId : uint8_t {
+  W_NONE,
+  W_MENU_ROOMS, W_MENU_SCHEDULE, W_MENU_SETTINGS, W_BACK,
+  W_HOLD, W_MODE, W_HOLD_UP, W_HOLD_DOWN, W_HUMD_UP, W_HUMD_DOWN,
+  W_PREV_DAY, W_NEXT_DAY, W_EDIT, W_SAVE, W_CANCEL, W_ROWS, W_SCROLL_UP, W_SCROLL_DOWN,
+  W_ADD, W_DEL, W_COPY, W_PASTE, W_TIME_DOWN, W_TIME_UP, W_HEAT_DOWN, W_HEAT_UP, W_COOL_DOWN, W_COOL_UP,
+  W_ROOM_LIST
+};
+
+/**
+ * How a widget is drawn. Areas are only touch targets, what's in them is drawn by the screen.
+ */
+enum WidgetArt : uint8_t { ART_AREA, ART_BUTTON, ART_BOX, ART_ICON };
+
+/**
+ * State a widget depends on, it is shown (and can be touched) when all of its flags are set
+ */
+enum : uint8_t {
+  WHEN_ALWAYS = 0,
+  WHEN_VIEWING = 1,
+  WHEN_EDITING = 2,
+  WHEN_NO_PASTE = 4,
+  WHEN_CAN_PASTE = 8,
+  WHEN_MAIN = 16,       // Nav bar on the main screen
+  WHEN_AWAY = 32        // Nav bar on any other
+};
+
+/**
+ * @brief One thing on a screen. The box is where it is drawn, the touch area is the box
+ * grown by the padding so small arrows are easy to hit.
+ *
+ */
+struct Widget {
+  WidgetId id;
+  Rect box;
+  uint8_t pad_x;
+  uint8_t pad_y;
+  WidgetArt art;
+  Icon icon;
+  const char *label;
+  uint8_t when;
+
+  constexpr Rect hit() const { return box.grow(pad_x, pad_y); }
+  constexpr bool shown(uint8_t state) const { return (when & state) == when; }
+};
+
+// Shorthand for the tables below
+constexpr Widget areaWidget(WidgetId id, Rect r, uint8_t when = WHEN_ALWAYS){
+  return Widget{id, r, 0, 0, ART_AREA, ICONS, nullptr, when};
+}
+constexpr Widget buttonWidget(WidgetId id, Rect r, const char *label, uint8_t when = WHEN_ALWAYS){
+  return Widget{id, r, 1, 1, ART_BUTTON, ICONS, label, when};
+}
+constexpr Widget boxWidget(WidgetId id, Rect r, uint8_t pad){
+  return Widget{id, r, pad, pad, ART_BOX, ICONS, nullptr, WHEN_ALWAYS};
+}
+constexpr Widget iconWidget(WidgetId id, Icon i, int16_t x, int16_t y, uint8_t pad_x, uint8_t pad_y, uint8_t when = WHEN_ALWAYS){
+  return Widget{id, iconAt(i, x, y), pad_x, pad_y, ART_ICON, i, nullptr, when};
+}
+
+/**
+ * Where everything goes, in screen coordinates. The renderers in Draw and the hit tests in
+ * handleTouch() both come from here.
+ */
+namespace Layout {
+  // Nav bar down the right of every screen, the back arrow takes the top slot away from the main screen
+  constexpr int16_t nav_top = 80;
+  constexpr int16_t nav_slot_h = 80;
+  constexpr Widget menu_rooms = iconWidget(W_MENU_ROOMS, ICON_HOME, BODY_W, nav_top, 0, 0, WHEN_MAIN);
+  constexpr Widget back = iconWidget(W_BACK, ICON_BACK, BODY_W, nav_top, 0, 0, WHEN_AWAY);
+  constexpr Widget menu_schedule = iconWidget(W_MENU_SCHEDULE, ICON_CALENDAR, BODY_W, nav_top + nav_slot_h, 0, 0);
+  constexpr Widget menu_settings = iconWidget(W_MENU_SETTINGS, ICON_GEAR, BODY_W, nav_top + (2 * nav_slot_h), 0, 0);
+
+  // Rooms, a title line over a list that scrolls, the scroll bar is drawn down the right of each row
+  constexpr Rect room_title = Rect{0, BODY_Y, BODY_W, 40};
+  constexpr Widget room_list = areaWidget(W_ROOM_LIST, Rect{0, room_title.bottom(), BODY_W, SCREEN_H - room_title.bottom()});
+  constexpr int16_t room_bar_x = BODY_W - 6;
+
+  // Settings
+  constexpr Widget hold = boxWidget(W_HOLD, Rect{5, 130, 70, 60}, 5);
+  constexpr Widget mode = boxWidget(W_MODE, Rect{5, 210, 70, 60}, 5);
+  constexpr Widget hold_up = iconWidget(W_HOLD_UP, ICON_UP, 125, 130, 30, 20);
+  constexpr Widget hold_down = iconWidget(W_HOLD_DOWN, ICON_DOWN, 125, 250, 30, 20);
+  constexpr Widget humd_up = iconWidget(W_HUMD_UP, ICON_UP, 275, 130, 30, 20);
+  constexpr Widget humd_down = iconWidget(W_HUMD_DOWN, ICON_DOWN, 275, 250, 30, 20);
+  constexpr int16_t settings_heading_y = 90;
+  constexpr int16_t settings_value_y = (hold_up.box.bottom() + hold_down.box.y) / 2;
+
+  // Schedule
+  constexpr Widget prev_day = iconWidget(W_PREV_DAY, ICON_PREV, 40, 40, 10, 4);
+  constexpr Widget next_day = iconWidget(W_NEXT_DAY, ICON_NEXT, 180, 40, 10, 4);
+  constexpr Widget edit = buttonWidget(W_EDIT, Rect{220, 42, 155, 36}, "Edit", WHEN_VIEWING);
+  constexpr Widget save = buttonWidget(W_SAVE, Rect{220, 42, 75, 36}, "Save", WHEN_EDITING);
+  constexpr Widget cancel = buttonWidget(W_CANCEL, Rect{300, 42, 75, 36}, "Cancel", WHEN_EDITING);
+  constexpr Widget rows = areaWidget(W_ROWS, Rect{0, 85, 272, SCHED_ROWS * SCHED_ROW_H});
+  constexpr Widget scroll_up = areaWidget(W_SCROLL_UP, Rect{rows.box.right(), rows.box.y, 30, rows.box.h / 2});
+  constexpr Widget scroll_down = areaWidget(W_SCROLL_DOWN, Rect{rows.box.right(), scroll_up.box.bottom(), 30, rows.box.h / 2});
+  constexpr Widget add = buttonWidget(W_ADD, Rect{305, 85, 70, 48}, "Add", WHEN_EDITING);
+  constexpr Widget del = buttonWidget(W_DEL, Rect{305, 141, 70, 48}, "Del", WHEN_EDITING);
+  constexpr Widget copy = buttonWidget(W_COPY, Rect{305, 197, 70, 48}, "Copy", WHEN_EDITING | WHEN_NO_PASTE);
+  constexpr Widget paste = buttonWidget(W_PASTE, Rect{305, 197, 70, 48}, "Paste", WHEN_EDITING | WHEN_CAN_PASTE);
+  constexpr int16_t bar_w = 63;
+  constexpr Rect barButton(int i){ return Rect{(int16_t)(i * bar_w), 255, bar_w - 3, 60}; }
+}
+
+constexpr Widget nav_bar[] = {Layout::menu_rooms, Layout::back, Layout::menu_schedule, Layout::menu_settings};
+
+constexpr Widget rooms_screen[] = {Layout::room_list};
+
+constexpr Widget settings_screen[] = {
+  Layout::hold, Layout::mode,
+  Layout::hold_up, Layout::hold_down, Layout::humd_up, Layout::humd_down
+};
+
+constexpr Widget schedule_screen[] = {
+  Layout::prev_day, Layout::next_day, Layout::edit, Layout::save, Layout::cancel,
+  Layout::rows, Layout::scroll_up, Layout::scroll_down, Layout::add, Layout::del, Layout::copy, Layout::paste,
+  buttonWidget(W_TIME_DOWN, Layout::barButton(0), "T-", WHEN_EDITING),
+  buttonWidget(W_TIME_UP, Layout::barButton(1), "T+", WHEN_EDITING),
+  buttonWidget(W_HEAT_DOWN, Layout::barButton(2), "H-", WHEN_EDITING),
+  buttonWidget(W_HEAT_UP, Layout::barButton(3), "H+", WHEN_EDITING),
+  buttonWidget(W_COOL_DOWN, Layout::barButton(4), "C-", WHEN_EDITING),
+  buttonWidget(W_COOL_UP, Layout::barButton(5), "C+", WHEN_EDITING)
+};
+
+/**
+ * @brief Which page of the room list is mostly showing, a page being a screenful
+ *
+ * @param scroll pixels from the top of the list
+ * @return int from 0
+ */
+constexpr int roomPage(int scroll){
+  return (scroll + (Layout::room_list.box.h / 2)) / Layout::room_list.box.h;
+}
+
+/**
+ * @brief Pages in a room list, at least one
+ *
+ * @param count rooms
+ * @return int
+ */
+constexpr int roomPages(int count){
+  return count * ROOM_ROW_H <= Layout::room_list.box.h ? 1 : ((count * ROOM_ROW_H) + Layout::room_list.box.h - 1) / Layout::room_list.box.h;
+}
+
+/**
+ * @brief The furthest the room list scrolls
+ *
+ * @param count rooms
+ * @return int
+ */
+constexpr int roomScrollLimit(int count){
+  return count * ROOM_ROW_H > Layout::room_list.box.h ? (count * ROOM_ROW_H) - Layout::room_list.box.h : 0;
+}
+
+/**
+ * @brief The nav bar's state flags
+ *
+ * @param on_main the main screen is showing
+ * @return uint8_t
+ */
+constexpr uint8_t navState(bool on_main){
+  return on_main ? WHEN_MAIN : WHEN_AWAY;
+}
+
+/**
+ * @brief The schedule screen's state flags
+ *
+ * @param editing
+ * @param can_paste a day has been copied
+ * @return uint8_t
+ */
+constexpr uint8_t scheduleState(bool editing, bool can_paste){
+  return editing ? WHEN_EDITING | (can_paste ? WHEN_CAN_PASTE : WHEN_NO_PASTE) : WHEN_VIEWING;
+}
+
+/**
+ * @brief The widget shown in state whose touch area contains x, y
+ *
+ * @param ws
+ * @param n
+ * @param x
+ * @param y
+ * @param state
+ * @return WidgetId W_NONE if nothing was hit
+ */
+constexpr WidgetId hitTest(const Widget *ws, size_t n, int x, int y, uint8_t state){
+  return n == 0 ? W_NONE :
+    (ws[0].shown(state) && ws[0].hit().contains(x, y)) ? ws[0].id : hitTest(ws + 1, n - 1, x, y, state);
+}
+
+template<size_t N>
+constexpr WidgetId hitTest(const Widget (&ws)[N], int x, int y, uint8_t state = WHEN_ALWAYS){
+  return hitTest(ws, N, x, y, state);
+}
+
+/**
+ * @brief Whether two widgets can be on the screen at the same time
+ *
+ * @param a
+ * @param b
+ * @return bool
+ */
+constexpr bool together(const Widget &a, const Widget &b){
+  return !(((a.when | b.when) & (WHEN_VIEWING | WHEN_EDITING)) == (WHEN_VIEWING | WHEN_EDITING)) &&
+    !(((a.when | b.when) & (WHEN_NO_PASTE | WHEN_CAN_PASTE)) == (WHEN_NO_PASTE | WHEN_CAN_PASTE)) &&
+    !(((a.when | b.when) & (WHEN_MAIN | WHEN_AWAY)) == (WHEN_MAIN | WHEN_AWAY));
+}
+
+/**
+ * @brief Whether a widget's touch area stays clear of the others it can be shown with, and inside the screen
+ *
+ * @param w
+ * @param ws
+ * @param n
+ * @return bool
+ */
+constexpr bool clearOf(const Widget &w, const Widget *ws, size_t n){
+  return n == 0 ? true :
+    !(together(w, ws[0]) && w.hit().overlaps(ws[0].hit())) && clearOf(w, ws + 1, n - 1);
+}
+
+constexpr bool noOverlaps(const Widget *ws, size_t n){
+  return n == 0 ? true :
+    ws[0].box.x >= 0 && ws[0].box.right() <= SCREEN_W && ws[0].box.y >= BODY_Y && ws[0].box.bottom() <= SCREEN_H &&
+    clearOf(ws[0], ws + 1, n - 1) && noOverlaps(ws + 1, n - 1);
+}
+
+template<size_t N>
+constexpr bool noOverlaps(const Widget (&ws)[N]){
+  return noOverlaps(ws, N);
+}
+
+/**
+ * @brief Whether every widget is drawn in the screen sprite, left of the nav bar
+ *
+ * @param ws
+ * @param n
+ * @return bool
+ */
+constexpr bool inBody(const Widget *ws, size_t n){
+  return n == 0 ? true : ws[0].hit().right() <= BODY_W && inBody(ws + 1, n - 1);
+}
+
+template<size_t N>
+constexpr bool inBody(const Widget (&ws)[N]){
+  return inBody(ws, N);
+}
+
+// Any two touch areas that overlap would make one of them unreachable, caught here instead of on the device
+static_assert(noOverlaps(nav_bar), "nav bar touch areas overlap");
+static_assert(noOverlaps(rooms_screen) && inBody(rooms_screen), "rooms screen runs into the nav bar");
+static_assert(inBody(settings_screen) && inBody(schedule_screen), "a screen runs into the nav bar");
+static_assert(noOverlaps(settings_screen), "settings screen touch areas overlap");
+static_assert(noOverlaps(schedule_screen), "schedule screen touch areas overlap");
+static_assert(hitTest(settings_screen, Layout::hold_up.box.cx(), Layout::hold_up.box.cy()) == W_HOLD_UP, "hold up isn't where it's drawn");
+static_assert(hitTest(schedule_screen, 10, 300, scheduleState(true, false)) == W_TIME_DOWN, "schedule bar isn't where it's drawn");
+static_assert(hitTest(nav_bar, 430, 120, navState(false)) == W_BACK && hitTest(nav_bar, 430, 120, navState(true)) == W_MENU_ROOMS, "back and rooms share the top slot");
+
+#endif
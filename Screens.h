@@ -0,0 +1,338 @@
+#ifndef SCREENS_H
+#define SCREENS_H
+
+#include "Temperature.h"
+
+#define TOUCH_REPEAT_MS 250        // A held button acts again this often
+#define SCROLL_FRAME_MS 16         // Coasting is worked out per 16ms, about one frame at 60Hz
+#define SCROLL_FRICTION 0.95f      // Speed kept each frame while coasting
+#define SCROLL_MIN_SPEED 0.05f     // Pixels per ms, slower than this it stops and snaps to a row
+#define SCROLL_SNAP 0.35f          // Part of the way to the nearest row moved each frame
+#define SCROLL_HELD_MS 80          // A finger resting this long before letting go doesn't fling
+
+enum ScreenId : uint8_t { SCREEN_MAIN, SCREEN_ROOMS, SCREEN_SCHEDULE, SCREEN_SETTINGS, SCREENS };
+
+const char* const screen_names[SCREENS] = {"Main", "Rooms", "Schedule", "Settings"};
+
+/**
+ * A touch from the first contact to letting go. Buttons act on the press and on each repeat
+ * while held, lists follow every drag.
+ */
+enum TouchPhase : uint8_t { TOUCH_PRESS, TOUCH_REPEAT, TOUCH_DRAG, TOUCH_RELEASE };
+
+/**
+ * @brief What a screen does, any of these can be left out. enter() sets up the screen's
+ * context and draw() draws all of it from there, update() runs every pass of the loop while
+ * it is showing and only draws what changed.
+ *
+ */
+struct ScreenHooks {
+  void (*enter)(ScreenId from);
+  void (*draw)();
+  void (*update)(unsigned long now);
+  void (*touch)(TouchPhase phase, int x, int y, unsigned long now);
+  void (*exit)(ScreenId to);
+};
+
+// What each screen keeps while it is away, allocated once with the rest of the globals
+
+// Values on the main screen, each cell is drawn again only when its own value changes
+struct MainView {
+  deci_celsius temp;
+  float humd;
+  deci_celsius goal;
+  float goal_humd;
+  boolean holding;
+  int hold_left;
+};
+
+struct SettingsView {
+  uint8_t hold;
+  uint8_t mode;
+  deci_celsius hold_temp;
+  float humd;
+};
+
+struct ScheduleView {
+  int scroll;                      // First slot shown
+};
+
+/**
+ * @brief Scroll position that follows a finger and coasts to a stop after a flick, then
+ * eases onto a whole step (a row) so nothing is left half cut off. Motion is worked out from
+ * the time between calls, so a slow frame skips ahead rather than slowing it down.
+ *
+ */
+class KineticScroll {
+  private:
+    float pos = 0;
+    float velocity = 0;            // Pixels per ms, positive is further down the list
+    int limit = 0;
+    int step = 1;
+    int16_t last_y = 0;
+    unsigned long last_ms = 0;
+    boolean dragging = false;
+    float clamp(float p);
+
+  public:
+    void reset(int max_pos, int snap);
+    void setLimit(int max_pos);
+    void press(int y, unsigned long now);
+    void drag(int y, unsigned long now);
+    void release(unsigned long now);
+    void update(unsigned long now);
+    int getPos();
+    boolean getMoving();
+};
+
+struct RoomsView {
+  KineticScroll scroll;
+  int drawn_pos;                   // Scroll position on the screen
+  int drawn_page;
+  uint32_t revision;               // Rooms revision on the screen
+  unsigned long drawn_at;
+};
+
+/**
+ * @brief The screen state machine. Only one screen shows at a time, moving to another runs
+ * the old one's exit hook then the new one's enter and draw. The header and the nav bar stay
+ * on the screen through a move, the nav bar hook only changes the slots that differ.
+ *
+ */
+class Screens {
+  private:
+    const ScreenHooks *hooks = nullptr;
+    void (*nav)(ScreenId current, boolean whole) = nullptr;
+    ScreenId current = SCREEN_MAIN;
+
+  public:
+    void begin(const ScreenHooks *table, void (*nav_bar)(ScreenId current, boolean whole));
+    void go(ScreenId next, boolean force = false);
+    void redraw();
+    void update(unsigned long now);
+    void touch(TouchPhase phase, int x, int y, unsigned long now);
+    ScreenId getCurrent();
+    boolean is(ScreenId s);
+    const char* getName();
+};
+
+/**
+ * @brief Keep a position inside the list
+ *
+ * @param p
+ * @return float
+ */
+float KineticScroll::clamp(float p){
+  return p < 0 ? 0 : p > limit ? limit : p;
+}
+
+/**
+ * @brief Back to the top and stopped
+ *
+ * @param max_pos furthest it scrolls, the list height less what fits on the screen
+ * @param snap size of a row
+ */
+void KineticScroll::reset(int max_pos, int snap){
+  pos = 0;
+  velocity = 0;
+  dragging = false;
+  step = max(snap, 1);
+  setLimit(max_pos);
+}
+
+/**
+ * @brief The list grew or shrank
+ *
+ * @param max_pos
+ */
+void KineticScroll::setLimit(int max_pos){
+  limit = max(max_pos, 0);
+  pos = clamp(pos);
+}
+
+/**
+ * @brief A finger came down on the list, catches it if it was coasting
+ *
+ * @param y
+ * @param now
+ */
+void KineticScroll::press(int y, unsigned long now){
+  dragging = true;
+  velocity = 0;
+  last_y = y;
+  last_ms = now;
+}
+
+/**
+ * @brief The finger moved, the list moves with it and the speed is smoothed for the flick
+ *
+ * @param y
+ * @param now
+ */
+void KineticScroll::drag(int y, unsigned long now){
+  if(!dragging){
+    return;
+  }
+  int dy = y - last_y;
+  unsigned long dt = now - last_ms;
+  if(dy == 0){
+    return;
+  }
+  pos = clamp(pos - dy);
+  if(dt > 0){
+    velocity = (0.6f * (-dy / (float)dt)) + (0.4f * velocity);
+  }
+  last_y = y;
+  last_ms = now;
+}
+
+/**
+ * @brief The finger let go, the list coasts on at the speed it was moving
+ *
+ * @param now
+ */
+void KineticScroll::release(unsigned long now){
+  if(!dragging){
+    return;
+  }
+  dragging = false;
+  if(now - last_ms >= SCROLL_HELD_MS){
+    velocity = 0;
+  }
+  last_ms = now;
+}
+
+/**
+ * @brief Coast and slow down, or ease onto a row once slow enough. Call every pass of the loop.
+ *
+ * @param now
+ */
+void KineticScroll::update(unsigned long now){
+  if(dragging){
+    return;
+  }
+  unsigned long dt = now - last_ms;
+  last_ms = now;
+  if(dt == 0){
+    return;
+  }
+  float frames = dt / (float)SCROLL_FRAME_MS;
+  if(fabsf(velocity) >= SCROLL_MIN_SPEED){
+    float next = pos + (velocity * dt);
+    pos = clamp(next);
+    velocity = pos == next ? velocity * powf(SCROLL_FRICTION, frames) : 0;
+    return;
+  }
+  velocity = 0;
+  float target = clamp(roundf(pos / step) * step);
+  float moved = (target - pos) * min(1.0f, SCROLL_SNAP * frames);
+  pos = fabsf(target - pos) < 0.5f ? target : pos + moved;
+}
+
+/**
+ * @brief Returns the position in whole pixels
+ *
+ * @return int
+ */
+int KineticScroll::getPos(){
+  return (int)(pos + 0.5f);
+}
+
+/**
+ * @brief Whether it is being dragged, coasting or easing onto a row
+ *
+ * @return boolean
+ */
+boolean KineticScroll::getMoving(){
+  return dragging || velocity != 0 || pos != clamp(roundf(pos / step) * step);
+}
+
+/**
+ * @brief Set up the screens, nothing is drawn until the first go()
+ *
+ * @param table hooks for each ScreenId, in order
+ * @param nav_bar draws the nav bar for the current screen, every slot if whole otherwise
+ * only those that changed
+ */
+void Screens::begin(const ScreenHooks *table, void (*nav_bar)(ScreenId current, boolean whole)){
+  hooks = table;
+  nav = nav_bar;
+}
+
+/**
+ * @brief Move to another screen. Going to the screen already showing does nothing.
+ *
+ * @param next
+ * @param force start it over and draw all of it even if it is already showing, the nav bar too
+ */
+void Screens::go(ScreenId next, boolean force){
+  if(next == current && !force){
+    return;
+  }
+  ScreenId from = current;
+  if(hooks[from].exit) hooks[from].exit(next);
+  current = next;
+  if(hooks[next].enter) hooks[next].enter(from);
+  nav(current, force);
+  if(hooks[next].draw) hooks[next].draw();
+}
+
+/**
+ * @brief Draw the whole of the current screen again as it was, i.e. after the screen was off
+ *
+ */
+void Screens::redraw(){
+  nav(current, true);
+  if(hooks[current].draw) hooks[current].draw();
+}
+
+/**
+ * @brief Give the current screen a chance to draw what has changed
+ *
+ * @param now millis()
+ */
+void Screens::update(unsigned long now){
+  if(hooks[current].update) hooks[current].update(now);
+}
+
+/**
+ * @brief Hand a touch that wasn't on the nav bar to the current screen
+ *
+ * @param phase
+ * @param x screen coordinates
+ * @param y
+ * @param now millis()
+ */
+void Screens::touch(TouchPhase phase, int x, int y, unsigned long now){
+  if(hooks[current].touch) hooks[current].touch(phase, x, y, now);
+}
+
+/**
+ * @brief Returns the screen showing
+ *
+ * @return ScreenId
+ */
+ScreenId Screens::getCurrent(){
+  return current;
+}
+
+/**
+ * @brief Whether a screen is the one showing
+ *
+ * @param s
+ * @return boolean
+ */
+boolean Screens::is(ScreenId s){
+  return current == s;
+}
+
+/**
+ * @brief Returns the name of the screen showing
+ *
+ * @return const char*
+ */
+const char* Screens::getName(){
+  return screen_names[current];
+}
+
+#endif
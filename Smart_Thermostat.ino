@@ -15,16 +15,43 @@ overshooting the heating. Also controls the humidifier on the furnace.
 */
 #include "DHT.h"
 #include "WiFi.h"
+#include <HTTPClient.h>
+#include <WebServer.h>
+#include "esp_sntp.h"
 #include <Adafruit_FT6206.h>
 
 #include "Draw.h"
 #include "Thermostat.h"
+#include "Schedule_Json.h"
+#include "Rooms.h"
+#include "Room_Link.h"
+#include "Metrics.h"
+#include "History.h"
+#include "Event_Stream.h"
+#include "Web_Assets.h"
+#include "Firmware.h"
+#include "Trace.h"
+#include "Bench.h"
+#include "Power.h"
+#include "Screens.h"
 #include "secrets.h"
 
 #define DHTPIN 32
 #define HEATPIN 33
 #define HUMDPIN 27
 #define DHTTYPE DHT22
+#define LIGHTPIN NOPIN // Analog ambient light sensor on an ADC1 pin (i.e. 34), NOPIN to follow the day/night curve
+
+// Only the first heating stage is wired on this board, set any extra outputs here (see Equipment.h)
+EquipmentPins equipment = {
+  HEATPIN,  // heat
+  NOPIN,    // heat2
+  NOPIN,    // cool
+  NOPIN,    // cool2
+  NOPIN,    // fan
+  NOPIN,    // reversing
+  false     // heat_pump
+};
 
 DHT dht(DHTPIN, DHTTYPE);
 Adafruit_FT6206 ts = Adafruit_FT6206();
@@ -34,13 +61,28 @@ struct intervals {
   unsigned long prev = 0;
   unsigned long prev_wifi = 0;
   unsigned long prev_heat = 0;
+  unsigned long prev_outdoor = 0;
   unsigned long intv = 2000;
   unsigned long intv_wifi = 30000;
-  unsigned long intv_heat = 120000;
+  unsigned long intv_heat = 30000;
+  unsigned long intv_outdoor = 600000;
 } interval;
 
-Thermostat thermostat = Thermostat(HEATPIN, HUMDPIN);
+// The outdoor temperature is fetched on its own task, a slow weather source would stall the loop
+TaskHandle_t outdoor_task = nullptr;
+QueueHandle_t outdoor_temps = nullptr;
+
+Thermostat thermostat = Thermostat(equipment, HUMDPIN);
 Draw draw = Draw();
+StreamServer server(80);
+Events events;
+Rooms rooms;
+RoomLink room_link;
+MetricsWriter metrics;
+EventStream stream;
+History history;
+Firmware firmware;
+ScheduleParser schedule_parser;
 
 /**
  * @brief Holds the current (or old) temperature. Used to compare against incoming
@@ -48,32 +90,50 @@ Draw draw = Draw();
  * 
  */
 struct old{
-  float temp;
+  deci_celsius temp = DECI_INVALID;
   float humd;
+  boolean wifi = false;
+  int rssi = 0;
+  uint8_t bars = 0;
 } old;
 
-// Create a button object using the 4 corner coordinates
-struct Button {
-  int x, y, x2, y2;
-  Button(int x, int x2, int y, int y2):x(x), x2(x2), y(y), y2(y2){}
+// Each screen's context, kept while it is away so coming back to it allocates nothing
+MainView main_view;
+RoomsView rooms_view;
+ScheduleView schedule_view;
+SettingsView settings_view;
+
+// The hooks are further down, the table needs them declared before the sketch's own prototypes
+void drawMain();
+void updateMain(unsigned long now);
+void enterRooms(ScreenId from);
+void drawRooms();
+void updateRooms(unsigned long now);
+void touchRooms(TouchPhase phase, int x, int y, unsigned long now);
+void enterSchedule(ScreenId from);
+void drawSchedule();
+void touchSchedule(TouchPhase phase, int x, int y, unsigned long now);
+void exitSchedule(ScreenId to);
+void drawSettings();
+void updateSettings(unsigned long now);
+void touchSettings(TouchPhase phase, int x, int y, unsigned long now);
+
+// enter, draw, update, touch, exit for each ScreenId
+const ScreenHooks screen_hooks[SCREENS] = {
+  {nullptr, drawMain, updateMain, nullptr, nullptr},
+  {enterRooms, drawRooms, updateRooms, touchRooms, nullptr},
+  {enterSchedule, drawSchedule, nullptr, touchSchedule, exitSchedule},
+  {nullptr, drawSettings, updateSettings, touchSettings, nullptr}
 };
+Screens screens;
 
-// Define where each button is going to go on the screen
-struct Layout {
-  Button next_dow = Button(170, 210, 20, 80);
-  Button prev_dow = Button(30, 70, 20, 80);
-  Button menu_bar = Button(380, 480, 80, 320);
-  Button menu_rooms = Button(380, 480, 80, 160);
-  Button menu_sched = Button(380, 480, 160, 240);
-  Button menu_setting = Button(380,480, 240, 320);
-  Button hold = Button(0, 80, 130, 190);
-  Button up_hold = Button(80, 230, 110, 215);
-  Button down_hold = Button(80, 230, 215, 320);
-  Button up_humd = Button(230, 380, 110, 215);
-  Button down_humd = Button(230, 380, 215, 320);
-} Layout;
-
-char* nav[4] = {"Main","Rooms","Schedule","Settings"};
+// The touch in progress, from the first contact until it lets go
+struct touching {
+  boolean held = false;
+  boolean waking = false;   // It woke the screen up, nothing else happens until it lets go
+  unsigned long repeat_at = 0;
+  TS_Point at;
+} touching;
 
 // Internet and NTP information
 const char* ssid = SSID_NAME;
@@ -82,16 +142,49 @@ const char* ntpServer = "pool.ntp.org";
 const long gmtOffset_sec = -25200;
 const int daylightOffset_sec = 3600;
 
-int nav_current = 0;
+// Serial commands are read a character at a time into a fixed line
+char serial_line[32];
+uint8_t serial_len = 0;
+
+/**
+ * @brief Sends whatever is printed to it as chunks of the current HTTP response
+ * 
+ */
+class ChunkPrint : public Print {
+  private:
+    char buf[256];
+    size_t n = 0;
+  public:
+    size_t write(uint8_t c){
+      buf[n++] = c;
+      if(n == sizeof(buf) - 1) send();
+      return 1;
+    }
+    void send(){
+      if(!n) return;
+      buf[n] = '\0';
+      server.sendContent(buf);
+      n = 0;
+    }
+};
 
 
 void setup() {
   // Initialization of all the classes/objects needed
   Serial.begin(115200);
+  event_log.begin();
+  firmware.begin();
+  profiler.begin();
+  sntp_set_time_sync_notification_cb(timeSynced);
   configTime(gmtOffset_sec, daylightOffset_sec, ntpServer);
   dht.begin();
   initWiFi();
-  thermostat.begin();
+  startOutdoor();
+  thermostat.begin(events);
+  initServer();
+  if(!room_link.begin()){
+    Serial.println("Couldn't listen for room modules");
+  }
 
   if (!ts.begin(18, 19, 40)) {
     Serial.println("Couldn't start touchscreen controller");
@@ -99,193 +192,1750 @@ void setup() {
   }
 
   draw.begin();
+  backlight.begin(TFT_BL, LIGHTPIN);
+  power.begin(millis());
+  screens.begin(screen_hooks, drawNavBar);
   // Draw the main landing screen
-  draw.main(old.temp, old.humd, thermostat.getGoalTemp(), thermostat.getGoalHumd(), thermostat.getHold());
+  screens.go(SCREEN_MAIN, true);
 }
 
 void loop() {
+  if(!runLoop()){
+    // Nothing more to do until the next tick or event, the loop only sleeps once the screen is off
+    power.sleep(untilTick(clockMillis()));
+  }
+}
+
+/**
+ * @brief One pass of the loop
+ * 
+ * @return boolean true if the screen was touched
+ */
+boolean runLoop(){
+  PROFILE(PROF_LOOP);
+  unsigned long now = millis();
+  tick(clockMillis());
+
+  {
+    PROFILE(PROF_HTTP);
+    server.handleClient();
+  }
+  room_link.poll(rooms, clockMillis());
+  checkOutdoor();
+  checkSerial();
+
+  // Dim then turn off the screen when it's left alone, nothing is drawn while it's off
+  if(power.update(now)){
+    draw.setVisible(power.getScreenOn());
+  }
+  if(power.getScreenOn()){
+    screens.update(clockMillis());
+  }
+  return checkTouch(now);
+}
+
+/**
+ * @brief Follow a touch from the first contact until it lets go. Buttons get the press and a
+ * repeat every TOUCH_REPEAT_MS while it's held, the screen gets every drag.
+ * 
+ * @param now 
+ * @return boolean true while the screen is touched
+ */
+boolean checkTouch(unsigned long now){
+  if(!ts.touched()){
+    if(touching.held && !touching.waking){
+      trace.add(TRACE_TOUCH, TOUCH_RELEASE, touching.at.x, touching.at.y, clockMillis());
+      handleTouch(TOUCH_RELEASE, touching.at);
+    }
+    touching.held = false;
+    return false;
+  }
+  TS_Point p = ts.getPoint();
+  boolean woke = wakeScreen();
+  if(!touching.held){
+    // A touch that wakes the screen up isn't a button press
+    touching.held = true;
+    touching.waking = woke;
+    touching.repeat_at = now;
+    if(!woke){
+      trace.add(TRACE_TOUCH, TOUCH_PRESS, p.x, p.y, clockMillis());
+      handleTouch(TOUCH_PRESS, p);
+    }
+  } else if(!touching.waking){
+    if(now - touching.repeat_at >= TOUCH_REPEAT_MS){
+      touching.repeat_at = now;
+      trace.add(TRACE_TOUCH, TOUCH_REPEAT, p.x, p.y, clockMillis());
+      handleTouch(TOUCH_REPEAT, p);
+    }
+    // Drags are traced only when the finger moves, a resting finger would fill the trace
+    if(p.x != touching.at.x || p.y != touching.at.y){
+      trace.add(TRACE_TOUCH, TOUCH_DRAG, p.x, p.y, clockMillis());
+    }
+    handleTouch(TOUCH_DRAG, p);
+  }
+  touching.at = p;
+  return true;
+}
+
+/**
+ * @brief Time until tick() next has something to do
+ * 
+ * @param now 
+ * @return unsigned long ms, 0 if it's due
+ */
+unsigned long untilTick(unsigned long now){
+  unsigned long since = now - interval.prev;
+  if(since >= interval.intv){
+    return 0;
+  }
+  return min(interval.intv - since, events.untilNext(now));
+}
+
+/**
+ * @brief Turn the screen back on if it was off and draw everything on it again
+ * 
+ * @return boolean true if it was off
+ */
+boolean wakeScreen(){
+  if(!power.touch(millis())){
+    return false;
+  }
+  draw.setVisible(true);
+  drawScreen();
+  power.frameDrawn();
+  return true;
+}
+
+/**
+ * @brief Draw the whole of the current screen, header and nav bar included
+ * 
+ */
+void drawScreen(){
+  screens.redraw();
+  draw.time();
+  draw.wifi(455, 35, old.bars);
+}
+
+/**
+ * @brief Everything the loop does on a timer, split out so a trace replay can run it
+ * with the trace's clock
+ * 
+ * @param current 
+ */
+void tick(unsigned long current){
+  boolean replaying = trace.getReplaying();
+  events.run(current);
   // Update the onboard temp/humidity every 2 seconds. This might be a bit aggressive.
-  unsigned long current = millis();
   if(current - interval.prev >= interval.intv){
     interval.prev = current;
     // Update the sensor readings
-    old.temp = getDHTTemp(old.temp, nav[nav_current]);
-    old.humd = getDHTHum(old.humd, nav[nav_current]);
+    {
+      PROFILE(PROF_DHT);
+      old.temp = getDHTTemp(old.temp);
+      old.humd = getDHTHum(old.humd);
+      trace.dht(old.temp, old.humd, current);
+    }
     // Draw the date string at the top of the screen
-    draw.time();
+    {
+      PROFILE(PROF_TIME);
+      draw.time();
+    }
+
+    // Move into a new scheduled slot, the main screen draws the new goal itself
+    {
+      PROFILE(PROF_SCHEDULE);
+      thermostat.checkSchedule();
+    }
 
-    // If the time has moved into a new scheduled slot then draw the goal temp again
-    if(thermostat.checkSchedule()){
-      draw.goalTemp(thermostat.getHold(), thermostat.getGoalTemp());
+    // Outdoor temperature only changes slowly, it is used to keep the windows from condensing
+    if(!replaying && (interval.prev_outdoor == 0 || current - interval.prev_outdoor >= interval.intv_outdoor)){
+      getOutdoorTemp();
+      interval.prev_outdoor = current;
     }
 
-    // Turn heating/humidity on/off every 5 minutes ( to avoid constantly turning on furnace )
+    // Decide on heating/humidity every 30 seconds, the relay governor keeps the furnace from short cycling
+    thermostat.update();
     if(current - interval.prev_heat >= interval.intv_heat){
+      PROFILE(PROF_TEMPERATURE);
       thermostat.keepTemperature(old.temp);
-      thermostat.keepHumidity(old.humd);
+      thermostat.keepHumidity(old.humd, old.temp);
       interval.prev_heat = current;
+      // A new firmware image is only kept once it has run the control loop for a while
+      if(isValid(old.temp) && !replaying){
+        firmware.healthy();
+      }
     }
     
     // Attempt to reconnect to wifi if disconnected
-    checkWifi();
+    {
+      PROFILE(PROF_WIFI);
+      checkWifi();
+    }
+    // The rest is network and dashboards, none of it is replayed
+    if(replaying){
+      return;
+    }
     if((WiFi.status() != WL_CONNECTED) && (current - interval.prev_wifi >= interval.intv_wifi)){
       WiFi.disconnect();
       WiFi.reconnect();
       interval.prev_wifi = current;
     }
+
+    // Push anything that changed to the dashboards
+    publishState(current);
+    if(history.due(current)){
+      addHistory(current);
+    }
+    stream.heartbeat(current);
+    firmware.check(current);
     interval.prev = current;
   }
-    
-  // Restart loop if the screen hasn't been touched
-  if (! ts.touched()) {
-    return;
+}
+
+/**
+ * @brief Handle input from screen. The nav bar is the same on every screen and is handled
+ * here, anything else goes to the screen showing. What was touched comes from the tables in
+ * Screen_Layout.h, the same ones it was drawn from.
+ * 
+ * @param phase 
+ * @param p raw from the touch controller
+ */
+void handleTouch(TouchPhase phase, TS_Point p){
+  PROFILE(PROF_TOUCH);
+  TouchPoint t = touchToScreen(p.x, p.y);
+  int x = t.x;
+  int y = t.y;
+  if(phase == TOUCH_PRESS || phase == TOUCH_REPEAT){
+    logEvent(LOG_TOUCH, screens.getCurrent(), x, y);
   }
 
-  handleTouch(ts.getPoint(), nav[nav_current]);
+  // Only the first touch moves between screens, holding the top slot doesn't go back and forth
+  if(phase == TOUCH_PRESS){
+    switch(hitTest(nav_bar, x, y, navState(screens.is(SCREEN_MAIN)))){
+      case W_MENU_ROOMS:
+        screens.go(SCREEN_ROOMS);
+        return;
+      case W_MENU_SCHEDULE:
+        screens.go(SCREEN_SCHEDULE);
+        return;
+      case W_MENU_SETTINGS:
+        screens.go(SCREEN_SETTINGS);
+        return;
+      case W_BACK:
+        screens.go(SCREEN_MAIN);
+        return;
+      default:
+        break;
+    }
+  }
+  screens.touch(phase, x, y, clockMillis());
+}
 
-  delay(250); // Delay to reduce loop rate (reduces flicker caused by aliasing with TFT screen refresh rate)
+/**
+ * @brief Draws the nav bar with the icon of the screen showing lit
+ * 
+ * @param current 
+ * @param whole every slot, not only those that changed
+ */
+void drawNavBar(ScreenId current, boolean whole){
+  const WidgetId lit[SCREENS] = {W_NONE, W_NONE, W_MENU_SCHEDULE, W_MENU_SETTINGS};
+  draw.navBar(navState(current == SCREEN_MAIN), lit[current], whole);
 }
 
 /**
- * @brief Handle input from screen
+ * @brief Draws the main screen and remembers what it showed
  * 
- * @param p 
- * @param screen 
  */
-void handleTouch(TS_Point p, char* screen){
-  int y = p.x;
-  int x = map(p.y, 0, 480, 480, 0);
+void drawMain(){
+  MainView &v = main_view;
+  v.temp = old.temp;
+  v.humd = old.humd;
+  v.goal = thermostat.getGoalTemp();
+  v.goal_humd = thermostat.getGoalHumd();
+  v.holding = thermostat.getHold();
+  v.hold_left = thermostat.getHoldRemaining();
+  draw.main(v.temp, v.humd, v.goal, v.goal_humd, v.holding, v.hold_left);
+}
 
-  // Handle all buttons that would appear on the main screen
-  if (screen == "Main"){
-    // Check to see if the touch was inside the menu bar (for now it's the only buttons on main anyways)
-    if(isButton(x, y, Layout.menu_bar)){
-      if(isButton(x, y, Layout.menu_rooms)){
-        nav_current = 1;
-        draw.rooms();
-      } else if(isButton(x, y, Layout.menu_sched)){
-        nav_current = 2;
-        String slots[10];
-        thermostat.daySlots(slots);
-        draw.schedule(slots, thermostat.getShortDow());
-      } else if(isButton(x, y, Layout.menu_setting)){
-        nav_current = 3;
-        draw.settings(thermostat.getHold(), thermostat.getHoldTemp(), thermostat.getGoalHumd());
-      }
-    }
-  } else {
-    // Check to see if the back button was pressed on the other screens
-    if(isButton(x,y, Layout.menu_bar)){
-      if(isButton(x, y, Layout.menu_rooms)){
-        nav_current = 0;
-        draw.main(old.temp, old.humd, thermostat.getGoalTemp(), thermostat.getGoalHumd(), thermostat.getHold());
-      }
-    }
+/**
+ * @brief Draws each value on the main screen again when it changes, whether that is a
+ * sensor reading, a new schedule slot, the hold counting down or a change from the web
+ * 
+ * @param now 
+ */
+void updateMain(unsigned long now){
+  MainView &v = main_view;
+  if(old.temp != v.temp){
+    v.temp = old.temp;
+    draw.dhtTemp(v.temp);
+  }
+  // A failed read is NaN, which never equals itself
+  if(old.humd != v.humd && !(isnan(old.humd) && isnan(v.humd))){
+    v.humd = old.humd;
+    draw.dhtHumd(v.humd);
+  }
+  deci_celsius goal = thermostat.getGoalTemp();
+  boolean holding = thermostat.getHold();
+  int hold_left = thermostat.getHoldRemaining();
+  if(goal != v.goal || holding != v.holding || hold_left != v.hold_left){
+    v.goal = goal;
+    v.holding = holding;
+    v.hold_left = hold_left;
+    draw.goalTemp(holding, goal, hold_left);
   }
+  float goal_humd = thermostat.getGoalHumd();
+  if(goal_humd != v.goal_humd){
+    v.goal_humd = goal_humd;
+    draw.goalHumd(goal_humd);
+  }
+}
 
-  // Settings has most of the buttons right now, this handles the control of holding a temp or setting
-  // the current humidity goal
-  if(screen == "Settings"){
-    boolean touched_button = false;
-    if(isButton(x, y, Layout.up_humd)){
-      thermostat.setTargetHumidity(thermostat.getGoalHumd() + 1);
-      touched_button = true;
-    }
-    if(isButton(x, y, Layout.down_humd)){
-      thermostat.setTargetHumidity(thermostat.getGoalHumd() - 1);
-      touched_button = true;
-    }
-    if(isButton(x, y, Layout.up_hold)){
-      thermostat.setHoldTemp(thermostat.getHoldTemp() + 0.5f);
-      touched_button = true;
-    }
-    if(isButton(x, y, Layout.down_hold)){
-      thermostat.setHoldTemp(thermostat.getHoldTemp() - 0.5f);
-      touched_button = true;
-    }
-    if(isButton(x, y, Layout.hold)){
-      thermostat.toggleHold();
-      touched_button = true;
-    }
-    // Only redraw the screen when a change has been made/button touched
-    if(touched_button) 
-      draw.settings(thermostat.getHold(), thermostat.getHoldTemp(), thermostat.getGoalHumd());
+/**
+ * @brief The room list starts at the top
+ * 
+ * @param from 
+ */
+void enterRooms(ScreenId from){
+  rooms_view.scroll.reset(roomScrollLimit(rooms.getCount()), ROOM_ROW_H);
+}
+
+/**
+ * @brief Draws the room list where it is scrolled to, with the title
+ * 
+ */
+void drawRooms(){
+  RoomsView &v = rooms_view;
+  v.drawn_pos = v.scroll.getPos();
+  v.drawn_page = roomPage(v.drawn_pos);
+  v.revision = rooms.getRevision();
+  v.drawn_at = clockMillis();
+  draw.rooms(rooms, v.drawn_pos, v.drawn_at, true);
+}
+
+/**
+ * @brief Moves the list on and draws a frame if it moved. Standing still it is drawn again
+ * when a room reports or a minute has gone by, for the ages.
+ * 
+ * @param now 
+ */
+void updateRooms(unsigned long now){
+  RoomsView &v = rooms_view;
+  v.scroll.setLimit(roomScrollLimit(rooms.getCount()));
+  v.scroll.update(now);
+  int pos = v.scroll.getPos();
+  boolean changed = rooms.getRevision() != v.revision || clockMillis() - v.drawn_at >= 60000;
+  if(pos == v.drawn_pos && !changed){
+    return;
+  }
+  int page = roomPage(pos);
+  boolean title = changed || page != v.drawn_page;
+  v.drawn_pos = pos;
+  v.drawn_page = page;
+  if(changed){
+    v.revision = rooms.getRevision();
+    v.drawn_at = clockMillis();
+  }
+  draw.rooms(rooms, pos, clockMillis(), title);
+}
+
+/**
+ * @brief The list follows a finger that came down on it and coasts on when it lets go
+ * 
+ * @param phase 
+ * @param x 
+ * @param y 
+ * @param now 
+ */
+void touchRooms(TouchPhase phase, int x, int y, unsigned long now){
+  KineticScroll &scroll = rooms_view.scroll;
+  if(phase == TOUCH_PRESS && Layout::room_list.hit().contains(x, y)){
+    scroll.press(y, now);
+  } else if(phase == TOUCH_DRAG){
+    scroll.drag(y, now);
+  } else if(phase == TOUCH_RELEASE){
+    scroll.release(now);
   }
+}
+
+/**
+ * @brief The schedule starts on its first slot
+ * 
+ * @param from 
+ */
+void enterSchedule(ScreenId from){
+  schedule_view.scroll = 0;
+}
 
-  // Navigate through to view the weeks schedule
-  if(screen == "Schedule"){
-    if(isButton(x, y, Layout.prev_dow)){
+/**
+ * @brief Leaving the schedule screen throws away anything that wasn't saved
+ * 
+ * @param to 
+ */
+void exitSchedule(ScreenId to){
+  thermostat.cancelEdit();
+}
+
+/**
+ * @brief Navigate through to view the weeks schedule, and edit it
+ * 
+ * @param phase 
+ * @param x 
+ * @param y 
+ * @param now 
+ */
+void touchSchedule(TouchPhase phase, int x, int y, unsigned long now){
+  if(phase != TOUCH_PRESS && phase != TOUCH_REPEAT){
+    return;
+  }
+  int &scroll = schedule_view.scroll;
+  ScheduleEditor &editor = thermostat.getEditor();
+  boolean touched_button = true;
+  WidgetId hit = hitTest(schedule_screen, x, y, scheduleState(editor.isEditing(), editor.hasCopy()));
+  switch(hit){
+    case W_PREV_DAY:
       thermostat.prevDisplayDay();
-      String slots[10];
-      thermostat.daySlots(slots);
-      draw.schedule(slots, thermostat.getShortDow());
-    }
-    if (isButton(x, y, Layout.next_dow)){
+      editor.select(thermostat.getDisplayDay(), 0);
+      scroll = 0;
+      break;
+    case W_NEXT_DAY:
       thermostat.nextDisplayDay();
-      String slots[10];
-      thermostat.daySlots(slots);
-      draw.schedule(slots, thermostat.getShortDow());
-    }
+      editor.select(thermostat.getDisplayDay(), 0);
+      scroll = 0;
+      break;
+    case W_SCROLL_UP:
+      touched_button = scroll > 0;
+      if(touched_button) scroll--;
+      break;
+    case W_SCROLL_DOWN:
+      scroll++;
+      break;
+    case W_EDIT:
+      thermostat.beginEdit();
+      break;
+    default:
+      touched_button = editSchedule(hit, y, editor, thermostat.getDisplayDay());
+  }
+  if(touched_button)
+    drawSchedule();
+}
+
+/**
+ * @brief Handles the buttons that are only on the schedule screen while editing
+ * 
+ * @param hit what was touched
+ * @param y 
+ * @param editor 
+ * @param d displayed day
+ * @return boolean true if the screen needs redrawing
+ */
+boolean editSchedule(WidgetId hit, int y, ScheduleEditor &editor, int d){
+  switch(hit){
+    case W_SAVE:
+      if(!thermostat.commitEdit()){
+        draw.notice("Invalid schedule");
+        return false;
+      }
+      return true;
+    case W_CANCEL:
+      thermostat.cancelEdit();
+      return true;
+    case W_ROWS:
+      return editor.select(d, schedule_view.scroll + ((y - Layout::rows.box.y) / SCHED_ROW_H));
+    case W_ADD:
+      return editor.addSlot(d);
+    case W_DEL:
+      return editor.deleteSlot(d);
+    case W_COPY:
+      editor.copy(d);
+      return true;
+    case W_PASTE:
+      return editor.paste(d);
+    case W_TIME_DOWN:
+      return editor.moveSlot(d, -SLOT_STEP);
+    case W_TIME_UP:
+      return editor.moveSlot(d, SLOT_STEP);
+    case W_HEAT_DOWN:
+      return editor.changeHeat(d, -deci(0, 5));
+    case W_HEAT_UP:
+      return editor.changeHeat(d, deci(0, 5));
+    case W_COOL_DOWN:
+      return editor.changeCool(d, -deci(0, 5));
+    case W_COOL_UP:
+      return editor.changeCool(d, deci(0, 5));
+    default:
+      return false;
+  }
+}
+
+/**
+ * @brief Draws the schedule screen for the displayed day, scrolled so the slot being
+ * edited is always in view
+ * 
+ */
+void drawSchedule(){
+  int &scroll = schedule_view.scroll;
+  ScheduleEditor &editor = thermostat.getEditor();
+  int count = thermostat.getSlotCount();
+  if(editor.isEditing()){
+    int selected = editor.getSelected();
+    if(selected < scroll) scroll = selected;
+    if(selected >= scroll + SCHED_ROWS) scroll = selected - SCHED_ROWS + 1;
+  }
+  scroll = constrain(scroll, 0, max(0, count - SCHED_ROWS));
+  String slots[10];
+  thermostat.daySlots(slots);
+  draw.schedule(slots, count, thermostat.getShortDow(), editor.isEditing(), editor.getSelected(), scroll, editor.hasCopy());
+}
+
+/**
+ * @brief Draws the settings screen and remembers what it showed
+ * 
+ */
+void drawSettings(){
+  SettingsView &v = settings_view;
+  v.hold = thermostat.getHoldType();
+  v.mode = thermostat.getMode();
+  v.hold_temp = thermostat.getHoldTemp();
+  v.humd = thermostat.getHumdSetpoint();
+  draw.settings(thermostat.getHoldName(), v.hold_temp, v.humd, thermostat.getModeName());
+}
+
+/**
+ * @brief Draws the settings again when any of them change, from the screen, the web or a
+ * hold running out
+ * 
+ * @param now 
+ */
+void updateSettings(unsigned long now){
+  SettingsView &v = settings_view;
+  if(v.hold != thermostat.getHoldType() || v.mode != thermostat.getMode() ||
+     v.hold_temp != thermostat.getHoldTemp() || v.humd != thermostat.getHumdSetpoint()){
+    drawSettings();
   }
 }
 
 /**
- * @brief Checks to see if the touched coordinates are inside the button
+ * @brief Settings has most of the buttons right now, this handles the control of holding a
+ * temp or setting the current humidity goal. The screen is drawn again by updateSettings().
  * 
+ * @param phase 
  * @param x 
  * @param y 
- * @param button 
- * @return boolean 
+ * @param now 
  */
-boolean isButton(int &x, int &y, Button &button){
-  if((x > button.x && x < button.x2) && (y > button.y && y < button.y2))
-    return true;
-  else
-    return false;
+void touchSettings(TouchPhase phase, int x, int y, unsigned long now){
+  if(phase != TOUCH_PRESS && phase != TOUCH_REPEAT){
+    return;
+  }
+  switch(hitTest(settings_screen, x, y)){
+    case W_HUMD_UP:
+      thermostat.setTargetHumidity(thermostat.getHumdSetpoint() + 1);
+      break;
+    case W_HUMD_DOWN:
+      thermostat.setTargetHumidity(thermostat.getHumdSetpoint() - 1);
+      break;
+    case W_HOLD_UP:
+      thermostat.setHoldTemp(thermostat.getHoldTemp() + deci(0, 5));
+      break;
+    case W_HOLD_DOWN:
+      thermostat.setHoldTemp(thermostat.getHoldTemp() - deci(0, 5));
+      break;
+    case W_HOLD:
+      thermostat.nextHold();
+      break;
+    case W_MODE:
+      thermostat.nextMode();
+      break;
+    default:
+      break;
+  }
 }
 
-// Update the screen with the temperature
-float getDHTTemp(float old_temp, char* screen){
-  float temp = dht.readTemperature();
-  if (temp != old_temp && screen == "Main"){
-    draw.dhtTemp(temp);
+// Read the temperature, the main screen draws it when the displayed tenth of a degree changes
+deci_celsius getDHTTemp(deci_celsius old_temp){
+  deci_celsius temp = trace.getReplaying() ? trace.getInputs().temp : toDeci(dht.readTemperature());
+  if(isValid(temp) != isValid(old_temp)){
+    logEvent(LOG_SENSOR, SENSOR_TEMP, !isValid(temp));
   }
   return temp;
 }
 
-// Update the screen with the humidity
-float getDHTHum(float old_humd, char* screen){
-  float humd = dht.readHumidity();
-  if (humd != old_humd && screen == "Main"){
-    draw.dhtHumd(humd);
+// Read the humidity
+float getDHTHum(float old_humd){
+  float humd = trace.getReplaying() ? trace.getInputs().humd : dht.readHumidity();
+  if(isnan(humd) != isnan(old_humd)){
+    logEvent(LOG_SENSOR, SENSOR_HUMD, isnan(humd));
   }
   return humd;
 }
 
-// Turn on the wifi and connect
-void initWiFi(){
-  WiFi.mode(WIFI_STA);
-  WiFi.begin(ssid, password);
-  while(WiFi.status() != WL_CONNECTED) {
-    delay(500);
+/**
+ * @brief Fetch the outdoor temperature from a local weather source. OUTDOOR_URL can be set in
+ * secrets.h to anything that answers a GET with the temperature in celsius as plain text,
+ * e.g. a Home Assistant template sensor. Without it humidity is held at the users setting.
+ * Runs on its own task, woken by getOutdoorTemp(), and leaves the reading for checkOutdoor().
+ * 
+ * @param arg 
+ */
+void outdoorTask(void *arg){
+  for(;;){
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+#ifdef OUTDOOR_URL
+    if(WiFi.status() != WL_CONNECTED){
+      continue;
+    }
+    HTTPClient http;
+    http.setTimeout(2000);
+    http.begin(OUTDOOR_URL);
+    if(http.GET() == HTTP_CODE_OK){
+      String body = http.getString();
+      body.trim();
+      if(body.length() && (isDigit(body[0]) || body[0] == '-')){
+        deci_celsius temp = parseDeci(body.c_str());
+        xQueueOverwrite(outdoor_temps, &temp);
+      }
+    }
+    http.end();
+#endif
   }
 }
 
 /**
- * @brief Check the strength of the wifi and call the draw.wifi with the current strength
+ * @brief Start the outdoor temperature task, only when there is an OUTDOOR_URL to fetch
  * 
  */
-void checkWifi(){
-  if(WiFi.status() != WL_CONNECTED){
-    draw.wifi(455,35,0);
+void startOutdoor(){
+#ifdef OUTDOOR_URL
+  outdoor_temps = xQueueCreate(1, sizeof(deci_celsius));
+  xTaskCreate(outdoorTask, "outdoor", 6144, nullptr, 1, &outdoor_task);
+#endif
+}
+
+/**
+ * @brief Ask the outdoor task for a new reading, it comes back through checkOutdoor()
+ * 
+ */
+void getOutdoorTemp(){
+  if(outdoor_task){
+    xTaskNotifyGive(outdoor_task);
+  }
+}
+
+/**
+ * @brief Take the reading the outdoor task left, if there is one
+ * 
+ */
+void checkOutdoor(){
+  deci_celsius temp;
+  if(outdoor_temps && !trace.getReplaying() && xQueueReceive(outdoor_temps, &temp, 0) == pdTRUE){
+    thermostat.setOutdoorTemp(temp);
+    trace.add(TRACE_OUTDOOR, 0, temp, 0, clockMillis());
+  }
+}
+
+/**
+ * @brief Set up the HTTP API
+ * GET /schedule returns the weekly schedule as JSON, PUT /schedule replaces it (see Schedule_Json.h)
+ * GET/POST/DELETE /exceptions lists, adds and removes dated exceptions
+ * POST/DELETE /hold starts or cancels a hold
+ * POST /presence is how room modules report someone in the room, POST /rooms their readings
+ * GET /rooms lists the room modules and their last readings
+ * GET /occupancy returns the learned occupancy, POST turns setback on or off
+ * GET /log returns the event log decoded, ?saved=1 for the copy saved by the last fault
+ * GET /profile returns how long each part of the loop takes, ?reset=1 starts over
+ * GET /metrics for Prometheus
+ * GET /bench runs the benchmarks, ?only=draw for the ones starting with draw
+ * GET /trace downloads the recorded trace, PUT /trace uploads one, POST /trace?action=start|stop|replay
+ * GET /events streams the live state to the dashboard, GET /history is the last day of it
+ * POST /settings changes the mode or humidity
+ * POST /update fetches new firmware from a URL, PUT /update takes it as the body, GET /update for progress
+ * Anything else is looked up in the dashboard files
+ * 
+ */
+void initServer(){
+  const char *headers[1] = {"If-None-Match"};
+  server.collectHeaders(headers, 1);
+  server.on("/schedule", HTTP_GET, handleGetSchedule);
+  server.on("/schedule", HTTP_PUT, handlePutSchedule, handleScheduleBody);
+  server.on("/exceptions", HTTP_GET, handleGetExceptions);
+  server.on("/exceptions", HTTP_POST, handleAddException);
+  server.on("/exceptions", HTTP_DELETE, handleRemoveException);
+  server.on("/hold", HTTP_POST, handleHold);
+  server.on("/hold", HTTP_DELETE, handleHold);
+  server.on("/presence", HTTP_POST, handlePresence);
+  server.on("/rooms", HTTP_GET, handleGetRooms);
+  server.on("/rooms", HTTP_POST, handleRoomReading);
+  server.on("/occupancy", HTTP_GET, handleGetOccupancy);
+  server.on("/occupancy", HTTP_POST, handleSetOccupancy);
+  server.on("/log", HTTP_GET, handleLog);
+  server.on("/profile", HTTP_GET, handleProfile);
+  server.on("/metrics", HTTP_GET, handleMetrics);
+  server.on("/events", HTTP_GET, handleEvents);
+  server.on("/history", HTTP_GET, handleHistory);
+  server.on("/settings", HTTP_POST, handleSettings);
+  server.on("/backlight", HTTP_GET, handleGetBacklight);
+  server.on("/backlight", HTTP_POST, handleSetBacklight);
+  server.on("/bench", HTTP_GET, handleBench);
+  server.on("/trace", HTTP_GET, handleGetTrace);
+  server.on("/trace", HTTP_PUT, handlePutTrace, handleTraceBody);
+  server.on("/trace", HTTP_POST, handleTrace);
+  server.on("/update", HTTP_GET, handleUpdateStatus);
+  server.on("/update", HTTP_POST, handleDownloadUpdate);
+  server.on("/update", HTTP_PUT, handlePutUpdate, handleUpdateBody);
+  server.onNotFound(handleAsset);
+  server.begin();
+}
+
+/**
+ * @brief Streams the schedule out a day at a time from a fixed buffer
+ * 
+ */
+void handleGetSchedule(){
+  char buf[512];
+  const struct Schedule *week = thermostat.getWeek();
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", "");
+  for(int d = 0; d < 7; d++){
+    scheduleDayJson(buf, sizeof(buf), week[d], d);
+    server.sendContent(buf);
+  }
+  server.sendContent("");
+}
+
+/**
+ * @brief Feeds the request body to the parser as it comes off the socket
+ * 
+ */
+void handleScheduleBody(){
+  HTTPRaw &raw = server.raw();
+  if(raw.status == RAW_START){
+    schedule_parser.begin();
+  } else if(raw.status == RAW_WRITE){
+    schedule_parser.feed(raw.buf, raw.currentSize);
+  }
+}
+
+/**
+ * @brief Called once the whole body has been parsed, applies the schedule if it is valid
+ * 
+ */
+void handlePutSchedule(){
+  char buf[80];
+  if(!schedule_parser.finish()){
+    snprintf(buf, sizeof(buf), "{\"error\":\"%s\",\"at\":%u}", schedule_parser.getError(), (unsigned)schedule_parser.getErrorPos());
+    server.send(400, "application/json", buf);
+  } else if(!thermostat.setWeek(schedule_parser.getWeek())){
+    server.send(500, "application/json", "{\"error\":\"could not save\"}");
+  } else {
+    server.send(204);
+    if(screens.is(SCREEN_SCHEDULE)){
+      drawSchedule();
+    }
+  }
+  // Start clean so a request without a body can't reuse this one
+  schedule_parser.begin();
+}
+
+/**
+ * @brief Lists the dated exceptions, the index is what DELETE takes
+ * 
+ */
+void handleGetExceptions(){
+  char buf[160];
+  char heat[8];
+  char cool[8];
+  Exceptions &exceptions = thermostat.getExceptions();
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", "[");
+  for(int i = 0; i < exceptions.getCount(); i++){
+    const ScheduleException *e = exceptions.get(i);
+    snprintf(buf, sizeof(buf), "%s{\"index\":%d,\"kind\":\"%s\",\"start\":%lu,\"end\":%lu,\"day\":\"%s\",\"heat\":%s,\"cool\":%s}",
+      i == 0 ? "" : ",", i, e->kind == EXC_DAY ? "day" : "vacation", (unsigned long)e->start, (unsigned long)e->end,
+      e->day == NO_DAY ? "" : json_days[e->day], formatDeci(heat, e->heat), formatDeci(cool, e->cool));
+    server.sendContent(buf);
+  }
+  server.sendContent("]");
+  server.sendContent("");
+}
+
+/**
+ * @brief Adds a vacation or day override
+ * kind=vacation|day, from=2026-12-24, to=2026-12-26 (inclusive, defaults to from),
+ * then either heat=16&cool=28 (cool defaults to heat plus the deadband) or day=sun to
+ * run another weekday's slots
+ * 
+ */
+void handleAddException(){
+  ScheduleException e = {};
+  uint32_t to;
+  e.kind = server.arg("kind") == "day" ? EXC_DAY : EXC_VACATION;
+  e.day = NO_DAY;
+  e.heat = DECI_INVALID;
+  e.cool = DECI_INVALID;
+  if(!parseDate(server.arg("from").c_str(), e.start)){
+    server.send(400, "text/plain", "bad from date");
+    return;
+  }
+  if(!server.hasArg("to")){
+    to = e.start;
+  } else if(!parseDate(server.arg("to").c_str(), to)){
+    server.send(400, "text/plain", "bad to date");
+    return;
+  }
+  // The end is exclusive, midnight after the last day
+  struct tm t;
+  time_t end = to;
+  localtime_r(&end, &t);
+  t.tm_mday++;
+  t.tm_isdst = -1;
+  e.end = mktime(&t);
+  for(int d = 0; d < 7; d++){
+    if(server.arg("day") == json_days[d]) e.day = d;
+  }
+  if(server.hasArg("heat")){
+    e.heat = parseDeci(server.arg("heat").c_str());
+    e.cool = server.hasArg("cool") ? parseDeci(server.arg("cool").c_str()) : e.heat + DEADBAND;
+    if(e.heat < MIN_TARGET || e.cool > MAX_TARGET || e.cool - e.heat < DEADBAND){
+      server.send(400, "text/plain", "bad temperature");
+      return;
+    }
+  }
+  if(!thermostat.addException(e)){
+    server.send(400, "text/plain", "invalid or full");
+    return;
+  }
+  server.send(204);
+}
+
+/**
+ * @brief Removes an exception, index=N from the list
+ * 
+ */
+void handleRemoveException(){
+  if(!server.hasArg("index") || !thermostat.removeException(server.arg("index").toInt())){
+    server.send(404, "text/plain", "no such exception");
     return;
   }
-  int strength = WiFi.RSSI();
-  if(strength > -50){
-    draw.wifi(455, 35, 3);
-  } else if(strength > -70){
-    draw.wifi(455, 35, 2);
+  server.send(204);
+}
+
+/**
+ * @brief POST temp=22.5&minutes=120 holds for that long, until=next holds until the next
+ * schedule slot and neither holds until cancelled. DELETE goes back to the schedule
+ * 
+ */
+void handleHold(){
+  if(server.method() == HTTP_DELETE){
+    thermostat.setHold(HOLD_OFF, 0);
   } else {
-    draw.wifi(455, 35, 1);
+    deci_celsius temp = server.hasArg("temp") ? parseDeci(server.arg("temp").c_str()) : thermostat.getHoldTemp();
+    if(temp < MIN_TARGET || temp > MAX_TARGET){
+      server.send(400, "text/plain", "bad temperature");
+      return;
+    }
+    if(server.arg("until") == "next"){
+      thermostat.setHoldTemp(temp);
+      thermostat.setHold(HOLD_NEXT_SLOT, 0);
+    } else {
+      thermostat.holdFor(temp, server.arg("minutes").toInt());
+    }
+  }
+  server.send(204);
+}
+
+/**
+ * @brief room=kitchen, a room module's presence sensor saw someone
+ * 
+ */
+void handlePresence(){
+  int room = rooms.add(server.arg("room").c_str());
+  if(room < 0){
+    server.send(400, "text/plain", "bad room or too many rooms");
+    return;
+  }
+  rooms.presence(room, clockMillis());
+  thermostat.reportPresence(room);
+  server.send(204);
+}
+
+/**
+ * @brief room=kitchen&temp=21.5&humidity=40&battery=87, a room module's reading. Humidity
+ * and battery can be left out.
+ * 
+ */
+void handleRoomReading(){
+  deci_celsius temp = server.hasArg("temp") ? parseDeci(server.arg("temp").c_str()) : DECI_INVALID;
+  int humd = server.hasArg("humidity") ? server.arg("humidity").toInt() : ROOM_UNKNOWN;
+  int battery = server.hasArg("battery") ? server.arg("battery").toInt() : ROOM_UNKNOWN;
+  if(!isValid(temp) || temp < deci(-40, 0) || temp > deci(80, 0)){
+    server.send(400, "text/plain", "bad temperature");
+    return;
+  }
+  // ROOM_UNKNOWN is only for leaving them out, anything sent has to be a percentage
+  if(server.hasArg("humidity") && (!isWholeNumber(server.arg("humidity")) || humd < 0 || humd > 100)){
+    server.send(400, "text/plain", "bad humidity");
+    return;
+  }
+  if(server.hasArg("battery") && (!isWholeNumber(server.arg("battery")) || battery < 0 || battery > 100)){
+    server.send(400, "text/plain", "bad battery");
+    return;
+  }
+  int room = rooms.add(server.arg("room").c_str());
+  if(room < 0){
+    server.send(400, "text/plain", "bad room or too many rooms");
+    return;
+  }
+  rooms.reading(room, temp, humd, battery, clockMillis());
+  server.send(204);
+}
+
+/**
+ * @brief The room modules with their last reading, null for anything they haven't sent.
+ * Age is in seconds, -1 before the first reading (a module that only reports presence).
+ * 
+ */
+void handleGetRooms(){
+  char buf[160];
+  char temp_buf[8];
+  char humd_buf[4];
+  char battery_buf[4];
+  unsigned long now = clockMillis();
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", "[");
+  for(int i = 0; i < rooms.getCount(); i++){
+    const Room *room = rooms.get(i);
+    snprintf(humd_buf, sizeof(humd_buf), "%u", room->humd);
+    snprintf(battery_buf, sizeof(battery_buf), "%u", room->battery);
+    snprintf(buf, sizeof(buf), "%s{\"room\":\"%s\",\"temp\":%s,\"humidity\":%s,\"battery\":%s,\"age\":%ld}",
+      i == 0 ? "" : ",", room->name, isValid(room->temp) ? formatDeci(temp_buf, room->temp) : "null",
+      room->humd == ROOM_UNKNOWN ? "null" : humd_buf, room->battery == ROOM_UNKNOWN ? "null" : battery_buf,
+      room->reading_at ? (long)((now - room->reading_at) / 1000) : -1L);
+    server.sendContent(buf);
+  }
+  server.sendContent("]");
+  server.sendContent("");
+}
+
+/**
+ * @brief The state of the occupancy model, the scores and rooms seen for each 15 minute
+ * bucket of the week starting Sunday 00:00. Room bits follow the order of "rooms".
+ * 
+ */
+void handleGetOccupancy(){
+  char buf[96];
+  Occupancy &occupancy = thermostat.getOccupancy();
+  unsigned long now = clockMillis();
+  snprintf(buf, sizeof(buf), "{\"enabled\":%s,\"empty\":%s,\"setback\":%s,\"setback_minutes\":%lu,\"rooms\":[",
+    occupancy.getEnabled() ? "true" : "false", occupancy.getEmpty(now) ? "true" : "false",
+    occupancy.getSetback() ? "true" : "false", (unsigned long)occupancy.getSetbackMinutes());
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", buf);
+  for(int i = 0; i < rooms.getCount(); i++){
+    snprintf(buf, sizeof(buf), "%s\"%s\"", i == 0 ? "" : ",", rooms.get(i)->name);
+    server.sendContent(buf);
+  }
+  server.sendContent("],\"score\":[");
+  sendBuckets(true);
+  server.sendContent("],\"seen\":[");
+  sendBuckets(false);
+  server.sendContent("]}");
+  server.sendContent("");
+}
+
+/**
+ * @brief Streams every occupancy bucket as a comma separated list, a few at a time
+ * 
+ * @param scores the learned scores, otherwise the rooms seen
+ */
+void sendBuckets(boolean scores){
+  char buf[192];
+  Occupancy &occupancy = thermostat.getOccupancy();
+  size_t n = 0;
+  for(int b = 0; b < OCC_BUCKETS; b++){
+    n += snprintf(buf + n, sizeof(buf) - n, "%s%u", b == 0 ? "" : ",", scores ? occupancy.getScore(b) : occupancy.getSeen(b));
+    if(n > sizeof(buf) - 8 || b == OCC_BUCKETS - 1){
+      server.sendContent(buf);
+      n = 0;
+    }
+  }
+}
+
+/**
+ * @brief enabled=0 or 1 turns occupancy setback off or on
+ * 
+ */
+void handleSetOccupancy(){
+  if(!server.hasArg("enabled")){
+    server.send(400, "text/plain", "missing enabled");
+    return;
+  }
+  thermostat.getOccupancy().setEnabled(server.arg("enabled").toInt() != 0);
+  server.send(204);
+}
+
+/**
+ * @brief Streams the decoded event log
+ * 
+ */
+void handleLog(){
+  ChunkPrint out;
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "text/plain", "");
+  event_log.dump(out, server.arg("saved") == "1");
+  out.send();
+  server.sendContent("");
+}
+
+/**
+ * @brief Timing of each profiled section as JSON, in microseconds
+ * 
+ */
+void handleProfile(){
+  char buf[128];
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", "{");
+  boolean first = true;
+  for(int s = 0; s < PROF_SECTIONS; s++){
+    ProfSection sec = (ProfSection)s;
+    if(!profiler.getCount(sec)) continue;
+    snprintf(buf, sizeof(buf), "%s\"%s\":{\"count\":%lu,\"mean\":%lu,\"p50\":%lu,\"p99\":%lu,\"max\":%lu}",
+      first ? "" : ",", prof_names[s], (unsigned long)profiler.getCount(sec), (unsigned long)profiler.getMean(sec),
+      (unsigned long)profiler.percentile(sec, 50), (unsigned long)profiler.percentile(sec, 99), (unsigned long)profiler.getMax(sec));
+    server.sendContent(buf);
+    first = false;
+  }
+  server.sendContent("}");
+  server.sendContent("");
+  if(server.arg("reset") == "1"){
+    profiler.reset();
+  }
+}
+
+/**
+ * @brief Sends a full metrics buffer as a chunk of the response
+ * 
+ * @param buf 
+ * @param len 
+ */
+void sendMetrics(const char *buf, size_t len){
+  server.sendContent(buf, len);
+}
+
+/**
+ * @brief Prometheus metrics, rendered through the preallocated writer in chunks
+ * 
+ */
+void handleMetrics(){
+  // Histogram bounds line up with the profiler's buckets so the counts are exact
+  const uint32_t bounds[8] = {128, 1024, 4096, 16384, 65536, 262144, 1048576, 4194304};
+  char labels[64];
+  Equipment &equipment = thermostat.getEquipment();
+  Humidity &humidifier = thermostat.getHumidifier();
+
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "text/plain; version=0.0.4", "");
+  metrics.begin(sendMetrics);
+
+  metrics.family("thermostat_temperature_celsius", "gauge", "Indoor temperature");
+  metrics.temperature("thermostat_temperature_celsius", "", old.temp);
+  metrics.family("thermostat_humidity_percent", "gauge", "Indoor relative humidity");
+  metrics.sample("thermostat_humidity_percent", "", (double)old.humd);
+  metrics.family("thermostat_outdoor_temperature_celsius", "gauge", "Last reported outdoor temperature");
+  metrics.temperature("thermostat_outdoor_temperature_celsius", "", thermostat.getOutdoorTemp());
+  metrics.family("thermostat_setpoint_celsius", "gauge", "Current heating and cooling targets");
+  metrics.temperature("thermostat_setpoint_celsius", "side=\"heat\"", thermostat.getHeatGoal());
+  metrics.temperature("thermostat_setpoint_celsius", "side=\"cool\"", thermostat.getCoolGoal());
+  metrics.family("thermostat_humidity_setpoint_percent", "gauge", "Humidity setting and the target after window protection");
+  metrics.sample("thermostat_humidity_setpoint_percent", "kind=\"setting\"", (double)thermostat.getHumdSetpoint());
+  metrics.sample("thermostat_humidity_setpoint_percent", "kind=\"target\"", (double)thermostat.getGoalHumd());
+  metrics.family("thermostat_mode", "gauge", "0 off, 1 heat, 2 cool, 3 auto");
+  metrics.sample("thermostat_mode", "", (long)thermostat.getMode());
+  metrics.family("thermostat_hold", "gauge", "0 none, 1 until next slot, 2 timed, 3 permanent");
+  metrics.sample("thermostat_hold", "", (long)thermostat.getHoldType());
+  metrics.family("thermostat_setback", "gauge", "1 while set back for an empty house");
+  metrics.sample("thermostat_setback", "", (long)thermostat.getOccupancy().getSetback());
+  metrics.family("thermostat_effort", "gauge", "Control effort, -100 full cooling to 100 full heating");
+  metrics.sample("thermostat_effort", "", (long)equipment.getEffort());
+  metrics.family("thermostat_stage", "gauge", "Equipment stages being called for");
+  metrics.sample("thermostat_stage", "", (long)equipment.getStage());
+
+  metrics.family("thermostat_relay_on", "gauge", "Relay output state");
+  for(int i = 0; i < EQUIP_RELAYS; i++){
+    Relay *relay = equipment.getRelay(i);
+    if(!relay->installed()) continue;
+    snprintf(labels, sizeof(labels), "relay=\"%s\"", relay->getName());
+    metrics.sample("thermostat_relay_on", labels, (long)relay->getOn());
+  }
+  metrics.sample("thermostat_relay_on", "relay=\"humidifier\"", (long)humidifier.getOn());
+  // Each family's samples have to follow its own HELP/TYPE lines, so one pass over the relays per family
+  const char* const relay_families[3][3] = {
+    {"thermostat_relay_failsafe", "gauge", "Relay held off because the sensor went quiet"},
+    {"thermostat_relay_starts_total", "counter", "Relay starts since first boot"},
+    {"thermostat_relay_runtime_seconds_total", "counter", "Relay on time since first boot"}
+  };
+  for(int f = 0; f < 3; f++){
+    metrics.family(relay_families[f][0], relay_families[f][1], relay_families[f][2]);
+    for(int i = 0; i < EQUIP_RELAYS; i++){
+      Relay *relay = equipment.getRelay(i);
+      if(!relay->installed()) continue;
+      snprintf(labels, sizeof(labels), "relay=\"%s\"", relay->getName());
+      long value = f == 0 ? (long)relay->getFailsafe() : f == 1 ? (long)relay->getCyclesTotal() : (long)relay->getRuntimeTotal();
+      metrics.sample(relay_families[f][0], labels, value);
+    }
+  }
+  metrics.family("thermostat_humidifier_starts_today", "gauge", "Humidifier starts in the current 24 hours");
+  metrics.sample("thermostat_humidifier_starts_today", "", (long)humidifier.getCyclesToday());
+
+  metrics.family("thermostat_wifi_rssi_dbm", "gauge", "WiFi signal strength");
+  metrics.sample("thermostat_wifi_rssi_dbm", "", (long)old.rssi);
+  metrics.family("thermostat_heap_bytes", "gauge", "Heap free now, lowest free since boot and largest block");
+  metrics.sample("thermostat_heap_bytes", "kind=\"free\"", (long)ESP.getFreeHeap());
+  metrics.sample("thermostat_heap_bytes", "kind=\"min_free\"", (long)ESP.getMinFreeHeap());
+  metrics.sample("thermostat_heap_bytes", "kind=\"max_alloc\"", (long)ESP.getMaxAllocHeap());
+  metrics.family("thermostat_uptime_seconds", "counter", "Time since boot");
+  metrics.sample("thermostat_uptime_seconds", "", (long)(millis() / 1000));
+
+  metrics.family("thermostat_screen_state", "gauge", "0 on, 1 dimmed, 2 off");
+  metrics.sample("thermostat_screen_state", "", (long)power.getState());
+  metrics.family("thermostat_backlight_duty", "gauge", "Backlight PWM duty, 0 to 255");
+  metrics.sample("thermostat_backlight_duty", "", (long)backlight.getDuty());
+  metrics.family("thermostat_asleep_seconds_total", "counter", "Time the loop has slept with the screen off");
+  metrics.sample("thermostat_asleep_seconds_total", "", power.getAsleepMs() / 1000.0);
+  metrics.family("thermostat_current_milliamps", "gauge", "Average current since boot, estimated from the time in each screen state");
+  metrics.sample("thermostat_current_milliamps", "", (long)power.getAverageMa(millis()));
+  metrics.family("thermostat_wake_seconds", "gauge", "Touch to first frame drawn when the screen wakes, last and longest");
+  metrics.sample("thermostat_wake_seconds", "kind=\"last\"", power.getLatency() / 1000000.0);
+  metrics.sample("thermostat_wake_seconds", "kind=\"max\"", power.getLatencyMax() / 1000000.0);
+
+  metrics.family("thermostat_draw_pushes_total", "counter", "Sprites pushed to the screen by each draw call");
+  for(int s = PROF_DRAW_MAIN; s < PROF_SECTIONS; s++){
+    const DrawStats &st = draw.getStats((ProfSection)s);
+    if(!st.calls) continue;
+    snprintf(labels, sizeof(labels), "call=\"%s\"", prof_names[s]);
+    metrics.sample("thermostat_draw_pushes_total", labels, (long)st.pushes);
+  }
+  metrics.family("thermostat_draw_bytes_total", "counter", "Bytes sent to the screen by each draw call");
+  for(int s = PROF_DRAW_MAIN; s < PROF_SECTIONS; s++){
+    const DrawStats &st = draw.getStats((ProfSection)s);
+    if(!st.calls) continue;
+    snprintf(labels, sizeof(labels), "call=\"%s\"", prof_names[s]);
+    metrics.sample("thermostat_draw_bytes_total", labels, (long)st.bytes);
+  }
+
+  metrics.family("thermostat_section_duration_seconds", "histogram", "Time taken by each part of the loop and each draw call");
+  for(int s = 0; s < PROF_SECTIONS; s++){
+    ProfSection sec = (ProfSection)s;
+    if(!profiler.getCount(sec)) continue;
+    for(int b = 0; b < 8; b++){
+      snprintf(labels, sizeof(labels), "section=\"%s\",le=\"%.6f\"", prof_names[s], bounds[b] / 1000000.0);
+      metrics.sample("thermostat_section_duration_seconds_bucket", labels, (long)profiler.countUpTo(sec, bounds[b] - 1));
+    }
+    snprintf(labels, sizeof(labels), "section=\"%s\",le=\"+Inf\"", prof_names[s]);
+    metrics.sample("thermostat_section_duration_seconds_bucket", labels, (long)profiler.getCount(sec));
+    snprintf(labels, sizeof(labels), "section=\"%s\"", prof_names[s]);
+    metrics.sample("thermostat_section_duration_seconds_sum", labels, profiler.getTotal(sec) / 1000000.0);
+    metrics.sample("thermostat_section_duration_seconds_count", labels, (long)profiler.getCount(sec));
+  }
+
+  metrics.finish();
+  server.sendContent("");
+}
+
+/**
+ * @brief Serves the dashboard from flash. The files are gzipped at build time and sent as
+ * they are, a browser that already has the same file gets a 304.
+ * 
+ */
+void handleAsset(){
+  for(int i = 0; i < WEB_ASSETS; i++){
+    const WebAsset &asset = web_assets[i];
+    if(server.uri() != asset.path) continue;
+    server.sendHeader("ETag", asset.etag);
+    server.sendHeader("Cache-Control", "no-cache");
+    if(server.header("If-None-Match") == asset.etag){
+      server.send(304);
+      return;
+    }
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, asset.type, (const char*)asset.data, asset.len);
+    return;
+  }
+  server.send(404, "text/plain", "not found");
+}
+
+/**
+ * @brief Hands the connection over to the event stream, it stays open after this returns
+ * 
+ */
+void handleEvents(){
+  WiFiClient client = server.client();
+  if(!stream.add(client)){
+    server.send(503, "text/plain", "too many dashboards open");
+    return;
+  }
+  server.release();
+}
+
+/**
+ * @brief A temperature for JSON, null when the reading failed
+ * 
+ * @param buf at least 8 characters
+ * @param t 
+ * @return char* 
+ */
+char* jsonDeci(char *buf, deci_celsius t){
+  if(!isValid(t)){
+    strcpy(buf, "null");
+    return buf;
+  }
+  return formatDeci(buf, t);
+}
+
+/**
+ * @brief Sends the state shown on the main screen to the dashboards, only when it changed
+ * 
+ * @param now 
+ */
+void publishState(unsigned long now){
+  char buf[STREAM_EVENT];
+  char temp[8], heat[8], cool[8], hold_temp[8], humd[8];
+  Equipment &equipment = thermostat.getEquipment();
+  if(isnan(old.humd)){
+    strcpy(humd, "null");
+  } else {
+    snprintf(humd, sizeof(humd), "%.0f", old.humd);
+  }
+  snprintf(buf, sizeof(buf), "{\"temp\":%s,\"humd\":%s,\"heat\":%s,\"cool\":%s,\"mode\":%d,"
+    "\"hold\":%d,\"hold_left\":%d,\"hold_temp\":%s,\"humd_goal\":%.0f,\"stage\":%u,"
+    "\"setback\":%s,\"humidifier\":%s}",
+    jsonDeci(temp, old.temp), humd, jsonDeci(heat, thermostat.getHeatGoal()), jsonDeci(cool, thermostat.getCoolGoal()),
+    thermostat.getMode(), thermostat.getHoldType(), thermostat.getHoldRemaining(), jsonDeci(hold_temp, thermostat.getHoldTemp()),
+    thermostat.getHumdSetpoint(), equipment.getStage(), thermostat.getOccupancy().getSetback() ? "true" : "false",
+    thermostat.getHumidifier().getOn() ? "true" : "false");
+  stream.publish("state", buf, now);
+}
+
+/**
+ * @brief One history sample as a JSON array, [time, temp, humidity, heat, cool, running]
+ * 
+ * @param buf 
+ * @param size 
+ * @param s 
+ * @return size_t 
+ */
+size_t historyJson(char *buf, size_t size, const HistorySample &s){
+  char temp[8], heat[8], cool[8];
+  int n = snprintf(buf, size, "[%lu,%s,%u,%s,%s,%u]", (unsigned long)s.time, jsonDeci(temp, s.temp), s.humd,
+    jsonDeci(heat, s.heat), jsonDeci(cool, s.cool), s.on);
+  return min((size_t)n, size - 1);
+}
+
+/**
+ * @brief Record a history sample and send it to the dashboards
+ * 
+ * @param now 
+ */
+void addHistory(unsigned long now){
+  char buf[64];
+  HistorySample s;
+  s.time = clockTime();
+  s.temp = old.temp;
+  s.heat = thermostat.getHeatGoal();
+  s.cool = thermostat.getCoolGoal();
+  s.humd = isnan(old.humd) ? 0 : (uint8_t)old.humd;
+  s.on = thermostat.getEquipment().getStage() > 0;
+  historyJson(buf, sizeof(buf), history.add(s, now));
+  stream.publish("history", buf, now);
+}
+
+/**
+ * @brief The last day of samples, oldest first, a few to each chunk
+ * 
+ */
+void handleHistory(){
+  char buf[512];
+  size_t n = 0;
+  snprintf(buf, sizeof(buf), "{\"interval\":%d,\"samples\":[", HISTORY_INTERVAL / 1000);
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", buf);
+  for(int i = 0; i < history.getCount(); i++){
+    if(i > 0) buf[n++] = ',';
+    n += historyJson(buf + n, sizeof(buf) - n, history.get(i));
+    if(n > sizeof(buf) - 64){
+      buf[n] = '\0';
+      server.sendContent(buf);
+      n = 0;
+    }
+  }
+  buf[n] = '\0';
+  server.sendContent(buf);
+  server.sendContent("]}");
+  server.sendContent("");
+}
+
+/**
+ * @brief Whether a query argument is a whole number, toInt() reads anything else as 0
+ * 
+ * @param str 
+ * @return boolean 
+ */
+boolean isWholeNumber(const String &str){
+  if(str.length() == 0 || str.length() > 6){
+    return false;
+  }
+  for(int i = 0; i < str.length(); i++){
+    if(!isDigit(str[i]) && !(i == 0 && str[i] == '-' && str.length() > 1)){
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief mode=off|heat|cool|auto and/or humidity=40, the same settings as the touchscreen
+ * 
+ */
+void handleSettings(){
+  const char *modes[4] = {"off", "heat", "cool", "auto"};
+  int mode = -1;
+  int humidity = server.arg("humidity").toInt();
+  if(server.hasArg("humidity") && !isWholeNumber(server.arg("humidity"))){
+    server.send(400, "text/plain", "bad humidity");
+    return;
+  }
+  for(int m = 0; m < 4; m++){
+    if(server.arg("mode") == modes[m]) mode = m;
+  }
+  if(server.hasArg("mode") && mode < 0){
+    server.send(400, "text/plain", "bad mode");
+    return;
+  }
+  if(server.hasArg("humidity") && (humidity < 0 || humidity > 60)){
+    server.send(400, "text/plain", "bad humidity");
+    return;
+  }
+  if(mode >= 0){
+    thermostat.setMode((ThermostatMode)mode);
+  }
+  if(server.hasArg("humidity")){
+    thermostat.setTargetHumidity(humidity);
+  }
+  server.send(204);
+}
+
+/**
+ * @brief The backlight's day/night curve and where it is now
+ * 
+ */
+void handleGetBacklight(){
+  char buf[320];
+  CurvePoint curve[BL_CURVE_POINTS];
+  uint8_t n = backlight.getCurve(curve);
+  int len = snprintf(buf, sizeof(buf), "{\"sensor\":%s,\"duty\":%lu,\"curve\":[", backlight.hasSensor() ? "true" : "false",
+    (unsigned long)backlight.getDuty());
+  for(int i = 0; i < n; i++){
+    len += snprintf(buf + len, sizeof(buf) - len, "%s{\"time\":\"%02u:%02u\",\"level\":%u}", i == 0 ? "" : ",",
+      curve[i].minute / 60, curve[i].minute % 60, curve[i].percent);
+  }
+  snprintf(buf + len, sizeof(buf) - len, "]}");
+  server.send(200, "application/json", buf);
+}
+
+/**
+ * @brief times=06:30,07:00,21:00,22:00&levels=25,100,100,25 sets the backlight's day/night
+ * curve, levels in percent. Brightness is interpolated between the points and wraps round midnight
+ * 
+ */
+void handleSetBacklight(){
+  CurvePoint curve[BL_CURVE_POINTS];
+  char times[80];
+  char levels[40];
+  char *t_save;
+  char *l_save;
+  uint8_t n = 0;
+  strlcpy(times, server.arg("times").c_str(), sizeof(times));
+  strlcpy(levels, server.arg("levels").c_str(), sizeof(levels));
+  char *t = strtok_r(times, ",", &t_save);
+  char *l = strtok_r(levels, ",", &l_save);
+  while(t && l && n < BL_CURVE_POINTS){
+    int h, m;
+    int level = atoi(l);
+    if(sscanf(t, "%d:%d", &h, &m) != 2 || h < 0 || h > 23 || m < 0 || m > 59 || level < 1 || level > 100){
+      server.send(400, "text/plain", "bad time or level");
+      return;
+    }
+    curve[n++] = {(uint16_t)(h * 60 + m), (uint8_t)level};
+    t = strtok_r(nullptr, ",", &t_save);
+    l = strtok_r(nullptr, ",", &l_save);
+  }
+  if(t || l || !backlight.setCurve(curve, n)){
+    server.send(400, "text/plain", "needs 1 to 6 times in order, each with a level");
+    return;
+  }
+  server.send(204);
+}
+
+/**
+ * @brief Turn everything off before the flash is written to, the furnace stays off until
+ * the new firmware is running or the update fails
+ * 
+ */
+void beginUpdate(){
+  thermostat.lock(true);
+  draw.notice("Updating firmware");
+}
+
+/**
+ * @brief The update didn't go through, give the furnace back to the thermostat
+ * 
+ */
+void failUpdate(){
+  thermostat.lock(false);
+  draw.notice("Update failed");
+}
+
+/**
+ * @brief Restart into the new image, or unlock the furnace and report why it failed
+ * 
+ */
+void endUpdate(){
+  char buf[96];
+  if(firmware.getStatus() == FW_READY){
+    server.send(202, "text/plain", "updated, restarting");
+    draw.notice("Restarting");
+    event_log.spill();
+    // Give the response a moment to get out
+    events.at(EVENT_RESTART, 1000, restartBoard, nullptr, clockMillis());
+    return;
+  }
+  failUpdate();
+  snprintf(buf, sizeof(buf), "{\"error\":\"%s\"}", firmware.getError() ? firmware.getError() : "no image");
+  server.send(400, "application/json", buf);
+}
+
+/**
+ * @brief Event callback, restarts the board
+ * 
+ * @param ctx 
+ */
+void restartBoard(void *ctx){
+  ESP.restart();
+}
+
+/**
+ * @brief url=http://...&sha256=... downloads new firmware a chunk at a time straight into
+ * the inactive partition
+ * 
+ */
+void handleDownloadUpdate(){
+  if(!server.hasArg("url")){
+    server.send(400, "text/plain", "missing url");
+    return;
+  }
+  beginUpdate();
+  firmware.download(server.arg("url").c_str(), server.arg("sha256").c_str());
+  endUpdate();
+}
+
+/**
+ * @brief Writes the request body to flash as it comes off the socket
+ * 
+ */
+void handleUpdateBody(){
+  HTTPRaw &raw = server.raw();
+  if(raw.status == RAW_START){
+    beginUpdate();
+    firmware.start(server.arg("sha256").c_str());
+  } else if(raw.status == RAW_WRITE){
+    firmware.write(raw.buf, raw.currentSize);
+  } else if(raw.status == RAW_ABORTED){
+    // The connection went, handlePutUpdate() won't be called to unlock
+    firmware.abort();
+    failUpdate();
+  }
+}
+
+/**
+ * @brief PUT /update?sha256=... with the image as the body, called once it has all arrived
+ * 
+ */
+void handlePutUpdate(){
+  firmware.finish();
+  endUpdate();
+}
+
+/**
+ * @brief Where the last update got to, and whether this image is still on probation
+ * 
+ */
+void handleUpdateStatus(){
+  const char *names[4] = {"idle", "writing", "ready", "failed"};
+  char buf[128];
+  snprintf(buf, sizeof(buf), "{\"status\":\"%s\",\"written\":%u,\"error\":%s%s%s,\"pending\":%s}",
+    names[firmware.getStatus()], (unsigned)firmware.getWritten(), firmware.getError() ? "\"" : "",
+    firmware.getError() ? firmware.getError() : "null", firmware.getError() ? "\"" : "",
+    firmware.getPending() ? "true" : "false");
+  server.send(200, "application/json", buf);
+}
+
+/**
+ * @brief Runs the loop over the recorded trace as fast as it will go, on the trace's clock.
+ * Touches go through handleTouch() and the screen is drawn as normal with every pixel
+ * checksummed, the relays decide but aren't switched. Nothing is saved while it runs (settings
+ * changed by replayed touches, relay totals, the event log) and the board restarts afterwards
+ * to drop the replayed state.
+ * 
+ * @param out where the result is printed
+ */
+void replayTrace(Print &out){
+  TraceEntry e;
+  // The replay is checked against what it draws
+  wakeScreen();
+  // Everything off for real before the relays stop being driven
+  thermostat.lock(true);
+  if(!trace.beginReplay()){
+    thermostat.lock(false);
+    out.println("No trace to replay");
+    return;
+  }
+  // The replay's relay switches and touches never happened, keep them out of the log
+  event_log.pause(true);
+  uint32_t started = micros();
+  uint32_t pushes = 0;
+  unsigned long begin_ms = clockMillis();
+  // Start from the same place every time, nothing from the real uptime carries in, so two
+  // replays of a trace make the same decisions and draw the same frames
+  events.clear();
+  thermostat.reset(begin_ms);
+  old.temp = DECI_INVALID;
+  old.humd = NAN;
+  old.wifi = false;
+  old.rssi = 0;
+  old.bars = 0;
+  touching.held = false;
+  touching.waking = false;
+  draw.resetStats(true);
+  screens.go(SCREEN_MAIN, true);
+  thermostat.lock(false);
+  interval.prev = interval.prev_heat = interval.prev_wifi = begin_ms - interval.intv_heat;
+  while(trace.next(e)){
+    while(e.ms - replay_clock.ms >= TRACE_STEP && e.ms - replay_clock.ms < 0x80000000UL){
+      replay_clock.ms += TRACE_STEP;
+      tick(replay_clock.ms);
+      screens.update(clockMillis());
+    }
+    replay_clock.ms = e.ms;
+    if(e.type == TRACE_TOUCH){
+      handleTouch((TouchPhase)e.a, TS_Point(e.b, e.value, 1));
+      screens.update(clockMillis());
+    } else if(e.type == TRACE_OUTDOOR){
+      thermostat.setOutdoorTemp(e.b);
+    }
+  }
+  trace.endReplay(micros() - started);
+  for(int s = PROF_DRAW_MAIN; s < PROF_SECTIONS; s++){
+    pushes += draw.getStats((ProfSection)s).pushes;
+  }
+  trace.frames(pushes, draw.getFrameCrc());
+  trace.report(out);
+  // Whatever the replay left on stays off until the restart
+  thermostat.lock(true);
+  event_log.pause(false);
+  events.at(EVENT_RESTART, 1000, restartBoard, nullptr, clockMillis());
+}
+
+/**
+ * @brief Runs the benchmarks in Bench.h. The relays are held off and the event log paused
+ * while they run. What the control loop had decided is put back before the relays are let go,
+ * then the main screen is drawn again over whatever they left.
+ * 
+ * @param out 
+ * @param only prefix of the cases to run, empty for all
+ */
+void runBenchmarks(Print &out, const char *only){
+  Bench bench;
+  ControlState control;
+  wakeScreen();
+  thermostat.lock(true);
+  thermostat.getControl(control);
+  event_log.pause(true);
+  bench.begin(out, thermostat, draw, only);
+  bench.all();
+  thermostat.setControl(control);
+  thermostat.checkSchedule();
+  event_log.pause(false);
+  thermostat.lock(false);
+  screens.go(SCREEN_MAIN, true);
+}
+
+/**
+ * @brief Benchmark results as a text table
+ * 
+ */
+void handleBench(){
+  ChunkPrint out;
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "text/plain", "");
+  runBenchmarks(out, server.arg("only").c_str());
+  out.send();
+  server.sendContent("");
+}
+
+/**
+ * @brief Downloads the trace, an array of 12 byte entries (see Trace.h)
+ * 
+ */
+void handleGetTrace(){
+  server.send_P(200, "application/octet-stream", (const char*)trace.getData(), trace.getSize());
+}
+
+/**
+ * @brief Copies an uploaded trace in as it comes off the socket
+ * 
+ */
+void handleTraceBody(){
+  HTTPRaw &raw = server.raw();
+  if(raw.status == RAW_START){
+    trace.loadBegin();
+  } else if(raw.status == RAW_WRITE){
+    trace.loadWrite(raw.buf, raw.currentSize);
+  }
+}
+
+/**
+ * @brief Called once an uploaded trace has arrived
+ * 
+ */
+void handlePutTrace(){
+  if(!trace.loadFinish()){
+    server.send(400, "text/plain", "not a trace, or too long");
+    return;
+  }
+  server.send(204);
+}
+
+/**
+ * @brief action=start records a new trace, stop ends it and replay runs it and returns the result
+ * 
+ */
+void handleTrace(){
+  String action = server.arg("action");
+  if(action == "start"){
+    trace.start(clockMillis());
+  } else if(action == "stop"){
+    trace.stop();
+  } else if(action == "replay"){
+    ChunkPrint out;
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "text/plain", "");
+    replayTrace(out);
+    out.send();
+    server.sendContent("");
+    return;
+  } else {
+    server.send(400, "text/plain", "action is start, stop or replay");
+    return;
+  }
+  server.send(204);
+}
+
+/**
+ * @brief Called by SNTP whenever the clock is set
+ * 
+ * @param tv 
+ */
+void timeSynced(struct timeval *tv){
+  logEvent(LOG_NTP);
+  trace.add(TRACE_CLOCK, 0, 0, time(nullptr), clockMillis());
+}
+
+/**
+ * @brief Reads commands typed on the serial monitor, one per line
+ * log        print the event log
+ * log saved  print the log saved to flash by the last fault
+ * prof       print the profiler table
+ * prof reset clear the profiler
+ * draw       print what each draw call has sent to the screen
+ * power      print the time spent with the screen on, dimmed, off and asleep
+ * bench      time the hot functions, "bench draw" for just the ones starting with draw
+ * trace start / trace stop / trace replay
+ * 
+ */
+void checkSerial(){
+  while(Serial.available()){
+    char c = Serial.read();
+    if(c != '\n' && c != '\r'){
+      if(serial_len < sizeof(serial_line) - 1) serial_line[serial_len++] = c;
+      continue;
+    }
+    serial_line[serial_len] = '\0';
+    if(serial_len > 0){
+      runCommand(serial_line);
+    }
+    serial_len = 0;
+  }
+}
+
+/**
+ * @brief Runs one serial command
+ * 
+ * @param cmd 
+ */
+void runCommand(const char *cmd){
+  if(strcmp(cmd, "log") == 0){
+    event_log.dump(Serial, false);
+  } else if(strcmp(cmd, "log saved") == 0){
+    event_log.dump(Serial, true);
+  } else if(strcmp(cmd, "prof") == 0){
+    profiler.report(Serial);
+  } else if(strcmp(cmd, "prof reset") == 0){
+    profiler.reset();
+  } else if(strcmp(cmd, "draw") == 0){
+    draw.report(Serial);
+  } else if(strcmp(cmd, "power") == 0){
+    power.report(Serial, millis());
+  } else if(strcmp(cmd, "rooms") == 0){
+    room_link.report(Serial);
+  } else if(strcmp(cmd, "bench") == 0 || strncmp(cmd, "bench ", 6) == 0){
+    runBenchmarks(Serial, cmd[5] ? cmd + 6 : "");
+  } else if(strcmp(cmd, "trace start") == 0){
+    trace.start(clockMillis());
+  } else if(strcmp(cmd, "trace stop") == 0){
+    trace.stop();
+    Serial.printf("%u entries\n", trace.getCount());
+  } else if(strcmp(cmd, "trace replay") == 0){
+    replayTrace(Serial);
+  } else {
+    Serial.println("Commands: log, log saved, prof, prof reset, draw, power, rooms, bench, trace start, trace stop, trace replay");
+  }
+}
+
+// Turn on the wifi and connect
+void initWiFi(){
+  WiFi.mode(WIFI_STA);
+  WiFi.begin(ssid, password);
+  while(WiFi.status() != WL_CONNECTED) {
+    delay(500);
+  }
+}
+
+/**
+ * @brief Check the strength of the wifi and call the draw.wifi with the current strength
+ * 
+ */
+void checkWifi(){
+  boolean replaying = trace.getReplaying();
+  boolean connected = replaying ? trace.getInputs().wifi : WiFi.status() == WL_CONNECTED;
+  if(connected != old.wifi){
+    old.wifi = connected;
+    logEvent(LOG_WIFI, connected, connected ? WiFi.RSSI() : 0);
+  }
+  int strength = !connected ? 0 : replaying ? trace.getInputs().rssi : WiFi.RSSI();
+  uint8_t bars = !connected ? 0 : strength > -50 ? 3 : strength > -70 ? 2 : 1;
+  old.rssi = strength;
+  if(bars != old.bars){
+    old.bars = bars;
+    trace.add(TRACE_WIFI, connected, strength, 0, clockMillis());
   }
+  draw.wifi(455, 35, bars);
 }
\ No newline at end of file
@@ -0,0 +1,113 @@
+#ifndef TEMPERATURE_H
+#define TEMPERATURE_H
+
+#include <stdint.h>
+
+/**
+ * @brief Temperatures are carried everywhere as tenths of a degree celsius. This is the
+ * resolution of the DHT22 and of what is drawn on the screen, so two readings are equal
+ * exactly when they would display the same.
+ *
+ */
+typedef int16_t deci_celsius;
+
+// Returned for a failed sensor read (the DHT library gives NaN)
+const deci_celsius DECI_INVALID = INT16_MIN;
+
+/**
+ * @brief Convert a float celsius reading into tenths, rounding to nearest
+ *
+ * @param c
+ * @return constexpr deci_celsius
+ */
+constexpr deci_celsius toDeci(float c){
+  return (c != c) ? DECI_INVALID : (deci_celsius)(c >= 0 ? (c * 10) + 0.5f : (c * 10) - 0.5f);
+}
+
+/**
+ * @brief Convert tenths back into float celsius
+ *
+ * @param t
+ * @return constexpr float
+ */
+constexpr float toCelsius(deci_celsius t){
+  return t / 10.0f;
+}
+
+/**
+ * @brief Builds a temperature from whole degrees and tenths, deci(18, 5) is 18.5c
+ *
+ * @param whole
+ * @param tenths
+ * @return constexpr deci_celsius
+ */
+constexpr deci_celsius deci(int whole, int tenths){
+  return (deci_celsius)((whole * 10) + (whole < 0 ? -tenths : tenths));
+}
+
+/**
+ * @brief Checks whether a temperature holds a real reading
+ *
+ * @param t
+ * @return constexpr bool
+ */
+constexpr bool isValid(deci_celsius t){
+  return t != DECI_INVALID;
+}
+
+/**
+ * @brief Parse a decimal string such as "18.5" or "-3" into tenths without going through float.
+ * Digits past the first decimal place are ignored.
+ *
+ * @param str
+ * @return deci_celsius
+ */
+deci_celsius parseDeci(const char *str){
+  boolean negative = false;
+  int value = 0;
+  int tenths = -1;
+  if(*str == '-'){
+    negative = true;
+    str++;
+  }
+  for(; *str; str++){
+    if(*str == '.'){
+      tenths = 0;
+      continue;
+    }
+    if(*str < '0' || *str > '9'){
+      break;
+    }
+    if(tenths < 0){
+      value = (value * 10) + (*str - '0');
+    } else if(tenths == 0){
+      tenths = *str - '0';
+    }
+  }
+  value = (value * 10) + (tenths > 0 ? tenths : 0);
+  return negative ? -value : value;
+}
+
+/**
+ * @brief Write the temperature as "21.5" into buf, which needs room for at least 8 characters
+ *
+ * @param buf
+ * @param t
+ * @return char* buf, for use inline
+ */
+char* formatDeci(char *buf, deci_celsius t){
+  if(!isValid(t)){
+    strcpy(buf, "--.-");
+    return buf;
+  }
+  char *p = buf;
+  int v = t;
+  if(v < 0){
+    *p++ = '-';
+    v = -v;
+  }
+  p += sprintf(p, "%d.%d", v / 10, v % 10);
+  return buf;
+}
+
+#endif
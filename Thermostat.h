@@ -3,6 +3,32 @@
 
 #include <Preferences.h>
 #include "time.h"
+#include "Temperature.h"
+#include "Clock.h"
+#include "Humidity.h"
+#include "Equipment.h"
+#include "Schedule.h"
+#include "Exceptions.h"
+#include "Events.h"
+#include "Occupancy.h"
+
+#define CHANGEOVER_MARGIN deci(1, 0) // How far past the other target before auto switches over
+#define CHANGEOVER_DELAY 1800000   // Minimum time between automatic heat/cool changeovers
+#define HOLD_HOURS 2                 // Length of a timed hold started from the screen
+#define EVENT_HOLD 1
+
+enum ThermostatMode { MODE_OFF, MODE_HEAT, MODE_COOL, MODE_AUTO };
+enum HoldType { HOLD_OFF, HOLD_NEXT_SLOT, HOLD_TIMED, HOLD_PERMANENT };
+
+/**
+ * @brief Everything the control loop moves on its own, see Thermostat::getControl()
+ * 
+ */
+struct ControlState {
+  EquipmentState equipment;
+  OccupancyState occupancy;
+  unsigned long changeover_at;
+};
 
 /**
  * @brief Holds all the logic for thermostat functions such as tracking a schedule and keeping the house warm
@@ -10,62 +36,122 @@
  */
 class Thermostat {
   private:
-    boolean heat_on = false;
-    boolean humd_on = false;
-    boolean hold = false;
-    float target_humidity;
+    HoldType hold = HOLD_OFF;
+    uint32_t hold_end = 0;     // Epoch seconds a hold ends, only used to pick it back up after a restart
+    boolean hold_ended = false;
+    Events *events = nullptr;
+    ThermostatMode mode = MODE_HEAT;
+    unsigned long changeover_at = 0;
     char* dow[7] = {"Sun","Mon","Tue","Wed","Thu","Fri","Sat"};
     char* full_days[7] = {"Sunday","Monday","Tuesday","Wednesday","Thursday","Friday","Saturday"};
+    char* mode_names[4] = {"OFF","HEAT","COOL","AUTO"};
+    char* hold_names[4] = {"OFF","SLOT","2H","ON"};
     int day;
-    int heat_pin;
-    int humd_pin;
     int screen_dow;
     int slot;
-    float hold_temp = 21.0;
+    int active = -1;
+    deci_celsius hold_temp = deci(21, 0);
 	  Preferences preferences;
+    Humidity humidity;
+    Equipment equipment;
     void initSchedule();
+    void restoreHold();
+    void startHold(HoldType type, unsigned long ms);
+    void endHold();
+    void saveHold();
+    unsigned long untilNextSlot();
+    static void onHoldEnd(void *ctx);
+    void changeover(deci_celsius temp, unsigned long now);
+    void formatSlot(String &str, const struct Schedule &sched, int s);
+    const struct Schedule& displayDay();
+
+    struct Schedule Schedule[7]; // 7 days of the week
+    ScheduleEditor editor;
+    Exceptions exceptions;
+    Occupancy occupancy;
+    int8_t exception = -1;     // Dated exception in effect
+    int override_slot = -1;    // Slot of the weekday a day override is running
+    const struct Schedule::Slot& currentSlot();
+
     /**
-     * @brief holds the day, number of schedule slots, and schedulable slots
-     * Slots contains the hour, minute, and temperature setting for each slot
+     * @brief Every slot of the week as minutes since Sunday 00:00, sorted. Each day's slots
+     * are a contiguous run starting at day_offset[day], so a single day can be rebuilt
+     * without touching the rest.
      */
-    struct Schedule {
-      String day;
-      uint8_t len = 0;
-      struct Slot {
-        uint8_t hour;
-        uint8_t minute;
-        float_t temp;
-      } Slot[10]; // Maximum 10 slots
-    } Schedule[7]; // 7 days of the week
+    uint16_t transitions[7 * MAX_SLOTS];
+    uint8_t day_offset[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    void rebuildDay(int d);
+    boolean commit(const struct Schedule next[7], uint8_t days);
+    int locate(int minute_of_week);
+    void setActive(int idx);
 
   public:
-    Thermostat(int heatPin, int humdPin);
+    Thermostat(EquipmentPins pins, int humdPin);
     char* getShortDow();
     float getGoalHumd();
-    float getGoalTemp();
-    float getHoldTemp();
+    deci_celsius getHeatGoal();
+    deci_celsius getCoolGoal();
+    ThermostatMode getMode();
+    char* getModeName();
+    float getHumdSetpoint();
+    deci_celsius getOutdoorTemp();
+    deci_celsius getGoalTemp();
+    deci_celsius getHoldTemp();
     boolean getHold();
+    HoldType getHoldType();
+    char* getHoldName();
+    int getHoldRemaining();
+    boolean getHeating();
+    Equipment& getEquipment();
+    Humidity& getHumidifier();
     int getSlot();
     int getSlotCount();
-    int getTimeNow(int * ar);
+    boolean getTimeNow(int * ar);
     String getSlotInfo(int slot);
     void daySlots(String slots[10]);
-    void begin();
+    void begin(Events &ev);
+    void update();
 
     boolean checkSchedule();
     void createSchedule(Preferences &prefs);
     void loadSchedule(Preferences& prefs);
+
+    // Schedule editing
+    ScheduleEditor& getEditor();
+    int getDisplayDay();
+    void beginEdit();
+    void cancelEdit();
+    boolean commitEdit();
+    const struct Schedule* getWeek();
+    boolean setWeek(const struct Schedule week[7]);
     
     void prevDisplayDay();
     void nextDisplayDay();
 
-    void keepTemperature(float temp);
-    void keepHumidity(float humd);
-    void setHeating(boolean val);
-    void setHumidity(boolean val);
+    void keepTemperature(deci_celsius temp);
+    void keepHumidity(float humd, deci_celsius temp);
     void setTargetHumidity(float target);
-    void setHoldTemp(float target);
-    void toggleHold();
+    void setOutdoorTemp(deci_celsius temp);
+    void setHoldTemp(deci_celsius target);
+    void setMode(ThermostatMode val);
+    void nextMode();
+    void setHold(HoldType type, uint16_t minutes);
+    void nextHold();
+    void holdFor(deci_celsius target, uint16_t minutes);
+    void lock(boolean val);
+    void reset(unsigned long now);
+    void getControl(ControlState &out);
+    void setControl(const ControlState &state);
+
+    // Dated exceptions
+    Exceptions& getExceptions();
+    const ScheduleException* getException();
+    boolean addException(const ScheduleException &e);
+    boolean removeException(uint8_t i);
+
+    // Occupancy
+    Occupancy& getOccupancy();
+    void reportPresence(uint8_t room);
 };
 
 /**
@@ -74,39 +160,98 @@ class Thermostat {
  */
 void Thermostat::initSchedule(){
   struct tm timeinfo;
-  while(!getLocalTime(&timeinfo)){
+  while(!clockLocal(&timeinfo)){
     delay(100);
   }
+  for(int d = 0; d < 7; d++){
+    rebuildDay(d);
+  }
   int tz[3];
   getTimeNow(tz);
   screen_dow = tz[0];
-  for(int i = 0; i < Schedule[tz[0]].len; i++){
-    if((tz[1]*60)+tz[2] < (Schedule[tz[0]].Slot[i].hour*60) + Schedule[tz[0]].Slot[i].minute){
-      if(i == 0){
-        day = (tz[0] + 6) % 7;
-        slot = Schedule[tz[0] - 1].len - 1;
-        return;
-      } else {
-        day = tz[0];
-        slot = i - 1;
-        return;
-      }
-    } 
+  setActive(locate((tz[0] * DAY_MINUTES) + (tz[1] * 60) + tz[2]));
+}
+
+/**
+ * @brief Rewrites one day's run of the transition index after that day's slots changed,
+ * the days after it are shifted along rather than recalculated
+ * 
+ * @param d 
+ */
+void Thermostat::rebuildDay(int d){
+  int start = day_offset[d];
+  int delta = Schedule[d].len - (day_offset[d + 1] - start);
+  if(delta != 0){
+    memmove(&transitions[day_offset[d + 1] + delta], &transitions[day_offset[d + 1]],
+      (day_offset[7] - day_offset[d + 1]) * sizeof(transitions[0]));
+    for(int k = d + 1; k < 8; k++){
+      day_offset[k] += delta;
+    }
+  }
+  for(int s = 0; s < Schedule[d].len; s++){
+    transitions[start + s] = (d * DAY_MINUTES) + slotMinute(Schedule[d], s);
   }
-  day = tz[0];
-  slot = Schedule[tz[0]].len - 1;
+}
+
+/**
+ * @brief Finds the slot in effect at the given time, the last transition at or before it.
+ * Before the first slot of Sunday the last slot of Saturday is still running.
+ * 
+ * @param minute_of_week 
+ * @return int index into the transitions
+ */
+int Thermostat::locate(int minute_of_week){
+  int lo = 0;
+  int hi = day_offset[7];
+  while(lo < hi){
+    int mid = (lo + hi) / 2;
+    if(transitions[mid] <= minute_of_week){
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return (lo == 0 ? day_offset[7] : lo) - 1;
+}
+
+/**
+ * @brief Makes the transition at idx the current day and slot
+ * 
+ * @param idx 
+ */
+void Thermostat::setActive(int idx){
+  active = idx;
+  day = 0;
+  while(day < 6 && idx >= day_offset[day + 1]){
+    day++;
+  }
+  slot = idx - day_offset[day];
+  logEvent(LOG_SCHEDULE, day, slot, Schedule[day].Slot[slot].heat);
+}
+
+/**
+ * @brief The slot being followed, from the weekday a day override runs when there is one
+ * 
+ * @return const struct Schedule::Slot& 
+ */
+const struct Schedule::Slot& Thermostat::currentSlot(){
+  const ScheduleException *e = exceptions.get(exception);
+  if(e && e->day != NO_DAY && override_slot >= 0){
+    return Schedule[e->day].Slot[override_slot];
+  }
+  return Schedule[day].Slot[slot];
 }
 
 /**
  * @brief Construct a new Thermostat:: Thermostat object.
- * assign the heating and humidity relays to the correct pins
+ * assign the heating/cooling equipment and humidity relays to the correct pins
  * 
- * @param heatPin 
+ * @param pins 
  * @param humdPin 
  */
-Thermostat::Thermostat(int heatPin, int humdPin){
-  heat_pin = heatPin;
-  humd_pin = humdPin;
+Thermostat::Thermostat(EquipmentPins pins, int humdPin) :
+  humidity(humdPin),
+  equipment(pins){
 }
 
 
@@ -120,33 +265,103 @@ char* Thermostat::getShortDow(){
 }
 
 /**
- * @brief Returns the current target humidity
+ * @brief Returns the current target humidity, this is the users setting lowered as needed
+ * to keep the windows from condensing
  * 
  * @return float 
  */
 float Thermostat::getGoalHumd(){
-  return target_humidity;
+  return humidity.getTarget();
 }
 
 /**
- * @brief Returns the current target temperature
+ * @brief Returns the users humidity setting
  * 
  * @return float 
  */
-float Thermostat::getGoalTemp(){
-  if(hold){
-    return hold_temp;
-  } else {
-    return Schedule[day].Slot[slot].temp;
+float Thermostat::getHumdSetpoint(){
+  return humidity.getSetpoint();
+}
+
+/**
+ * @brief Returns the last reported outdoor temperature
+ * 
+ * @return deci_celsius 
+ */
+deci_celsius Thermostat::getOutdoorTemp(){
+  return humidity.getOutdoorTemp();
+}
+
+/**
+ * @brief Returns the target temperature for whichever of heating or cooling is active
+ * 
+ * @return deci_celsius 
+ */
+deci_celsius Thermostat::getGoalTemp(){
+  if(equipment.getMode() == EQUIP_COOL){
+    return getCoolGoal();
+  }
+  return getHeatGoal();
+}
+
+/**
+ * @brief Returns the current heating target. Following the schedule it is set back
+ * while the house is empty, fixed exception targets and holds are left alone.
+ * 
+ * @return deci_celsius 
+ */
+deci_celsius Thermostat::getHeatGoal(){
+  if(hold != HOLD_OFF){
+    return mode == MODE_COOL ? hold_temp - DEADBAND : hold_temp;
+  }
+  const ScheduleException *e = exceptions.get(exception);
+  if(e && e->day == NO_DAY){
+    return e->heat;
   }
+  return currentSlot().heat - (occupancy.getSetback() ? SETBACK : 0);
+}
+
+/**
+ * @brief Returns the current cooling target. When holding in cooling mode the hold temperature
+ * is the cooling target, otherwise cooling holds the deadband above it.
+ * 
+ * @return deci_celsius 
+ */
+deci_celsius Thermostat::getCoolGoal(){
+  if(hold != HOLD_OFF){
+    return mode == MODE_COOL ? hold_temp : hold_temp + DEADBAND;
+  }
+  const ScheduleException *e = exceptions.get(exception);
+  if(e && e->day == NO_DAY){
+    return e->cool;
+  }
+  return currentSlot().cool + (occupancy.getSetback() ? SETBACK : 0);
+}
+
+/**
+ * @brief Returns whether the thermostat is off, heating, cooling or changing over automatically
+ * 
+ * @return ThermostatMode 
+ */
+ThermostatMode Thermostat::getMode(){
+  return mode;
+}
+
+/**
+ * @brief Returns the name of the mode for display
+ * 
+ * @return char* 
+ */
+char* Thermostat::getModeName(){
+  return mode_names[mode];
 }
 
 /**
  * @brief Returns the currently set holding temperature
  * 
- * @return float 
+ * @return deci_celsius 
  */
-float Thermostat::getHoldTemp(){
+deci_celsius Thermostat::getHoldTemp(){
   return hold_temp;
 }
 
@@ -156,9 +371,66 @@ float Thermostat::getHoldTemp(){
  * @return boolean 
  */
 boolean Thermostat::getHold(){
+  return hold != HOLD_OFF;
+}
+
+/**
+ * @brief Returns how the current hold ends
+ * 
+ * @return HoldType 
+ */
+HoldType Thermostat::getHoldType(){
   return hold;
 }
 
+/**
+ * @brief Returns the name of the hold type for display
+ * 
+ * @return char* 
+ */
+char* Thermostat::getHoldName(){
+  return hold_names[hold];
+}
+
+/**
+ * @brief Returns the minutes left on a hold that ends by itself, rounded up
+ * 
+ * @return int 0 when not holding or holding until cancelled
+ */
+int Thermostat::getHoldRemaining(){
+  if(!events || (hold != HOLD_NEXT_SLOT && hold != HOLD_TIMED)){
+    return 0;
+  }
+  return (events->remaining(EVENT_HOLD, clockMillis()) + 59999) / 60000;
+}
+
+/**
+ * @brief Returns whether any heating stage is currently on
+ * 
+ * @return boolean 
+ */
+boolean Thermostat::getHeating(){
+  return equipment.getHeating();
+}
+
+/**
+ * @brief Returns the equipment output layer, for stage state and relay counters
+ * 
+ * @return Equipment& 
+ */
+Equipment& Thermostat::getEquipment(){
+  return equipment;
+}
+
+/**
+ * @brief Returns the humidifier, for its relay state and cycle counts
+ * 
+ * @return Humidity& 
+ */
+Humidity& Thermostat::getHumidifier(){
+  return humidity;
+}
+
 /**
  * @brief Returns the schedule slot that the thermostat is currently in
  * 
@@ -175,20 +447,42 @@ int Thermostat::getSlot(){
  * @return int 
  */
 int Thermostat::getSlotCount(){
-  return Schedule[screen_dow].len;
+  return displayDay().len;
 }
 
+/**
+ * @brief The displayed day, from the copy being edited while the editor is open
+ * 
+ * @return const struct Schedule& 
+ */
+const struct Schedule& Thermostat::displayDay(){
+  if(editor.isEditing()){
+    return editor.getWeek()[screen_dow];
+  }
+  return Schedule[screen_dow];
+}
 
 /**
- * @brief Get the current timestamp as an integer array
+ * @brief Returns the day of the week being displayed, 0 is Sunday
  * 
- * @param ar 
- * @return int[3]
+ * @return int 
  */
-int Thermostat::getTimeNow(int * ar){
+int Thermostat::getDisplayDay(){
+  return screen_dow;
+}
+
+
+/**
+ * @brief Get the current day of the week, hour and minute as an integer array
+ * 
+ * @param ar int[3], left alone if the clock isn't set
+ * @return boolean false if the clock isn't set
+ */
+boolean Thermostat::getTimeNow(int * ar){
   struct tm timeinfo;
-  if(!getLocalTime(&timeinfo)){
-    delay(100);
+  memset(&timeinfo, 0, sizeof(timeinfo));
+  if(!clockLocal(&timeinfo)){
+    return false;
   }
   char dow[2]; // 0 - 6
   char hour[3]; // 0 - 23
@@ -201,126 +495,213 @@ int Thermostat::getTimeNow(int * ar){
   ar[0] = String(dow).toInt();
   ar[1] = String(hour).toInt();
   ar[2] = String(minute).toInt();
+  return true;
 }
 
 
+/**
+ * @brief Formats a slot as HH:MM Heat/Cool (06:30 22.5/26.0)
+ * 
+ * @param str 
+ * @param sched day of the week
+ * @param s slot
+ */
+void Thermostat::formatSlot(String &str, const struct Schedule &sched, int s){
+  char temp_buf[8];
+  str = "";
+  if (sched.Slot[s].hour < 10){
+    str += "0";
+  }
+  str += String(sched.Slot[s].hour) + ":";
+  if (sched.Slot[s].minute < 10){
+    str += "0";
+  }
+  str += String(sched.Slot[s].minute);
+  str += " " + String(formatDeci(temp_buf, sched.Slot[s].heat));
+  str += "/" + String(formatDeci(temp_buf, sched.Slot[s].cool));
+}
+
 /**
  * @brief Return the details about all the slots for the requested day
- * the format returns as HH:MM Temp (06:30 22.5)
+ * the format returns as HH:MM Heat/Cool (06:30 22.5/26.0)
  * 
  * @param slot 
  * @return String 
  */
 String Thermostat::getSlotInfo(int slot){
   String temp_str;
-  if (Schedule[screen_dow].Slot[slot].hour < 10){
-    temp_str += "0";
-  }
-  temp_str += String(Schedule[screen_dow].Slot[slot].hour) + ":";
-  if (Schedule[screen_dow].Slot[slot].minute < 10){
-    temp_str += "0";
-  }
-  temp_str += String(Schedule[screen_dow].Slot[slot].minute);
-  temp_str += "  " + String(Schedule[screen_dow].Slot[slot].temp);
-  temp_str += "c";
+  formatSlot(temp_str, displayDay(), slot);
   return temp_str;
 }
 
 /**
- * @brief Returns a String array with preformatted HH:MM DD strings
+ * @brief Returns a String array with preformatted HH:MM Heat/Cool strings
  * 
  * @param slots 
  */
 void Thermostat::daySlots(String slots[10]){
-  for(int s = 0; s < 10; s++){
-    if(!Schedule[screen_dow].Slot[s].temp){
-      continue;
-    }
-    slots[s] = "";
-    if (Schedule[screen_dow].Slot[s].hour < 10){
-      slots[s] += "0";
-    }
-    slots[s] += String(Schedule[screen_dow].Slot[s].hour) + ":";
-    if (Schedule[screen_dow].Slot[s].minute < 10){
-      slots[s] += "0";
-    }
-    slots[s] += String(Schedule[screen_dow].Slot[s].minute);
-    slots[s] += "  " + String(Schedule[screen_dow].Slot[s].temp);
-    slots[s] += "c";
+  const struct Schedule &sched = displayDay();
+  for(int s = 0; s < sched.len; s++){
+    formatSlot(slots[s], sched, s);
   }
 }
 
 /**
  * @brief Configures the heating and humidity relay pins and turns them to off so that the
  * furnace is stuck with heat on incase there is an issue on device startup. Loads
- * the schedule from preferences as well.
+ * the schedule and any hold from preferences as well.
  * 
+ * @param ev the event queue that ends holds
  */
-void Thermostat::begin(){
-  pinMode(heat_pin, OUTPUT);
-  pinMode(humd_pin, OUTPUT);
-  digitalWrite(heat_pin, HIGH);
-  digitalWrite(humd_pin, HIGH);
+void Thermostat::begin(Events &ev){
+  events = &ev;
+  equipment.begin();
+  humidity.begin();
   preferences.begin("schedule",false);
   loadSchedule(preferences);
+  exceptions.begin(preferences);
+  occupancy.begin(preferences);
   initSchedule();
+  restoreHold();
+}
+
+
+/**
+ * @brief Lets the relay governor apply pending requests and its safety cut offs,
+ * call this often (every loop interval)
+ * 
+ */
+void Thermostat::update(){
+  equipment.update(clockMillis());
 }
 
+/**
+ * @brief Turn the furnace and humidifier off and keep them off, used while the firmware is
+ * being replaced
+ * 
+ * @param val 
+ */
+void Thermostat::lock(boolean val){
+  unsigned long now = clockMillis();
+  equipment.lock(val, now);
+  humidity.lock(val, now);
+}
+
+/**
+ * @brief Start a trace replay from the same place every time. Drops the hold and every
+ * timer and governor that was running on the real clock, then picks the slot for the
+ * trace's clock. Settings (mode, hold temperature, humidity, schedule) are kept. Call with
+ * everything locked off.
+ * 
+ * @param now the trace's clockMillis()
+ */
+void Thermostat::reset(unsigned long now){
+  hold = HOLD_OFF;
+  hold_end = 0;
+  hold_ended = false;
+  changeover_at = 0;
+  if(events) events->cancel(EVENT_HOLD);
+  equipment.reset(now);
+  humidity.reset(now);
+  occupancy.reset(now);
+  cancelEdit();
+  active = -1;
+  exception = -1;
+  override_slot = -1;
+  int tz[3];
+  if(getTimeNow(tz)){
+    screen_dow = tz[0];
+  }
+  checkSchedule();
+}
+
+/**
+ * @brief Copy out what the control loop has decided, so it can be put back after something
+ * else has driven it with made up readings (the benchmarks)
+ * 
+ * @param out 
+ */
+void Thermostat::getControl(ControlState &out){
+  equipment.getState(out.equipment);
+  occupancy.getState(out.occupancy);
+  out.changeover_at = changeover_at;
+}
+
+/**
+ * @brief Put back what getControl() copied out. Call with everything locked off, then
+ * checkSchedule() to pick the slot for the real clock again.
+ * 
+ * @param state 
+ */
+void Thermostat::setControl(const ControlState &state){
+  equipment.setState(state.equipment, clockMillis());
+  occupancy.setState(state.occupancy);
+  changeover_at = state.changeover_at;
+}
 
 /**
  * @brief Gets the current timestamp from an NTP server and then updates the
  * day and slot so that the correct temperature is set as the target.
+ * Looking the time up in the transition index also copes with the clock jumping.
  * 
- * @return boolean 
+ * Precedence is a hold, then a dated exception, then the weekly schedule (with any
+ * occupancy setback). A day
+ * override that runs another weekday follows that day's slots, before its first
+ * slot the weekly schedule carries on.
+ * 
+ * @return boolean true if the target changed
  */
 boolean Thermostat::checkSchedule(){
   int tz[3];
-  getTimeNow(tz);
-  int next_hour,next_minute;
-  boolean changed = false;
-  
-  if(slot + 1 == Schedule[day].len){
-    if( (day + 1) % 7 != tz[0]) 
-      return changed;
-    next_hour = Schedule[(day + 1) % 7].Slot[0].hour;
-    next_minute = Schedule[(day + 1) % 7].Slot[0].minute;
-  } else {
-    next_hour = Schedule[day].Slot[slot + 1].hour;
-    next_minute = Schedule[day].Slot[slot + 1].minute;
-  }
-  if( (next_hour * 60) + next_minute <= (tz[1] * 60) + tz[2]){
-    if(slot + 1 == Schedule[day].len){
-      day = (day + 1) % 7;
-      slot = 0; 
-      changed = true;
-    } else {
-      slot += 1;
-      changed = true;
+  if(!getTimeNow(tz)){
+    // Nothing to go on until the clock is set, the target stays as it was
+    return false;
+  }
+  uint32_t now = clockTime();
+  boolean changed = hold_ended;
+  hold_ended = false;
+  int minute_of_week = (tz[0] * DAY_MINUTES) + (tz[1] * 60) + tz[2];
+  int idx = locate(minute_of_week);
+  if(idx != active){
+    setActive(idx);
+    changed = true;
+  }
+  if(occupancy.update(minute_of_week, clockMillis())){
+    changed = true;
+  }
+  int8_t exc = exceptions.lookup(now);
+  int over = -1;
+  const ScheduleException *e = exceptions.get(exc);
+  if(e && e->day != NO_DAY){
+    int minute = (tz[1] * 60) + tz[2];
+    for(int s = 0; s < Schedule[e->day].len && slotMinute(Schedule[e->day], s) <= minute; s++){
+      over = s;
     }
   }
+  if(exc != exception || over != override_slot){
+    exception = exc;
+    override_slot = over;
+    changed = true;
+  }
   return changed;
 }
 
 
 /**
- * @brief Write the default schedule to long term storage.
- * Currently this is hard-coded, this should instead take the Schedule struct
- * and then parse and write the schedule back into preferences.
- * 
- * As there isn't any function to input schedules into the screen at this time
- * this needs to stay hard-coded.
+ * @brief Write the default schedule to long term storage, used on first boot.
+ * Schedules edited on the screen are stored as a single "Week" entry by commitEdit()
  * 
  * @param prefs 
  */
 void Thermostat::createSchedule(Preferences &prefs){
-  String temp_sched = "7,30,22;9,0,21;20,0,20;23,0,18.5";
+  String temp_sched = "7,30,22,25;9,0,21,25;20,0,20,24;23,0,18.5,26";
   prefs.putString(full_days[0],temp_sched);
   prefs.putString(full_days[6],temp_sched);
-  temp_sched = "6,30,23;8,0,20;15,0,21.5;23,0,18.5";
+  temp_sched = "6,30,23,25;8,0,20,28;15,0,21.5,25;23,0,18.5,26";
   for(int i = 1; i < 5; i++){
     prefs.putString(full_days[i],temp_sched);
   }
-  temp_sched = "6,30,23;8,0,20;12,0,21.5;23,0,18.5";
+  temp_sched = "6,30,23,25;8,0,20,28;12,0,21.5,25;23,0,18.5,26";
   prefs.putString(full_days[5], temp_sched);
 }
 
@@ -335,65 +716,186 @@ void Thermostat::loadSchedule(Preferences& prefs){
   String sched_sun = prefs.getString(full_days[0],"");
   float read_humd = prefs.getFloat("Humidity");
   if(!read_humd){
-    target_humidity = 30;
+    humidity.setSetpoint(30);
   } else {
-    target_humidity = read_humd;
+    humidity.setSetpoint(read_humd);
+  }
+  mode = (ThermostatMode)prefs.getUChar("Mode", MODE_HEAT);
+  // A schedule committed from the editor is stored whole, it replaces the per day strings
+  if(prefs.getBytesLength("Week") == sizeof(Schedule)){
+    struct Schedule week[7];
+    prefs.getBytes("Week", week, sizeof(week));
+    if(validWeek(week)){
+      memcpy(Schedule, week, sizeof(Schedule));
+      return;
+    }
   }
   // If the schedule has never been saved then save it on setup
   if(sched_sun == ""){
     createSchedule(prefs);
-  } else {
-    /**
-     * Read the schedule from memory and put it into the schedule object
-     * schedules are saved as a non-nested key:value json like object
-     * Format of preferences schedule as below
-     * "<Day_of_week>": [ { <hour(int)>, <minute(int)>, <temperature(float)> }, {}]
-     * 
-     */
-    for(int i = 0; i < 7; i++){
-      String get_sched = prefs.getString(full_days[i],"");
-      int slot_count = 0;
-      String t_s = "";
-      String slots[10];
-      for(int s = 0; s < get_sched.length(); s++){
-        if(get_sched[s] == ';'){
-          slots[slot_count] = t_s;
-          slot_count ++;
-          t_s = "";
-          continue;
-        }
-        t_s += get_sched[s];
+  }
+  /**
+   * Read the schedule from memory and put it into the schedule object
+   * schedules are saved as a non-nested key:value json like object
+   * Format of preferences schedule as below
+   * "<Day_of_week>": [ { <hour(int)>, <minute(int)>, <heat(float)>, <cool(float)> }, {}]
+   * 
+   * Schedules saved before cooling existed have no cool value, those cool at the
+   * heating target plus the deadband.
+   */
+  for(int i = 0; i < 7; i++){
+    String get_sched = prefs.getString(full_days[i],"");
+    int slot_count = 0;
+    String t_s = "";
+    String slots[10];
+    for(int s = 0; s < get_sched.length(); s++){
+      if(get_sched[s] == ';'){
+        slots[slot_count] = t_s;
+        slot_count ++;
+        t_s = "";
+        continue;
       }
-      slots[slot_count] = t_s;
-      slot_count++;
-      Schedule[i].day = dow[i];
-      int p = 0;
-      for(int s = 0; s < slot_count; s++){
-        int temp_c = 0;
-        String temp_v;
-        for(int s_l = 0; s_l < slots[s].length(); s_l++){
-          if(slots[s][s_l] == ','){
-            if(temp_c == 0){
-              Schedule[i].Slot[s].hour = temp_v.toInt();
-              temp_v = "";
-              temp_c++;
-              continue;
-            } else if(temp_c == 1){
-              Schedule[i].Slot[s].minute = temp_v.toInt();
-              temp_v = "";
-              temp_c++;
-              continue;
-            }
+      t_s += get_sched[s];
+    }
+    slots[slot_count] = t_s;
+    slot_count++;
+    for(int s = 0; s < slot_count; s++){
+      int temp_c = 0;
+      String temp_v;
+      for(int s_l = 0; s_l < slots[s].length(); s_l++){
+        if(slots[s][s_l] == ','){
+          if(temp_c == 0){
+            Schedule[i].Slot[s].hour = temp_v.toInt();
+            temp_v = "";
+            temp_c++;
+            continue;
+          } else if(temp_c == 1){
+            Schedule[i].Slot[s].minute = temp_v.toInt();
+            temp_v = "";
+            temp_c++;
+            continue;
+          } else if(temp_c == 2){
+            Schedule[i].Slot[s].heat = parseDeci(temp_v.c_str());
+            temp_v = "";
+            temp_c++;
+            continue;
           }
-          temp_v += slots[s][s_l];
         }
-        Schedule[i].Slot[s].temp = temp_v.toFloat();
+        temp_v += slots[s][s_l];
+      }
+      if(temp_c == 2){
+        Schedule[i].Slot[s].heat = parseDeci(temp_v.c_str());
+        Schedule[i].Slot[s].cool = Schedule[i].Slot[s].heat + DEADBAND;
+      } else {
+        Schedule[i].Slot[s].cool = max((deci_celsius)parseDeci(temp_v.c_str()), (deci_celsius)(Schedule[i].Slot[s].heat + DEADBAND));
       }
-      Schedule[i].len = slot_count;
     }
+    Schedule[i].len = slot_count;
+  }
+}
+
+
+/**
+ * @brief Returns the schedule editor, its edits apply to the displayed day
+ * 
+ * @return ScheduleEditor& 
+ */
+ScheduleEditor& Thermostat::getEditor(){
+  return editor;
+}
+
+/**
+ * @brief Start editing a copy of the schedule
+ * 
+ */
+void Thermostat::beginEdit(){
+  editor.begin(Schedule);
+}
+
+/**
+ * @brief Throw away any edits
+ * 
+ */
+void Thermostat::cancelEdit(){
+  editor.finish();
+}
+
+/**
+ * @brief Makes a validated week live. The new week is written to preferences as a single
+ * entry first, so storage holds either the old or the new schedule, never half of each.
+ * Only then are the changed days copied in and their part of the transition index rebuilt.
+ * 
+ * @param next the whole new week
+ * @param days bit for each day that changed, bit 0 is Sunday
+ * @return boolean false if it couldn't be saved
+ */
+boolean Thermostat::commit(const struct Schedule next[7], uint8_t days){
+  if(days && !traceReplaying() && preferences.putBytes("Week", next, sizeof(Schedule)) != sizeof(Schedule)){
+    return false;
+  }
+  for(int d = 0; d < 7; d++){
+    if(days & (1 << d)){
+      Schedule[d] = next[d];
+      rebuildDay(d);
+    }
+  }
+  active = -1;
+  checkSchedule();
+  return true;
+}
+
+/**
+ * @brief Validates the edited copy and commits it
+ * 
+ * @return boolean false if the edits are invalid or couldn't be saved, editing continues
+ */
+boolean Thermostat::commitEdit(){
+  if(!editor.validate()){
+    return false;
   }
+  uint8_t dirty = editor.getDirty();
+  struct Schedule *shadow = editor.getWeek();
+  struct Schedule next[7];
+  for(int d = 0; d < 7; d++){
+    next[d] = (dirty & (1 << d)) ? shadow[d] : Schedule[d];
+  }
+  if(!commit(next, dirty)){
+    return false;
+  }
+  editor.finish();
+  return true;
 }
 
+/**
+ * @brief Returns the live weekly schedule
+ * 
+ * @return const struct Schedule* 
+ */
+const struct Schedule* Thermostat::getWeek(){
+  return Schedule;
+}
+
+/**
+ * @brief Replace the whole week, i.e. from the network. Any edit in progress on the
+ * screen is dropped since it was started from the old schedule.
+ * 
+ * @param week 
+ * @return boolean false if the week is invalid or couldn't be saved
+ */
+boolean Thermostat::setWeek(const struct Schedule week[7]){
+  if(!validWeek(week)){
+    return false;
+  }
+  uint8_t days = 0;
+  for(int d = 0; d < 7; d++){
+    if(memcmp(&week[d], &Schedule[d], sizeof(Schedule[d])) != 0) days |= 1 << d;
+  }
+  if(!commit(week, days)){
+    return false;
+  }
+  editor.finish();
+  return true;
+}
 
 /**
  * @brief Sets the display day to the previous day of the week
@@ -412,43 +914,63 @@ void Thermostat::nextDisplayDay(){
 }
  
 /**
- * @brief Takes an input temperature and determines whether the furnace should
- * turn on or off.
+ * @brief In auto mode switch between heating and cooling once the temperature has gone
+ * past the other target by the margin. Changeovers are rate limited so the two never
+ * fight each other.
  * 
  * @param temp 
+ * @param now 
  */
-void Thermostat::keepTemperature(float temp){
-  if(heat_on == true){
-    if(temp > getGoalTemp() + 1){
-      digitalWrite(heat_pin, HIGH); // Turn heat off
-      heat_on = false;
-    }
-  } else {
-    if(temp < getGoalTemp() - 1){
-      digitalWrite(heat_pin, LOW); // Turn heat on
-      heat_on = true;
+void Thermostat::changeover(deci_celsius temp, unsigned long now){
+  EquipmentMode want = equipment.getMode();
+  if(mode == MODE_OFF){
+    want = EQUIP_OFF;
+  } else if(mode == MODE_HEAT){
+    want = EQUIP_HEAT;
+  } else if(mode == MODE_COOL){
+    want = EQUIP_COOL;
+  } else if(changeover_at == 0 || now - changeover_at >= CHANGEOVER_DELAY || want == EQUIP_OFF){
+    if(want != EQUIP_COOL && temp > getCoolGoal() + CHANGEOVER_MARGIN){
+      want = EQUIP_COOL;
+    } else if(want != EQUIP_HEAT && temp < getHeatGoal() - CHANGEOVER_MARGIN){
+      want = EQUIP_HEAT;
+    } else if(want == EQUIP_OFF){
+      want = EQUIP_HEAT;
     }
   }
+  if(want != equipment.getMode()){
+    equipment.setMode(want, now);
+    changeover_at = now;
+  }
+}
+
+/**
+ * @brief Takes an input temperature and works out the control effort from how far it
+ * is from the goal, the equipment decides which stages that turns on. Failed sensor
+ * reads are ignored, if they keep failing the relay governors shut everything off.
+ * 
+ * @param temp 
+ */
+void Thermostat::keepTemperature(deci_celsius temp){
+  if(!isValid(temp)){
+    return;
+  }
+  unsigned long now = clockMillis();
+  equipment.sensorOk(now);
+  changeover(temp, now);
+  int effort = (getGoalTemp() - temp) * EFFORT_PER_DECI;
+  equipment.drive(constrain(effort, -100, 100), now);
 }
 
 /**
  * @brief Takes an input humidity and determines whether the humidifier should
- * turn on or off.
+ * turn on or off. The indoor temperature is needed to work out the window dew point.
  * 
  * @param humd 
+ * @param temp 
  */
-void Thermostat::keepHumidity(float humd){
-  if(humd_on == true){
-    if(humd > target_humidity + 1.5){
-      digitalWrite(humd_pin, HIGH); // Turn humidity off
-      humd_on = false;
-    }
-  } else {
-    if(humd < target_humidity - 2.0){
-      digitalWrite(humd_pin, LOW); // Turn humidity on
-      humd_on = true;
-    }
-  }
+void Thermostat::keepHumidity(float humd, deci_celsius temp){
+  humidity.keep(humd, temp, clockMillis());
 }
 
 /**
@@ -457,25 +979,240 @@ void Thermostat::keepHumidity(float humd){
  * @param target 
  */
 void Thermostat::setTargetHumidity(float target){
-  target_humidity = target;
-  preferences.putFloat("Humidity", target);
+  humidity.setSetpoint(target);
+  if(!traceReplaying()) preferences.putFloat("Humidity", target);
 }
 
 /**
- * @brief Set the holding temperature to the provided float
+ * @brief Record the current outdoor temperature, used to limit humidity in cold weather
+ * 
+ * @param temp 
+ */
+void Thermostat::setOutdoorTemp(deci_celsius temp){
+  humidity.setOutdoorTemp(temp, clockMillis());
+}
+
+/**
+ * @brief Set the holding temperature, in tenths of a degree, and save it
  * 
  * @param target 
  */
-void Thermostat::setHoldTemp(float target){
+void Thermostat::setHoldTemp(deci_celsius target){
   hold_temp = target;
+  if(!traceReplaying()) preferences.putShort("HoldTemp", target);
+}
+
+/**
+ * @brief Set the mode and save it so it survives a restart
+ * 
+ * @param val 
+ */
+void Thermostat::setMode(ThermostatMode val){
+  mode = val;
+  if(!traceReplaying()) preferences.putUChar("Mode", val);
+  changeover_at = 0;
+}
+
+/**
+ * @brief Step through the modes, used by the mode button on the settings screen
+ * 
+ */
+void Thermostat::nextMode(){
+  setMode((ThermostatMode)((mode + 1) % 4));
+}
+
+/**
+ * @brief Milliseconds until the schedule moves to its next slot
+ * 
+ * @return unsigned long HOLD_HOURS if the clock isn't set, the next slot isn't known then
+ */
+unsigned long Thermostat::untilNextSlot(){
+  int tz[3];
+  if(!getTimeNow(tz)){
+    return HOLD_HOURS * 3600000UL;
+  }
+  int now = (tz[0] * DAY_MINUTES) + (tz[1] * 60) + tz[2];
+  int next = transitions[(active + 1) % day_offset[7]];
+  int minutes = (next - now + WEEK_MINUTES) % WEEK_MINUTES;
+  if(minutes == 0){
+    minutes = WEEK_MINUTES;
+  }
+  return (minutes * 60000UL) - ((clockTime() % 60) * 1000UL);
+}
+
+/**
+ * @brief Start a hold that ends after ms (0 never ends). The deadline is kept as a clockMillis()
+ * timer in the event queue so clock changes can't cut it short or stretch it, the end time
+ * is only saved as a wall clock time for picking the hold back up after a restart.
+ * 
+ * @param type 
+ * @param ms 
+ */
+void Thermostat::startHold(HoldType type, unsigned long ms){
+  hold = type;
+  hold_end = ms ? clockTime() + (ms / 1000) : 0;
+  if(events){
+    if(ms){
+      events->at(EVENT_HOLD, ms, onHoldEnd, this, clockMillis());
+    } else {
+      events->cancel(EVENT_HOLD);
+    }
+  }
+  logEvent(LOG_HOLD, hold, hold_temp);
+  saveHold();
+}
+
+/**
+ * @brief Event callback for the end of a hold
+ * 
+ * @param ctx the thermostat
+ */
+void Thermostat::onHoldEnd(void *ctx){
+  ((Thermostat*)ctx)->endHold();
+}
+
+/**
+ * @brief Go back to the schedule, the next checkSchedule() reports the change
+ * 
+ */
+void Thermostat::endHold(){
+  hold = HOLD_OFF;
+  hold_end = 0;
+  hold_ended = true;
+  logEvent(LOG_HOLD, hold, hold_temp);
+  saveHold();
+}
+
+/**
+ * @brief Write the hold to preferences, not during a trace replay
+ * 
+ */
+void Thermostat::saveHold(){
+  if(traceReplaying()){
+    return;
+  }
+  preferences.putUChar("HoldType", hold);
+  preferences.putUInt("HoldEnd", hold_end);
+}
+
+/**
+ * @brief Pick up the hold from before a restart with whatever time it had left
+ * 
+ */
+void Thermostat::restoreHold(){
+  hold_temp = preferences.getShort("HoldTemp", deci(21, 0));
+  HoldType type = (HoldType)preferences.getUChar("HoldType", HOLD_OFF);
+  uint32_t end = preferences.getUInt("HoldEnd", 0);
+  uint32_t now = clockTime();
+  if(type == HOLD_PERMANENT){
+    hold = type;
+  } else if(type != HOLD_OFF && end > now){
+    startHold(type, (end - now) * 1000UL);
+  } else if(type != HOLD_OFF){
+    saveHold();
+  }
+}
+
+/**
+ * @brief Start or cancel a hold at the hold temperature
+ * 
+ * @param type 
+ * @param minutes length of a HOLD_TIMED hold
+ */
+void Thermostat::setHold(HoldType type, uint16_t minutes){
+  unsigned long ms = 0;
+  if(type == HOLD_NEXT_SLOT){
+    ms = untilNextSlot();
+  } else if(type == HOLD_TIMED){
+    ms = minutes * 60000UL;
+  }
+  startHold(type, ms);
+}
+
+/**
+ * @brief Step through off, until the next slot, HOLD_HOURS and permanent. Used by the hold
+ * button on the settings screen
+ * 
+ */
+void Thermostat::nextHold(){
+  setHold((HoldType)((hold + 1) % 4), HOLD_HOURS * 60);
+}
+
+/**
+ * @brief Hold a temperature for a while, then go back to the schedule
+ * 
+ * @param target 
+ * @param minutes 0 holds until cancelled
+ */
+void Thermostat::holdFor(deci_celsius target, uint16_t minutes){
+  setHoldTemp(target);
+  setHold(minutes ? HOLD_TIMED : HOLD_PERMANENT, minutes);
+}
+
+/**
+ * @brief Returns the dated exceptions
+ * 
+ * @return Exceptions& 
+ */
+Exceptions& Thermostat::getExceptions(){
+  return exceptions;
+}
+
+/**
+ * @brief Returns the dated exception in effect
+ * 
+ * @return const ScheduleException* nullptr when following the weekly schedule
+ */
+const ScheduleException* Thermostat::getException(){
+  return exceptions.get(exception);
+}
+
+/**
+ * @brief Store a dated exception, it takes effect straight away if it has started
+ * 
+ * @param e 
+ * @return boolean false if invalid or there's no room
+ */
+boolean Thermostat::addException(const ScheduleException &e){
+  if(!exceptions.add(e, clockTime())){
+    return false;
+  }
+  exception = -1;
+  checkSchedule();
+  return true;
+}
+
+/**
+ * @brief Delete a dated exception
+ * 
+ * @param i 
+ * @return boolean 
+ */
+boolean Thermostat::removeException(uint8_t i){
+  if(!exceptions.remove(i)){
+    return false;
+  }
+  exception = -1;
+  checkSchedule();
+  return true;
+}
+
+/**
+ * @brief Returns the occupancy model
+ * 
+ * @return Occupancy& 
+ */
+Occupancy& Thermostat::getOccupancy(){
+  return occupancy;
 }
 
 /**
- * @brief Toggle whether to hold temperature at the holding temperature or not
+ * @brief A room module saw someone, ends any setback at the next checkSchedule()
  * 
+ * @param room index from Rooms
  */
-void Thermostat::toggleHold(){
-  hold = !hold;
+void Thermostat::reportPresence(uint8_t room){
+  occupancy.presence(room, clockMillis());
 }
 
 #endif
@@ -0,0 +1,402 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "Clock.h"
+#include "Temperature.h"
+
+#define TRACE_SIZE 1024            // Entries kept, 12KB
+#define TRACE_STEP 250             // Replay runs the loop every 250ms of trace time
+
+enum TraceType : uint8_t {
+  TRACE_CLOCK,     // value: epoch seconds
+  TRACE_DHT,       // b: temperature, value: humidity x10 (0xFFFF failed)
+  TRACE_TOUCH,     // a: TouchPhase, b: x, value: y, raw from the touch controller
+  TRACE_WIFI,      // a: connected, b: rssi
+  TRACE_OUTDOOR    // b: outdoor temperature
+};
+
+/**
+ * @brief One recorded input, 12 bytes. A trace is a plain array of these, the same bytes
+ * are downloaded and uploaded.
+ *
+ */
+struct TraceEntry {
+  uint32_t ms;
+  uint32_t value;
+  int16_t b;
+  TraceType type;
+  uint8_t a;
+};
+
+/**
+ * @brief The inputs as of the current point in a replay
+ *
+ */
+struct TraceInputs {
+  deci_celsius temp;
+  float humd;
+  boolean wifi;
+  int rssi;
+};
+
+/**
+ * @brief What a replay did. Two replays of the same trace should match exactly, after a
+ * change to the control or drawing code any difference shows up in the hashes.
+ *
+ */
+struct TraceResult {
+  uint32_t decisions;      // Relay switches
+  uint32_t decision_hash;  // FNV-1a over the time, pin and state of every switch
+  uint32_t on_ms;          // Total relay on time
+  uint32_t trace_ms;       // Trace time covered
+  uint32_t wall_us;        // Real time the replay took
+  uint32_t pushes;         // Sprites pushed to the screen
+  uint32_t frame_crc;      // CRC-32 of everything drawn, from Draw
+};
+
+/**
+ * @brief Records the inputs of a running unit (sensor readings, touches, WiFi and the wall
+ * clock) and feeds them back in. Readings are only recorded when they change, so a trace
+ * covers hours of normal running.
+ *
+ * Recording stops when the trace is full rather than overwriting it, a replay has to start
+ * from the clock entry at the beginning.
+ *
+ */
+class Trace {
+  private:
+    TraceEntry entries[TRACE_SIZE];
+    uint16_t count = 0;
+    uint16_t pos = 0;
+    size_t loaded = 0;
+    boolean recording = false;
+    boolean replaying = false;
+    deci_celsius last_temp = DECI_INVALID;
+    uint16_t last_humd = 0;
+    TraceInputs inputs;
+    TraceResult result;
+    uint32_t on_since[40];         // Per pin, when it last switched on
+    void hash(uint32_t v);
+
+  public:
+    void start(unsigned long now);
+    void stop();
+    void add(TraceType type, uint8_t a, int16_t b, uint32_t value, unsigned long now);
+    void dht(deci_celsius temp, float humd, unsigned long now);
+    boolean getRecording();
+    uint16_t getCount();
+
+    boolean beginReplay();
+    boolean next(TraceEntry &e);
+    void endReplay(uint32_t wall_us);
+    void decision(uint8_t pin, boolean on, unsigned long now);
+    void frames(uint32_t pushes, uint32_t crc);
+    boolean getReplaying();
+    TraceInputs& getInputs();
+    const TraceResult& getResult();
+    void report(Print &out);
+
+    const uint8_t* getData();
+    size_t getSize();
+    void loadBegin();
+    void loadWrite(const uint8_t *buf, size_t len);
+    boolean loadFinish();
+};
+
+Trace trace;
+
+/**
+ * @brief Whether a trace is being replayed, outputs aren't driven while it is
+ *
+ * @return boolean
+ */
+boolean traceReplaying(){
+  return trace.getReplaying();
+}
+
+/**
+ * @brief Start a new recording from the current wall clock
+ *
+ * @param now
+ */
+void Trace::start(unsigned long now){
+  count = 0;
+  last_temp = DECI_INVALID;
+  last_humd = 0;
+  recording = true;
+  add(TRACE_CLOCK, 0, 0, time(nullptr), now);
+}
+
+/**
+ * @brief Stop recording, the trace is kept for download or replay
+ *
+ */
+void Trace::stop(){
+  recording = false;
+}
+
+/**
+ * @brief Record an input
+ *
+ * @param type
+ * @param a
+ * @param b
+ * @param value
+ * @param now
+ */
+void Trace::add(TraceType type, uint8_t a, int16_t b, uint32_t value, unsigned long now){
+  if(!recording){
+    return;
+  }
+  entries[count++] = {now, value, b, type, a};
+  if(count == TRACE_SIZE){
+    recording = false;
+  }
+}
+
+/**
+ * @brief Record a sensor reading if it differs from the last one recorded
+ *
+ * @param temp
+ * @param humd
+ * @param now
+ */
+void Trace::dht(deci_celsius temp, float humd, unsigned long now){
+  uint16_t h = isnan(humd) ? 0xFFFF : (uint16_t)lround(humd * 10);
+  if(temp == last_temp && h == last_humd){
+    return;
+  }
+  last_temp = temp;
+  last_humd = h;
+  add(TRACE_DHT, 0, temp, h, now);
+}
+
+/**
+ * @brief Whether a recording is running
+ *
+ * @return boolean
+ */
+boolean Trace::getRecording(){
+  return recording;
+}
+
+/**
+ * @brief Returns the number of entries in the trace
+ *
+ * @return uint16_t
+ */
+uint16_t Trace::getCount(){
+  return count;
+}
+
+/**
+ * @brief Start feeding the trace back in, the clock switches over to the trace's time. Anything
+ * holding a time from the real clock (the relay governors, timers, holds) has to be reset to
+ * clockMillis() by the caller before the first entry.
+ *
+ * @return boolean false if there's no trace
+ */
+boolean Trace::beginReplay(){
+  if(count == 0 || entries[0].type != TRACE_CLOCK){
+    return false;
+  }
+  recording = false;
+  replaying = true;
+  pos = 0;
+  memset(&result, 0, sizeof(result));
+  memset(on_since, 0, sizeof(on_since));
+  result.decision_hash = 2166136261UL;
+  inputs = {DECI_INVALID, NAN, true, 0};
+  replay_clock = {true, entries[0].ms, (time_t)entries[0].value, entries[0].ms};
+  return true;
+}
+
+/**
+ * @brief The next input of the replay, the inputs are updated before it is returned
+ *
+ * @param e
+ * @return boolean false at the end of the trace
+ */
+boolean Trace::next(TraceEntry &e){
+  if(!replaying || pos >= count){
+    return false;
+  }
+  e = entries[pos++];
+  switch(e.type){
+    case TRACE_CLOCK:
+      replay_clock.epoch = e.value;
+      replay_clock.epoch_ms = e.ms;
+      break;
+    case TRACE_DHT:
+      inputs.temp = e.b;
+      inputs.humd = e.value == 0xFFFF ? NAN : e.value / 10.0;
+      break;
+    case TRACE_WIFI:
+      inputs.wifi = e.a;
+      inputs.rssi = e.b;
+      break;
+    default:
+      break;
+  }
+  return true;
+}
+
+/**
+ * @brief Finish a replay and go back to the real clock
+ *
+ * @param wall_us how long the replay took
+ */
+void Trace::endReplay(uint32_t wall_us){
+  unsigned long now = replay_clock.ms;
+  for(int p = 0; p < 40; p++){
+    if(on_since[p]) result.on_ms += now - on_since[p];
+  }
+  result.trace_ms = now - entries[0].ms;
+  result.wall_us = wall_us;
+  replaying = false;
+  replay_clock.active = false;
+}
+
+/**
+ * @brief FNV-1a, a byte at a time
+ *
+ * @param v
+ */
+void Trace::hash(uint32_t v){
+  for(int i = 0; i < 4; i++){
+    result.decision_hash = (result.decision_hash ^ ((v >> (i * 8)) & 0xFF)) * 16777619UL;
+  }
+}
+
+/**
+ * @brief Called by the relays each time one switches, only counts during a replay
+ *
+ * @param pin
+ * @param on
+ * @param now
+ */
+void Trace::decision(uint8_t pin, boolean on, unsigned long now){
+  if(!replaying){
+    return;
+  }
+  result.decisions++;
+  hash(now - entries[0].ms);
+  hash((pin << 1) | on);
+  if(pin >= 40) return;
+  if(on){
+    on_since[pin] = now;
+  } else if(on_since[pin]){
+    result.on_ms += now - on_since[pin];
+    on_since[pin] = 0;
+  }
+}
+
+/**
+ * @brief Record what the replay drew
+ *
+ * @param pushes
+ * @param crc
+ */
+void Trace::frames(uint32_t pushes, uint32_t crc){
+  result.pushes = pushes;
+  result.frame_crc = crc;
+}
+
+/**
+ * @brief Whether a replay is running
+ *
+ * @return boolean
+ */
+boolean Trace::getReplaying(){
+  return replaying;
+}
+
+/**
+ * @brief The sensor and WiFi state at this point in the replay
+ *
+ * @return TraceInputs&
+ */
+TraceInputs& Trace::getInputs(){
+  return inputs;
+}
+
+/**
+ * @brief Returns what the last replay did
+ *
+ * @return const TraceResult&
+ */
+const TraceResult& Trace::getResult(){
+  return result;
+}
+
+/**
+ * @brief Print the result of the last replay
+ *
+ * @param out
+ */
+void Trace::report(Print &out){
+  out.printf("entries   %u\n", count);
+  out.printf("covered   %lu s\n", (unsigned long)(result.trace_ms / 1000));
+  out.printf("took      %lu ms\n", (unsigned long)(result.wall_us / 1000));
+  out.printf("switches  %lu\n", (unsigned long)result.decisions);
+  out.printf("on time   %lu s\n", (unsigned long)(result.on_ms / 1000));
+  out.printf("decisions %08lx\n", (unsigned long)result.decision_hash);
+  out.printf("pushes    %lu\n", (unsigned long)result.pushes);
+  out.printf("frames    %08lx\n", (unsigned long)result.frame_crc);
+}
+
+/**
+ * @brief The trace as bytes, for download
+ *
+ * @return const uint8_t*
+ */
+const uint8_t* Trace::getData(){
+  return (const uint8_t*)entries;
+}
+
+/**
+ * @brief Returns the size of the trace in bytes
+ *
+ * @return size_t
+ */
+size_t Trace::getSize(){
+  return count * sizeof(TraceEntry);
+}
+
+/**
+ * @brief Start replacing the trace with an uploaded one
+ *
+ */
+void Trace::loadBegin(){
+  recording = false;
+  count = 0;
+  loaded = 0;
+}
+
+/**
+ * @brief Copy the next piece of an upload in, anything past TRACE_SIZE entries is dropped
+ *
+ * @param buf
+ * @param len
+ */
+void Trace::loadWrite(const uint8_t *buf, size_t len){
+  size_t room = sizeof(entries) - min(loaded, sizeof(entries));
+  memcpy((uint8_t*)entries + loaded, buf, min(len, room));
+  loaded += len;
+}
+
+/**
+ * @brief Check the upload is a whole number of entries starting with the clock
+ *
+ * @return boolean
+ */
+boolean Trace::loadFinish(){
+  if(loaded == 0 || loaded > sizeof(entries) || loaded % sizeof(TraceEntry) != 0 || entries[0].type != TRACE_CLOCK){
+    loaded = 0;
+    return false;
+  }
+  count = loaded / sizeof(TraceEntry);
+  return true;
+}
+
+#endif
@@ -0,0 +1,206 @@
+// Generated by   : tools/web_assets.py
+// Generated from : web/app.js, web/index.html, web/style.css
+// Format         : gzip, served with Content-Encoding: gzip
+// Memory usage   : 2681 bytes
+
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+typedef struct {
+  const char *path;
+  const char *type;
+  const char *etag;   // Quoted, ready for the header
+  const uint8_t *data;
+  uint32_t len;
+} WebAsset;
+
+// web/app.js, 3669 bytes, 1527 gzipped
+const uint8_t Web_app_js[1527] PROGMEM = {
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9D, 0x57, 0x51, 0x6F, 0xDB, 0x36,
+  0x10, 0x7E, 0xCF, 0xAF, 0xB8, 0x19, 0x1D, 0x24, 0xAD, 0x89, 0xEC, 0xA4, 0x5B, 0x51, 0x24, 0x71,
+  0x8A, 0x6D, 0xCD, 0xB6, 0x0E, 0x49, 0x5B, 0x34, 0xDD, 0x93, 0x61, 0x14, 0xAC, 0x74, 0xB2, 0xD8,
+  0x50, 0xA4, 0x4B, 0x52, 0x49, 0x8C, 0x22, 0xFF, 0x7D, 0x77, 0xA4, 0x64, 0xCB, 0x8D, 0x3B, 0xB4,
+  0x7B, 0xB1, 0x2C, 0xF2, 0xEE, 0xBB, 0x8F, 0x77, 0xC7, 0xBB, 0xD3, 0x78, 0x0C, 0x97, 0xD2, 0x5A,
+  0x63, 0x1D, 0xF8, 0x1A, 0xC1, 0x9B, 0xB6, 0xA8, 0x5D, 0x61, 0x11, 0x75, 0x0E, 0x17, 0xF2, 0x06,
+  0xE1, 0x46, 0xA8, 0x16, 0x1D, 0x14, 0xA6, 0x41, 0xA8, 0xAC, 0x69, 0x60, 0x8C, 0x37, 0xA8, 0xBD,
+  0xDB, 0x0F, 0xF2, 0xAE, 0xA8, 0xB1, 0x6C, 0x15, 0x82, 0xD0, 0x25, 0xD4, 0xD2, 0x79, 0x63, 0x57,
+  0x20, 0x2C, 0xEE, 0x8D, 0xC7, 0x50, 0xA1, 0xE7, 0x5D, 0x30, 0xBA, 0x88, 0xFB, 0xAC, 0xD0, 0xCB,
+  0x48, 0xB2, 0x67, 0x96, 0x4B, 0xDA, 0x6E, 0x97, 0x11, 0x37, 0xC0, 0x79, 0x8B, 0xA2, 0xC9, 0xF7,
+  0x0A, 0xA3, 0x9D, 0x87, 0x47, 0x30, 0x05, 0x59, 0xC2, 0xF4, 0x0C, 0x4A, 0x53, 0xB4, 0x0D, 0x59,
+  0xCD, 0x17, 0xE8, 0xCF, 0x15, 0xF2, 0xDF, 0xDF, 0x56, 0x2F, 0xCB, 0x54, 0x96, 0xD9, 0x49, 0x27,
+  0x5C, 0x8A, 0x95, 0x23, 0xF9, 0x59, 0xE2, 0x5A, 0x9D, 0xEC, 0x43, 0xD2, 0x98, 0xF0, 0xF0, 0x2D,
+  0xF2, 0xE3, 0x16, 0xCB, 0xF0, 0x56, 0xB7, 0xFC, 0xA8, 0xAC, 0xE4, 0x87, 0x13, 0x3E, 0x99, 0xF7,
+  0xFA, 0x8D, 0x29, 0x31, 0x02, 0x98, 0xAA, 0xE2, 0xDD, 0x1A, 0x69, 0x9B, 0x9E, 0x85, 0x31, 0x8A,
+  0x9F, 0xA2, 0xF5, 0x66, 0x23, 0x5E, 0x1B, 0x55, 0x46, 0x71, 0xDE, 0x6B, 0xB5, 0x97, 0x0A, 0x34,
+  0xDE, 0x79, 0x70, 0xCA, 0x04, 0xB5, 0x08, 0xA1, 0x4A, 0x56, 0x51, 0xE8, 0xD7, 0x07, 0x27, 0x95,
+  0x6E, 0x05, 0x4B, 0xE9, 0xA5, 0x5E, 0xD0, 0x4A, 0x25, 0x94, 0xC3, 0x93, 0xBD, 0xBD, 0xAA, 0xD5,
+  0x85, 0x97, 0x46, 0x43, 0xD5, 0xF8, 0xD4, 0x67, 0xF0, 0x79, 0x0F, 0xC0, 0xA2, 0x6F, 0xAD, 0x06,
+  0x0F, 0xD3, 0xE9, 0x14, 0x74, 0xAB, 0x14, 0x3C, 0x87, 0xE4, 0xE0, 0x20, 0x3F, 0x48, 0xE0, 0x18,
+  0x7C, 0xEE, 0xCD, 0x1F, 0xF2, 0x0E, 0xCB, 0xF4, 0x90, 0x1C, 0x71, 0x3F, 0x40, 0x58, 0x1A, 0xE7,
+  0xD3, 0xA5, 0xF0, 0xF5, 0x3E, 0x85, 0x63, 0xE1, 0xB6, 0xB0, 0x42, 0x60, 0xC2, 0x26, 0x3C, 0x86,
+  0xE4, 0x79, 0x42, 0xBF, 0x1A, 0x6F, 0xE1, 0x9F, 0xB7, 0x17, 0x57, 0x28, 0x6C, 0x51, 0xBF, 0x11,
+  0x56, 0x34, 0x2E, 0x0D, 0x7A, 0xFB, 0xF0, 0xB9, 0x41, 0x5F, 0x9B, 0xF2, 0x18, 0x92, 0x37, 0xAF,
+  0xAF, 0xDE, 0x25, 0xF7, 0x5F, 0x18, 0x72, 0xB5, 0xB9, 0xBD, 0xF2, 0xC2, 0x63, 0xDA, 0x19, 0x79,
+  0x94, 0x26, 0x1E, 0x9B, 0x65, 0x92, 0xE5, 0x9E, 0xFC, 0xF1, 0xBB, 0xD1, 0x9E, 0xA2, 0xC5, 0x87,
+  0xA4, 0x33, 0xB9, 0x9C, 0xB7, 0x08, 0x21, 0x88, 0xD5, 0x6D, 0x53, 0x3E, 0x10, 0x73, 0x39, 0x2F,
+  0x7F, 0x71, 0x5A, 0x3E, 0xEB, 0x25, 0xF1, 0xCD, 0xAD, 0x69, 0x75, 0x99, 0x46, 0x99, 0x1E, 0x66,
+  0x61, 0x84, 0xFA, 0x8A, 0x35, 0x0E, 0x6A, 0x80, 0x3A, 0x22, 0x1C, 0x97, 0x73, 0x28, 0x09, 0x89,
+  0xD4, 0x29, 0xB6, 0x6B, 0x16, 0x14, 0xC9, 0x5D, 0x2C, 0x68, 0x79, 0xAD, 0x9A, 0x54, 0xC6, 0x02,
+  0xFB, 0x29, 0x90, 0xA8, 0x94, 0x31, 0x36, 0x8D, 0x22, 0xEF, 0x15, 0x56, 0x1E, 0xC6, 0xF0, 0x74,
+  0x92, 0xB1, 0x33, 0x8F, 0x49, 0x88, 0x60, 0x01, 0xAE, 0xBC, 0xA5, 0xD8, 0x6E, 0x09, 0xFD, 0xC8,
+  0x42, 0xF9, 0x52, 0x94, 0xE4, 0x2E, 0xEB, 0xD3, 0x23, 0x4A, 0x90, 0x49, 0x92, 0x11, 0x9F, 0x90,
+  0x4B, 0xB3, 0x28, 0x3A, 0xEF, 0x58, 0xE1, 0xA7, 0x56, 0x2E, 0x39, 0xCF, 0x1F, 0x50, 0x23, 0x4C,
+  0xE7, 0xC5, 0x02, 0x99, 0xD6, 0xDB, 0x56, 0x6B, 0x4E, 0xA1, 0xB8, 0xC0, 0x04, 0xFB, 0x4D, 0x0A,
+  0xD7, 0xCB, 0x52, 0x21, 0xE1, 0x47, 0x3E, 0xAC, 0x85, 0xFE, 0x83, 0x28, 0xAE, 0x59, 0x6F, 0x1F,
+  0xE8, 0x05, 0xF8, 0x8D, 0x3D, 0x9B, 0xB0, 0x14, 0x44, 0xAF, 0xCA, 0x52, 0x56, 0x12, 0x6D, 0x14,
+  0xEA, 0xDE, 0x57, 0x64, 0xA2, 0x93, 0x63, 0x76, 0xB2, 0x82, 0xF4, 0x87, 0x2E, 0x79, 0x63, 0xC8,
+  0x03, 0x63, 0xF6, 0x35, 0x91, 0x0D, 0xF5, 0x82, 0x68, 0x86, 0xFB, 0x34, 0x8B, 0x21, 0x08, 0x87,
+  0xEA, 0x43, 0x4E, 0x88, 0x7E, 0x35, 0x10, 0x8C, 0xC1, 0x7C, 0xCF, 0x51, 0xDC, 0x88, 0xB1, 0xD3,
+  0xBA, 0x2C, 0x1A, 0xC8, 0xF5, 0xAB, 0x2C, 0x77, 0xBF, 0x95, 0x85, 0xA5, 0x15, 0xB7, 0x7F, 0x5A,
+  0xB1, 0xAC, 0xD3, 0xC8, 0x28, 0x5E, 0x52, 0xBE, 0x5B, 0x9C, 0x20, 0xBC, 0x11, 0xB9, 0xC7, 0x75,
+  0x4D, 0xEB, 0xDD, 0x7D, 0xCC, 0x15, 0xEA, 0x85, 0xAF, 0xFB, 0x73, 0x69, 0x38, 0x85, 0xA3, 0xAC,
+  0xBB, 0x28, 0x1B, 0x05, 0x36, 0xEA, 0x06, 0x4A, 0x95, 0x12, 0xFE, 0x52, 0x2C, 0xD3, 0x9A, 0x8B,
+  0xD3, 0xAC, 0x9E, 0x1D, 0xCE, 0xC9, 0x59, 0xB3, 0x27, 0xF3, 0x79, 0x96, 0x57, 0x52, 0x79, 0xB4,
+  0xA9, 0xE7, 0x1D, 0x0F, 0x3F, 0x74, 0x69, 0x3C, 0x30, 0xAE, 0x0C, 0x01, 0x0D, 0xF2, 0x28, 0xFC,
+  0x6D, 0xA4, 0x4E, 0xF3, 0x3C, 0xDC, 0x0E, 0x97, 0x65, 0x70, 0x00, 0x87, 0x1B, 0x85, 0x5A, 0xF6,
+  0x0A, 0x05, 0x4A, 0xD5, 0xC9, 0x8B, 0xBB, 0xA1, 0xFC, 0xE3, 0xA1, 0xFC, 0x1D, 0x97, 0x4D, 0x36,
+  0x2F, 0xE1, 0x27, 0xF8, 0xF9, 0xD9, 0x84, 0xB2, 0x93, 0xCE, 0x45, 0x90, 0x03, 0x12, 0x5C, 0x87,
+  0x02, 0xC5, 0xC3, 0xA7, 0x13, 0xDA, 0x22, 0xBA, 0x07, 0x44, 0x2C, 0x23, 0x05, 0x5E, 0x20, 0x05,
+  0x32, 0x1A, 0x56, 0x06, 0xBC, 0xA5, 0xE6, 0x30, 0x5C, 0xB3, 0x56, 0xEF, 0x87, 0x86, 0x7C, 0x90,
+  0x52, 0x89, 0x91, 0x59, 0x58, 0x9D, 0x5D, 0xCF, 0xB7, 0x2E, 0x2E, 0x27, 0xCD, 0x5D, 0x2A, 0xB3,
+  0x41, 0x95, 0xE2, 0x4B, 0xB2, 0xCF, 0x89, 0xBA, 0x4A, 0x59, 0x7C, 0xB8, 0x95, 0xE5, 0x1F, 0x0D,
+  0xB9, 0x21, 0x81, 0x18, 0x2A, 0x15, 0x32, 0xD4, 0xB2, 0xDB, 0x93, 0x84, 0x17, 0xD6, 0xCE, 0x37,
+  0xF6, 0x5C, 0x50, 0x01, 0xDB, 0x18, 0x8E, 0x39, 0xC8, 0xF1, 0xAB, 0x67, 0xBF, 0xCC, 0xB3, 0xA8,
+  0xF6, 0x98, 0xF4, 0x4E, 0x2D, 0x16, 0x1E, 0x0A, 0x25, 0x9C, 0x9B, 0x8E, 0x8C, 0x1E, 0xC1, 0xDD,
+  0x74, 0xC4, 0xC6, 0x77, 0x90, 0x1A, 0xC1, 0x6A, 0x3A, 0x9A, 0x8C, 0xE0, 0x56, 0x96, 0xBE, 0x8E,
+  0x52, 0xE9, 0x96, 0xF3, 0x1E, 0x2A, 0xD4, 0x28, 0x17, 0xB5, 0x9F, 0x8E, 0xC8, 0x65, 0xA3, 0xF1,
+  0x59, 0xE0, 0x78, 0x1F, 0xA8, 0x2F, 0x72, 0xA9, 0x35, 0xDA, 0xBF, 0xDE, 0x5D, 0x5E, 0x10, 0xFB,
+  0xC8, 0x86, 0xC8, 0x2C, 0x8D, 0x5A, 0x05, 0x2F, 0x76, 0x84, 0xB8, 0x0A, 0x8D, 0xA8, 0x52, 0x4B,
+  0x6A, 0xA7, 0xD1, 0x22, 0xEF, 0xA6, 0x4F, 0x22, 0xFC, 0xF8, 0xEC, 0x81, 0x02, 0x87, 0x7B, 0x87,
+  0xC2, 0x61, 0xAF, 0x90, 0xEC, 0x28, 0xCD, 0x5D, 0x83, 0x4E, 0x6F, 0x11, 0xAF, 0xD7, 0x05, 0x9A,
+  0x5F, 0xE8, 0x6A, 0x0D, 0x59, 0x72, 0xFF, 0x0C, 0xF1, 0x0C, 0x0D, 0x37, 0x39, 0xF5, 0xF6, 0xEC,
+  0xD4, 0x97, 0x67, 0x6C, 0xA4, 0x0C, 0xEC, 0xC7, 0xF4, 0xD6, 0xAF, 0xB0, 0xFE, 0xAC, 0x9C, 0x07,
+  0x79, 0x0A, 0xD0, 0xD9, 0x97, 0x25, 0xAF, 0xB5, 0x3B, 0x0A, 0x5D, 0x57, 0x1E, 0x37, 0x72, 0x94,
+  0xF4, 0xAD, 0xC7, 0xDD, 0x92, 0x5D, 0x31, 0x63, 0x17, 0x0D, 0xFC, 0x4E, 0x76, 0xFA, 0x2C, 0x21,
+  0xD1, 0x6C, 0xC3, 0x6B, 0x4C, 0x74, 0x93, 0x7E, 0x2B, 0xF9, 0xA2, 0x45, 0x51, 0xFE, 0x6A, 0xCA,
+  0x83, 0xAD, 0xD2, 0x10, 0x7A, 0x3D, 0x77, 0xBD, 0x73, 0x9E, 0x66, 0xAE, 0x88, 0x71, 0x81, 0x69,
+  0xD2, 0xCD, 0x36, 0x31, 0x01, 0xD1, 0xE5, 0xA2, 0x2C, 0xC3, 0xFE, 0x05, 0xA5, 0x1E, 0x92, 0xAF,
+  0xD2, 0xC4, 0x71, 0xAB, 0x23, 0xE3, 0xC8, 0x5E, 0xDA, 0xF4, 0xBE, 0xBF, 0xAF, 0x5E, 0xBF, 0xA2,
+  0x73, 0x58, 0x87, 0x29, 0xE6, 0xA5, 0xF0, 0x22, 0xCB, 0xBE, 0x8E, 0xD1, 0x25, 0x72, 0x8F, 0x12,
+  0xB3, 0xB7, 0xCF, 0xEE, 0x65, 0xEB, 0xEA, 0x5D, 0x70, 0x27, 0x9B, 0x1C, 0xDF, 0xAA, 0x5C, 0x70,
+  0x06, 0x47, 0xCF, 0x9E, 0x65, 0x6B, 0x7D, 0x57, 0xCB, 0x8A, 0x8E, 0x1A, 0xC5, 0x07, 0x65, 0x71,
+  0x93, 0x9D, 0xC4, 0xC9, 0x68, 0xB3, 0x44, 0xAE, 0x82, 0x69, 0xBC, 0x3F, 0x9C, 0x13, 0x94, 0x4A,
+  0xD7, 0x0F, 0x9A, 0x0D, 0xAD, 0xDE, 0x60, 0x72, 0x32, 0xD8, 0x0F, 0xA9, 0xF8, 0x4A, 0x34, 0x5C,
+  0x0B, 0x92, 0x76, 0x49, 0x7B, 0xF7, 0x6B, 0x50, 0xE4, 0x41, 0xF2, 0x5B, 0x50, 0x69, 0xC4, 0xE2,
+  0xCC, 0xFD, 0x3A, 0x70, 0x69, 0x6E, 0x75, 0x84, 0xA6, 0x40, 0x92, 0x0C, 0xB5, 0x2B, 0x6E, 0x37,
+  0x14, 0x99, 0x1D, 0xFE, 0xAC, 0x68, 0x3A, 0x74, 0x92, 0xC7, 0xBD, 0x68, 0x78, 0x33, 0x58, 0x79,
+  0xDB, 0x22, 0x9D, 0xF9, 0x9B, 0x00, 0x4C, 0xEB, 0x77, 0x20, 0x84, 0xD1, 0x2C, 0x42, 0x74, 0x0D,
+  0xEE, 0xA1, 0x7A, 0x51, 0x0B, 0xBD, 0x58, 0x27, 0x45, 0x98, 0xBC, 0x92, 0xF1, 0xDA, 0x20, 0x4F,
+  0x50, 0xA4, 0x79, 0x0C, 0x98, 0x53, 0x92, 0xD3, 0x00, 0x1B, 0x3B, 0xDA, 0x7D, 0x16, 0x51, 0x07,
+  0x1D, 0xF1, 0x7F, 0x20, 0xF7, 0xDA, 0x3B, 0xD1, 0xD7, 0x53, 0xF3, 0xA7, 0x16, 0xED, 0xEA, 0x0A,
+  0x15, 0x5D, 0x02, 0x63, 0x7F, 0x55, 0x2A, 0x4D, 0x66, 0x9C, 0x54, 0x07, 0x61, 0xE0, 0x20, 0xC3,
+  0x7D, 0x45, 0xFD, 0xC0, 0x56, 0x3E, 0xEC, 0xE2, 0xA1, 0x24, 0x8D, 0x0A, 0xBD, 0x77, 0x36, 0xB7,
+  0xA8, 0xE6, 0xF2, 0x16, 0x12, 0x94, 0x48, 0x85, 0xFE, 0xDC, 0x37, 0xD2, 0x3A, 0x34, 0x82, 0x30,
+  0x4B, 0x67, 0xDD, 0xC0, 0x99, 0x8C, 0xC3, 0xA8, 0x35, 0x9C, 0x28, 0x5F, 0x9C, 0x5F, 0x9C, 0xBF,
+  0x3B, 0x4F, 0xBA, 0xBC, 0x24, 0x4F, 0x6F, 0xE9, 0x6A, 0x52, 0xED, 0xCE, 0xDC, 0x6B, 0x72, 0x05,
+  0x3C, 0xDE, 0x39, 0x21, 0xEC, 0xC6, 0xE0, 0x91, 0xFC, 0x7B, 0x50, 0xF6, 0x21, 0x8C, 0xF2, 0xC7,
+  0x9D, 0xE6, 0x00, 0xF4, 0x3B, 0x20, 0x62, 0x5D, 0x73, 0x34, 0xD8, 0x85, 0x61, 0x99, 0x43, 0xB1,
+  0xD7, 0xBB, 0xA0, 0xFF, 0x60, 0xE2, 0x3B, 0x51, 0xA3, 0x4E, 0x2D, 0x3B, 0xD4, 0xE6, 0x1F, 0x9D,
+  0xD1, 0x69, 0xD6, 0xAD, 0x0D, 0xEB, 0x36, 0xE9, 0xAE, 0xBD, 0xD7, 0x95, 0x8D, 0xFF, 0xD0, 0xAC,
+  0xE3, 0xBD, 0xDB, 0x7C, 0x6B, 0xD4, 0xB9, 0x13, 0xCD, 0x52, 0xA1, 0x3B, 0xD9, 0xAA, 0x05, 0xA1,
+  0x12, 0xAC, 0xCB, 0xE2, 0xC9, 0x1E, 0x45, 0xEF, 0x25, 0x5D, 0x4E, 0x4B, 0x07, 0x48, 0x63, 0x8C,
+  0x1F, 0x71, 0xD0, 0x4D, 0xF1, 0xF0, 0xEE, 0x72, 0xCD, 0x7C, 0xC1, 0x25, 0x8F, 0xFB, 0xE1, 0x85,
+  0x29, 0x84, 0xC2, 0xAE, 0xA0, 0xD3, 0xB7, 0xC2, 0xE1, 0x64, 0x32, 0x21, 0xB8, 0x7F, 0x01, 0x85,
+  0x3E, 0xAC, 0x7B, 0x55, 0x0E, 0x00, 0x00,
+};
+
+// web/index.html, 1576 bytes, 675 gzipped
+const uint8_t Web_index_html[675] PROGMEM = {
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8D, 0x55, 0x4D, 0x73, 0xD3, 0x30,
+  0x10, 0xBD, 0xF7, 0x57, 0x08, 0xCD, 0x70, 0xC3, 0x71, 0x1A, 0x5A, 0xA6, 0x07, 0xDB, 0x33, 0xA5,
+  0x30, 0xD3, 0x03, 0x5F, 0x53, 0xCA, 0x81, 0x13, 0xA3, 0x48, 0x1B, 0x5B, 0x54, 0x96, 0x8C, 0xB4,
+  0x4E, 0x9A, 0x7F, 0xCF, 0x4A, 0xB6, 0x43, 0x12, 0x0A, 0xE9, 0xC5, 0x8A, 0x9E, 0x76, 0xDF, 0xEE,
+  0xD3, 0xAE, 0x36, 0xC5, 0x8B, 0x77, 0x9F, 0x6F, 0xEE, 0xBF, 0x7F, 0x79, 0xCF, 0x1A, 0x6C, 0x4D,
+  0x75, 0x56, 0xC4, 0x85, 0x19, 0x61, 0xEB, 0x92, 0x83, 0xE5, 0x11, 0x00, 0xA1, 0x68, 0x69, 0x01,
+  0x05, 0x93, 0x8D, 0xF0, 0x01, 0xB0, 0xE4, 0x3D, 0xAE, 0xB2, 0x2B, 0x3E, 0xC1, 0x56, 0xB4, 0x50,
+  0xF2, 0xB5, 0x86, 0x4D, 0xE7, 0x3C, 0x72, 0x26, 0x9D, 0x45, 0xB0, 0x64, 0xB6, 0xD1, 0x0A, 0x9B,
+  0x52, 0xC1, 0x5A, 0x4B, 0xC8, 0xD2, 0xE6, 0x15, 0xD3, 0x56, 0xA3, 0x16, 0x26, 0x0B, 0x52, 0x18,
+  0x28, 0xCF, 0x23, 0x09, 0x6A, 0x34, 0x50, 0xDD, 0x37, 0xE0, 0x5B, 0x17, 0x50, 0x60, 0x91, 0x0F,
+  0xC8, 0x59, 0x61, 0xB4, 0x7D, 0x60, 0x1E, 0x4C, 0xC9, 0x03, 0x6E, 0x0D, 0x84, 0x06, 0x80, 0xF8,
+  0x1B, 0x0F, 0xAB, 0x92, 0xE7, 0x09, 0x9A, 0xC9, 0x10, 0x22, 0x47, 0x3E, 0xE6, 0xB9, 0x74, 0x6A,
+  0x3B, 0x66, 0x0D, 0xBE, 0x3A, 0x63, 0xAC, 0x08, 0x9D, 0xB0, 0x4C, 0xAB, 0x92, 0x4B, 0xE3, 0xE4,
+  0x03, 0xAF, 0x8A, 0x3C, 0x22, 0x87, 0x47, 0x31, 0x0E, 0xE5, 0x6D, 0x44, 0x08, 0x25, 0x57, 0x6E,
+  0x43, 0xCA, 0xDD, 0x6A, 0x45, 0x28, 0x4C, 0xD6, 0x43, 0x80, 0x48, 0x59, 0xB4, 0x42, 0x8F, 0xEE,
+  0x20, 0x51, 0xBB, 0x81, 0xC1, 0xBA, 0x0D, 0x8F, 0x20, 0xC1, 0x4A, 0xAF, 0x27, 0xAA, 0xA5, 0xAE,
+  0x29, 0xE0, 0x2E, 0x0C, 0x42, 0xDB, 0xF1, 0x2A, 0xCB, 0x66, 0xD9, 0x48, 0xCB, 0x64, 0x91, 0x93,
+  0xF9, 0x49, 0xC7, 0xA6, 0x6F, 0x55, 0x74, 0x9C, 0xDC, 0x5E, 0x1E, 0xB9, 0x55, 0xF7, 0xC2, 0xD7,
+  0x80, 0x7B, 0x8A, 0x6A, 0x27, 0xCC, 0x61, 0xA8, 0x3D, 0x36, 0x67, 0xD4, 0xEE, 0x1E, 0x8E, 0x13,
+  0x88, 0x06, 0xF0, 0xAB, 0xD7, 0x5D, 0x4B, 0x25, 0xE4, 0x7F, 0x8E, 0xC9, 0x7C, 0x90, 0xFB, 0x97,
+  0x74, 0xEA, 0x08, 0xD4, 0xB6, 0x0E, 0x93, 0xFE, 0x66, 0x51, 0x7D, 0x1D, 0x21, 0xBA, 0xB5, 0xC5,
+  0x88, 0x1A, 0xB1, 0x04, 0x53, 0x7D, 0x74, 0x0A, 0xD2, 0x3E, 0x71, 0x18, 0x62, 0x49, 0x14, 0x2D,
+  0xC1, 0xA3, 0x7B, 0x3A, 0x72, 0x5D, 0x62, 0x5F, 0x0B, 0xD3, 0x53, 0x67, 0x51, 0x29, 0x78, 0xF5,
+  0x79, 0xB5, 0x2A, 0xF2, 0x01, 0xFF, 0xA7, 0x21, 0x95, 0x88, 0x52, 0xBE, 0x85, 0xD8, 0x42, 0x27,
+  0x4C, 0xA5, 0x73, 0x74, 0x3F, 0x37, 0xF4, 0x3D, 0x69, 0x2A, 0x7A, 0x74, 0xBC, 0xBA, 0xA6, 0xEF,
+  0xB1, 0x69, 0xBC, 0x93, 0xA8, 0x61, 0x94, 0x98, 0x0F, 0x1A, 0xF7, 0xF5, 0xDE, 0xF6, 0xAD, 0x56,
+  0x1A, 0xB7, 0xAC, 0xD0, 0xB6, 0xEB, 0x71, 0x2A, 0x66, 0xC2, 0x38, 0xC3, 0x6D, 0x47, 0xFC, 0xB6,
+  0x6F, 0x97, 0xE0, 0x39, 0x6B, 0xB5, 0x2D, 0xF9, 0x9C, 0x56, 0xF1, 0x58, 0xF2, 0x37, 0xF4, 0x23,
+  0x20, 0x74, 0x25, 0x3F, 0x8F, 0x45, 0x78, 0x82, 0x99, 0x8A, 0x78, 0xC0, 0x4A, 0xFB, 0x1F, 0xA9,
+  0xC1, 0x9E, 0xA2, 0xBD, 0x1C, 0x69, 0x5F, 0x5F, 0x4E, 0xB4, 0xF3, 0xD9, 0xE5, 0x31, 0xF1, 0x7E,
+  0xFF, 0xF5, 0x88, 0xCE, 0x86, 0x5D, 0x4D, 0x8A, 0x01, 0x60, 0x4A, 0xA0, 0xC8, 0x62, 0x28, 0xCA,
+  0x6B, 0x31, 0xE7, 0xD5, 0x82, 0x35, 0xAE, 0xF7, 0x54, 0xE7, 0xE1, 0xFC, 0x3F, 0xE6, 0x16, 0x1E,
+  0xA9, 0x36, 0x9F, 0xE8, 0xCB, 0x82, 0x71, 0xF8, 0x0C, 0x0F, 0x47, 0xAF, 0xF0, 0x9B, 0x45, 0x6D,
+  0x98, 0x14, 0x56, 0x82, 0x31, 0xA0, 0x9E, 0xE3, 0x15, 0x9B, 0xE5, 0x0E, 0x42, 0xDF, 0x02, 0x0B,
+  0xB2, 0x01, 0xD5, 0x1B, 0x38, 0x74, 0x7B, 0x46, 0x4B, 0x37, 0x3A, 0xA0, 0xF3, 0xDB, 0xBD, 0x8E,
+  0xFE, 0x20, 0x02, 0xB2, 0xC5, 0xC5, 0x24, 0x77, 0xD7, 0xD6, 0x61, 0x5D, 0x0F, 0xEF, 0xCD, 0x8B,
+  0xAE, 0xE1, 0x2C, 0x0E, 0xC1, 0xB7, 0x8E, 0x2E, 0x7A, 0xCE, 0xE6, 0xEC, 0xE2, 0x6A, 0xCE, 0xCE,
+  0x63, 0x21, 0x3B, 0x0F, 0x01, 0xFC, 0x1A, 0xAE, 0x43, 0x47, 0x41, 0xEE, 0x04, 0xC5, 0x89, 0x13,
+  0xC3, 0x42, 0x7A, 0x85, 0xEB, 0xFA, 0xC4, 0xFB, 0x1A, 0x55, 0xEC, 0xBF, 0xAF, 0x9D, 0xB0, 0x5D,
+  0x22, 0x28, 0x96, 0x06, 0x92, 0xFD, 0x06, 0x20, 0x8D, 0xB9, 0x84, 0x1C, 0x51, 0x17, 0xF9, 0x30,
+  0xBD, 0x8A, 0x20, 0xBD, 0xEE, 0xA8, 0x14, 0x5E, 0xD2, 0x24, 0x15, 0x5D, 0x37, 0xFB, 0x19, 0x52,
+  0x32, 0x09, 0x8E, 0x76, 0xE3, 0x20, 0xCD, 0x87, 0xFF, 0x85, 0xDF, 0xDF, 0x04, 0x77, 0x14, 0x28,
+  0x06, 0x00, 0x00,
+};
+
+// web/style.css, 971 bytes, 479 gzipped
+const uint8_t Web_style_css[479] PROGMEM = {
+  0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6D, 0x52, 0xED, 0x6E, 0xE3, 0x20,
+  0x10, 0xFC, 0x9F, 0xA7, 0x40, 0x3A, 0x9D, 0xD4, 0x4A, 0x71, 0xE5, 0x2F, 0x55, 0x91, 0xFD, 0x34,
+  0x6B, 0xB3, 0xD8, 0x5C, 0x30, 0x20, 0xC0, 0x17, 0xA7, 0x55, 0xDE, 0xFD, 0x16, 0xDC, 0xA4, 0x76,
+  0x7A, 0x8A, 0x12, 0x85, 0x65, 0x76, 0x67, 0x76, 0x98, 0xCE, 0xF0, 0x2B, 0xFB, 0x64, 0x13, 0xB8,
+  0x41, 0xEA, 0x86, 0xE5, 0x2D, 0x13, 0x46, 0x87, 0x4C, 0xC0, 0x24, 0xD5, 0xB5, 0x61, 0x1E, 0xB4,
+  0xCF, 0x3C, 0x3A, 0x29, 0x5A, 0xD6, 0x41, 0x7F, 0x1E, 0x9C, 0x99, 0x35, 0x6F, 0xD8, 0xAF, 0x3C,
+  0x27, 0x68, 0x6F, 0x94, 0x71, 0x74, 0x10, 0x82, 0xAE, 0x6F, 0x87, 0x11, 0x81, 0xA3, 0xA3, 0x69,
+  0x5C, 0x7A, 0xAB, 0x80, 0xDA, 0x85, 0xC2, 0xA5, 0x65, 0x7F, 0x66, 0x1F, 0xA4, 0xB8, 0x66, 0x3D,
+  0x4D, 0x46, 0x1D, 0x68, 0xAA, 0x85, 0x1E, 0xB3, 0x0E, 0xC3, 0x05, 0x51, 0xB7, 0xCC, 0x02, 0xE7,
+  0x52, 0x0F, 0x0D, 0x3B, 0xD9, 0x85, 0x15, 0xA5, 0x5D, 0x9E, 0xB8, 0xCA, 0xB2, 0x8C, 0xE3, 0x27,
+  0x90, 0x7A, 0x3B, 0x7C, 0x70, 0x92, 0xB7, 0xE9, 0x37, 0x0B, 0x38, 0x51, 0x2D, 0x20, 0x51, 0xA8,
+  0x79, 0xD2, 0xBE, 0x61, 0x0E, 0x2D, 0x42, 0x78, 0x81, 0x39, 0x98, 0x4C, 0xC8, 0x70, 0x64, 0x93,
+  0xD4, 0x13, 0x2C, 0x2F, 0x55, 0x9E, 0xDB, 0xE5, 0xC8, 0x0A, 0xE1, 0x5E, 0x5F, 0xA9, 0x19, 0x6C,
+  0xF3, 0xC5, 0xF8, 0x10, 0xB1, 0x1E, 0x6F, 0x07, 0x8F, 0x7D, 0x90, 0x26, 0x32, 0xEE, 0xC4, 0x14,
+  0x45, 0x41, 0xF2, 0x8C, 0xA3, 0x4D, 0x33, 0x07, 0x5C, 0xCE, 0x44, 0xF6, 0xFE, 0xDF, 0x01, 0x63,
+  0xB9, 0x35, 0x96, 0x3E, 0xA7, 0x58, 0x4F, 0xF6, 0x7A, 0xF9, 0x81, 0x04, 0xC4, 0xE9, 0xDB, 0x43,
+  0x00, 0x88, 0x4D, 0x6F, 0x9D, 0x1C, 0xA8, 0x6D, 0x83, 0xAA, 0x22, 0x8A, 0x2E, 0xB8, 0xB9, 0x44,
+  0x31, 0x0F, 0xCF, 0xEB, 0x3A, 0x95, 0x67, 0xBB, 0x29, 0xD6, 0x22, 0x15, 0x15, 0x74, 0xA8, 0xB6,
+  0x56, 0x75, 0xCA, 0xF4, 0xE7, 0xF6, 0x21, 0x86, 0xF4, 0xC6, 0x97, 0xBE, 0x1D, 0xA4, 0xB6, 0x33,
+  0x79, 0xE3, 0x51, 0xD1, 0xB2, 0x47, 0xD6, 0xCD, 0x21, 0xA4, 0x8D, 0x9F, 0x45, 0xFE, 0x7C, 0x8E,
+  0xDD, 0xD3, 0xAF, 0x76, 0x10, 0x96, 0xE6, 0x7A, 0xA3, 0x24, 0x27, 0x25, 0x51, 0xDE, 0x93, 0x4D,
+  0xF5, 0xCE, 0x26, 0x3A, 0xAD, 0x8E, 0xC4, 0xA5, 0x13, 0xB1, 0xFF, 0x16, 0x70, 0x57, 0x1A, 0x41,
+  0xF1, 0x9B, 0xAF, 0x7A, 0xFD, 0xDF, 0x68, 0xCE, 0x45, 0xF2, 0x30, 0x12, 0x5B, 0x9E, 0xFF, 0x6E,
+  0xD9, 0x88, 0x72, 0x18, 0x29, 0x53, 0xC5, 0x7B, 0xFE, 0x23, 0x38, 0x29, 0xA4, 0x34, 0x3E, 0xC6,
+  0x83, 0xFA, 0x7C, 0x70, 0xE6, 0x8C, 0x77, 0xD1, 0x42, 0x2A, 0xD5, 0x30, 0x6D, 0x34, 0x26, 0x0C,
+  0x85, 0x37, 0xEC, 0x30, 0xA7, 0x7A, 0x8F, 0x59, 0x6F, 0x32, 0x0E, 0x7E, 0x04, 0xE7, 0xA2, 0xAB,
+  0x35, 0xAB, 0x52, 0xEB, 0x6A, 0x59, 0x82, 0xAE, 0x6D, 0x86, 0xF2, 0x2D, 0x03, 0x21, 0xDE, 0x12,
+  0x20, 0x40, 0xA7, 0x30, 0xE6, 0x68, 0xB5, 0x83, 0xAC, 0x53, 0x60, 0x3D, 0x91, 0xDC, 0xFF, 0xB5,
+  0xFB, 0x95, 0xA8, 0x83, 0x13, 0xFC, 0xE1, 0x14, 0xE5, 0x69, 0x8D, 0xD8, 0xD7, 0x80, 0x60, 0xEC,
+  0xCE, 0xEB, 0xAA, 0x4A, 0x34, 0xFF, 0x00, 0x7C, 0xA2, 0xD6, 0x15, 0xCB, 0x03, 0x00, 0x00,
+};
+
+#define WEB_ASSETS 3
+
+const WebAsset web_assets[WEB_ASSETS] = {
+  {"/app.js", "application/javascript", "\"dac659b0a0aef0ce\"", Web_app_js, 1527},
+  {"/", "text/html", "\"8f852786e1261625\"", Web_index_html, 675},
+  {"/style.css", "text/css", "\"0cced64eebcd1c42\"", Web_style_css, 479},
+};
+
+#endif
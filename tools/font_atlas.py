@@ -0,0 +1,322 @@
+#!/usr/bin/env python3
+"""
+Generates Font_Atlas.h, the anti-aliased font atlas used by Font.h
+
+Glyphs are rasterized from TrueType outlines with 4x4 supersampling and stored
+as 4-bit alpha, two pixels per byte (high nibble first), each row padded to a
+whole byte. Only the standard library is needed so the atlas can be rebuilt on
+any machine:
+
+    python3 tools/font_atlas.py /usr/share/fonts/truetype/dejavu > Font_Atlas.h
+"""
+import os
+import struct
+import sys
+
+FIRST = 0x20
+LAST = 0x7E
+SUPERSAMPLE = 4
+
+# name, ttf file, pixels per em, the font it replaces in Draw.h
+FONTS = [
+    ("Atlas_Main", "DejaVuSans.ttf", 46, "FF26 at text size 2"),
+    ("Atlas_Header", "DejaVuSans.ttf", 23, "FF26 at text size 1"),
+    ("Atlas_Table", "DejaVuSansMono.ttf", 29, "FM9 at text size 2"),
+    ("Atlas_Second", "DejaVuSansMono.ttf", 19, "FMO12 at text size 1"),
+]
+
+
+class TrueType:
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        num_tables = struct.unpack(">H", self.data[4:6])[0]
+        self.tables = {}
+        for i in range(num_tables):
+            tag, _, offset, length = struct.unpack(">4sIII", self.data[12 + i * 16:28 + i * 16])
+            self.tables[tag.decode("latin-1")] = (offset, length)
+        head = self.tables["head"][0]
+        self.units_per_em = self.u16(head + 18)
+        self.loc_format = self.i16(head + 50)
+        hhea = self.tables["hhea"][0]
+        self.ascender = self.i16(hhea + 4)
+        self.descender = self.i16(hhea + 6)
+        self.line_gap = self.i16(hhea + 8)
+        self.num_hmetrics = self.u16(hhea + 34)
+        self.cmap = self.read_cmap()
+
+    def u16(self, o):
+        return struct.unpack(">H", self.data[o:o + 2])[0]
+
+    def i16(self, o):
+        return struct.unpack(">h", self.data[o:o + 2])[0]
+
+    def u32(self, o):
+        return struct.unpack(">I", self.data[o:o + 4])[0]
+
+    def read_cmap(self):
+        base = self.tables["cmap"][0]
+        for i in range(self.u16(base + 2)):
+            platform, encoding, offset = struct.unpack(">HHI", self.data[base + 4 + i * 8:base + 12 + i * 8])
+            if platform == 3 and encoding == 1:
+                return self.read_format4(base + offset)
+        raise ValueError("no unicode BMP cmap")
+
+    def read_format4(self, o):
+        segs = self.u16(o + 6) // 2
+        ends = o + 14
+        starts = ends + segs * 2 + 2
+        deltas = starts + segs * 2
+        ranges = deltas + segs * 2
+        cmap = {}
+        for s in range(segs):
+            end, start = self.u16(ends + s * 2), self.u16(starts + s * 2)
+            delta, rng = self.i16(deltas + s * 2), self.u16(ranges + s * 2)
+            for c in range(start, min(end, LAST) + 1):
+                if rng == 0:
+                    cmap[c] = (c + delta) & 0xFFFF
+                else:
+                    g = self.u16(ranges + s * 2 + rng + (c - start) * 2)
+                    cmap[c] = (g + delta) & 0xFFFF if g else 0
+        return cmap
+
+    def advance(self, glyph):
+        hmtx = self.tables["hmtx"][0]
+        return self.u16(hmtx + min(glyph, self.num_hmetrics - 1) * 4)
+
+    def glyph_offset(self, glyph):
+        loca = self.tables["loca"][0]
+        if self.loc_format == 0:
+            start, end = self.u16(loca + glyph * 2) * 2, self.u16(loca + glyph * 2 + 2) * 2
+        else:
+            start, end = self.u32(loca + glyph * 4), self.u32(loca + glyph * 4 + 4)
+        return (None if start == end else self.tables["glyf"][0] + start)
+
+    def contours(self, glyph, dx=0, dy=0):
+        """Returns the outline as a list of contours of (x, y, on_curve) points in font units"""
+        o = self.glyph_offset(glyph)
+        if o is None:
+            return []
+        count = self.i16(o)
+        if count < 0:
+            return self.composite(o + 10, dx, dy)
+        end_pts = [self.u16(o + 10 + i * 2) for i in range(count)]
+        n = end_pts[-1] + 1
+        p = o + 10 + count * 2
+        p += 2 + self.u16(p)
+        flags = []
+        while len(flags) < n:
+            f = self.data[p]
+            p += 1
+            flags.append(f)
+            if f & 8:
+                flags.extend([f] * self.data[p])
+                p += 1
+        xs, ys = [], []
+        for coords, short, same in ((xs, 2, 16), (ys, 4, 32)):
+            v = 0
+            for f in flags[:n]:
+                if f & short:
+                    d = self.data[p]
+                    p += 1
+                    v += d if f & same else -d
+                elif not f & same:
+                    v += self.i16(p)
+                    p += 2
+                coords.append(v)
+        result, start = [], 0
+        for end in end_pts:
+            result.append([(xs[i] + dx, ys[i] + dy, flags[i] & 1) for i in range(start, end + 1)])
+            start = end + 1
+        return result
+
+    def composite(self, p, dx, dy):
+        result = []
+        while True:
+            flags, glyph = self.u16(p), self.u16(p + 2)
+            p += 4
+            if flags & 1:
+                ox, oy = self.i16(p), self.i16(p + 2)
+                p += 4
+            else:
+                ox, oy = struct.unpack(">bb", self.data[p:p + 2])
+                p += 2
+            if flags & 8:
+                p += 2
+            elif flags & 0x40:
+                p += 4
+            elif flags & 0x80:
+                p += 8
+            result += self.contours(glyph, dx + ox, dy + oy)
+            if not flags & 0x20:
+                return result
+
+
+def flatten(contour, scale):
+    """Turns a quadratic contour into line segments in pixel space, y pointing down"""
+    pts = [(x * scale, -y * scale, on) for x, y, on in contour]
+    # Insert the implied on-curve points between consecutive off-curve points
+    full = []
+    for i, p in enumerate(pts):
+        q = pts[(i + 1) % len(pts)]
+        full.append(p)
+        if not p[2] and not q[2]:
+            full.append(((p[0] + q[0]) / 2, (p[1] + q[1]) / 2, 1))
+    start = next(i for i, p in enumerate(full) if p[2])
+    full = full[start:] + full[:start]
+    lines, prev, i = [], full[0], 1
+    while i <= len(full):
+        p = full[i % len(full)]
+        if p[2]:
+            lines.append((prev[0], prev[1], p[0], p[1]))
+            prev, i = p, i + 1
+            continue
+        end = full[(i + 1) % len(full)]
+        last = prev
+        for step in range(1, 9):
+            t = step / 8
+            x = (1 - t) ** 2 * prev[0] + 2 * (1 - t) * t * p[0] + t * t * end[0]
+            y = (1 - t) ** 2 * prev[1] + 2 * (1 - t) * t * p[1] + t * t * end[1]
+            lines.append((last[0], last[1], x, y))
+            last = (x, y)
+        prev, i = end, i + 2
+    return lines
+
+
+def rasterize(lines, x0, y0, w, h):
+    """Non-zero winding coverage of each pixel, returned as 0-15 alpha rows"""
+    ss = SUPERSAMPLE
+    cover = [[0] * (w * ss) for _ in range(h * ss)]
+    for row in range(h * ss):
+        sy = y0 + (row + 0.5) / ss
+        crossings = []
+        for ax, ay, bx, by in lines:
+            if ay == by or not (min(ay, by) <= sy < max(ay, by)):
+                continue
+            x = ax + (sy - ay) * (bx - ax) / (by - ay)
+            crossings.append((x, 1 if by > ay else -1))
+        crossings.sort()
+        winding = 0
+        for i, (x, d) in enumerate(crossings):
+            winding += d
+            if winding and i + 1 < len(crossings):
+                left = max(0, int(round((x - x0) * ss)))
+                right = min(w * ss, int(round((crossings[i + 1][0] - x0) * ss)))
+                for sx in range(left, right):
+                    cover[row][sx] = 1
+    alpha = []
+    for y in range(h):
+        out = []
+        for x in range(w):
+            total = sum(cover[y * ss + j][x * ss + i] for j in range(ss) for i in range(ss))
+            out.append((total * 15 + (ss * ss) // 2) // (ss * ss))
+        alpha.append(out)
+    return alpha
+
+
+def build(name, path, px, replaces):
+    font = TrueType(path)
+    scale = px / font.units_per_em
+    bitmap, glyphs = [], []
+    for c in range(FIRST, LAST + 1):
+        glyph = font.cmap.get(c, 0)
+        advance = int(round(font.advance(glyph) * scale))
+        lines = []
+        for contour in font.contours(glyph):
+            lines += flatten(contour, scale)
+        if not lines:
+            glyphs.append((len(bitmap), 0, 0, 0, 0, advance, chr(c)))
+            continue
+        left = int(min(min(l[0], l[2]) for l in lines)) - 1
+        top = int(min(min(l[1], l[3]) for l in lines)) - 1
+        right = int(max(max(l[0], l[2]) for l in lines)) + 2
+        bottom = int(max(max(l[1], l[3]) for l in lines)) + 2
+        alpha = rasterize(lines, left, top, right - left, bottom - top)
+        # Trim empty rows/columns left over from the padding
+        while alpha and not any(alpha[0]):
+            alpha.pop(0)
+            top += 1
+        while alpha and not any(alpha[-1]):
+            alpha.pop()
+        while alpha and not any(r[0] for r in alpha):
+            alpha = [r[1:] for r in alpha]
+            left += 1
+        while alpha and not any(r[-1] for r in alpha):
+            alpha = [r[:-1] for r in alpha]
+        w, h = (len(alpha[0]), len(alpha)) if alpha else (0, 0)
+        glyphs.append((len(bitmap), w, h, left, top, advance, chr(c)))
+        for r in alpha:
+            r = r + [0] * (len(r) % 2)
+            bitmap += [(r[i] << 4) | r[i + 1] for i in range(0, len(r), 2)]
+    ascent = -min(g[4] for g in glyphs if g[6].isdigit())
+    descent = max(g[4] + g[2] for g in glyphs if g[1])
+    y_advance = int(round((font.ascender - font.descender + font.line_gap) * scale))
+    assert len(bitmap) < 0x10000
+
+    out = []
+    out.append("// %s, %dpx em from %s, replaces %s" % (name, px, os.path.basename(path), replaces))
+    out.append("const uint8_t %s_Bitmap[%d] PROGMEM = {" % (name, len(bitmap)))
+    for i in range(0, len(bitmap), 16):
+        out.append("  " + ", ".join("0x%02X" % b for b in bitmap[i:i + 16]) + ",")
+    out.append("};")
+    out.append("")
+    out.append("const AtlasGlyph %s_Glyphs[%d] PROGMEM = {" % (name, len(glyphs)))
+    for offset, w, h, x, y, adv, ch in glyphs:
+        out.append("  { %5d, %2d, %2d, %3d, %3d, %2d },  // '%s'" % (offset, w, h, x, y, adv, "\\\\" if ch == "\\" else ch))
+    out.append("};")
+    out.append("")
+    out.append("const AtlasFont %s PROGMEM = {%s_Bitmap, %s_Glyphs, 0x%02X, 0x%02X, %d, %d, %d};" % (
+        name, name, name, FIRST, LAST, y_advance, ascent, descent))
+    return "\n".join(out), len(bitmap) + len(glyphs) * 8
+
+
+def main():
+    font_dir = sys.argv[1] if len(sys.argv) > 1 else "/usr/share/fonts/truetype/dejavu"
+    bodies, total = [], 0
+    for name, ttf, px, replaces in FONTS:
+        body, size = build(name, os.path.join(font_dir, ttf), px, replaces)
+        bodies.append(body)
+        total += size
+    print("// Generated by   : tools/font_atlas.py")
+    print("// Generated from : DejaVuSans.ttf, DejaVuSansMono.ttf (Bitstream Vera license)")
+    print("// Glyph format   : 4-bit alpha, 2 pixels per byte, high nibble first, rows byte aligned")
+    print("// Memory usage   : %d bytes" % total)
+    print("")
+    print("#ifndef FONT_ATLAS_H")
+    print("#define FONT_ATLAS_H")
+    print("")
+    print("#if defined(__AVR__)")
+    print("    #include <avr/pgmspace.h>")
+    print("#elif defined(__PIC32MX__)")
+    print("    #define PROGMEM")
+    print("#elif defined(__arm__)")
+    print("    #define PROGMEM")
+    print("#endif")
+    print("")
+    print("// Same layout as the Adafruit GFXglyph, offsets are relative to the baseline/cursor")
+    print("typedef struct {")
+    print("  uint16_t offset;  // Start of the glyph in the bitmap array")
+    print("  uint8_t width;")
+    print("  uint8_t height;")
+    print("  int8_t x_offset;")
+    print("  int8_t y_offset;  // Negative is above the baseline")
+    print("  uint8_t advance;")
+    print("} AtlasGlyph;")
+    print("")
+    print("typedef struct {")
+    print("  const uint8_t *bitmap;")
+    print("  const AtlasGlyph *glyphs;")
+    print("  uint8_t first;")
+    print("  uint8_t last;")
+    print("  uint8_t y_advance;")
+    print("  uint8_t ascent;   // Height of the digits above the baseline")
+    print("  uint8_t descent;  // Deepest glyph below the baseline")
+    print("} AtlasFont;")
+    print("")
+    print("\n\n".join(bodies))
+    print("")
+    print("#endif")
+
+
+if __name__ == "__main__":
+    main()
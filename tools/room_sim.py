@@ -0,0 +1,412 @@
+#!/usr/bin/env python3
+"""
+Simulates a room module against a stand-in for the thermostat, on the host
+
+The module side runs the same wake, batch, send and back off logic as
+Room_Module/Room_Module.ino on a simulated clock, and the base side takes
+reports the way Room_Link.h does. They talk over real UDP on localhost through
+a link that drops and duplicates packets, and the packets are packed and
+checked from the structs in Room_Module/Wire_Format.h, read from the header
+so it stays the only definition of the format. The constants come from the
+sketch, the header and Room_Link.h the same way.
+
+At the end it checks every reading the module took was taken by the base at
+most once, and none went missing other than ones pushed out of a full batch,
+then prints the battery estimate the sketch would print, from the UA_ figures.
+Only the standard library is needed:
+
+    python3 tools/room_sim.py --days 7 --loss 0.1 --dup 0.05 --outage 48:6
+
+It exits with 1 if a reading was taken twice or lost.
+"""
+import argparse
+import math
+import os
+import random
+import re
+import socket
+import struct
+import zlib
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+
+# Time spent awake outside the sketch's control, rough figures for an ESP32 at 80MHz
+BOOT_MS = 120        # Wake stub, boot and reading the DHT22
+JOIN_MS = 350        # Joining on the channel and AP of the last join
+SCAN_MS = 2500       # Joining with a scan
+RTT_MS = 8           # Report out, ack back
+
+TYPES = {"uint8_t": "B", "int8_t": "b", "uint16_t": "H", "int16_t": "h", "uint32_t": "I", "int32_t": "i", "char": "s"}
+
+
+def read(path):
+    with open(os.path.join(ROOT, path)) as f:
+        return f.read()
+
+
+def defines(src):
+    """Every #define with a whole number value"""
+    out = {}
+    for name, value in re.findall(r"^#define\s+(\w+)\s+(-?(?:0x[0-9A-Fa-f]+|\d+))\b", src, re.M):
+        out[name] = int(value, 0)
+    return out
+
+
+class Layout:
+    """A packed struct from Wire_Format.h, packed and unpacked as a dict"""
+
+    def __init__(self, name, src, consts, structs):
+        body = re.search(r"struct __attribute__\(\(packed\)\) %s \{(.*?)\};" % name, src, re.S).group(1)
+        self.fields = []
+        fmt = "<"
+        for type_, field, count in re.findall(r"^\s*(\w+)\s+(\w+)(?:\[(\w+)\])?;", body, re.M):
+            n = int(consts.get(count, count or 1)) if count else 1
+            if type_ in structs:
+                sub = structs[type_]
+                self.fields.append((field, sub, n))
+                fmt += sub.fmt[1:] * n
+            elif type_ == "char":
+                self.fields.append((field, None, 1))
+                fmt += "%ds" % n
+            else:
+                self.fields.append((field, None, n))
+                fmt += TYPES[type_] * n
+        self.fmt = fmt
+        self.size = struct.calcsize(fmt)
+        self.crc_at = struct.calcsize(fmt[:-1]) if self.fields[-1][0] == "crc" else None
+
+    def flatten(self, msg):
+        values = []
+        for field, sub, n in self.fields:
+            v = msg[field]
+            if sub:
+                for item in v:
+                    values += sub.flatten(item)
+            elif n > 1:
+                values += list(v)
+            else:
+                values.append(v)
+        return values
+
+    def build(self, values):
+        msg = {}
+        for field, sub, n in self.fields:
+            if sub:
+                count = len(sub.fields)
+                msg[field] = [sub.build(values[k * count:(k + 1) * count]) for k in range(n)]
+                values = values[n * count:]
+            elif n > 1:
+                msg[field] = list(values[:n])
+                values = values[n:]
+            else:
+                msg[field] = values[0]
+                values = values[1:]
+        return msg
+
+    def pack(self, msg):
+        return struct.pack(self.fmt, *self.flatten(msg))
+
+    def unpack(self, data):
+        return self.build(list(struct.unpack(self.fmt, data)))
+
+
+class Wire:
+    """Wire_Format.h, wireSeal() and wireOpen()"""
+
+    def __init__(self):
+        src = read("Room_Module/Wire_Format.h")
+        self.consts = defines(src)
+        enum = re.search(r"enum WireType[^{]*\{(.*?)\}", src, re.S).group(1)
+        for name, value in re.findall(r"(\w+)\s*=\s*(\d+)", enum):
+            self.consts[name] = int(value)
+        structs = {}
+        for name in ("WireSample", "WireReport", "WireAck"):
+            structs[name] = Layout(name, src, self.consts, structs)
+        self.sample, self.report, self.ack = structs["WireSample"], structs["WireReport"], structs["WireAck"]
+
+    def seal(self, layout, msg, type_, seq):
+        msg.update(magic=self.consts["WIRE_MAGIC"], version=self.consts["WIRE_VERSION"], type=type_, seq=seq, crc=0)
+        msg["crc"] = zlib.crc32(layout.pack(msg)[:layout.crc_at])
+        return layout.pack(msg)
+
+    def open(self, layout, data, type_):
+        if len(data) != layout.size:
+            return None
+        msg = layout.unpack(data)
+        ok = msg["magic"] == self.consts["WIRE_MAGIC"] and msg["version"] == self.consts["WIRE_VERSION"] and \
+            msg["type"] == type_ and msg["crc"] == zlib.crc32(data[:layout.crc_at])
+        return msg if ok else None
+
+
+class Link:
+    """UDP on localhost that loses and repeats packets, and loses all of them in an outage"""
+
+    def __init__(self, rng, loss, dup, outage):
+        self.rng = rng
+        self.loss = loss
+        self.dup = dup
+        self.outage = outage
+        self.sent = self.dropped = self.duplicated = 0
+
+    def send(self, sock, data, addr, now_ms):
+        self.sent += 1
+        start, hours = self.outage
+        if hours and start * 3600000 <= now_ms < (start + hours) * 3600000 or self.rng.random() < self.loss:
+            self.dropped += 1
+            return
+        sock.sendto(data, addr)
+        if self.rng.random() < self.dup:
+            self.duplicated += 1
+            sock.sendto(data, addr)
+
+
+class Base:
+    """The thermostat's side, RoomLink::packet() and RoomLink::poll() with one room"""
+
+    def __init__(self, wire, link, same_ms):
+        self.wire = wire
+        self.link = link
+        self.same_ms = same_ms
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.sock.bind(("127.0.0.1", 0))
+        self.sock.setblocking(False)
+        self.addr = self.sock.getsockname()
+        self.heard = False
+        self.last_seq = 0
+        self.reading_at = 0
+        self.taken = []
+        self.received = self.duplicates = self.rejected = self.skipped = 0
+
+    def service(self, now_ms):
+        """Take whatever has arrived, as the network task and then the loop would"""
+        c = self.wire.consts
+        while True:
+            try:
+                data, addr = self.sock.recvfrom(2048)
+            except BlockingIOError:
+                return
+            r = self.wire.open(self.wire.report, data, c["WIRE_REPORT"])
+            if r is None or r["count"] == 0 or r["count"] > c["WIRE_BATCH"]:
+                self.rejected += 1
+                continue
+            self.link.send(self.sock, self.wire.seal(self.wire.ack, {}, c["WIRE_ACK"], r["seq"]), addr, now_ms)
+            if self.heard and self.last_seq == r["seq"]:
+                self.duplicates += 1
+                continue
+            self.heard = True
+            self.last_seq = r["seq"]
+            self.received += 1
+            for s in r["samples"][:r["count"]]:
+                if s["temp"] < -400 or s["temp"] > 800:
+                    continue
+                at = now_ms - min(s["ago"] * 1000, now_ms - 1)
+                if self.reading_at and at - self.reading_at <= self.same_ms:
+                    self.skipped += 1
+                    continue
+                self.reading_at = at
+                self.taken.append((at, s["temp"], s["humd"]))
+
+
+class Module:
+    """Room_Module.ino, one call of wake() is one pass through setup()"""
+
+    def __init__(self, wire, link, base, consts, rng, dht_fail, join_fail):
+        self.wire = wire
+        self.link = link
+        self.base = base
+        self.c = consts
+        self.rng = rng
+        self.dht_fail = dht_fail
+        self.join_fail = join_fail
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.sock.bind(("127.0.0.1", 0))
+        self.sock.settimeout(0.02)
+        self.now_ms = 0
+        self.awake_at = 0
+        # Saved in RTC memory
+        self.seq = rng.getrandbits(16)
+        self.held = []
+        self.reported = False
+        self.sent_temp = self.sent_humd = self.sent_at = 0
+        self.misses = 0
+        self.retry_at = 0
+        self.channel = 0
+        self.wakes = self.sends = self.acked = 0
+        self.asleep_ms = self.awake_ms = self.radio_ms = 0
+        # What the sensor read, to check against what the base took
+        self.truth = []
+        self.pushed_out = set()
+
+    def millis(self):
+        return self.now_ms - self.awake_at
+
+    def seconds(self):
+        return self.now_ms // 1000
+
+    def sensor(self):
+        hours = self.now_ms / 3600000.0
+        temp = 21 + 1.5 * math.sin(2 * math.pi * hours / 24) + self.rng.gauss(0, 0.05)
+        humd = 40 + 5 * math.sin(2 * math.pi * (hours + 6) / 24) + self.rng.gauss(0, 0.3)
+        return int(round(temp * 10)), int(round(humd))
+
+    def wake(self):
+        self.awake_at = self.now_ms
+        self.now_ms += BOOT_MS
+        self.wakes += 1
+        now = self.seconds()
+        if self.rng.random() >= self.dht_fail:
+            temp, humd = self.sensor()
+            self.hold(temp, humd, now)
+        if self.due(now):
+            self.report(now)
+        self.sleep_until_next()
+
+    def hold(self, temp, humd, now):
+        if len(self.held) == self.c["WIRE_BATCH"]:
+            self.pushed_out.add(self.held.pop(0)[2])
+        self.held.append((temp, humd, now))
+        self.truth.append((now, temp, humd))
+
+    def due(self, now):
+        if not self.held:
+            return False
+        if self.misses and now - self.retry_at < 0:
+            return False
+        temp, humd, _ = self.held[-1]
+        unknown = self.c["WIRE_UNKNOWN"]
+        humd_moved = humd != unknown and self.sent_humd != unknown and abs(humd - self.sent_humd) >= self.c["CHANGE_HUMD"]
+        return not self.reported or self.misses > 0 or abs(temp - self.sent_temp) >= self.c["CHANGE_TEMP"] or \
+            humd_moved or now - self.sent_at >= self.c["HEARTBEAT"]
+
+    def join(self):
+        if self.rng.random() < self.join_fail:
+            self.now_ms += self.c["WIFI_TIMEOUT"]
+            self.channel = 0
+            return False
+        self.now_ms += JOIN_MS if self.channel else SCAN_MS
+        self.channel = 1
+        return True
+
+    def deliver(self, data, seq):
+        # A fresh socket on each wake in the sketch, nothing left over from the last one
+        self.sock.setblocking(False)
+        try:
+            while self.sock.recv(2048):
+                pass
+        except BlockingIOError:
+            pass
+        self.sock.settimeout(0.02)
+        for i in range(self.c["SEND_TRIES"]):
+            sent = self.now_ms
+            self.link.send(self.sock, data, self.base.addr, self.now_ms)
+            self.base.service(self.now_ms + RTT_MS // 2)
+            wait = self.c["ACK_TIMEOUT"] << i
+            while True:
+                try:
+                    buf = self.sock.recv(2048)
+                except socket.timeout:
+                    break
+                ack = self.wire.open(self.wire.ack, buf, self.c["WIRE_ACK"])
+                if ack and ack["seq"] == seq:
+                    self.now_ms = sent + RTT_MS
+                    return True
+            self.now_ms = sent + wait
+        return False
+
+    def report(self, now):
+        started = self.millis()
+        samples = [{"temp": t, "humd": h, "ago": min(now - at, 0xFFFF)} for t, h, at in self.held]
+        samples += [{"temp": 0, "humd": 0, "ago": 0}] * (self.c["WIRE_BATCH"] - len(samples))
+        msg = {"room": b"sim", "battery": self.c["WIRE_UNKNOWN"], "count": len(self.held), "samples": samples}
+        seq = self.seq
+        data = self.wire.seal(self.wire.report, msg, self.c["WIRE_REPORT"], seq)
+        self.seq = (self.seq + 1) & 0xFFFF
+
+        acked = self.join() and self.deliver(data, seq)
+        self.radio_ms += self.millis() - started
+        self.sends += 1
+
+        if not acked:
+            self.misses = min(self.misses + 1, 8)
+            self.retry_at = now + min((self.c["SAMPLE_EVERY"] // 1000) << (self.misses - 1), self.c["HEARTBEAT"])
+            return
+        self.acked += 1
+        self.reported = True
+        self.sent_temp, self.sent_humd, _ = self.held[-1]
+        self.sent_at = now
+        self.misses = 0
+        self.held = []
+
+    def sleep_until_next(self):
+        awake = self.millis()
+        self.awake_ms += awake
+        ms = self.c["SAMPLE_EVERY"] - min(awake, self.c["SAMPLE_EVERY"] - 1000)
+        self.asleep_ms += ms
+        self.now_ms += ms
+
+    def estimate(self):
+        """printEstimate() in the sketch"""
+        total = max(self.asleep_ms + self.awake_ms, 1)
+        charge = self.asleep_ms * self.c["UA_ASLEEP"] + (self.awake_ms - self.radio_ms) * self.c["UA_AWAKE"] + \
+            self.radio_ms * self.c["UA_RADIO"]
+        ua = max(charge // total, 1)
+        return self.awake_ms * 100.0 / total, ua, self.c["BATTERY_MAH"] * 1000 // ua // 24
+
+
+def check(module, base):
+    """Match what the base took to what the module read, by time. The base only knows the
+    time to the second the report was sealed, and the report takes a while to get there."""
+    read_at = {now: (t, h) for now, t, h in module.truth}
+    window = module.c["SAMPLE_EVERY"] // 2000
+    taken = {}
+    for at, temp, humd in base.taken:
+        for now in range(at // 1000 - window, at // 1000 + 1):
+            if read_at.get(now) == (temp, humd):
+                taken[now] = taken.get(now, 0) + 1
+                break
+    twice = sum(1 for n in taken.values() if n > 1)
+    held = set(at for _, _, at in module.held)
+    lost = sum(1 for now in read_at if now not in taken and now not in module.pushed_out and now not in held)
+    dropped = sum(1 for now in module.pushed_out if now not in taken)
+    return twice, lost, dropped, len(held)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Room module battery and link simulator")
+    parser.add_argument("--days", type=float, default=7, help="simulated time")
+    parser.add_argument("--loss", type=float, default=0.05, help="chance a packet is lost, either way")
+    parser.add_argument("--dup", type=float, default=0.02, help="chance a packet arrives twice")
+    parser.add_argument("--outage", default="0:0", help="HOUR:HOURS the thermostat is unreachable")
+    parser.add_argument("--join-fail", type=float, default=0.01, help="chance joining the WiFi times out")
+    parser.add_argument("--dht-fail", type=float, default=0.01, help="chance a reading fails")
+    parser.add_argument("--seed", type=int, default=1)
+    args = parser.parse_args()
+
+    wire = Wire()
+    consts = dict(wire.consts)
+    consts.update(defines(read("Room_Module/Room_Module.ino")))
+    same_ms = defines(read("Room_Link.h"))["LINK_SAME_MS"]
+    rng = random.Random(args.seed)
+    outage = tuple(float(v) for v in args.outage.split(":"))
+    link = Link(rng, args.loss, args.dup, outage)
+    base = Base(wire, link, same_ms)
+    module = Module(wire, link, base, consts, rng, args.dht_fail, args.join_fail)
+
+    while module.now_ms < args.days * 86400000:
+        module.wake()
+    twice, lost, dropped, waiting = check(module, base)
+    awake, ua, days = module.estimate()
+
+    print("WireReport %d bytes, WireAck %d bytes, port %d" % (wire.report.size, wire.ack.size, consts["WIRE_PORT"]))
+    print("%.1f days, %d wakes, %d sends, %d acked" % (args.days, module.wakes, module.sends, module.acked))
+    print("link: %d packets, %d lost, %d repeated" % (link.sent, link.dropped, link.duplicated))
+    print("base: %d reports, %d repeats, %d bad, %d readings taken, %d already taken" %
+          (base.received, base.duplicates, base.rejected, len(base.taken), base.skipped))
+    print("check: %d readings, %d taken twice, %d lost, %d pushed out of a full batch unsent, %d still held" %
+          (len(module.truth), twice, lost, dropped, waiting))
+    print("%.2f%% awake, %d uA average (estimated), %d days on %d mAh" % (awake, ua, days, consts["BATTERY_MAH"]))
+    raise SystemExit(1 if twice or lost else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+"""
+Generates Web_Assets.h, the dashboard files served by the thermostat
+
+Each file in web/ is gzipped at maximum compression (with a zero timestamp so the
+output only changes when the file does) and stored in flash. The server sends the
+bytes as they are with Content-Encoding: gzip, so nothing is compressed on the
+ESP32. The ETag is a hash of the compressed bytes, so browsers revalidate with a
+304 until the firmware carries a different file. Only the standard library is
+needed:
+
+    python3 tools/web_assets.py web > Web_Assets.h
+"""
+import gzip
+import hashlib
+import os
+import sys
+
+TYPES = {
+    ".html": "text/html",
+    ".js": "application/javascript",
+    ".css": "text/css",
+    ".svg": "image/svg+xml",
+    ".ico": "image/x-icon",
+}
+
+
+def ident(name):
+    return "Web_" + "".join(c if c.isalnum() else "_" for c in name)
+
+
+def main():
+    web_dir = sys.argv[1] if len(sys.argv) > 1 else "web"
+    assets = []
+    for name in sorted(os.listdir(web_dir)):
+        ext = os.path.splitext(name)[1]
+        if ext not in TYPES:
+            continue
+        with open(os.path.join(web_dir, name), "rb") as f:
+            raw = f.read()
+        data = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = hashlib.sha1(data).hexdigest()[:16]
+        path = "/" if name == "index.html" else "/" + name
+        assets.append((name, path, TYPES[ext], etag, raw, data))
+
+    total = sum(len(a[5]) for a in assets)
+    print("// Generated by   : tools/web_assets.py")
+    print("// Generated from : web/%s" % ", web/".join(a[0] for a in assets))
+    print("// Format         : gzip, served with Content-Encoding: gzip")
+    print("// Memory usage   : %d bytes" % total)
+    print("")
+    print("#ifndef WEB_ASSETS_H")
+    print("#define WEB_ASSETS_H")
+    print("")
+    print("typedef struct {")
+    print("  const char *path;")
+    print("  const char *type;")
+    print("  const char *etag;   // Quoted, ready for the header")
+    print("  const uint8_t *data;")
+    print("  uint32_t len;")
+    print("} WebAsset;")
+    print("")
+    for name, path, type_, etag, raw, data in assets:
+        print("// web/%s, %d bytes, %d gzipped" % (name, len(raw), len(data)))
+        print("const uint8_t %s[%d] PROGMEM = {" % (ident(name), len(data)))
+        for i in range(0, len(data), 16):
+            print("  " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+        print("};")
+        print("")
+    print("#define WEB_ASSETS %d" % len(assets))
+    print("")
+    print("const WebAsset web_assets[WEB_ASSETS] = {")
+    for name, path, type_, etag, raw, data in assets:
+        print("  {\"%s\", \"%s\", \"\\\"%s\\\"\", %s, %d}," % (path, type_, etag, ident(name), len(data)))
+    print("};")
+    print("")
+    print("#endif")
+
+
+if __name__ == "__main__":
+    main()
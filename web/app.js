@@ -0,0 +1,83 @@
+// Mirrors the touchscreen. Live values come from /events, the schedule and history are
+// fetched once and the history is topped up from the stream.
+const $ = id => document.getElementById(id);
+const days = ['sun', 'mon', 'tue', 'wed', 'thu', 'fri', 'sat'];
+const modes = ['off', 'heat', 'cool', 'auto'];
+const holds = ['', 'until next slot', '', 'held'];
+let history = [];
+let editing = false;
+
+function fmt(t) {
+  return t === null ? '--.-' : t.toFixed(1);
+}
+
+function post(path, args) {
+  return fetch(path + '?' + new URLSearchParams(args), {method: 'POST'});
+}
+
+function showState(s) {
+  $('temp').textContent = fmt(s.temp);
+  $('humd').textContent = s.humd === null ? '--' : Math.round(s.humd);
+  $('goal').textContent = fmt(s.mode === 2 ? s.cool : s.heat);
+  $('hold').textContent = s.hold === 2 ? 'for ' + Math.floor(s.hold_left / 60) + ':' +
+    String(s.hold_left % 60).padStart(2, '0') : holds[s.hold];
+  $('equipment').textContent = (s.stage ? 'Running stage ' + s.stage : 'Idle') +
+    (s.setback ? ', set back' : '') + (s.humidifier ? ', humidifying' : '');
+  if (!editing) {
+    $('mode').value = modes[s.mode];
+    $('humidity').value = s.humd_goal;
+    $('hold_temp').value = s.hold_temp;
+  }
+}
+
+function drawGraph() {
+  const g = $('graph');
+  const n = history.length;
+  if (n < 2) return;
+  const temps = history.flatMap(h => [h[1], h[3]]).filter(t => t !== null);
+  const lo = Math.floor(Math.min(...temps)) - 1;
+  const hi = Math.ceil(Math.max(...temps)) + 1;
+  const x = i => i * 480 / (n - 1);
+  const y = t => 160 - (t - lo) * 160 / (hi - lo);
+  const line = k => history.map((h, i) => h[k] === null ? '' : x(i).toFixed(1) + ',' + y(h[k]).toFixed(1)).join(' ');
+  let bars = '';
+  history.forEach((h, i) => {
+    if (h[5]) bars += '<rect class="on" x="' + x(i).toFixed(1) + '" y="0" width="' + (480 / (n - 1)).toFixed(1) + '" height="160"/>';
+  });
+  g.innerHTML = bars + '<polyline class="heat" points="' + line(3) + '"/><polyline class="temp" points="' + line(1) + '"/>';
+}
+
+function showSchedule(week) {
+  $('week').innerHTML = days.map(d => '<tr><td>' + d + '</td><td>' + week[d].map(s =>
+    String(s.hour).padStart(2, '0') + ':' + String(s.minute).padStart(2, '0') + ' ' + s.heat.toFixed(1)
+  ).join(', ') + '</td></tr>').join('');
+}
+
+function connect() {
+  const es = new EventSource('/events');
+  es.addEventListener('state', e => showState(JSON.parse(e.data)));
+  es.addEventListener('history', e => {
+    history.push(JSON.parse(e.data));
+    if (history.length > 288) history.shift();
+    drawGraph();
+  });
+  es.onopen = () => { $('link').textContent = 'live'; $('link').className = 'up'; };
+  es.onerror = () => { $('link').textContent = 'offline'; $('link').className = 'down'; };
+}
+
+$('settings').addEventListener('focusin', () => editing = true);
+$('settings').addEventListener('focusout', () => editing = false);
+$('mode').addEventListener('change', e => post('/settings', {mode: e.target.value}));
+$('humidity').addEventListener('change', e => post('/settings', {humidity: e.target.value}));
+document.querySelectorAll('[data-hold]').forEach(b => b.addEventListener('click', () => {
+  const h = b.dataset.hold;
+  if (h === 'off') fetch('/hold', {method: 'DELETE'});
+  else if (h === 'on') post('/hold', {temp: $('hold_temp').value});
+  else if (h === 'next') post('/hold', {temp: $('hold_temp').value, until: 'next'});
+  else post('/hold', {temp: $('hold_temp').value, minutes: h});
+}));
+
+fetch('/schedule').then(r => r.json()).then(showSchedule);
+fetch('/history').then(r => r.json()).then(h => { history = h.samples; drawGraph(); });
+connect();
+setInterval(() => $('clock').textContent = new Date().toLocaleString(), 1000);